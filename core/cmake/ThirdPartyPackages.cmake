@@ -21,6 +21,7 @@ set(MILVUS_THIRDPARTY_DEPENDENCIES
         gperftools
         GRPC
         ZLIB
+        LZ4
         Opentracing
         fiu
         AWS
@@ -56,6 +57,8 @@ macro(build_dependency DEPENDENCY_NAME)
         build_grpc()
     elseif ("${DEPENDENCY_NAME}" STREQUAL "ZLIB")
         build_zlib()
+    elseif ("${DEPENDENCY_NAME}" STREQUAL "LZ4")
+        build_lz4()
     elseif ("${DEPENDENCY_NAME}" STREQUAL "Opentracing")
         build_opentracing()
     elseif ("${DEPENDENCY_NAME}" STREQUAL "fiu")
@@ -307,6 +310,12 @@ else ()
                         "https://gitee.com/quicksilver/zlib/repository/archive/${ZLIB_VERSION}.zip")
 endif ()
 
+if (DEFINED ENV{MILVUS_LZ4_URL})
+    set(LZ4_SOURCE_URL "$ENV{MILVUS_LZ4_URL}")
+else ()
+    set(LZ4_SOURCE_URL "https://github.com/lz4/lz4/archive/${LZ4_VERSION}.tar.gz")
+endif ()
+
 if (DEFINED ENV{MILVUS_OPENTRACING_URL})
     set(OPENTRACING_SOURCE_URL "$ENV{MILVUS_OPENTRACING_URL}")
 else ()
@@ -918,6 +927,52 @@ if (MILVUS_WITH_ZLIB)
     include_directories(SYSTEM ${ZLIB_INCLUDE_DIR})
 endif ()
 
+# ----------------------------------------------------------------------
+# lz4
+
+macro(build_lz4)
+    message(STATUS "Building LZ4-${LZ4_VERSION} from source")
+    set(LZ4_PREFIX "${CMAKE_CURRENT_BINARY_DIR}/lz4_ep-prefix/src/lz4_ep")
+    set(LZ4_STATIC_LIB_NAME liblz4.a)
+    set(LZ4_STATIC_LIB "${LZ4_PREFIX}/lib/${LZ4_STATIC_LIB_NAME}")
+    set(LZ4_INCLUDE_DIR "${LZ4_PREFIX}/include")
+    set(LZ4_CMAKE_ARGS ${EP_COMMON_CMAKE_ARGS} "-DCMAKE_INSTALL_PREFIX=${LZ4_PREFIX}"
+            -DCMAKE_INSTALL_LIBDIR=lib
+            -DBUILD_SHARED_LIBS=OFF
+            -DBUILD_STATIC_LIBS=ON
+            -DLZ4_BUILD_CLI=OFF
+            -DLZ4_BUILD_LEGACY_LZ4C=OFF)
+
+    externalproject_add(lz4_ep
+            URL
+            ${LZ4_SOURCE_URL}
+            ${EP_LOG_OPTIONS}
+            SOURCE_SUBDIR
+            build/cmake
+            BUILD_COMMAND
+            ${MAKE}
+            ${MAKE_BUILD_ARGS}
+            BUILD_BYPRODUCTS
+            "${LZ4_STATIC_LIB}"
+            CMAKE_ARGS
+            ${LZ4_CMAKE_ARGS})
+
+    file(MAKE_DIRECTORY "${LZ4_INCLUDE_DIR}")
+    add_library(lz4 STATIC IMPORTED)
+    set_target_properties(lz4
+            PROPERTIES IMPORTED_LOCATION "${LZ4_STATIC_LIB}"
+            INTERFACE_INCLUDE_DIRECTORIES "${LZ4_INCLUDE_DIR}")
+
+    add_dependencies(lz4 lz4_ep)
+endmacro()
+
+if (MILVUS_WITH_LZ4)
+    resolve_dependency(LZ4)
+
+    get_target_property(LZ4_INCLUDE_DIR lz4 INTERFACE_INCLUDE_DIRECTORIES)
+    include_directories(SYSTEM ${LZ4_INCLUDE_DIR})
+endif ()
+
 # ----------------------------------------------------------------------
 # opentracing
 
@@ -31,6 +31,10 @@ class AttrsIndexFormat {
     virtual void
     read(const storage::FSHandlerPtr& fd_ptr, segment::AttrsIndexPtr& attr_index) = 0;
 
+    // read the index of a single field, attr_index is nullptr if the field has no index
+    virtual void
+    read(const storage::FSHandlerPtr& fs_ptr, const std::string& field_name, segment::AttrIndexPtr& attr_index) = 0;
+
     virtual void
     write(const storage::FSHandlerPtr& fs_ptr, const segment::AttrsIndexPtr& attr_index) = 0;
 };
@@ -25,6 +25,7 @@
 #include "VectorCompressFormat.h"
 #include "VectorIndexFormat.h"
 #include "VectorsFormat.h"
+#include "ZoneMapsFormat.h"
 #include "utils/Exception.h"
 
 namespace milvus {
@@ -66,6 +67,11 @@ class Codec {
     GetVectorCompressFormat() {
         throw Exception(SERVER_UNSUPPORTED_ERROR, "vector compress not supported");
     }
+
+    virtual ZoneMapsFormatPtr
+    GetZoneMapsFormat() {
+        throw Exception(SERVER_UNSUPPORTED_ERROR, "zone maps not supported");
+    }
 };
 
 }  // namespace codec
@@ -33,6 +33,10 @@ class DeletedDocsFormat {
     virtual void
     write(const storage::FSHandlerPtr& fs_ptr, const segment::DeletedDocsPtr& deleted_docs) = 0;
 
+    // replace the whole list instead of appending to it
+    virtual void
+    rewrite(const storage::FSHandlerPtr& fs_ptr, const segment::DeletedDocsPtr& deleted_docs) = 0;
+
     virtual void
     readSize(const storage::FSHandlerPtr& fs_ptr, size_t& size) = 0;
 };
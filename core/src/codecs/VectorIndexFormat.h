@@ -26,7 +26,7 @@
 namespace milvus {
 namespace codec {
 
-enum ExternalData { ExternalData_None, ExternalData_RawData, ExternalData_SQ8 };
+enum ExternalData { ExternalData_None, ExternalData_RawData, ExternalData_SQ8, ExternalData_Sectors };
 
 class VectorIndexFormat {
  public:
@@ -35,6 +35,10 @@ class VectorsFormat {
     virtual void
     write(const storage::FSHandlerPtr& fs_ptr, const segment::VectorsPtr& vectors) = 0;
 
+    // replace the vectors and uids of a segment, each file is written aside and renamed over the old one
+    virtual void
+    rewrite(const storage::FSHandlerPtr& fs_ptr, const segment::VectorsPtr& vectors) = 0;
+
     virtual void
     read_uids(const storage::FSHandlerPtr& fs_ptr, std::vector<segment::doc_id_t>& uids) = 0;
 
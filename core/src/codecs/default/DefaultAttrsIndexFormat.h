@@ -34,6 +34,10 @@ class DefaultAttrsIndexFormat : public AttrsIndexFormat {
     void
     read(const storage::FSHandlerPtr& fs_ptr, segment::AttrsIndexPtr& attr_index) override;
 
+    void
+    read(const storage::FSHandlerPtr& fs_ptr, const std::string& field_name,
+         segment::AttrIndexPtr& attr_index) override;
+
     void
     write(const storage::FSHandlerPtr& fs_ptr, const segment::AttrsIndexPtr& attr_index) override;
 
@@ -52,7 +56,7 @@ class DefaultAttrsIndexFormat : public AttrsIndexFormat {
                   engine::meta::hybrid::DataType& attr_type);
 
     knowhere::IndexPtr
-    create_structured_index(const engine::meta::hybrid::DataType data_type);
+    create_structured_index(const engine::meta::hybrid::DataType data_type, bool bitmap);
 
  private:
     const std::string attr_index_extension_ = ".idx";
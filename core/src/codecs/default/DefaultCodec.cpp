@@ -26,6 +26,7 @@
 #include "DefaultVectorCompressFormat.h"
 #include "DefaultVectorIndexFormat.h"
 #include "DefaultVectorsFormat.h"
+#include "DefaultZoneMapsFormat.h"
 
 namespace milvus {
 namespace codec {
@@ -44,6 +45,7 @@ DefaultCodec::DefaultCodec() {
     deleted_docs_format_ptr_ = std::make_shared<DefaultDeletedDocsFormat>();
     id_bloom_filter_format_ptr_ = std::make_shared<DefaultIdBloomFilterFormat>();
     vector_compress_format_ptr_ = std::make_shared<DefaultVectorCompressFormat>();
+    zone_maps_format_ptr_ = std::make_shared<DefaultZoneMapsFormat>();
 }
 
 VectorsFormatPtr
@@ -81,5 +83,10 @@ DefaultCodec::GetVectorCompressFormat() {
     return vector_compress_format_ptr_;
 }
 
+ZoneMapsFormatPtr
+DefaultCodec::GetZoneMapsFormat() {
+    return zone_maps_format_ptr_;
+}
+
 }  // namespace codec
 }  // namespace milvus
@@ -48,6 +48,9 @@ class DefaultCodec : public Codec {
     VectorCompressFormatPtr
     GetVectorCompressFormat() override;
 
+    ZoneMapsFormatPtr
+    GetZoneMapsFormat() override;
+
  private:
     DefaultCodec();
 
@@ -59,6 +62,7 @@ class DefaultCodec : public Codec {
     DeletedDocsFormatPtr deleted_docs_format_ptr_;
     IdBloomFilterFormatPtr id_bloom_filter_format_ptr_;
     VectorCompressFormatPtr vector_compress_format_ptr_;
+    ZoneMapsFormatPtr zone_maps_format_ptr_;
 };
 
 }  // namespace codec
@@ -142,6 +142,42 @@ DefaultDeletedDocsFormat::write(const storage::FSHandlerPtr& fs_ptr, const segme
     boost::filesystem::rename(temp_path, del_file_path);
 }
 
+void
+DefaultDeletedDocsFormat::rewrite(const storage::FSHandlerPtr& fs_ptr, const segment::DeletedDocsPtr& deleted_docs) {
+    std::string dir_path = fs_ptr->operation_ptr_->GetDirectory();
+    const std::string del_file_path = dir_path + "/" + deleted_docs_filename_;
+
+    // Write a fresh temp file and move it over the delete file, searches keep reading the complete old list
+    const std::string temp_path = dir_path + "/" + "temp_del";
+    int del_fd = open(temp_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 00664);
+    if (del_fd == -1) {
+        std::string err_msg = "Failed to open file: " + temp_path + ", error: " + std::strerror(errno);
+        LOG_ENGINE_ERROR_ << err_msg;
+        throw Exception(SERVER_CANNOT_CREATE_FILE, err_msg);
+    }
+
+    auto& deleted_docs_list = deleted_docs->GetDeletedDocs();
+    size_t num_bytes = sizeof(segment::offset_t) * deleted_docs->GetSize();
+    if (::write(del_fd, &num_bytes, sizeof(size_t)) == -1) {
+        std::string err_msg = "Failed to write to file" + temp_path + ", error: " + std::strerror(errno);
+        LOG_ENGINE_ERROR_ << err_msg;
+        throw Exception(SERVER_WRITE_ERROR, err_msg);
+    }
+    if (::write(del_fd, deleted_docs_list.data(), num_bytes) == -1) {
+        std::string err_msg = "Failed to write to file" + temp_path + ", error: " + std::strerror(errno);
+        LOG_ENGINE_ERROR_ << err_msg;
+        throw Exception(SERVER_WRITE_ERROR, err_msg);
+    }
+
+    if (::close(del_fd) == -1) {
+        std::string err_msg = "Failed to close file: " + temp_path + ", error: " + std::strerror(errno);
+        LOG_ENGINE_ERROR_ << err_msg;
+        throw Exception(SERVER_WRITE_ERROR, err_msg);
+    }
+
+    boost::filesystem::rename(temp_path, del_file_path);
+}
+
 void
 DefaultDeletedDocsFormat::readSize(const storage::FSHandlerPtr& fs_ptr, size_t& size) {
     std::string dir_path = fs_ptr->operation_ptr_->GetDirectory();
@@ -34,6 +34,9 @@ class DefaultDeletedDocsFormat : public DeletedDocsFormat {
     void
     write(const storage::FSHandlerPtr& fs_ptr, const segment::DeletedDocsPtr& deleted_docs) override;
 
+    void
+    rewrite(const storage::FSHandlerPtr& fs_ptr, const segment::DeletedDocsPtr& deleted_docs) override;
+
     void
     readSize(const storage::FSHandlerPtr& fs_ptr, size_t& size) override;
 
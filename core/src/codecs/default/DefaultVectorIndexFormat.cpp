@@ -21,6 +21,8 @@
 #include "codecs/default/DefaultCodec.h"
 #include "codecs/default/DefaultVectorIndexFormat.h"
 #include "knowhere/common/BinarySet.h"
+#include "knowhere/common/Exception.h"
+#include "knowhere/index/vector_index/IndexDiskANN.h"
 #include "knowhere/index/vector_index/VecIndex.h"
 #include "knowhere/index/vector_index/VecIndexFactory.h"
 #include "segment/VectorIndex.h"
@@ -31,6 +33,39 @@
 namespace milvus {
 namespace codec {
 
+namespace {
+
+// serves the sectors of a disk index through the storage the segment is read from
+class StorageSectorReader : public knowhere::SectorReader {
+ public:
+    StorageSectorReader(const storage::IOReaderPtr& reader, const std::string& path)
+        : reader_(reader), path_(path), size_(reader->length()) {
+    }
+
+    ~StorageSectorReader() override {
+        reader_->close();
+    }
+
+    int64_t
+    Size() const override {
+        return size_;
+    }
+
+    void
+    Read(void* data, size_t length, int64_t offset) const override {
+        if (!reader_->read_at(data, length, offset)) {
+            throw knowhere::KnowhereException("failed to read sectors " + path_);
+        }
+    }
+
+ private:
+    storage::IOReaderPtr reader_;
+    std::string path_;
+    int64_t size_;
+};
+
+}  // namespace
+
 knowhere::VecIndexPtr
 DefaultVectorIndexFormat::read_internal(const storage::FSHandlerPtr& fs_ptr, const std::string& path,
                                         const std::string& extern_key, const knowhere::BinaryPtr& extern_data) {
@@ -140,6 +175,30 @@ DefaultVectorIndexFormat::read(const storage::FSHandlerPtr& fs_ptr, const std::s
             index = read_internal(fs_ptr, location, SQ8_DATA, sq8_data);
             break;
         }
+        case ExternalData_Sectors: {
+            // the sectors stay in their file and are read on demand, by a reader of their own since
+            // fs_ptr goes on to read other files of the segment
+            index = read_internal(fs_ptr, location);
+            auto diskann = std::dynamic_pointer_cast<knowhere::IndexDiskANN>(index);
+            if (diskann == nullptr) {
+                break;
+            }
+
+            std::string sector_path = location + sector_extension_;
+            auto sector_reader = fs_ptr->reader_ptr_->clone();
+            if (!sector_reader->open(sector_path)) {
+                LOG_ENGINE_ERROR_ << "Fail to open vector index sectors: " << sector_path;
+                index = nullptr;
+                break;
+            }
+            try {
+                diskann->SetSectorReader(std::make_shared<StorageSectorReader>(sector_reader, sector_path));
+            } catch (std::exception& e) {
+                LOG_ENGINE_ERROR_ << "Invalid vector index sectors: " << sector_path << ", " << e.what();
+                index = nullptr;
+            }
+            break;
+        }
     }
 
     vector_index->SetVectorIndex(index);
@@ -161,6 +220,17 @@ DefaultVectorIndexFormat::write(const storage::FSHandlerPtr& fs_ptr, const std::
         default_codec.GetVectorCompressFormat()->write(fs_ptr, location, sq8_data);
     }
 
+    auto sector_data = binaryset.Erase(SECTOR_DATA);
+    if (sector_data != nullptr) {
+        const std::string sector_path = location + sector_extension_;
+        if (!fs_ptr->writer_ptr_->open(sector_path)) {
+            LOG_ENGINE_ERROR_ << "Fail to open vector index sectors: " << sector_path;
+            return;
+        }
+        fs_ptr->writer_ptr_->write(sector_data->data.get(), sector_data->size);
+        fs_ptr->writer_ptr_->close();
+    }
+
     recorder.RecordSection("Start");
     if (!fs_ptr->writer_ptr_->open(location)) {
         LOG_ENGINE_ERROR_ << "Fail to open vector index: " << location;
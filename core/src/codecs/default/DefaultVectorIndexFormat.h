@@ -49,6 +49,8 @@ class DefaultVectorIndexFormat : public VectorIndexFormat {
     knowhere::VecIndexPtr
     read_internal(const storage::FSHandlerPtr& fs_ptr, const std::string& path, const std::string& extern_key = "",
                   const knowhere::BinaryPtr& extern_data = nullptr);
+
+    const std::string sector_extension_ = ".sectors";
 };
 
 }  // namespace codec
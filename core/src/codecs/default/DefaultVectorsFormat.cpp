@@ -23,6 +23,7 @@
 #include <memory>
 
 #include <boost/filesystem.hpp>
+#include <faiss/utils/half_precision.h>
 
 #include "utils/Exception.h"
 #include "utils/Log.h"
@@ -31,6 +32,23 @@
 namespace milvus {
 namespace codec {
 
+namespace {
+
+// decode half precision components to float, num_bytes is the size of the half precision data
+void
+DecodeHalfVectors(segment::VectorsDataType data_type, const uint8_t* half_data, size_t num_bytes, uint8_t* float_data) {
+    auto n = num_bytes / sizeof(uint16_t);
+    auto src = reinterpret_cast<const uint16_t*>(half_data);
+    auto dst = reinterpret_cast<float*>(float_data);
+    if (data_type == segment::VectorsDataType::FP16) {
+        faiss::fp16_to_fvec(src, dst, n);
+    } else {
+        faiss::bf16_to_fvec(src, dst, n);
+    }
+}
+
+}  // namespace
+
 void
 DefaultVectorsFormat::read_vectors_internal(const storage::FSHandlerPtr& fs_ptr, const std::string& file_path,
                                             off_t offset, size_t num, std::vector<uint8_t>& raw_vectors) {
@@ -78,6 +96,35 @@ DefaultVectorsFormat::read_vectors_internal(const storage::FSHandlerPtr& fs_ptr,
     fs_ptr->reader_ptr_->close();
 }
 
+void
+DefaultVectorsFormat::read_half_vectors_internal(const storage::FSHandlerPtr& fs_ptr, const std::string& file_path,
+                                                 off_t offset, size_t num, segment::VectorsDataType& data_type,
+                                                 std::vector<uint8_t>& raw_vectors) {
+    if (!fs_ptr->reader_ptr_->open(file_path.c_str())) {
+        std::string err_msg = "Failed to open file: " + file_path + ", error: " + std::strerror(errno);
+        LOG_ENGINE_ERROR_ << err_msg;
+        throw Exception(SERVER_CANNOT_OPEN_FILE, err_msg);
+    }
+
+    // Beginning of file is data type and num_bytes
+    int32_t type;
+    fs_ptr->reader_ptr_->read(&type, sizeof(int32_t));
+    data_type = static_cast<segment::VectorsDataType>(type);
+
+    size_t num_bytes;
+    fs_ptr->reader_ptr_->read(&num_bytes, sizeof(size_t));
+
+    offset = std::min<off_t>(offset, num_bytes);
+    num = std::min(num, num_bytes - offset);
+
+    fs_ptr->reader_ptr_->seekg(sizeof(int32_t) + sizeof(size_t) + offset);
+
+    raw_vectors.resize(num);
+    fs_ptr->reader_ptr_->read(raw_vectors.data(), num);
+
+    fs_ptr->reader_ptr_->close();
+}
+
 void
 DefaultVectorsFormat::read_uids_internal(const storage::FSHandlerPtr& fs_ptr, const std::string& file_path,
                                          std::vector<segment::doc_id_t>& uids) {
@@ -116,6 +163,13 @@ DefaultVectorsFormat::read(const storage::FSHandlerPtr& fs_ptr, segment::Vectors
             auto& vector_list = vectors_read->GetMutableData();
             read_vectors_internal(fs_ptr, path.string(), 0, INT64_MAX, vector_list);
             vectors_read->SetName(path.stem().string());
+        } else if (path.extension().string() == half_raw_vector_extension_) {
+            // keep half precision vectors as they are, the segment is merged or searched in this format
+            auto& vector_list = vectors_read->GetMutableData();
+            segment::VectorsDataType data_type;
+            read_half_vectors_internal(fs_ptr, path.string(), 0, INT64_MAX, data_type, vector_list);
+            vectors_read->SetDataType(data_type);
+            vectors_read->SetName(path.stem().string());
         } else if (path.extension().string() == user_id_extension_) {
             auto& uids = vectors_read->GetMutableUids();
             read_uids_internal(fs_ptr, path.string(), uids);
@@ -127,9 +181,37 @@ void
 DefaultVectorsFormat::write(const storage::FSHandlerPtr& fs_ptr, const segment::VectorsPtr& vectors) {
     std::string dir_path = fs_ptr->operation_ptr_->GetDirectory();
 
-    const std::string rv_file_path = dir_path + "/" + vectors->GetName() + raw_vector_extension_;
+    bool is_half = (vectors->GetDataType() != segment::VectorsDataType::FLOAT);
+    const std::string rv_file_path =
+        dir_path + "/" + vectors->GetName() + (is_half ? half_raw_vector_extension_ : raw_vector_extension_);
     const std::string uid_file_path = dir_path + "/" + vectors->GetName() + user_id_extension_;
 
+    write_internal(fs_ptr, vectors, rv_file_path, uid_file_path);
+}
+
+void
+DefaultVectorsFormat::rewrite(const storage::FSHandlerPtr& fs_ptr, const segment::VectorsPtr& vectors) {
+    std::string dir_path = fs_ptr->operation_ptr_->GetDirectory();
+
+    bool is_half = (vectors->GetDataType() != segment::VectorsDataType::FLOAT);
+    const std::string rv_file_path =
+        dir_path + "/" + vectors->GetName() + (is_half ? half_raw_vector_extension_ : raw_vector_extension_);
+    const std::string uid_file_path = dir_path + "/" + vectors->GetName() + user_id_extension_;
+
+    // Write both files under temp names and move them over the old ones, read() skips the temp extension
+    const std::string rv_temp_path = rv_file_path + temp_extension_;
+    const std::string uid_temp_path = uid_file_path + temp_extension_;
+    write_internal(fs_ptr, vectors, rv_temp_path, uid_temp_path);
+
+    boost::filesystem::rename(rv_temp_path, rv_file_path);
+    boost::filesystem::rename(uid_temp_path, uid_file_path);
+}
+
+void
+DefaultVectorsFormat::write_internal(const storage::FSHandlerPtr& fs_ptr, const segment::VectorsPtr& vectors,
+                                     const std::string& rv_file_path, const std::string& uid_file_path) {
+    bool is_half = (vectors->GetDataType() != segment::VectorsDataType::FLOAT);
+
     TimeRecorder rc("write vectors");
 
     if (!fs_ptr->writer_ptr_->open(rv_file_path.c_str())) {
@@ -138,6 +220,10 @@ DefaultVectorsFormat::write(const storage::FSHandlerPtr& fs_ptr, const segment::
         throw Exception(SERVER_CANNOT_CREATE_FILE, err_msg);
     }
 
+    if (is_half) {
+        auto data_type = static_cast<int32_t>(vectors->GetDataType());
+        fs_ptr->writer_ptr_->write(&data_type, sizeof(int32_t));
+    }
     size_t rv_num_bytes = vectors->GetData().size() * sizeof(uint8_t);
     fs_ptr->writer_ptr_->write(&rv_num_bytes, sizeof(size_t));
     fs_ptr->writer_ptr_->write((void*)vectors->GetData().data(), rv_num_bytes);
@@ -200,6 +286,18 @@ DefaultVectorsFormat::read_vectors(const storage::FSHandlerPtr& fs_ptr, knowhere
         if (path.extension().string() == raw_vector_extension_) {
             read_vectors_internal(fs_ptr, path.string(), raw_vectors);
             break;
+        } else if (path.extension().string() == half_raw_vector_extension_) {
+            // index building works on float vectors
+            segment::VectorsDataType data_type;
+            std::vector<uint8_t> half_vectors;
+            read_half_vectors_internal(fs_ptr, path.string(), 0, INT64_MAX, data_type, half_vectors);
+
+            size_t num_bytes = half_vectors.size() / sizeof(uint16_t) * sizeof(float);
+            raw_vectors = std::make_shared<knowhere::Binary>();
+            raw_vectors->size = num_bytes;
+            raw_vectors->data = std::shared_ptr<uint8_t[]>(new uint8_t[num_bytes]);
+            DecodeHalfVectors(data_type, half_vectors.data(), half_vectors.size(), raw_vectors->data.get());
+            break;
         }
     }
 }
@@ -224,6 +322,17 @@ DefaultVectorsFormat::read_vectors(const storage::FSHandlerPtr& fs_ptr, off_t of
         if (path.extension().string() == raw_vector_extension_) {
             read_vectors_internal(fs_ptr, path.string(), offset, num_bytes, raw_vectors);
             break;
+        } else if (path.extension().string() == half_raw_vector_extension_) {
+            // offset and num_bytes address float vectors, translate them to the half precision layout
+            const size_t ratio = sizeof(float) / sizeof(uint16_t);
+            segment::VectorsDataType data_type;
+            std::vector<uint8_t> half_vectors;
+            read_half_vectors_internal(fs_ptr, path.string(), offset / ratio, num_bytes / ratio, data_type,
+                                       half_vectors);
+
+            raw_vectors.resize(half_vectors.size() * ratio);
+            DecodeHalfVectors(data_type, half_vectors.data(), half_vectors.size(), raw_vectors.data());
+            break;
         }
     }
 }
@@ -36,6 +36,9 @@ class DefaultVectorsFormat : public VectorsFormat {
     void
     write(const storage::FSHandlerPtr& fs_ptr, const segment::VectorsPtr& vectors) override;
 
+    void
+    rewrite(const storage::FSHandlerPtr& fs_ptr, const segment::VectorsPtr& vectors) override;
+
     void
     read_uids(const storage::FSHandlerPtr& fs_ptr, std::vector<segment::doc_id_t>& uids) override;
 
@@ -56,6 +59,10 @@ class DefaultVectorsFormat : public VectorsFormat {
     operator=(DefaultVectorsFormat&&) = delete;
 
  private:
+    void
+    write_internal(const storage::FSHandlerPtr& fs_ptr, const segment::VectorsPtr& vectors,
+                   const std::string& rv_file_path, const std::string& uid_file_path);
+
     void
     read_vectors_internal(const storage::FSHandlerPtr& fs_ptr, const std::string& file_path, off_t offset, size_t num,
                           std::vector<uint8_t>& raw_vectors);
@@ -64,13 +71,19 @@ class DefaultVectorsFormat : public VectorsFormat {
     read_vectors_internal(const storage::FSHandlerPtr& fs_ptr, const std::string& file_path,
                           knowhere::BinaryPtr& raw_vectors);
 
+    void
+    read_half_vectors_internal(const storage::FSHandlerPtr& fs_ptr, const std::string& file_path, off_t offset,
+                               size_t num, segment::VectorsDataType& data_type, std::vector<uint8_t>& raw_vectors);
+
     void
     read_uids_internal(const storage::FSHandlerPtr& fs_ptr, const std::string& file_path,
                        std::vector<segment::doc_id_t>& uids);
 
  private:
     const std::string raw_vector_extension_ = ".rv";
+    const std::string half_raw_vector_extension_ = ".rvh";
     const std::string user_id_extension_ = ".uid";
+    const std::string temp_extension_ = ".tmp";
 };
 
 }  // namespace codec
@@ -0,0 +1,90 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "codecs/default/DefaultZoneMapsFormat.h"
+
+#include <boost/filesystem.hpp>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "utils/Exception.h"
+#include "utils/Log.h"
+
+namespace milvus {
+namespace codec {
+
+void
+DefaultZoneMapsFormat::read(const storage::FSHandlerPtr& fs_ptr, segment::ZoneMapsPtr& zone_maps) {
+    std::string dir_path = fs_ptr->operation_ptr_->GetDirectory();
+    const std::string zone_maps_file_path = dir_path + "/" + zone_maps_filename_;
+
+    zone_maps = nullptr;
+    if (!boost::filesystem::exists(zone_maps_file_path)) {
+        return;
+    }
+
+    if (!fs_ptr->reader_ptr_->open(zone_maps_file_path)) {
+        std::string err_msg = "Failed to open file: " + zone_maps_file_path + ", error: " + std::strerror(errno);
+        LOG_ENGINE_ERROR_ << err_msg;
+        throw Exception(SERVER_CANNOT_OPEN_FILE, err_msg);
+    }
+
+    auto result = std::make_shared<segment::ZoneMaps>();
+    size_t field_count = 0;
+    fs_ptr->reader_ptr_->read(&field_count, sizeof(field_count));
+    for (size_t i = 0; i < field_count; ++i) {
+        size_t name_length = 0;
+        fs_ptr->reader_ptr_->read(&name_length, sizeof(name_length));
+        std::string field_name(name_length, '\0');
+        fs_ptr->reader_ptr_->read(&field_name[0], name_length);
+
+        segment::ZoneMap zone_map;
+        fs_ptr->reader_ptr_->read(&zone_map, sizeof(zone_map));
+        result->Set(field_name, zone_map);
+    }
+    fs_ptr->reader_ptr_->close();
+
+    zone_maps = result;
+}
+
+void
+DefaultZoneMapsFormat::write(const storage::FSHandlerPtr& fs_ptr, const segment::ZoneMapsPtr& zone_maps) {
+    std::string dir_path = fs_ptr->operation_ptr_->GetDirectory();
+    const std::string zone_maps_file_path = dir_path + "/" + zone_maps_filename_;
+
+    if (!fs_ptr->writer_ptr_->open(zone_maps_file_path)) {
+        std::string err_msg = "Failed to open file: " + zone_maps_file_path + ", error: " + std::strerror(errno);
+        LOG_ENGINE_ERROR_ << err_msg;
+        throw Exception(SERVER_CANNOT_CREATE_FILE, err_msg);
+    }
+
+    auto& maps = zone_maps->GetZoneMaps();
+    size_t field_count = maps.size();
+    fs_ptr->writer_ptr_->write(&field_count, sizeof(field_count));
+    for (auto& pair : maps) {
+        size_t name_length = pair.first.size();
+        fs_ptr->writer_ptr_->write(&name_length, sizeof(name_length));
+        fs_ptr->writer_ptr_->write((void*)pair.first.data(), name_length);
+        fs_ptr->writer_ptr_->write((void*)&pair.second, sizeof(pair.second));
+    }
+    fs_ptr->writer_ptr_->close();
+}
+
+}  // namespace codec
+}  // namespace milvus
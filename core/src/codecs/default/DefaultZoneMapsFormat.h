@@ -0,0 +1,52 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <string>
+
+#include "codecs/ZoneMapsFormat.h"
+
+namespace milvus {
+namespace codec {
+
+class DefaultZoneMapsFormat : public ZoneMapsFormat {
+ public:
+    DefaultZoneMapsFormat() = default;
+
+    // zone_maps stays nullptr for segments written without zone maps
+    void
+    read(const storage::FSHandlerPtr& fs_ptr, segment::ZoneMapsPtr& zone_maps) override;
+
+    void
+    write(const storage::FSHandlerPtr& fs_ptr, const segment::ZoneMapsPtr& zone_maps) override;
+
+    // No copy and move
+    DefaultZoneMapsFormat(const DefaultZoneMapsFormat&) = delete;
+    DefaultZoneMapsFormat(DefaultZoneMapsFormat&&) = delete;
+
+    DefaultZoneMapsFormat&
+    operator=(const DefaultZoneMapsFormat&) = delete;
+    DefaultZoneMapsFormat&
+    operator=(DefaultZoneMapsFormat&&) = delete;
+
+ private:
+    const std::string zone_maps_filename_ = "zone_maps";
+};
+
+}  // namespace codec
+}  // namespace milvus
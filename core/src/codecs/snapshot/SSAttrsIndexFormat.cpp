@@ -25,6 +25,7 @@
 #include <utility>
 
 #include "db/meta/MetaTypes.h"
+#include "knowhere/index/structured_index/StructuredIndexBitmap.h"
 #include "knowhere/index/structured_index/StructuredIndexSort.h"
 
 #include "utils/Exception.h"
@@ -35,31 +36,55 @@ namespace milvus {
 namespace codec {
 
 knowhere::IndexPtr
-SSAttrsIndexFormat::create_structured_index(const milvus::engine::meta::hybrid::DataType data_type) {
+SSAttrsIndexFormat::create_structured_index(const milvus::engine::meta::hybrid::DataType data_type, bool bitmap) {
     knowhere::IndexPtr index = nullptr;
     switch (data_type) {
         case engine::meta::hybrid::DataType::INT8: {
-            index = std::make_shared<knowhere::StructuredIndexSort<int8_t>>();
+            if (bitmap) {
+                index = std::make_shared<knowhere::StructuredIndexBitmap<int8_t>>();
+            } else {
+                index = std::make_shared<knowhere::StructuredIndexSort<int8_t>>();
+            }
             break;
         }
         case engine::meta::hybrid::DataType::INT16: {
-            index = std::make_shared<knowhere::StructuredIndexSort<int16_t>>();
+            if (bitmap) {
+                index = std::make_shared<knowhere::StructuredIndexBitmap<int16_t>>();
+            } else {
+                index = std::make_shared<knowhere::StructuredIndexSort<int16_t>>();
+            }
             break;
         }
         case engine::meta::hybrid::DataType::INT32: {
-            index = std::make_shared<knowhere::StructuredIndexSort<int32_t>>();
+            if (bitmap) {
+                index = std::make_shared<knowhere::StructuredIndexBitmap<int32_t>>();
+            } else {
+                index = std::make_shared<knowhere::StructuredIndexSort<int32_t>>();
+            }
             break;
         }
         case engine::meta::hybrid::DataType::INT64: {
-            index = std::make_shared<knowhere::StructuredIndexSort<int64_t>>();
+            if (bitmap) {
+                index = std::make_shared<knowhere::StructuredIndexBitmap<int64_t>>();
+            } else {
+                index = std::make_shared<knowhere::StructuredIndexSort<int64_t>>();
+            }
             break;
         }
         case engine::meta::hybrid::DataType::FLOAT: {
-            index = std::make_shared<knowhere::StructuredIndexSort<float>>();
+            if (bitmap) {
+                index = std::make_shared<knowhere::StructuredIndexBitmap<float>>();
+            } else {
+                index = std::make_shared<knowhere::StructuredIndexSort<float>>();
+            }
             break;
         }
         case engine::meta::hybrid::DataType::DOUBLE: {
-            index = std::make_shared<knowhere::StructuredIndexSort<double>>();
+            if (bitmap) {
+                index = std::make_shared<knowhere::StructuredIndexBitmap<double>>();
+            } else {
+                index = std::make_shared<knowhere::StructuredIndexSort<double>>();
+            }
             break;
         }
         default: {
@@ -129,7 +154,9 @@ SSAttrsIndexFormat::read_internal(const milvus::storage::FSHandlerPtr& fs_ptr, c
     double rate = length * 1000000.0 / span / 1024 / 1024;
     LOG_ENGINE_DEBUG_ << "read_index(" << path << ") rate " << rate << "MB/s";
 
-    index = create_structured_index((engine::meta::hybrid::DataType)data_type);
+    // bitmap and sorted indexes share the file layout, tell them apart by the binary names
+    bool bitmap = load_data_list.binary_map_.find("bitmap_values") != load_data_list.binary_map_.end();
+    index = create_structured_index((engine::meta::hybrid::DataType)data_type, bitmap);
 
     index->Load(load_data_list);
 
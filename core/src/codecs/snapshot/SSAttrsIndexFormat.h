@@ -53,7 +53,7 @@ class SSAttrsIndexFormat {
                   engine::meta::hybrid::DataType& attr_type);
 
     knowhere::IndexPtr
-    create_structured_index(const engine::meta::hybrid::DataType data_type);
+    create_structured_index(const engine::meta::hybrid::DataType data_type, bool bitmap);
 
  private:
     const std::string attr_index_extension_ = ".idx";
@@ -120,7 +120,9 @@ SSVectorIndexFormat::read(const storage::FSHandlerPtr& fs_ptr, const std::string
 
     knowhere::VecIndexPtr index = nullptr;
     switch (externalData) {
-        case ExternalData_None: {
+        case ExternalData_None:
+        case ExternalData_Sectors: {
+            // sectors are written inline here and served from memory
             index = read_internal(fs_ptr, location);
             break;
         }
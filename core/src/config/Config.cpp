@@ -95,6 +95,8 @@ const char* CONFIG_CACHE_CACHE_INSERT_DATA = "cache_insert_data";
 const char* CONFIG_CACHE_CACHE_INSERT_DATA_DEFAULT = "false";
 const char* CONFIG_CACHE_PRELOAD_COLLECTION = "preload_collection";
 const char* CONFIG_CACHE_PRELOAD_COLLECTION_DEFAULT = "";
+const char* CONFIG_CACHE_RESULT_CACHE_SIZE = "result_cache_size";
+const char* CONFIG_CACHE_RESULT_CACHE_SIZE_DEFAULT = "0"; /* disabled */
 
 /* metric config */
 const char* CONFIG_METRIC = "metric";
@@ -115,6 +117,8 @@ const char* CONFIG_ENGINE_SIMD_TYPE = "simd_type";
 const char* CONFIG_ENGINE_SIMD_TYPE_DEFAULT = "auto";
 const char* CONFIG_ENGINE_SEARCH_COMBINE_MAX_NQ = "search_combine_nq";
 const char* CONFIG_ENGINE_SEARCH_COMBINE_MAX_NQ_DEFAULT = "64";
+const char* CONFIG_ENGINE_INCREMENTAL_HNSW = "incremental_hnsw";
+const char* CONFIG_ENGINE_INCREMENTAL_HNSW_DEFAULT = "false";
 
 /* gpu resource config */
 const char* CONFIG_GPU_RESOURCE = "gpu";
@@ -146,6 +150,8 @@ const char* CONFIG_WAL_ENABLE = "enable";
 const char* CONFIG_WAL_ENABLE_DEFAULT = "true";
 const char* CONFIG_WAL_RECOVERY_ERROR_IGNORE = "recovery_error_ignore";
 const char* CONFIG_WAL_RECOVERY_ERROR_IGNORE_DEFAULT = "true";
+const char* CONFIG_WAL_COMPRESSION_ENABLE = "compression_enable";
+const char* CONFIG_WAL_COMPRESSION_ENABLE_DEFAULT = "false";
 const char* CONFIG_WAL_BUFFER_SIZE = "buffer_size";
 const char* CONFIG_WAL_BUFFER_SIZE_DEFAULT = "268435456"; /* 256 MB */
 const int64_t CONFIG_WAL_BUFFER_SIZE_MIN = 67108864;      /* 64 MB */
@@ -339,6 +345,9 @@ Config::ValidateConfig() {
     std::string cache_preload_collection;
     STATUS_CHECK(GetCacheConfigPreloadCollection(cache_preload_collection));
 
+    int64_t cache_result_cache_size;
+    STATUS_CHECK(GetCacheConfigResultCacheSize(cache_result_cache_size));
+
     /* engine config */
     int64_t engine_use_blas_threshold;
     STATUS_CHECK(GetEngineConfigUseBlasThreshold(engine_use_blas_threshold));
@@ -349,6 +358,9 @@ Config::ValidateConfig() {
     std::string engine_simd_type;
     STATUS_CHECK(GetEngineConfigSimdType(engine_simd_type));
 
+    bool engine_incremental_hnsw;
+    STATUS_CHECK(GetEngineConfigIncrementalHnsw(engine_incremental_hnsw));
+
     /* gpu resource config */
 #ifdef MILVUS_GPU_VERSION
     bool gpu_resource_enable;
@@ -384,6 +396,9 @@ Config::ValidateConfig() {
     bool recovery_error_ignore;
     STATUS_CHECK(GetWalConfigRecoveryErrorIgnore(recovery_error_ignore));
 
+    bool compression_enable;
+    STATUS_CHECK(GetWalConfigCompressionEnable(compression_enable));
+
     int64_t buffer_size;
     STATUS_CHECK(GetWalConfigBufferSize(buffer_size));
 
@@ -451,12 +466,14 @@ Config::ResetDefaultConfig() {
     STATUS_CHECK(SetCacheConfigInsertBufferSize(CONFIG_CACHE_INSERT_BUFFER_SIZE_DEFAULT));
     STATUS_CHECK(SetCacheConfigCacheInsertData(CONFIG_CACHE_CACHE_INSERT_DATA_DEFAULT));
     STATUS_CHECK(SetCacheConfigPreloadCollection(CONFIG_CACHE_PRELOAD_COLLECTION_DEFAULT));
+    STATUS_CHECK(SetCacheConfigResultCacheSize(CONFIG_CACHE_RESULT_CACHE_SIZE_DEFAULT));
 
     /* engine config */
     STATUS_CHECK(SetEngineConfigUseBlasThreshold(CONFIG_ENGINE_USE_BLAS_THRESHOLD_DEFAULT));
     STATUS_CHECK(SetEngineConfigOmpThreadNum(CONFIG_ENGINE_OMP_THREAD_NUM_DEFAULT));
     STATUS_CHECK(SetEngineConfigSimdType(CONFIG_ENGINE_SIMD_TYPE_DEFAULT));
     STATUS_CHECK(SetEngineSearchCombineMaxNq(CONFIG_ENGINE_SEARCH_COMBINE_MAX_NQ_DEFAULT));
+    STATUS_CHECK(SetEngineConfigIncrementalHnsw(CONFIG_ENGINE_INCREMENTAL_HNSW_DEFAULT));
 
     /* gpu resource config */
 #ifdef MILVUS_GPU_VERSION
@@ -471,6 +488,7 @@ Config::ResetDefaultConfig() {
     /* wal config */
     STATUS_CHECK(SetWalConfigEnable(CONFIG_WAL_ENABLE_DEFAULT));
     STATUS_CHECK(SetWalConfigRecoveryErrorIgnore(CONFIG_WAL_RECOVERY_ERROR_IGNORE_DEFAULT));
+    STATUS_CHECK(SetWalConfigCompressionEnable(CONFIG_WAL_COMPRESSION_ENABLE_DEFAULT));
     STATUS_CHECK(SetWalConfigBufferSize(CONFIG_WAL_BUFFER_SIZE_DEFAULT));
     STATUS_CHECK(SetWalConfigWalPath(CONFIG_WAL_WAL_PATH_DEFAULT));
 
@@ -574,6 +592,8 @@ Config::SetConfigCli(const std::string& parent_key, const std::string& child_key
             status = SetCacheConfigInsertBufferSize(value);
         } else if (child_key == CONFIG_CACHE_PRELOAD_COLLECTION) {
             status = SetCacheConfigPreloadCollection(value);
+        } else if (child_key == CONFIG_CACHE_RESULT_CACHE_SIZE) {
+            status = SetCacheConfigResultCacheSize(value);
         } else {
             status = Status(SERVER_UNEXPECTED_ERROR, invalid_node_str);
         }
@@ -586,6 +606,8 @@ Config::SetConfigCli(const std::string& parent_key, const std::string& child_key
             status = SetEngineConfigSimdType(value);
         } else if (child_key == CONFIG_ENGINE_SEARCH_COMBINE_MAX_NQ) {
             status = SetEngineSearchCombineMaxNq(value);
+        } else if (child_key == CONFIG_ENGINE_INCREMENTAL_HNSW) {
+            status = SetEngineConfigIncrementalHnsw(value);
         } else {
             status = Status(SERVER_UNEXPECTED_ERROR, invalid_node_str);
         }
@@ -618,6 +640,8 @@ Config::SetConfigCli(const std::string& parent_key, const std::string& child_key
             status = SetWalConfigEnable(value);
         } else if (child_key == CONFIG_WAL_RECOVERY_ERROR_IGNORE) {
             status = SetWalConfigRecoveryErrorIgnore(value);
+        } else if (child_key == CONFIG_WAL_COMPRESSION_ENABLE) {
+            status = SetWalConfigCompressionEnable(value);
         } else if (child_key == CONFIG_WAL_BUFFER_SIZE) {
             status = SetWalConfigBufferSize(value);
         } else if (child_key == CONFIG_WAL_WAL_PATH) {
@@ -757,7 +781,8 @@ Config::UpdateFileConfigFromMem(const std::string& parent_key, const std::string
     if (child_key == CONFIG_CACHE_CACHE_INSERT_DATA ||
         // child_key == CONFIG_STORAGE_S3_ENABLE ||
         child_key == CONFIG_METRIC_ENABLE_MONITOR || child_key == CONFIG_GPU_RESOURCE_ENABLE ||
-        child_key == CONFIG_WAL_ENABLE || child_key == CONFIG_WAL_RECOVERY_ERROR_IGNORE) {
+        child_key == CONFIG_WAL_ENABLE || child_key == CONFIG_WAL_RECOVERY_ERROR_IGNORE ||
+        child_key == CONFIG_WAL_COMPRESSION_ENABLE) {
         bool ok = false;
         STATUS_CHECK(StringHelpFunctions::ConvertToBoolean(value, ok));
         value_str = ok ? "true" : "false";
@@ -1307,6 +1332,34 @@ Config::CheckCacheConfigPreloadCollection(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckCacheConfigResultCacheSize(const std::string& value) {
+    fiu_return_on("check_config_result_cache_size_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    std::string err;
+    int64_t cache_size = parse_bytes(value, err);
+    if (not err.empty()) {
+        return Status(SERVER_INVALID_ARGUMENT, err);
+    } else {
+        if (cache_size < 0) {
+            std::string msg = "Invalid result cache size: " + value +
+                              ". Possible reason: cache.result_cache_size is negative.";
+            return Status(SERVER_INVALID_ARGUMENT, msg);
+        }
+
+        int64_t total_mem = 0, free_mem = 0;
+        GetSystemMemInfo(total_mem, free_mem);
+        if (cache_size >= total_mem) {
+            std::stringstream ss;
+            ss << "Invalid result cache size: " << value << ". ";
+            ss << "Possible reason: cache.result_cache_size exceeds system memory (" << (total_mem >> 30)
+               << "GB).";
+            return Status(SERVER_INVALID_ARGUMENT, ss.str());
+        }
+    }
+    return Status::OK();
+}
+
 /* engine config */
 Status
 Config::CheckEngineConfigUseBlasThreshold(const std::string& value) {
@@ -1364,6 +1417,18 @@ Config::CheckEngineSearchCombineMaxNq(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckEngineConfigIncrementalHnsw(const std::string& value) {
+    fiu_return_on("check_config_incremental_hnsw_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (!ValidateStringIsBool(value).ok()) {
+        std::string msg = "Invalid incremental hnsw option: " + value +
+                          ". Possible reason: engine_config.incremental_hnsw is not a boolean.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
 /* gpu resource config */
 #ifdef MILVUS_GPU_VERSION
 Status
@@ -1559,6 +1624,19 @@ Config::CheckWalConfigRecoveryErrorIgnore(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckWalConfigCompressionEnable(const std::string& value) {
+    auto exist_error = !ValidateStringIsBool(value).ok();
+    fiu_do_on("check_config_wal_compression_enable_fail", exist_error = true);
+
+    if (exist_error) {
+        std::string msg =
+            "Invalid wal config: " + value + ". Possible reason: wal.compression_enable is not a boolean.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
 Status
 Config::CheckWalConfigBufferSize(const std::string& value) {
     std::string err;
@@ -1963,6 +2041,16 @@ Config::GetCacheConfigPreloadCollection(std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::GetCacheConfigResultCacheSize(int64_t& value) {
+    std::string str = GetConfigStr(CONFIG_CACHE, CONFIG_CACHE_RESULT_CACHE_SIZE,
+                                   CONFIG_CACHE_RESULT_CACHE_SIZE_DEFAULT);
+    STATUS_CHECK(CheckCacheConfigResultCacheSize(str));
+    std::string err;
+    value = parse_bytes(str, err);
+    return Status::OK();
+}
+
 /* engine config */
 Status
 Config::GetEngineConfigUseBlasThreshold(int64_t& value) {
@@ -1996,6 +2084,16 @@ Config::GetEngineSearchCombineMaxNq(int64_t& value) {
     return Status::OK();
 }
 
+Status
+Config::GetEngineConfigIncrementalHnsw(bool& value) {
+    std::string str =
+        GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_INCREMENTAL_HNSW, CONFIG_ENGINE_INCREMENTAL_HNSW_DEFAULT);
+    STATUS_CHECK(CheckEngineConfigIncrementalHnsw(str));
+    std::transform(str.begin(), str.end(), str.begin(), ::tolower);
+    value = (str == "true" || str == "on" || str == "yes" || str == "1");
+    return Status::OK();
+}
+
 /* gpu resource config */
 #ifdef MILVUS_GPU_VERSION
 Status
@@ -2127,6 +2225,14 @@ Config::GetWalConfigRecoveryErrorIgnore(bool& recovery_error_ignore) {
     return Status::OK();
 }
 
+Status
+Config::GetWalConfigCompressionEnable(bool& compression_enable) {
+    std::string str = GetConfigStr(CONFIG_WAL, CONFIG_WAL_COMPRESSION_ENABLE, CONFIG_WAL_COMPRESSION_ENABLE_DEFAULT);
+    STATUS_CHECK(CheckWalConfigCompressionEnable(str));
+    STATUS_CHECK(StringHelpFunctions::ConvertToBoolean(str, compression_enable));
+    return Status::OK();
+}
+
 Status
 Config::GetWalConfigBufferSize(int64_t& buffer_size) {
     std::string str = GetConfigStr(CONFIG_WAL, CONFIG_WAL_BUFFER_SIZE, CONFIG_WAL_BUFFER_SIZE_DEFAULT);
@@ -2370,6 +2476,12 @@ Config::SetCacheConfigPreloadCollection(const std::string& value) {
     return SetConfigValueInMem(CONFIG_CACHE, CONFIG_CACHE_PRELOAD_COLLECTION, cor_value);
 }
 
+Status
+Config::SetCacheConfigResultCacheSize(const std::string& value) {
+    STATUS_CHECK(CheckCacheConfigResultCacheSize(value));
+    return SetConfigValueInMem(CONFIG_CACHE, CONFIG_CACHE_RESULT_CACHE_SIZE, value);
+}
+
 /* engine config */
 Status
 Config::SetEngineConfigUseBlasThreshold(const std::string& value) {
@@ -2397,6 +2509,12 @@ Config::SetEngineSearchCombineMaxNq(const std::string& value) {
     return ExecCallBacks(CONFIG_ENGINE, CONFIG_ENGINE_SEARCH_COMBINE_MAX_NQ, value);
 }
 
+Status
+Config::SetEngineConfigIncrementalHnsw(const std::string& value) {
+    STATUS_CHECK(CheckEngineConfigIncrementalHnsw(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_INCREMENTAL_HNSW, value);
+}
+
 /* gpu resource config */
 #ifdef MILVUS_GPU_VERSION
 
@@ -2467,6 +2585,12 @@ Config::SetWalConfigRecoveryErrorIgnore(const std::string& value) {
     return SetConfigValueInMem(CONFIG_WAL, CONFIG_WAL_RECOVERY_ERROR_IGNORE, value);
 }
 
+Status
+Config::SetWalConfigCompressionEnable(const std::string& value) {
+    STATUS_CHECK(CheckWalConfigCompressionEnable(value));
+    return SetConfigValueInMem(CONFIG_WAL, CONFIG_WAL_COMPRESSION_ENABLE, value);
+}
+
 Status
 Config::SetWalConfigBufferSize(const std::string& value) {
     STATUS_CHECK(CheckWalConfigBufferSize(value));
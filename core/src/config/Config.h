@@ -82,6 +82,8 @@ extern const char* CONFIG_CACHE_CACHE_INSERT_DATA;
 extern const char* CONFIG_CACHE_CACHE_INSERT_DATA_DEFAULT;
 extern const char* CONFIG_CACHE_PRELOAD_COLLECTION;
 extern const char* CONFIG_CACHE_PRELOAD_COLLECTION_DEFAULT;
+extern const char* CONFIG_CACHE_RESULT_CACHE_SIZE;
+extern const char* CONFIG_CACHE_RESULT_CACHE_SIZE_DEFAULT;
 
 /* metric config */
 extern const char* CONFIG_METRIC;
@@ -102,6 +104,8 @@ extern const char* CONFIG_ENGINE_SIMD_TYPE;
 extern const char* CONFIG_ENGINE_SIMD_TYPE_DEFAULT;
 extern const char* CONFIG_ENGINE_SEARCH_COMBINE_MAX_NQ;
 extern const char* CONFIG_ENGINE_SEARCH_COMBINE_MAX_NQ_DEFAULT;
+extern const char* CONFIG_ENGINE_INCREMENTAL_HNSW;
+extern const char* CONFIG_ENGINE_INCREMENTAL_HNSW_DEFAULT;
 
 /* gpu resource config */
 extern const char* CONFIG_GPU_RESOURCE;
@@ -129,6 +133,8 @@ extern const char* CONFIG_WAL_ENABLE;
 extern const char* CONFIG_WAL_ENABLE_DEFAULT;
 extern const char* CONFIG_WAL_RECOVERY_ERROR_IGNORE;
 extern const char* CONFIG_WAL_RECOVERY_ERROR_IGNORE_DEFAULT;
+extern const char* CONFIG_WAL_COMPRESSION_ENABLE;
+extern const char* CONFIG_WAL_COMPRESSION_ENABLE_DEFAULT;
 extern const char* CONFIG_WAL_BUFFER_SIZE;
 extern const char* CONFIG_WAL_BUFFER_SIZE_DEFAULT;
 extern const int64_t CONFIG_WAL_BUFFER_SIZE_MIN;
@@ -258,6 +264,8 @@ class Config {
     CheckCacheConfigCacheInsertData(const std::string& value);
     Status
     CheckCacheConfigPreloadCollection(const std::string& value);
+    Status
+    CheckCacheConfigResultCacheSize(const std::string& value);
 
     /* engine config */
     Status
@@ -268,6 +276,8 @@ class Config {
     CheckEngineConfigSimdType(const std::string& value);
     Status
     CheckEngineSearchCombineMaxNq(const std::string& value);
+    Status
+    CheckEngineConfigIncrementalHnsw(const std::string& value);
 
     /* gpu resource config */
 #ifdef MILVUS_GPU_VERSION
@@ -295,6 +305,8 @@ class Config {
     Status
     CheckWalConfigRecoveryErrorIgnore(const std::string& value);
     Status
+    CheckWalConfigCompressionEnable(const std::string& value);
+    Status
     CheckWalConfigBufferSize(const std::string& value);
     Status
     CheckWalConfigWalPath(const std::string& value);
@@ -378,6 +390,8 @@ class Config {
     GetCacheConfigCacheInsertData(bool& value);
     Status
     GetCacheConfigPreloadCollection(std::string& value);
+    Status
+    GetCacheConfigResultCacheSize(int64_t& value);
 
     /* engine config */
     Status
@@ -388,6 +402,8 @@ class Config {
     GetEngineConfigSimdType(std::string& value);
     Status
     GetEngineSearchCombineMaxNq(int64_t& value);
+    Status
+    GetEngineConfigIncrementalHnsw(bool& value);
 
     /* gpu resource config */
 #ifdef MILVUS_GPU_VERSION
@@ -415,6 +431,8 @@ class Config {
     Status
     GetWalConfigRecoveryErrorIgnore(bool& value);
     Status
+    GetWalConfigCompressionEnable(bool& value);
+    Status
     GetWalConfigBufferSize(int64_t& value);
     Status
     GetWalConfigWalPath(std::string& value);
@@ -490,6 +508,8 @@ class Config {
     SetCacheConfigCacheInsertData(const std::string& value);
     Status
     SetCacheConfigPreloadCollection(const std::string& value);
+    Status
+    SetCacheConfigResultCacheSize(const std::string& value);
 
     /* engine config */
     Status
@@ -500,6 +520,8 @@ class Config {
     SetEngineConfigSimdType(const std::string& value);
     Status
     SetEngineSearchCombineMaxNq(const std::string& value);
+    Status
+    SetEngineConfigIncrementalHnsw(const std::string& value);
 
     /* gpu resource config */
 #ifdef MILVUS_GPU_VERSION
@@ -527,6 +549,8 @@ class Config {
     Status
     SetWalConfigRecoveryErrorIgnore(const std::string& value);
     Status
+    SetWalConfigCompressionEnable(const std::string& value);
+    Status
     SetWalConfigBufferSize(const std::string& value);
     Status
     SetWalConfigWalPath(const std::string& value);
@@ -68,6 +68,11 @@ class DB {
     virtual Status
     GetCollectionRowCount(const std::string& collection_id, uint64_t& row_count) = 0;
 
+    // changes whenever a flush, merge, index build or delete changes what a search of the collection returns,
+    // fails when this node does not track it
+    virtual Status
+    GetCollectionVersion(const std::string& collection_id, uint64_t& version) = 0;
+
     virtual Status
     PreloadCollection(const std::shared_ptr<server::Context>& context, const std::string& collection_id,
                       bool force = false) = 0;
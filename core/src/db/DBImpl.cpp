@@ -14,10 +14,12 @@
 #include <assert.h>
 #include <fiu-local.h>
 
+#include <knowhere/index/structured_index/StructuredIndexBitmap.h>
 #include <knowhere/index/structured_index/StructuredIndexSort.h>
 #include <algorithm>
 #include <boost/filesystem.hpp>
 #include <chrono>
+#include <condition_variable>
 #include <cstring>
 #include <functional>
 #include <iostream>
@@ -34,11 +36,13 @@
 #include "cache/GpuCacheMgr.h"
 #include "config/Utils.h"
 #include "db/IDGenerator.h"
+#include "db/engine/QueryEvaluator.h"
 #include "db/merge/MergeManagerFactory.h"
 #include "engine/EngineFactory.h"
 #include "index/knowhere/knowhere/index/vector_index/helpers/BuilderSuspend.h"
 #include "index/thirdparty/faiss/utils/distances.h"
 #include "insert/MemManagerFactory.h"
+#include "meta/CachedMetaImpl.h"
 #include "meta/MetaConsts.h"
 #include "meta/MetaFactory.h"
 #include "meta/SqliteMetaImpl.h"
@@ -48,8 +52,11 @@
 #include "scheduler/job/BuildIndexJob.h"
 #include "scheduler/job/DeleteJob.h"
 #include "scheduler/job/SearchJob.h"
+#include "segment/SegmentLock.h"
 #include "segment/SegmentReader.h"
 #include "segment/SegmentWriter.h"
+#include "segment/ZoneMaps.h"
+#include "utils/BlockingQueue.h"
 #include "utils/Exception.h"
 #include "utils/Log.h"
 #include "utils/StringHelpFunctions.h"
@@ -74,8 +81,66 @@ constexpr const char* JSON_SEGMENT_NAME = "name";
 constexpr const char* JSON_INDEX_NAME = "index_name";
 constexpr const char* JSON_DATA_SIZE = "data_size";
 
+constexpr uint64_t WAL_RECOVERY_MAX_THREADS = 8;
+
 static const Status SHUTDOWN_ERROR = Status(DB_ERROR, "Milvus server is shutdown!");
 
+// a recovered record with its own copy of ids and vectors, the wal read buffer is reused by the next read
+struct WalRecoveryRecord {
+    wal::MXLogRecord record;
+    std::vector<IDNumber> ids;
+    std::vector<uint8_t> data;
+};
+using WalRecoveryRecordPtr = std::shared_ptr<WalRecoveryRecord>;
+using WalRecoveryQueue = BlockingQueue<WalRecoveryRecordPtr>;
+
+WalRecoveryRecordPtr
+CopyWalRecord(const wal::MXLogRecord& record) {
+    auto copy = std::make_shared<WalRecoveryRecord>();
+    copy->record = record;
+    if (record.ids != nullptr && record.length > 0) {
+        copy->ids.assign(record.ids, record.ids + record.length);
+        copy->record.ids = copy->ids.data();
+    }
+    if (record.data != nullptr && record.data_size > 0) {
+        auto data = static_cast<const uint8_t*>(record.data);
+        copy->data.assign(data, data + record.data_size);
+        copy->record.data = copy->data.data();
+    }
+    return copy;
+}
+
+// low cardinality attributes get a bitmap index, others are sorted
+template <typename T>
+knowhere::IndexPtr
+BuildStructuredIndex(const std::vector<uint8_t>& raw_data, int64_t count) {
+    std::vector<T> attr_data(count);
+    memcpy(attr_data.data(), raw_data.data(), count * sizeof(T));
+
+    if (knowhere::StructuredIndexBitmap<T>::IsLowCardinality((size_t)count, attr_data.data())) {
+        return std::make_shared<knowhere::StructuredIndexBitmap<T>>((size_t)count, attr_data.data());
+    }
+    return std::make_shared<knowhere::StructuredIndexSort<T>>((size_t)count, attr_data.data());
+}
+
+// zone maps are tiny and read by every hybrid query, keep them in cpu cache
+segment::ZoneMapsPtr
+LoadZoneMaps(const std::string& segment_dir) {
+    std::string cache_key = segment_dir + "/zone_maps";
+    auto zone_maps =
+        std::static_pointer_cast<segment::ZoneMaps>(cache::CpuCacheMgr::GetInstance()->GetIndex(cache_key));
+    if (zone_maps != nullptr) {
+        return zone_maps;
+    }
+
+    segment::SegmentReader segment_reader(segment_dir);
+    auto status = segment_reader.LoadZoneMaps(zone_maps);
+    if (status.ok() && zone_maps != nullptr) {
+        cache::CpuCacheMgr::GetInstance()->InsertItem(cache_key, zone_maps);
+    }
+    return zone_maps;
+}
+
 }  // namespace
 
 DBImpl::DBImpl(const DBOptions& options)
@@ -87,6 +152,7 @@ DBImpl::DBImpl(const DBOptions& options)
     if (options_.wal_enable_) {
         wal::MXLogConfiguration mxlog_config;
         mxlog_config.recovery_error_ignore = options_.recovery_error_ignore_;
+        mxlog_config.compression_enable = options_.wal_compression_enable_;
         // 2 buffers in the WAL
         mxlog_config.buffer_size = options_.buffer_size_ / 2;
         mxlog_config.mxlog_path = options_.mxlog_path_;
@@ -137,17 +203,7 @@ DBImpl::Start() {
         }
 
         // recovery
-        while (1) {
-            wal::MXLogRecord record;
-            auto error_code = wal_mgr_->GetNextRecovery(record);
-            if (error_code != WAL_SUCCESS) {
-                throw Exception(error_code, "Wal recovery error!");
-            }
-            if (record.type == wal::MXLogType::None) {
-                break;
-            }
-            ExecWalRecord(record);
-        }
+        RecoverWal();
 
         // for distribute version, some nodes are read only
         if (options_.mode_ != DBOptions::MODE::CLUSTER_READONLY) {
@@ -555,6 +611,9 @@ DBImpl::ReLoadSegmentsDeletedDocs(const std::string& collection_id, const std::v
     for (auto& file : hold_files) {
         std::string segment_dir;
         utils::GetParentPath(file.location_, segment_dir);
+        // the cached index and the deleted docs must be in the same order
+        auto segment_lock = segment::GetSegmentLock(segment_dir);
+        std::lock_guard<std::mutex> lock(*segment_lock);
 
         auto data_obj_ptr = cache::CpuCacheMgr::GetInstance()->GetIndex(file.location_);
         auto index = std::static_pointer_cast<knowhere::VecIndex>(data_obj_ptr);
@@ -606,6 +665,21 @@ DBImpl::GetCollectionRowCount(const std::string& collection_id, uint64_t& row_co
     return GetCollectionRowCountRecursively(collection_id, row_count);
 }
 
+Status
+DBImpl::GetCollectionVersion(const std::string& collection_id, uint64_t& version) {
+    if (!initialized_.load(std::memory_order_acquire)) {
+        return SHUTDOWN_ERROR;
+    }
+
+    // only the meta cache sees every change, it is not used on readonly nodes whose meta is written elsewhere
+    auto cached_meta = std::dynamic_pointer_cast<meta::CachedMetaImpl>(meta_ptr_);
+    if (cached_meta == nullptr) {
+        return Status(DB_ERROR, "Collection versions are not tracked on this node");
+    }
+    version = cached_meta->CollectionVersion(collection_id);
+    return Status::OK();
+}
+
 Status
 DBImpl::CreatePartition(const std::string& collection_id, const std::string& partition_name,
                         const std::string& partition_tag) {
@@ -1184,6 +1258,8 @@ DBImpl::CompactFile(const meta::SegmentSchema& file, double threshold, meta::Seg
 
     // no need to compact if deleted vectors are too few(less than threashold)
     if (file.row_count_ > 0 && threshold > 0.0) {
+        auto segment_lock = segment::GetSegmentLock(segment_dir_to_merge);
+        std::lock_guard<std::mutex> lock(*segment_lock);
         segment::SegmentReader segment_reader_to_merge(segment_dir_to_merge);
         segment::DeletedDocsPtr deleted_docs_ptr;
         auto status = segment_reader_to_merge.LoadDeletedDocs(deleted_docs_ptr);
@@ -1428,6 +1504,8 @@ DBImpl::GetVectorIDs(const std::string& collection_id, const std::string& segmen
     // step 3: load segment ids and delete offset
     std::string segment_dir;
     engine::utils::GetParentPath(collection_files[0].location_, segment_dir);
+    auto segment_lock = segment::GetSegmentLock(segment_dir);
+    std::lock_guard<std::mutex> lock(*segment_lock);
     segment::SegmentReader segment_reader(segment_dir);
 
     std::vector<segment::doc_id_t> uids;
@@ -1482,6 +1560,8 @@ DBImpl::GetVectorsByIdHelper(const IDNumbers& id_array, std::vector<engine::Vect
         // Load bloom filter
         std::string segment_dir;
         engine::utils::GetParentPath(file.location_, segment_dir);
+        auto segment_lock = segment::GetSegmentLock(segment_dir);
+        std::lock_guard<std::mutex> lock(*segment_lock);
         segment::SegmentReader segment_reader(segment_dir);
         segment::IdBloomFilterPtr id_bloom_filter_ptr;
         auto status = segment_reader.LoadBloomFilter(id_bloom_filter_ptr);
@@ -1591,6 +1671,8 @@ DBImpl::GetEntitiesByIdHelper(const std::string& collection_id, const milvus::en
         // Load bloom filter
         std::string segment_dir;
         engine::utils::GetParentPath(file.location_, segment_dir);
+        auto segment_lock = segment::GetSegmentLock(segment_dir);
+        std::lock_guard<std::mutex> lock(*segment_lock);
         segment::SegmentReader segment_reader(segment_dir);
         segment::IdBloomFilterPtr id_bloom_filter_ptr;
         segment_reader.LoadBloomFilter(id_bloom_filter_ptr);
@@ -1830,7 +1912,12 @@ DBImpl::FlushAttrsIndex(const std::string& collection_id) {
         auto segment_reader_ptr = std::make_shared<segment::SegmentReader>(segment_dir);
         segment::SegmentPtr segment_ptr;
         segment_reader_ptr->GetSegment(segment_ptr);
-        status = segment_reader_ptr->Load();
+        {
+            // attributes are indexed by offset, read them in the order of the vectors
+            auto segment_lock = segment::GetSegmentLock(segment_dir);
+            std::lock_guard<std::mutex> lock(*segment_lock);
+            status = segment_reader_ptr->Load();
+        }
 
         if (!status.ok()) {
             return status;
@@ -1877,87 +1964,44 @@ DBImpl::CreateStructuredIndex(const std::string& collection_id, const std::vecto
 
     for (auto& field_name : field_names) {
         knowhere::IndexPtr index_ptr = nullptr;
+        auto attr_size = attr_sizes.at(field_name);
+        auto& attr_data = attr_datas.at(field_name);
         switch (attr_types.at(field_name)) {
             case engine::meta::hybrid::DataType::INT8: {
-                auto attr_size = attr_sizes.at(field_name);
-                std::vector<int8_t> attr_data(attr_size);
-                memcpy(attr_data.data(), attr_datas.at(field_name).data(), attr_size);
-
-                auto int8_index_ptr = std::make_shared<knowhere::StructuredIndexSort<int8_t>>(
-                    (size_t)attr_size, reinterpret_cast<const signed char*>(attr_data.data()));
-                index_ptr = std::static_pointer_cast<knowhere::Index>(int8_index_ptr);
-
-                attr_indexes.insert(std::make_pair(field_name, index_ptr));
+                index_ptr = BuildStructuredIndex<int8_t>(attr_data, attr_size);
                 attr_sizes.at(field_name) *= sizeof(int8_t);
                 break;
             }
             case engine::meta::hybrid::DataType::INT16: {
-                auto attr_size = attr_sizes.at(field_name);
-                std::vector<int16_t> attr_data(attr_size);
-                memcpy(attr_data.data(), attr_datas.at(field_name).data(), attr_size);
-
-                auto int16_index_ptr = std::make_shared<knowhere::StructuredIndexSort<int16_t>>(
-                    (size_t)attr_size, reinterpret_cast<const int16_t*>(attr_data.data()));
-                index_ptr = std::static_pointer_cast<knowhere::Index>(int16_index_ptr);
-
-                attr_indexes.insert(std::make_pair(field_name, index_ptr));
+                index_ptr = BuildStructuredIndex<int16_t>(attr_data, attr_size);
                 attr_sizes.at(field_name) *= sizeof(int16_t);
                 break;
             }
             case engine::meta::hybrid::DataType::INT32: {
-                auto attr_size = attr_sizes.at(field_name);
-                std::vector<int32_t> attr_data(attr_size);
-                memcpy(attr_data.data(), attr_datas.at(field_name).data(), attr_size);
-
-                auto int32_index_ptr = std::make_shared<knowhere::StructuredIndexSort<int32_t>>(
-                    (size_t)attr_size, reinterpret_cast<const int32_t*>(attr_data.data()));
-                index_ptr = std::static_pointer_cast<knowhere::Index>(int32_index_ptr);
-
-                attr_indexes.insert(std::make_pair(field_name, index_ptr));
+                index_ptr = BuildStructuredIndex<int32_t>(attr_data, attr_size);
                 attr_sizes.at(field_name) *= sizeof(int32_t);
                 break;
             }
             case engine::meta::hybrid::DataType::INT64: {
-                auto attr_size = attr_sizes.at(field_name);
-                std::vector<int64_t> attr_data(attr_size);
-                memcpy(attr_data.data(), attr_datas.at(field_name).data(), attr_size);
-
-                auto int64_index_ptr = std::make_shared<knowhere::StructuredIndexSort<int64_t>>(
-                    (size_t)attr_size, reinterpret_cast<const int64_t*>(attr_data.data()));
-                index_ptr = std::static_pointer_cast<knowhere::Index>(int64_index_ptr);
-
-                attr_indexes.insert(std::make_pair(field_name, index_ptr));
+                index_ptr = BuildStructuredIndex<int64_t>(attr_data, attr_size);
                 attr_sizes.at(field_name) *= sizeof(int64_t);
                 break;
             }
             case engine::meta::hybrid::DataType::FLOAT: {
-                auto attr_size = attr_sizes.at(field_name);
-                std::vector<float> attr_data(attr_size);
-                memcpy(attr_data.data(), attr_datas.at(field_name).data(), attr_size);
-
-                auto float_index_ptr = std::make_shared<knowhere::StructuredIndexSort<float>>(
-                    (size_t)attr_size, reinterpret_cast<const float*>(attr_data.data()));
-                index_ptr = std::static_pointer_cast<knowhere::Index>(float_index_ptr);
-
-                attr_indexes.insert(std::make_pair(field_name, index_ptr));
+                index_ptr = BuildStructuredIndex<float>(attr_data, attr_size);
                 attr_sizes.at(field_name) *= sizeof(float);
                 break;
             }
             case engine::meta::hybrid::DataType::DOUBLE: {
-                auto attr_size = attr_sizes.at(field_name);
-                std::vector<double> attr_data(attr_size);
-                memcpy(attr_data.data(), attr_datas.at(field_name).data(), attr_size);
-
-                auto double_index_ptr = std::make_shared<knowhere::StructuredIndexSort<double>>(
-                    (size_t)attr_size, reinterpret_cast<const double*>(attr_data.data()));
-                index_ptr = std::static_pointer_cast<knowhere::Index>(double_index_ptr);
-
-                attr_indexes.insert(std::make_pair(field_name, index_ptr));
+                index_ptr = BuildStructuredIndex<double>(attr_data, attr_size);
                 attr_sizes.at(field_name) *= sizeof(double);
                 break;
             }
             default: {}
         }
+        if (index_ptr != nullptr) {
+            attr_indexes.insert(std::make_pair(field_name, index_ptr));
+        }
     }
 
 #if 0
@@ -2433,10 +2477,39 @@ DBImpl::HybridQueryAsync(const std::shared_ptr<server::Context>& context, const
     LOG_ENGINE_DEBUG_ << LogOut("Engine query begin, index file count: %ld", files_holder.HoldFiles().size());
     scheduler::SearchJobPtr job =
         std::make_shared<scheduler::SearchJob>(query_async_ctx, general_query, query_ptr, attr_type, vectors);
+
+    // compile the attribute predicates once, every segment of the job evaluates the same evaluator
+    engine::QueryEvaluatorPtr evaluator;
+    std::string vector_placeholder;
+    auto status = engine::CompileQuery(general_query, attr_type, evaluator, vector_placeholder);
+    if (!status.ok()) {
+        files_holder.ReleaseFiles();
+        query_async_ctx->GetTraceContext()->GetSpan()->Finish();
+        return status;
+    }
+    job->SetQueryEvaluator(evaluator, vector_placeholder);
+
+    int64_t pruned_count = 0;
     for (auto& file : files) {
+        // skip segments whose zone maps prove that no entity passes the attribute predicates
+        std::string segment_dir;
+        utils::GetParentPath(file.location_, segment_dir);
+        auto zone_maps = LoadZoneMaps(segment_dir);
+        if (zone_maps != nullptr && !zone_maps->MayMatch(general_query)) {
+            ++pruned_count;
+            continue;
+        }
+
         scheduler::SegmentSchemaPtr file_ptr = std::make_shared<meta::SegmentSchema>(file);
         job->AddIndexFile(file_ptr);
     }
+    LOG_ENGINE_DEBUG_ << LogOut("Engine query pruned %ld files by zone maps", pruned_count);
+    if (job->index_files().empty()) {
+        files_holder.ReleaseFiles();
+        rc.ElapseFromBegin("Engine query totally cost");
+        query_async_ctx->GetTraceContext()->GetSpan()->Finish();
+        return Status::OK();  // no files to search
+    }
 
     // step 2: put search job to scheduler and wait result
     scheduler::JobMgrInst::GetInstance()->Put(job);
@@ -2453,7 +2526,7 @@ DBImpl::HybridQueryAsync(const std::shared_ptr<server::Context>& context, const
     result.result_distances_ = job->GetResultDistances();
 
     // step 4: get entities by result ids
-    auto status = GetEntitiesByID(collection_id, result.result_ids_, result.vectors_, result.attrs_);
+    status = GetEntitiesByID(collection_id, result.result_ids_, result.vectors_, result.attrs_);
     if (!status.ok()) {
         query_async_ctx->GetTraceContext()->GetSpan()->Finish();
         return status;
@@ -3032,7 +3105,7 @@ DBImpl::ExecWalRecord(const wal::MXLogRecord& record) {
                     max_lsn = lsn;
                 }
             }
-            wal_mgr_->CollectionFlushed(collection_id, lsn);
+            wal_mgr_->CollectionFlushed(collection_id, max_lsn);
         }
 
         std::set<std::string> merge_collection_ids;
@@ -3043,8 +3116,9 @@ DBImpl::ExecWalRecord(const wal::MXLogRecord& record) {
         return max_lsn;
     };
 
-    auto force_flush_if_mem_full = [&]() -> uint64_t {
-        if (mem_mgr_->GetCurrentMem() > options_.insert_buffer_size_) {
+    auto force_flush_if_mem_full = [&]() {
+        // during wal recovery the reader flushes once all dispatched records are applied
+        if (!wal_recovering_ && mem_mgr_->GetCurrentMem() > options_.insert_buffer_size_) {
             LOG_ENGINE_DEBUG_ << LogOut("[%s][%ld] ", "insert", 0) << "Insert buffer size exceeds limit. Force flush";
             InternalFlush();
         }
@@ -3180,6 +3254,7 @@ DBImpl::ExecWalRecord(const wal::MXLogRecord& record) {
                 uint64_t lsn = collections_flushed("", collection_ids);
                 if (options_.wal_enable_) {
                     wal_mgr_->RemoveOldFiles(lsn);
+                    wal_mgr_->Checkpoint();
                 }
             }
             break;
@@ -3192,6 +3267,95 @@ DBImpl::ExecWalRecord(const wal::MXLogRecord& record) {
     return status;
 }
 
+void
+DBImpl::RecoverWal() {
+    auto start_time = std::chrono::steady_clock::now();
+
+    // records of one collection go to the same worker so they are applied in lsn order
+    uint64_t thread_num = std::thread::hardware_concurrency();
+    thread_num = std::max<uint64_t>(1, std::min(thread_num, WAL_RECOVERY_MAX_THREADS));
+    std::vector<std::shared_ptr<WalRecoveryQueue>> queues;
+    std::vector<std::thread> workers;
+
+    std::mutex pending_mutex;
+    std::condition_variable pending_cv;
+    uint64_t pending = 0;
+
+    wal_recovering_ = true;
+    for (uint64_t i = 0; i < thread_num; ++i) {
+        auto queue = std::make_shared<WalRecoveryQueue>();
+        queues.push_back(queue);
+        workers.emplace_back([&, queue]() {
+            SetThreadName("wal_recovery");
+            while (true) {
+                auto copy = queue->Take();
+                if (copy == nullptr) {
+                    break;
+                }
+                auto status = ExecWalRecord(copy->record);
+                if (!status.ok()) {
+                    LOG_WAL_ERROR_ << "Failed to recover record lsn " << copy->record.lsn << ": " << status.message();
+                }
+
+                std::lock_guard<std::mutex> lock(pending_mutex);
+                if (--pending == 0) {
+                    pending_cv.notify_all();
+                }
+            }
+        });
+    }
+
+    auto wait_applied = [&]() {
+        std::unique_lock<std::mutex> lock(pending_mutex);
+        pending_cv.wait(lock, [&] { return pending == 0; });
+    };
+
+    std::hash<std::string> hash_fn;
+    uint64_t record_count = 0, row_count = 0;
+    ErrorCode error_code = WAL_SUCCESS;
+    while (true) {
+        wal::MXLogRecord record;
+        error_code = wal_mgr_->GetNextRecovery(record);
+        if (error_code != WAL_SUCCESS || record.type == wal::MXLogType::None) {
+            break;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(pending_mutex);
+            ++pending;
+        }
+        queues[hash_fn(record.collection_id) % thread_num]->Put(CopyWalRecord(record));
+        ++record_count;
+        row_count += record.length;
+
+        // flushed lsn must cover every record read so far, let the workers catch up first
+        if (mem_mgr_->GetCurrentMem() > options_.insert_buffer_size_) {
+            wait_applied();
+            LOG_ENGINE_DEBUG_ << "Insert buffer size exceeds limit. Force flush during wal recovery";
+            InternalFlush();
+        }
+    }
+
+    for (auto& queue : queues) {
+        queue->Put(nullptr);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    wal_recovering_ = false;
+
+    if (error_code != WAL_SUCCESS) {
+        throw Exception(error_code, "Wal recovery error!");
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    double rows_per_second = (seconds > 0) ? row_count / seconds : 0;
+    LOG_WAL_INFO_ << "Wal recovery applied " << record_count << " records, " << row_count << " rows in " << seconds
+                  << " seconds with " << thread_num << " threads, " << rows_per_second << " rows per second";
+    server::Metrics::GetInstance().WalRecoveryDurationSecondsGaugeSet(seconds);
+    server::Metrics::GetInstance().WalRecoveryRowsPerSecondGaugeSet(rows_per_second);
+}
+
 void
 DBImpl::InternalFlush(const std::string& collection_id) {
     wal::MXLogRecord record;
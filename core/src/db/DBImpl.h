@@ -90,6 +90,9 @@ class DBImpl : public DB, public server::CacheConfigHandler, public server::Engi
     Status
     GetCollectionRowCount(const std::string& collection_id, uint64_t& row_count) override;
 
+    Status
+    GetCollectionVersion(const std::string& collection_id, uint64_t& version) override;
+
     Status
     CreatePartition(const std::string& collection_id, const std::string& partition_name,
                     const std::string& partition_tag) override;
@@ -228,6 +231,9 @@ class DBImpl : public DB, public server::CacheConfigHandler, public server::Engi
                           std::vector<engine::VectorsData>& vectors, std::vector<engine::AttrsData>& attrs,
                           meta::FilesHolder& files_holder);
 
+    void
+    RecoverWal();
+
     void
     InternalFlush(const std::string& collection_id = "");
 
@@ -320,6 +326,7 @@ class DBImpl : public DB, public server::CacheConfigHandler, public server::Engi
 
     std::shared_ptr<wal::WalManager> wal_mgr_;
     std::thread bg_wal_thread_;
+    std::atomic<bool> wal_recovering_{false};
 
     std::thread bg_flush_thread_;
     std::thread bg_metric_thread_;
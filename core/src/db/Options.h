@@ -76,9 +76,13 @@ struct DBOptions {
 
     bool metric_enable_ = false;
 
+    // maintain hnsw graph for insert buffer, persisted as index file when segment is sealed
+    bool incremental_hnsw_ = false;
+
     // wal relative configurations
     bool wal_enable_ = true;
     bool recovery_error_ignore_ = true;
+    bool wal_compression_enable_ = false;
     int64_t buffer_size_ = 256;
     std::string mxlog_path_ = "/tmp/milvus/wal/";
 };  // Options
@@ -56,6 +56,7 @@ SSDBImpl::SSDBImpl(const DBOptions& options)
     if (options_.wal_enable_) {
         wal::MXLogConfiguration mxlog_config;
         mxlog_config.recovery_error_ignore = options_.recovery_error_ignore_;
+        mxlog_config.compression_enable = options_.wal_compression_enable_;
         // 2 buffers in the WAL
         mxlog_config.buffer_size = options_.buffer_size_ / 2;
         mxlog_config.mxlog_path = options_.mxlog_path_;
@@ -145,6 +145,8 @@ Status
 DeleteCollectionFilePath(const DBMetaOptions& options, meta::SegmentSchema& table_file) {
     utils::GetCollectionFilePath(options, table_file);
     boost::filesystem::remove(table_file.location_);
+    boost::filesystem::remove(GetIncrementalIndexPath(table_file.location_));
+    boost::filesystem::remove(GetDiskListsPath(table_file.location_));
     return Status::OK();
 }
 
@@ -164,6 +166,16 @@ GetParentPath(const std::string& path, std::string& parent_path) {
     return Status::OK();
 }
 
+std::string
+GetIncrementalIndexPath(const std::string& location) {
+    return location + ".hnsw";
+}
+
+std::string
+GetDiskListsPath(const std::string& location) {
+    return location + ".ivfdata";
+}
+
 bool
 IsSameIndex(const CollectionIndex& index1, const CollectionIndex& index2) {
     return index1.engine_type_ == index2.engine_type_ && index1.extra_params_ == index2.extra_params_ &&
@@ -254,6 +266,7 @@ GetIndexName(int32_t index_type) {
         {(int32_t)engine::EngineType::FAISS_IVFSQ8NR, "IVFSQ8NR"},
         {(int32_t)engine::EngineType::FAISS_IVFSQ8H, "IVFSQ8H"},
         {(int32_t)engine::EngineType::FAISS_PQ, "PQ"},
+        {(int32_t)engine::EngineType::FAISS_IVFPQFS, "PQ_FS"},
 #ifdef MILVUS_SUPPORT_SPTAG
         {(int32_t)engine::EngineType::SPTAG_KDT, "KDT"},
         {(int32_t)engine::EngineType::SPTAG_BKT, "BKT"},
@@ -262,6 +275,7 @@ GetIndexName(int32_t index_type) {
         {(int32_t)engine::EngineType::FAISS_BIN_IVFFLAT, "IVFFLAT"},
         {(int32_t)engine::EngineType::HNSW_SQ8NR, "HNSW_SQ8NR"},
         {(int32_t)engine::EngineType::HNSW, "HNSW"},
+        {(int32_t)engine::EngineType::DISKANN, "DISKANN"},
         {(int32_t)engine::EngineType::NSG_MIX, "NSG"},
         {(int32_t)engine::EngineType::ANNOY, "ANNOY"}};
 
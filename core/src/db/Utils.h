@@ -47,6 +47,14 @@ DeleteSegment(const DBMetaOptions& options, meta::SegmentSchema& table_file);
 Status
 GetParentPath(const std::string& path, std::string& parent_path);
 
+// hnsw graph linked while a raw file was buffered, see DBOptions::incremental_hnsw_
+std::string
+GetIncrementalIndexPath(const std::string& location);
+
+// inverted lists of an IVF index built with "disk_mode"
+std::string
+GetDiskListsPath(const std::string& location);
+
 bool
 IsSameIndex(const CollectionIndex& index1, const CollectionIndex& index2);
 
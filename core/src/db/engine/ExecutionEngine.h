@@ -56,8 +56,9 @@ class ExecutionEngine {
     virtual Status
     Load(bool to_cache = true) = 0;
 
+    // load the indexes of the given attribute fields, each field is cached on its own
     virtual Status
-    LoadAttr(bool to_cache = true) = 0;
+    LoadAttr(const std::vector<std::string>& field_names, bool to_cache = true) = 0;
 
     virtual Status
     CopyToGpu(uint64_t device_id, bool hybrid) = 0;
@@ -94,6 +95,10 @@ class ExecutionEngine {
     virtual Status
     Search(std::vector<int64_t>& ids, std::vector<float>& distances, scheduler::SearchJobPtr job, bool hybrid) = 0;
 
+    // true if the distances of the last search are exact ones recomputed from the raw vectors
+    virtual bool
+    SearchRefined() const = 0;
+
     virtual std::shared_ptr<ExecutionEngine>
     BuildIndex(const std::string& location, EngineType engine_type) = 0;
 
@@ -11,10 +11,14 @@
 
 #include "db/engine/ExecutionEngineImpl.h"
 
+#include <faiss/FaissHook.h>
 #include <faiss/utils/ConcurrentBitset.h>
 #include <fiu-local.h>
 
+#include <algorithm>
+#include <limits>
 #include <stdexcept>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -22,17 +26,22 @@
 #include "cache/CpuCacheMgr.h"
 #include "cache/GpuCacheMgr.h"
 #include "config/Config.h"
+#include "db/Constants.h"
 #include "db/Utils.h"
+#include "db/engine/QueryEvaluator.h"
 #include "knowhere/common/Config.h"
-#include "knowhere/index/structured_index/StructuredIndexSort.h"
 #include "knowhere/index/vector_index/ConfAdapter.h"
 #include "knowhere/index/vector_index/ConfAdapterMgr.h"
 #include "knowhere/index/vector_index/IndexBinaryIDMAP.h"
 #include "knowhere/index/vector_index/IndexIDMAP.h"
+#include "knowhere/index/vector_index/IndexIDMAPHalf.h"
+#include "knowhere/index/vector_index/IndexIVF.h"
 #include "knowhere/index/vector_index/VecIndex.h"
 #include "knowhere/index/vector_index/VecIndexFactory.h"
 #include "knowhere/index/vector_index/adapter/VectorAdapter.h"
+#include "knowhere/index/vector_offset_index/IndexIVF_NM.h"
 #ifdef MILVUS_GPU_VERSION
+#include "faiss/gpu/utils/DeviceUtils.h"
 #include "knowhere/index/vector_index/gpu/GPUIndex.h"
 #include "knowhere/index/vector_index/gpu/IndexIVFSQHybrid.h"
 #include "knowhere/index/vector_index/gpu/Quantizer.h"
@@ -42,6 +51,7 @@
 #include "metrics/Metrics.h"
 #include "scheduler/Utils.h"
 #include "scheduler/job/SearchJob.h"
+#include "segment/SegmentLock.h"
 #include "segment/SegmentReader.h"
 #include "segment/SegmentWriter.h"
 #include "utils/CommonUtil.h"
@@ -87,13 +97,49 @@ MappingMetricType(MetricType metric_type, milvus::json& conf) {
     return Status::OK();
 }
 
+// attribute indexes are cached per field, next to the key of the segment's zone maps
+std::string
+AttrIndexCacheKey(const std::string& segment_dir, const std::string& field_name) {
+    return segment_dir + "/" + field_name + ".idx";
+}
+
 bool
 IsBinaryIndexType(knowhere::IndexType type) {
     return type == knowhere::IndexEnum::INDEX_FAISS_BIN_IDMAP || type == knowhere::IndexEnum::INDEX_FAISS_BIN_IVFFLAT;
 }
 
+// IVF indexes created with "disk_mode" keep their inverted lists in a file of their own
+bool
+IsDiskModeIndex(EngineType type, const milvus::json& index_params) {
+    switch (type) {
+        case EngineType::FAISS_IVFFLAT:
+        case EngineType::FAISS_IVFSQ8:
+        case EngineType::FAISS_IVFSQ8NR:
+            return index_params.contains(knowhere::IndexParams::disk_mode) &&
+                   index_params[knowhere::IndexParams::disk_mode].get<bool>();
+        default:
+            return false;
+    }
+}
+
+constexpr int64_t DEFAULT_DISK_CACHE_SIZE = 64;  // MB
+
+int64_t
+DiskCacheSize(const milvus::json& index_params) {
+    int64_t cache_size = DEFAULT_DISK_CACHE_SIZE;
+    if (index_params.contains(knowhere::IndexParams::disk_cache_size)) {
+        cache_size = index_params[knowhere::IndexParams::disk_cache_size].get<int64_t>();
+    }
+    return cache_size * MB;
+}
+
 codec::ExternalData
-GetIndexDataType(EngineType type) {
+GetIndexDataType(EngineType type, const milvus::json& index_params) {
+    if (IsDiskModeIndex(type, index_params)) {
+        // the codes are read from the inverted lists file
+        return codec::ExternalData::ExternalData_None;
+    }
+
     switch (type) {
         case EngineType::FAISS_IVFFLAT:
         case EngineType::HNSW:
@@ -104,11 +150,41 @@ GetIndexDataType(EngineType type) {
         case EngineType::FAISS_IVFSQ8NR:
             return codec::ExternalData::ExternalData_SQ8;
 
+        case EngineType::DISKANN:
+            return codec::ExternalData::ExternalData_Sectors;
+
+        case EngineType::FAISS_IVFPQFS:
+            // raw vectors are only needed to re-rank the fast scan candidates
+            if (index_params.contains(knowhere::IndexParams::rerank) &&
+                index_params[knowhere::IndexParams::rerank].get<bool>()) {
+                return codec::ExternalData::ExternalData_RawData;
+            }
+            return codec::ExternalData::ExternalData_None;
+
         default:
             return codec::ExternalData::ExternalData_None;
     }
 }
 
+// distances of these index types are approximate, they can be refined with the raw vectors
+bool
+IsRefinableIndexType(EngineType type) {
+    switch (type) {
+        case EngineType::FAISS_IVFSQ8:
+        case EngineType::FAISS_IVFSQ8H:
+        case EngineType::FAISS_IVFSQ8NR:
+        case EngineType::FAISS_PQ:
+        case EngineType::FAISS_IVFPQFS:
+        case EngineType::HNSW_SQ8NR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// candidate rows closer than this are fetched by one read, reading the gap is cheaper than another file open
+constexpr size_t REFINE_READ_GAP = 64 * 1024;
+
 }  // namespace
 
 #ifdef MILVUS_GPU_VERSION
@@ -204,6 +280,10 @@ ExecutionEngineImpl::CreatetVecIndex(EngineType type) {
             index = vec_index_factory.CreateVecIndex(knowhere::IndexEnum::INDEX_FAISS_IVFPQ, mode);
             break;
         }
+        case EngineType::FAISS_IVFPQFS: {
+            index = vec_index_factory.CreateVecIndex(knowhere::IndexEnum::INDEX_FAISS_IVFPQFS, mode);
+            break;
+        }
         case EngineType::FAISS_IVFSQ8: {
             index = vec_index_factory.CreateVecIndex(knowhere::IndexEnum::INDEX_FAISS_IVFSQ8, mode);
             break;
@@ -230,6 +310,10 @@ ExecutionEngineImpl::CreatetVecIndex(EngineType type) {
             index = vec_index_factory.CreateVecIndex(knowhere::IndexEnum::INDEX_NSG, mode);
             break;
         }
+        case EngineType::DISKANN: {
+            index = vec_index_factory.CreateVecIndex(knowhere::IndexEnum::INDEX_DISKANN, mode);
+            break;
+        }
 #ifdef MILVUS_SUPPORT_SPTAG
         case EngineType::SPTAG_KDT: {
             index = vec_index_factory.CreateVecIndex(knowhere::IndexEnum::INDEX_SPTAG_KDT_RNT, mode);
@@ -414,12 +498,34 @@ ExecutionEngineImpl::Load(bool to_cache) {
     if (!already_in_cache) {
         std::string segment_dir;
         utils::GetParentPath(location_, segment_dir);
+        // held until the index is cached, a segment rewritten meanwhile must not be cached in its old order
+        auto segment_lock = segment::GetSegmentLock(segment_dir);
+        std::lock_guard<std::mutex> lock(*segment_lock);
         auto segment_reader_ptr = std::make_shared<segment::SegmentReader>(segment_dir);
         knowhere::VecIndexFactory& vec_index_factory = knowhere::VecIndexFactory::GetInstance();
 
         if (utils::IsRawIndexType((int32_t)index_type_)) {
+            auto status = segment_reader_ptr->Load();
+            if (!status.ok()) {
+                std::string msg = "Failed to load segment from " + location_;
+                LOG_ENGINE_ERROR_ << msg;
+                return Status(DB_ERROR, msg);
+            }
+
+            segment::SegmentPtr segment_ptr;
+            segment_reader_ptr->GetSegment(segment_ptr);
+            auto& vectors = segment_ptr->vectors_ptr_;
+
             if (index_type_ == EngineType::FAISS_IDMAP) {
-                index_ = vec_index_factory.CreateVecIndex(knowhere::IndexEnum::INDEX_FAISS_IDMAP);
+                // half precision vectors are searched as they are stored, without widening to float
+                auto data_type = vectors->GetDataType();
+                if (data_type == segment::VectorsDataType::FP16) {
+                    index_ = std::make_shared<knowhere::IDMAPHalf>(knowhere::HalfType::FP16);
+                } else if (data_type == segment::VectorsDataType::BF16) {
+                    index_ = std::make_shared<knowhere::IDMAPHalf>(knowhere::HalfType::BF16);
+                } else {
+                    index_ = vec_index_factory.CreateVecIndex(knowhere::IndexEnum::INDEX_FAISS_IDMAP);
+                }
             } else {
                 index_ = vec_index_factory.CreateVecIndex(knowhere::IndexEnum::INDEX_FAISS_BIN_IDMAP);
             }
@@ -430,17 +536,6 @@ ExecutionEngineImpl::Load(bool to_cache) {
             if (!adapter->CheckTrain(conf, index_->index_mode())) {
                 throw Exception(DB_ERROR, "Illegal index params");
             }
-
-            auto status = segment_reader_ptr->Load();
-            if (!status.ok()) {
-                std::string msg = "Failed to load segment from " + location_;
-                LOG_ENGINE_ERROR_ << msg;
-                return Status(DB_ERROR, msg);
-            }
-
-            segment::SegmentPtr segment_ptr;
-            segment_reader_ptr->GetSegment(segment_ptr);
-            auto& vectors = segment_ptr->vectors_ptr_;
             auto& deleted_docs = segment_ptr->deleted_docs_ptr_->GetDeletedDocs();
 
             auto& vectors_uids = vectors->GetMutableUids();
@@ -474,7 +569,10 @@ ExecutionEngineImpl::Load(bool to_cache) {
                 segment::SegmentPtr segment_ptr;
                 segment_reader_ptr->GetSegment(segment_ptr);
 
-                auto external_data = GetIndexDataType(index_type_);
+                // only FAISS_IDMAP above searches half precision vectors as stored, the raw data given to the
+                // indexes that keep no copy of the vectors (IVF_FLAT, HNSW, NSG, ...) is decoded to float here,
+                // like the input of BuildIndex, so half precision saves them disk space but no memory
+                auto external_data = GetIndexDataType(index_type_, index_params_);
                 auto status =
                     segment_reader_ptr->LoadVectorIndex(location_, external_data, segment_ptr->vector_index_ptr_);
                 index_ = segment_ptr->vector_index_ptr_->GetVectorIndex();
@@ -494,6 +592,9 @@ ExecutionEngineImpl::Load(bool to_cache) {
                         LOG_ENGINE_ERROR_ << err_msg;
                         return Status(DB_ERROR, err_msg);
                     }
+                    if (IsDiskModeIndex(index_type_, index_params_)) {
+                        STATUS_CHECK(OpenListsOnDisk());
+                    }
                     segment::DeletedDocsPtr deleted_docs_ptr;
                     auto status = segment_reader_ptr->LoadDeletedDocs(deleted_docs_ptr);
                     if (!status.ok()) {
@@ -525,10 +626,10 @@ ExecutionEngineImpl::Load(bool to_cache) {
                 return Status(DB_ERROR, e.what());
             }
         }
-    }
 
-    if (!already_in_cache && to_cache) {
-        Cache();
+        if (to_cache) {
+            Cache();
+        }
     }
 
     //    auto status = LoadAttr(to_cache);
@@ -540,44 +641,50 @@ ExecutionEngineImpl::Load(bool to_cache) {
 }  // namespace engine
 
 Status
-ExecutionEngineImpl::LoadAttr(bool to_cache) {
-    attr_index_ =
-        std::static_pointer_cast<Attr::AttrIndex>(cache::CpuCacheMgr::GetInstance()->GetIndex(attr_location_));
-    bool already_in_cache = (attr_index_ != nullptr);
-    if (!already_in_cache) {
-        std::string segment_dir;
-        utils::GetParentPath(location_, segment_dir);
-        auto segment_reader_ptr = std::make_shared<segment::SegmentReader>(segment_dir);
-
-        attr_index_ = std::make_shared<Attr::AttrIndex>();
+ExecutionEngineImpl::LoadAttr(const std::vector<std::string>& field_names, bool to_cache) {
+    std::string segment_dir;
+    utils::GetParentPath(location_, segment_dir);
+    auto segment_reader_ptr = std::make_shared<segment::SegmentReader>(segment_dir);
+    auto cpu_cache_mgr = cache::CpuCacheMgr::GetInstance();
+
+    std::unordered_map<std::string, knowhere::IndexPtr> attr_indexes;
+    std::unordered_map<std::string, int64_t> attr_sizes;
+    bool loaded_from_disk = false;
+    for (auto& field_name : field_names) {
+        auto index = std::dynamic_pointer_cast<knowhere::Index>(
+            cpu_cache_mgr->GetIndex(AttrIndexCacheKey(segment_dir, field_name)));
+        if (index == nullptr) {
+            segment::AttrIndexPtr attr_index_ptr;
+            auto status = segment_reader_ptr->LoadAttrsIndex(field_name, attr_index_ptr);
+            if (!status.ok()) {
+                return status;
+            }
+            if (attr_index_ptr == nullptr) {
+                // the field has no index in this segment, the evaluator reports it
+                continue;
+            }
+            index = attr_index_ptr->GetAttrIndex();
+            loaded_from_disk = true;
+        }
+        attr_indexes.insert(std::make_pair(field_name, index));
+        attr_sizes.insert(std::make_pair(field_name, index->Size()));
+    }
 
-        auto status = segment_reader_ptr->Load();
+    // every attribute column holds one value per vector of the segment
+    int64_t entity_count = 0;
+    if (index_ != nullptr) {
+        entity_count = index_->Count();
+    } else if (!attr_indexes.empty()) {
+        std::vector<segment::doc_id_t> uids;
+        auto status = segment_reader_ptr->LoadUids(uids);
         if (!status.ok()) {
             return status;
         }
-
-        segment::SegmentPtr segment_ptr;
-        segment_reader_ptr->GetSegment(segment_ptr);
-        auto attrs_index = segment_ptr->attrs_index_ptr_;
-
-        std::unordered_map<std::string, knowhere::IndexPtr> attr_indexes;
-        std::unordered_map<std::string, int64_t> attr_sizes;
-
-        auto attr_it = attrs_index->attr_indexes.begin();
-        if (attr_it == attrs_index->attr_indexes.end()) {
-            return Status::OK();
-        }
-
-        for (; attr_it != attrs_index->attr_indexes.end(); attr_it++) {
-            attr_indexes.insert(std::make_pair(attr_it->first, attr_it->second->GetAttrIndex()));
-        }
-
-        auto count = segment_ptr->attrs_ptr_->attrs.begin()->second->GetUids().size();
-        attr_index_->SetIndexData(attr_indexes);
-        attr_index_->SetEntityCount(count);
+        entity_count = uids.size();
     }
+    attr_index_ = std::make_shared<Attr::AttrIndex>(attr_indexes, attr_sizes, entity_count);
 
-    if (!already_in_cache && to_cache) {
+    if (loaded_from_disk && to_cache) {
         auto status = AttrCache();
         if (!status.ok()) {
             return status;
@@ -652,6 +759,12 @@ ExecutionEngineImpl::CopyToGpu(uint64_t device_id, bool hybrid) {
             return Status(DB_ERROR, "index is null");
         }
 
+        if (std::dynamic_pointer_cast<knowhere::IDMAPHalf>(index_) != nullptr) {
+            // half precision raw vectors are only searched on cpu
+            LOG_ENGINE_DEBUG_ << "Half precision raw data of " << location_ << " stays on CPU";
+            return Status::OK();
+        }
+
         try {
             /* Index data is copied to GPU first, then added into GPU cache.
              * Add lock here to avoid multiple INDEX are copied to one GPU card at same time.
@@ -748,9 +861,17 @@ ExecutionEngineImpl::BuildIndex(const std::string& location, EngineType engine_t
 
     std::vector<segment::doc_id_t> uids;
     faiss::ConcurrentBitsetPtr blacklist;
+    std::vector<float> decoded;  // half precision raw vectors, decoded for this build only
+    const float* raw_vectors = nullptr;
     if (from_index) {
-        auto dataset =
-            knowhere::GenDatasetWithIds(Count(), Dimension(), from_index->GetRawVectors(), from_index->GetRawIds());
+        if (auto half_index = std::dynamic_pointer_cast<knowhere::IDMAPHalf>(from_index)) {
+            decoded.resize(Count() * Dimension());
+            half_index->DecodeRawVectors(decoded.data());
+            raw_vectors = decoded.data();
+        } else {
+            raw_vectors = from_index->GetRawVectors();
+        }
+        auto dataset = knowhere::GenDatasetWithIds(Count(), Dimension(), raw_vectors, from_index->GetRawIds());
         to_index->BuildAll(dataset, conf);
         uids = from_index->GetUids();
         blacklist = from_index->GetBlacklist();
@@ -770,6 +891,20 @@ ExecutionEngineImpl::BuildIndex(const std::string& location, EngineType engine_t
     }
 #endif
 
+    if (IsDiskModeIndex(engine_type, index_params_)) {
+        // the codes are read from the lists file, the segment stays in insertion order
+        auto raw_data = reinterpret_cast<const uint8_t*>(raw_vectors);
+        auto status = MoveListsToDisk(to_index, location, raw_data);
+        if (!status.ok()) {
+            throw Exception(DB_ERROR, status.message());
+        }
+    } else if (auto nm_index = std::dynamic_pointer_cast<knowhere::IVF_NM>(to_index)) {
+        auto status = ArrangeInListOrder(*nm_index, uids, blacklist);
+        if (!status.ok()) {
+            throw Exception(DB_ERROR, status.message());
+        }
+    }
+
     to_index->SetUids(uids);
     LOG_ENGINE_DEBUG_ << "Set " << to_index->GetUids().size() << "uids for " << location;
     if (blacklist != nullptr) {
@@ -805,186 +940,41 @@ MapAndCopyResult(const knowhere::DatasetPtr& dataset, const std::vector<milvus::
 }
 
 Status
-ExecutionEngineImpl::ProcessTermQuery(faiss::ConcurrentBitsetPtr& bitset, query::GeneralQueryPtr general_query,
-                                      std::unordered_map<std::string, meta::hybrid::DataType>& attr_type) {
-    auto field_name = general_query->leaf->term_query->field_name;
-    auto type = attr_type.at(field_name);
-
-    switch (type) {
-        case meta::hybrid::DataType::INT8: {
-            auto int8_index = std::dynamic_pointer_cast<knowhere::StructuredIndexSort<int8_t>>(
-                attr_index_->attr_index_data().at(field_name));
-            if (not int8_index) {
-                return Status{SERVER_INVALID_ARGUMENT, "Attribute's type is wrong"};
-            }
-
-            std::vector<int8_t> term_value;
-            auto term_size = general_query->leaf->term_query->field_value.size() * (sizeof(int8_t)) / sizeof(int8_t);
-            term_value.resize(term_size);
-            memcpy(term_value.data(), general_query->leaf->term_query->field_value.data(), term_size * sizeof(int8_t));
-
-            bitset = int8_index->In(term_size, term_value.data());
-            break;
-        }
-        case meta::hybrid::DataType::INT16: {
-            auto int16_index = std::dynamic_pointer_cast<knowhere::StructuredIndexSort<int16_t>>(
-                attr_index_->attr_index_data().at(field_name));
-            if (not int16_index) {
-                return Status{SERVER_INVALID_ARGUMENT, "Attribute's type is wrong"};
-            }
-
-            std::vector<int16_t> term_value;
-            auto term_size = general_query->leaf->term_query->field_value.size() * (sizeof(int8_t)) / sizeof(int16_t);
-            term_value.resize(term_size);
-            memcpy(term_value.data(), general_query->leaf->term_query->field_value.data(), term_size * sizeof(int16_t));
-
-            bitset = int16_index->In(term_size, term_value.data());
-            break;
-        }
-        case meta::hybrid::DataType::INT32: {
-            auto int32_index = std::dynamic_pointer_cast<knowhere::StructuredIndexSort<int32_t>>(
-                attr_index_->attr_index_data().at(field_name));
-            if (not int32_index) {
-                return Status{SERVER_INVALID_ARGUMENT, "Attribute's type is wrong"};
-            }
-
-            std::vector<int32_t> term_value;
-            auto term_size = general_query->leaf->term_query->field_value.size() * (sizeof(int8_t)) / sizeof(int32_t);
-            term_value.resize(term_size);
-            memcpy(term_value.data(), general_query->leaf->term_query->field_value.data(), term_size * sizeof(int32_t));
-
-            bitset = int32_index->In(term_size, term_value.data());
-            break;
-        }
-        case meta::hybrid::DataType::INT64: {
-            auto int64_index = std::dynamic_pointer_cast<knowhere::StructuredIndexSort<int64_t>>(
-                attr_index_->attr_index_data().at(field_name));
-            if (not int64_index) {
-                return Status{SERVER_INVALID_ARGUMENT, "Attribute's type is wrong"};
-            }
-
-            std::vector<int64_t> term_value;
-            auto term_size = general_query->leaf->term_query->field_value.size() * (sizeof(int8_t)) / sizeof(int64_t);
-            term_value.resize(term_size);
-            memcpy(term_value.data(), general_query->leaf->term_query->field_value.data(), term_size * sizeof(int64_t));
-
-            bitset = int64_index->In(term_size, term_value.data());
-            break;
-        }
-        case meta::hybrid::DataType::FLOAT: {
-            auto float_index = std::dynamic_pointer_cast<knowhere::StructuredIndexSort<float>>(
-                attr_index_->attr_index_data().at(field_name));
-            if (not float_index) {
-                return Status{SERVER_INVALID_ARGUMENT, "Attribute's type is wrong"};
-            }
-
-            std::vector<float> term_value;
-            auto term_size = general_query->leaf->term_query->field_value.size() * (sizeof(int8_t)) / sizeof(float);
-            term_value.resize(term_size);
-            memcpy(term_value.data(), general_query->leaf->term_query->field_value.data(), term_size * sizeof(int64_t));
-
-            bitset = float_index->In(term_size, term_value.data());
-            break;
-        }
-        case meta::hybrid::DataType::DOUBLE: {
-            auto double_index = std::dynamic_pointer_cast<knowhere::StructuredIndexSort<double>>(
-                attr_index_->attr_index_data().at(field_name));
-            if (not double_index) {
-                return Status{SERVER_INVALID_ARGUMENT, "Attribute's type is wrong"};
-            }
-
-            std::vector<double> term_value;
-            auto term_size = general_query->leaf->term_query->field_value.size() * (sizeof(int8_t)) / sizeof(double);
-            term_value.resize(term_size);
-            memcpy(term_value.data(), general_query->leaf->term_query->field_value.data(), term_size * sizeof(double));
-
-            bitset = double_index->In(term_size, term_value.data());
-            break;
+ExecutionEngineImpl::HybridSearch(scheduler::SearchJobPtr search_job,
+                                  std::unordered_map<std::string, meta::hybrid::DataType>& attr_type,
+                                  std::vector<float>& distances, std::vector<int64_t>& search_ids, bool hybrid) {
+    auto evaluator = search_job->query_evaluator();
+    std::string vector_placeholder = search_job->vector_placeholder();
+    if (evaluator == nullptr && vector_placeholder.empty()) {
+        auto status = CompileQuery(search_job->general_query(), attr_type, evaluator, vector_placeholder);
+        if (!status.ok()) {
+            return status;
         }
-        default:
-            break;
     }
-    return Status::OK();
-}
-
-Status
-ExecutionEngineImpl::ProcessRangeQuery(const meta::hybrid::DataType data_type, const std::string& operand,
-                                       const query::CompareOperator& com_operator, knowhere::IndexPtr& index_ptr,
-                                       faiss::ConcurrentBitsetPtr& bitset) {
-    switch (data_type) {
-        case meta::hybrid::DataType::INT8: {
-            auto int8_index = std::dynamic_pointer_cast<knowhere::StructuredIndexSort<int8_t>>(index_ptr);
-
-            int8_t value = atoi(operand.c_str());
-            bitset = int8_index->Range(value, (knowhere::OperatorType)com_operator);
-            break;
-        }
-        case meta::hybrid::DataType::INT16: {
-            auto int16_index = std::dynamic_pointer_cast<knowhere::StructuredIndexSort<int16_t>>(index_ptr);
-
-            int16_t value = atoi(operand.c_str());
-            bitset = int16_index->Range(value, (knowhere::OperatorType)com_operator);
-            break;
-        }
-        case meta::hybrid::DataType::INT32: {
-            auto int32_index = std::dynamic_pointer_cast<knowhere::StructuredIndexSort<int32_t>>(index_ptr);
-
-            int32_t value = atoi(operand.c_str());
-            bitset = int32_index->Range(value, (knowhere::OperatorType)com_operator);
-            break;
-        }
-        case meta::hybrid::DataType::INT64: {
-            auto int64_index = std::dynamic_pointer_cast<knowhere::StructuredIndexSort<int64_t>>(index_ptr);
 
-            int64_t value = atoi(operand.c_str());
-            bitset = int64_index->Range(value, (knowhere::OperatorType)com_operator);
-            break;
-        }
-        case meta::hybrid::DataType::FLOAT: {
-            auto float_index = std::dynamic_pointer_cast<knowhere::StructuredIndexSort<float>>(index_ptr);
-
-            std::istringstream iss(operand);
-            float value;
-            iss >> value;
-            bitset = float_index->Range(value, (knowhere::OperatorType)com_operator);
-            break;
+    faiss::ConcurrentBitsetPtr bitset;
+    if (evaluator != nullptr) {
+        if (attr_index_ == nullptr) {
+            return Status(DB_ERROR, "attribute indexes are not loaded");
         }
-        case meta::hybrid::DataType::DOUBLE: {
-            auto double_index = std::dynamic_pointer_cast<knowhere::StructuredIndexSort<double>>(index_ptr);
-
-            std::istringstream iss(operand);
-            double value;
-            iss >> value;
-            bitset = double_index->Range(value, (knowhere::OperatorType)com_operator);
-            break;
+        auto status = evaluator->Evaluate(attr_index_->attr_index_data(), attr_index_->entity_count(), bitset);
+        if (!status.ok()) {
+            return status;
         }
-        default:
-            break;
-    }
-    return Status::OK();
-}
-
-Status
-ExecutionEngineImpl::HybridSearch(scheduler::SearchJobPtr search_job,
-                                  std::unordered_map<std::string, meta::hybrid::DataType>& attr_type,
-                                  std::vector<float>& distances, std::vector<int64_t>& search_ids, bool hybrid) {
-    faiss::ConcurrentBitsetPtr bitset;
-    std::string vector_placeholder;
-    auto status = ExecBinaryQuery(search_job->general_query(), bitset, attr_type, vector_placeholder);
-    if (!status.ok()) {
-        return status;
     }
 
     // Do search
-    faiss::ConcurrentBitsetPtr list;
-    list = index_->GetBlacklist();
-    // Do AND
-    for (uint64_t i = 0; i < attr_index_->entity_count(); ++i) {
-        if (list->test(i) && !bitset->test(i)) {
-            list->clear(i);
+    if (bitset != nullptr) {
+        faiss::ConcurrentBitsetPtr list;
+        list = index_->GetBlacklist();
+        // Do AND
+        for (uint64_t i = 0; i < attr_index_->entity_count(); ++i) {
+            if (list->test(i) && !bitset->test(i)) {
+                list->clear(i);
+            }
         }
+        index_->SetBlacklist(list);
     }
-    index_->SetBlacklist(list);
 
     auto vector_query = search_job->query_ptr()->vectors.at(vector_placeholder);
     int64_t topk = vector_query->topk;
@@ -999,263 +989,32 @@ ExecutionEngineImpl::HybridSearch(scheduler::SearchJobPtr search_job,
     search_job->vector_count() = nq;
     search_job->topk() = topk;
 
-    status = Search(search_ids, distances, search_job, hybrid);
+    auto status = Search(search_ids, distances, search_job, hybrid);
     if (!status.ok()) {
         return status;
     }
 
     return Status::OK();
 }
+
 Status
 ExecutionEngineImpl::ExecBinaryQuery(milvus::query::GeneralQueryPtr general_query, faiss::ConcurrentBitsetPtr& bitset,
                                      std::unordered_map<std::string, meta::hybrid::DataType>& attr_type,
                                      std::string& vector_placeholder) {
-    Status status = Status::OK();
-    if (general_query->leaf == nullptr) {
-        faiss::ConcurrentBitsetPtr left_bitset, right_bitset;
-        if (general_query->bin->left_query != nullptr) {
-            status = ExecBinaryQuery(general_query->bin->left_query, left_bitset, attr_type, vector_placeholder);
-            if (!status.ok()) {
-                return status;
-            }
-        }
-        if (general_query->bin->right_query != nullptr) {
-            status = ExecBinaryQuery(general_query->bin->right_query, right_bitset, attr_type, vector_placeholder);
-            if (!status.ok()) {
-                return status;
-            }
-        }
-
-        if (left_bitset == nullptr || right_bitset == nullptr) {
-            bitset = left_bitset != nullptr ? left_bitset : right_bitset;
-        } else {
-            switch (general_query->bin->relation) {
-                case milvus::query::QueryRelation::AND:
-                case milvus::query::QueryRelation::R1: {
-                    bitset = (*left_bitset) & right_bitset;
-                    break;
-                }
-                case milvus::query::QueryRelation::OR:
-                case milvus::query::QueryRelation::R2:
-                case milvus::query::QueryRelation::R3: {
-                    bitset = (*left_bitset) | right_bitset;
-                    break;
-                }
-                case milvus::query::QueryRelation::R4: {
-                    for (uint64_t i = 0; i < attr_->entity_count(); ++i) {
-                        if (left_bitset->test(i) && !right_bitset->test(i)) {
-                            bitset->set(i);
-                        }
-                    }
-                    break;
-                }
-                default: {
-                    std::string msg = "Invalid QueryRelation in RangeQuery";
-                    return Status{SERVER_INVALID_ARGUMENT, msg};
-                }
-            }
-        }
+    QueryEvaluatorPtr evaluator;
+    auto status = CompileQuery(general_query, attr_type, evaluator, vector_placeholder);
+    if (!status.ok()) {
         return status;
-    } else {
-        bitset = std::make_shared<faiss::ConcurrentBitset>(attr_index_->entity_count());
-        if (general_query->leaf->term_query != nullptr) {
-            // process attrs_data
-            status = ProcessTermQuery(bitset, general_query, attr_type);
-            if (!status.ok()) {
-                return status;
-            }
-#if 0
-            auto field_name = general_query->leaf->term_query->field_name;
-            auto type = attr_type.at(field_name);
-            if (attr_->attr_size().find(field_name) == attr_->attr_size().end()) {
-                return Status{SERVER_INVALID_BINARY_QUERY, "Attribute's field_name is wrong"};
-            }
-            auto size = attr_->attr_size().at(field_name);
-
-            switch (type) {
-                case DataType::INT8: {
-                    std::vector<int8_t> data;
-                    data.resize(size / sizeof(int8_t));
-                    memcpy(data.data(), attr_->attr_data().at(field_name).data(), size);
-
-                    std::vector<int8_t> term_value;
-                    auto term_size =
-                        general_query->leaf->term_query->field_value.size() * (sizeof(int8_t)) / sizeof(int8_t);
-                    term_value.resize(term_size);
-                    memcpy(term_value.data(), general_query->leaf->term_query->field_value.data(),
-                           term_size * sizeof(int8_t));
-
-                    for (uint64_t i = 0; i < data.size(); ++i) {
-                        bool value_in_term = false;
-                        for (auto query_value : term_value) {
-                            if (data[i] == query_value) {
-                                value_in_term = true;
-                                break;
-                            }
-                        }
-                        if (value_in_term) {
-                            bitset->set(i);
-                        }
-                    }
-                    break;
-                }
-                case DataType::INT16: {
-                    std::vector<int16_t> data;
-                    data.resize(size / sizeof(int16_t));
-                    memcpy(data.data(), attr_->attr_data().at(field_name).data(), size);
-                    std::vector<int16_t> term_value;
-                    auto term_size =
-                        general_query->leaf->term_query->field_value.size() * (sizeof(int8_t)) / sizeof(int16_t);
-                    term_value.resize(term_size);
-                    memcpy(term_value.data(), general_query->leaf->term_query->field_value.data(),
-                           term_size * sizeof(int16_t));
-
-                    for (uint64_t i = 0; i < data.size(); ++i) {
-                        bool value_in_term = false;
-                        for (auto query_value : term_value) {
-                            if (data[i] == query_value) {
-                                value_in_term = true;
-                                break;
-                            }
-                        }
-                        if (value_in_term) {
-                            bitset->set(i);
-                        }
-                    }
-                    break;
-                }
-                case DataType::INT32: {
-                    std::vector<int32_t> data;
-                    data.resize(size / sizeof(int32_t));
-                    memcpy(data.data(), attr_->attr_data().at(field_name).data(), size);
-
-                    std::vector<int32_t> term_value;
-                    auto term_size =
-                        general_query->leaf->term_query->field_value.size() * (sizeof(int8_t)) / sizeof(int32_t);
-                    term_value.resize(term_size);
-                    memcpy(term_value.data(), general_query->leaf->term_query->field_value.data(),
-                           term_size * sizeof(int32_t));
-
-                    for (uint64_t i = 0; i < data.size(); ++i) {
-                        bool value_in_term = false;
-                        for (auto query_value : term_value) {
-                            if (data[i] == query_value) {
-                                value_in_term = true;
-                                break;
-                            }
-                        }
-                        if (value_in_term) {
-                            bitset->set(i);
-                        }
-                    }
-                    break;
-                }
-                case DataType::INT64: {
-                    std::vector<int64_t> data;
-                    data.resize(size / sizeof(int64_t));
-                    memcpy(data.data(), attr_->attr_data().at(field_name).data(), size);
-
-                    std::vector<int64_t> term_value;
-                    auto term_size =
-                        general_query->leaf->term_query->field_value.size() * (sizeof(int8_t)) / sizeof(int64_t);
-                    term_value.resize(term_size);
-                    memcpy(term_value.data(), general_query->leaf->term_query->field_value.data(),
-                           term_size * sizeof(int64_t));
-
-                    for (uint64_t i = 0; i < data.size(); ++i) {
-                        bool value_in_term = false;
-                        for (auto query_value : term_value) {
-                            if (data[i] == query_value) {
-                                value_in_term = true;
-                                break;
-                            }
-                        }
-                        if (value_in_term) {
-                            bitset->set(i);
-                        }
-                    }
-                    break;
-                }
-                case DataType::FLOAT: {
-                    std::vector<float> data;
-                    data.resize(size / sizeof(float));
-                    memcpy(data.data(), attr_->attr_data().at(field_name).data(), size);
-
-                    std::vector<float> term_value;
-                    auto term_size =
-                        general_query->leaf->term_query->field_value.size() * (sizeof(int8_t)) / sizeof(float);
-                    term_value.resize(term_size);
-                    memcpy(term_value.data(), general_query->leaf->term_query->field_value.data(),
-                           term_size * sizeof(int64_t));
-
-                    for (uint64_t i = 0; i < data.size(); ++i) {
-                        bool value_in_term = false;
-                        for (auto query_value : term_value) {
-                            if (data[i] == query_value) {
-                                value_in_term = true;
-                                break;
-                            }
-                        }
-                        if (value_in_term) {
-                            bitset->set(i);
-                        }
-                    }
-                    break;
-                }
-                case DataType::DOUBLE: {
-                    std::vector<double> data;
-                    data.resize(size / sizeof(double));
-                    memcpy(data.data(), attr_->attr_data().at(field_name).data(), size);
-
-                    std::vector<double> term_value;
-                    auto term_size =
-                        general_query->leaf->term_query->field_value.size() * (sizeof(int8_t)) / sizeof(double);
-                    term_value.resize(term_size);
-                    memcpy(term_value.data(), general_query->leaf->term_query->field_value.data(),
-                           term_size * sizeof(double));
-
-                    for (uint64_t i = 0; i < data.size(); ++i) {
-                        bool value_in_term = false;
-                        for (auto query_value : term_value) {
-                            if (data[i] == query_value) {
-                                value_in_term = true;
-                                break;
-                            }
-                        }
-                        if (value_in_term) {
-                            bitset->set(i);
-                        }
-                    }
-                    break;
-                }
-                default:
-                    break;
-            }
-            return Status::OK();
-#endif
-        }
-        if (general_query->leaf->range_query != nullptr) {
-            auto field_name = general_query->leaf->range_query->field_name;
-            auto com_expr = general_query->leaf->range_query->compare_expr;
-            auto type = attr_type.at(field_name);
-            for (uint64_t j = 0; j < com_expr.size(); ++j) {
-                auto operand = com_expr[j].operand;
-                auto com_operator = com_expr[j].compare_operator;
-
-                status = ProcessRangeQuery(type, operand, com_operator, attr_index_->attr_index_data().at(field_name),
-                                           bitset);
-                if (!status.ok()) {
-                    return status;
-                }
-            }
-        }
-        if (general_query->leaf->vector_placeholder.size() > 0) {
-            // skip vector query
-            vector_placeholder = general_query->leaf->vector_placeholder;
-            bitset = nullptr;
+    }
+
+    bitset = nullptr;
+    if (evaluator != nullptr) {
+        if (attr_index_ == nullptr) {
+            return Status(DB_ERROR, "attribute indexes are not loaded");
         }
+        return evaluator->Evaluate(attr_index_->attr_index_data(), attr_index_->entity_count(), bitset);
     }
-    return status;
+    return Status::OK();
 }
 
 Status
@@ -1271,6 +1030,7 @@ ExecutionEngineImpl::Search(std::vector<int64_t>& ids, std::vector<float>& dista
     double span;
     uint64_t nq = job->nq();
     uint64_t topk = job->topk();
+    search_refined_ = false;
 
     const VectorsData& vectors = job->vectors();
 
@@ -1285,6 +1045,34 @@ ExecutionEngineImpl::Search(std::vector<int64_t>& ids, std::vector<float>& dista
         throw Exception(DB_ERROR, "Illegal search params");
     }
 
+    // fetch topk * refine_factor candidates, the exact distances decide the final topk. An IVF_PQ_FS index loaded
+    // with its raw vectors takes refine_factor itself and returns exact distances
+    bool self_refined = index_type_ == EngineType::FAISS_IVFPQFS &&
+                        GetIndexDataType(index_type_, index_params_) == codec::ExternalData::ExternalData_RawData;
+    int64_t refine_factor = 1;
+    if (conf.contains(knowhere::IndexParams::refine_factor) && IsRefinableIndexType(index_type_) && !self_refined &&
+        !vectors.float_data_.empty()) {
+        refine_factor = conf[knowhere::IndexParams::refine_factor].get<int64_t>();
+    }
+    int64_t candidate_k = topk * std::max(refine_factor, (int64_t)1);
+#ifdef MILVUS_GPU_VERSION
+    if (index_->index_mode() == knowhere::IndexMode::MODE_GPU) {
+        candidate_k = std::max((int64_t)topk, std::min(candidate_k, (int64_t)faiss::gpu::getMaxKSelection()));
+    }
+#endif
+    conf[knowhere::meta::TOPK] = candidate_k;
+
+    // candidates worse than the k-th result already merged from other segments cannot make it into the job's topk,
+    // the scan starts from these distances instead of empty heaps. The heaps of the index keep the smallest L2 and
+    // the largest IP, bounds of results merged in another order do not apply
+    std::vector<float> topk_bounds;
+    bool natural_ascending = (metric_type_ != MetricType::IP);
+    if (candidate_k == (int64_t)topk && !hybrid && index_->index_mode() == knowhere::IndexMode::MODE_CPU &&
+        !vectors.float_data_.empty() && job->GetTopkBounds(topk_bounds, natural_ascending) &&
+        topk_bounds.size() == nq) {
+        conf[knowhere::meta::TOPK_BOUNDS] = topk_bounds;
+    }
+
     if (hybrid) {
         HybridLoad();
     }
@@ -1302,7 +1090,19 @@ ExecutionEngineImpl::Search(std::vector<int64_t>& ids, std::vector<float>& dista
 
     LOG_ENGINE_DEBUG_ << LogOut("[%s][%ld] get %ld uids from index %s", "search", 0, index_->GetUids().size(),
                                 location_.c_str());
-    MapAndCopyResult(result, index_->GetUids(), nq, topk, distances.data(), ids.data());
+    if (candidate_k > (int64_t)topk) {
+        auto status = Refine(result, vectors.float_data_.data(), nq, candidate_k, topk, distances.data(), ids.data());
+        if (!status.ok()) {
+            if (hybrid) {
+                HybridUnset();
+            }
+            return status;
+        }
+        search_refined_ = true;
+        rc.RecordSection("refine " + std::to_string(nq * candidate_k));
+    } else {
+        MapAndCopyResult(result, index_->GetUids(), nq, topk, distances.data(), ids.data());
+    }
     span = rc.RecordSection("map uids " + std::to_string(nq * topk));
     job->time_stat().map_uids_time += span / 1000;
 
@@ -1313,6 +1113,102 @@ ExecutionEngineImpl::Search(std::vector<int64_t>& ids, std::vector<float>& dista
     return Status::OK();
 }
 
+Status
+ExecutionEngineImpl::Refine(const knowhere::DatasetPtr& result, const float* queries, int64_t nq, int64_t candidate_k,
+                            int64_t topk, float* distances, int64_t* labels) {
+    int64_t* res_ids = result->Get<int64_t*>(knowhere::meta::IDS);
+    float* res_dist = result->Get<float*>(knowhere::meta::DISTANCE);
+    free(res_dist);
+
+    int64_t dim = index_->Dim();
+    size_t row_bytes = sizeof(float) * dim;
+    auto& uids = index_->GetUids();
+    int64_t row_count = uids.size();
+
+    // only the rows of the candidates are read, they are dropped after the search instead of taking cache space
+    std::vector<int64_t> rows;
+    rows.reserve(nq * candidate_k);
+    for (int64_t i = 0; i < nq * candidate_k; i++) {
+        if (res_ids[i] >= 0 && res_ids[i] < row_count) {
+            rows.push_back(res_ids[i]);
+        }
+    }
+    std::sort(rows.begin(), rows.end());
+    rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+
+    std::vector<float> raw_data(rows.size() * dim);
+    std::vector<bool> loaded(rows.size(), false);
+    {
+        std::string segment_dir;
+        utils::GetParentPath(location_, segment_dir);
+        // the candidates are offsets of the loaded index, the vectors must not be read halfway through a rewrite
+        auto segment_lock = segment::GetSegmentLock(segment_dir);
+        std::lock_guard<std::mutex> lock(*segment_lock);
+        segment::SegmentReader segment_reader(segment_dir);
+        std::vector<uint8_t> data;
+        for (size_t begin = 0, end = 0; begin < rows.size(); begin = end) {
+            for (end = begin + 1; end < rows.size(); ++end) {
+                if ((rows[end] - rows[end - 1] - 1) * row_bytes > REFINE_READ_GAP) {
+                    break;
+                }
+            }
+            auto status = segment_reader.LoadVectors(rows[begin] * row_bytes,
+                                                     (rows[end - 1] - rows[begin] + 1) * row_bytes, data);
+            if (!status.ok()) {
+                free(res_ids);
+                return status;
+            }
+            for (size_t r = begin; r < end; ++r) {
+                size_t pos = (rows[r] - rows[begin]) * row_bytes;
+                if (pos + row_bytes <= data.size()) {
+                    memcpy(raw_data.data() + r * dim, data.data() + pos, row_bytes);
+                    loaded[r] = true;
+                }
+            }
+        }
+    }
+
+    bool is_ip = (metric_type_ == MetricType::IP);
+    float missing = is_ip ? -std::numeric_limits<float>::max() : std::numeric_limits<float>::max();
+
+    using Candidate = std::pair<float, int64_t>;
+    auto compare = [is_ip](const Candidate& a, const Candidate& b) {
+        return is_ip ? a.first > b.first : a.first < b.first;
+    };
+
+#pragma omp parallel for
+    for (int64_t i = 0; i < nq; i++) {
+        const float* query = queries + i * dim;
+        std::vector<Candidate> candidates;
+        candidates.reserve(candidate_k);
+        for (int64_t j = 0; j < candidate_k; j++) {
+            int64_t offset = res_ids[i * candidate_k + j];
+            auto iter = std::lower_bound(rows.begin(), rows.end(), offset);
+            if (iter == rows.end() || *iter != offset || !loaded[iter - rows.begin()]) {
+                continue;
+            }
+            const float* raw = raw_data.data() + (iter - rows.begin()) * dim;
+            float dis = is_ip ? faiss::fvec_inner_product(query, raw, dim) : faiss::fvec_L2sqr(query, raw, dim);
+            candidates.emplace_back(dis, offset);
+        }
+
+        int64_t found = std::min((int64_t)candidates.size(), topk);
+        std::partial_sort(candidates.begin(), candidates.begin() + found, candidates.end(), compare);
+        for (int64_t j = 0; j < topk; j++) {
+            if (j < found) {
+                distances[i * topk + j] = candidates[j].first;
+                labels[i * topk + j] = uids[candidates[j].second];
+            } else {
+                distances[i * topk + j] = missing;
+                labels[i * topk + j] = -1;
+            }
+        }
+    }
+
+    free(res_ids);
+    return Status::OK();
+}
+
 #if 0
 Status
 ExecutionEngineImpl::GetVectorByID(const int64_t id, float* vector, bool hybrid) {
@@ -1367,6 +1263,111 @@ ExecutionEngineImpl::GetVectorByID(const int64_t id, uint8_t* vector, bool hybri
 }
 #endif
 
+Status
+ExecutionEngineImpl::MoveListsToDisk(const knowhere::VecIndexPtr& index, const std::string& location,
+                                     const uint8_t* raw_data) {
+    auto lists_path = utils::GetDiskListsPath(location);
+    try {
+        if (auto ivf = std::dynamic_pointer_cast<knowhere::IVF>(index)) {
+            ivf->MoveListsToDisk(lists_path, DiskCacheSize(index_params_));
+        } else if (auto ivf_nm = std::dynamic_pointer_cast<knowhere::IVF_NM>(index)) {
+            ivf_nm->MoveListsToDisk(lists_path, DiskCacheSize(index_params_), raw_data);
+        } else {
+            std::string msg = "Index type " + index->index_type() + " does not support disk mode";
+            LOG_ENGINE_ERROR_ << msg;
+            return Status(DB_ERROR, msg);
+        }
+    } catch (std::exception& e) {
+        LOG_ENGINE_ERROR_ << e.what();
+        return Status(DB_ERROR, e.what());
+    }
+
+    LOG_ENGINE_DEBUG_ << "Inverted lists of " << location << " written to " << lists_path;
+    return Status::OK();
+}
+
+Status
+ExecutionEngineImpl::OpenListsOnDisk() {
+    auto lists_path = utils::GetDiskListsPath(location_);
+    auto cache_size = DiskCacheSize(index_params_);
+    if (auto ivf = std::dynamic_pointer_cast<knowhere::IVF>(index_)) {
+        ivf->OpenListsOnDisk(lists_path, cache_size);
+    } else if (auto ivf_nm = std::dynamic_pointer_cast<knowhere::IVF_NM>(index_)) {
+        ivf_nm->OpenListsOnDisk(lists_path, cache_size);
+    } else {
+        std::string msg = "Index type " + index_->index_type() + " does not support disk mode";
+        LOG_ENGINE_ERROR_ << msg;
+        return Status(DB_ERROR, msg);
+    }
+
+    LOG_ENGINE_DEBUG_ << "Inverted lists of " << location_ << " served from " << lists_path << ", "
+                      << cache_size / MB << "MB of them cached";
+    return Status::OK();
+}
+
+Status
+ExecutionEngineImpl::ArrangeInListOrder(knowhere::IVF_NM& index, std::vector<segment::doc_id_t>& uids,
+                                        faiss::ConcurrentBitsetPtr& blacklist) {
+    std::string segment_dir;
+    utils::GetParentPath(location_, segment_dir);
+    auto segment_lock = segment::GetSegmentLock(segment_dir);
+    std::lock_guard<std::mutex> lock(*segment_lock);
+
+    segment::SegmentReader segment_reader(segment_dir);
+    STATUS_CHECK(segment_reader.Load());
+    segment::SegmentPtr segment_ptr;
+    segment_reader.GetSegment(segment_ptr);
+    auto& vectors = segment_ptr->vectors_ptr_;
+
+    // attribute indexes address entities by offset too, they are not rewritten here
+    if (!segment_ptr->attrs_ptr_->attrs.empty() || vectors->GetDataType() != segment::VectorsDataType::FLOAT ||
+        vectors->GetCount() != uids.size()) {
+        LOG_ENGINE_DEBUG_ << "Segment " << segment_dir << " is kept in insertion order";
+        return Status::OK();
+    }
+
+    std::vector<int64_t> order;
+    index.GetListOrder(order);
+    index.RenumberInListOrder();
+
+    std::vector<segment::offset_t> new_offset(order.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        new_offset[order[i]] = i;
+    }
+
+    vectors->Rearrange(order);
+    std::vector<segment::offset_t> deleted_docs;
+    for (auto offset : segment_ptr->deleted_docs_ptr_->GetDeletedDocs()) {
+        deleted_docs.push_back(new_offset[offset]);
+    }
+
+    // every file is written aside and renamed into place, readers of the segment wait on its lock
+    segment::SegmentWriter segment_writer(segment_dir);
+    STATUS_CHECK(segment_writer.RewriteVectors(vectors));
+    STATUS_CHECK(segment_writer.RewriteDeletedDocs(std::make_shared<segment::DeletedDocs>(deleted_docs)));
+
+    // the raw file is searched by offset as well, drop what was cached in the old order
+    cache::CpuCacheMgr::GetInstance()->EraseItem(location_);
+
+    std::vector<segment::doc_id_t> new_uids(uids.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        new_uids[i] = uids[order[i]];
+    }
+    uids.swap(new_uids);
+    if (blacklist != nullptr) {
+        auto new_blacklist = std::make_shared<faiss::ConcurrentBitset>(blacklist->capacity());
+        for (size_t i = 0; i < order.size(); ++i) {
+            if (blacklist->test(order[i])) {
+                new_blacklist->set(i);
+            }
+        }
+        blacklist = new_blacklist;
+    }
+
+    LOG_ENGINE_DEBUG_ << "Segment " << segment_dir << " rewritten in the inverted list order of " << location_;
+    return Status::OK();
+}
+
 Status
 ExecutionEngineImpl::Cache() {
     auto cpu_cache_mgr = milvus::cache::CpuCacheMgr::GetInstance();
@@ -1377,9 +1378,17 @@ ExecutionEngineImpl::Cache() {
 
 Status
 ExecutionEngineImpl::AttrCache() {
+    if (attr_index_ == nullptr) {
+        return Status::OK();
+    }
+
+    std::string segment_dir;
+    utils::GetParentPath(location_, segment_dir);
     auto cpu_cache_mgr = milvus::cache::CpuCacheMgr::GetInstance();
-    cache::DataObjPtr obj = std::static_pointer_cast<cache::DataObj>(attr_);
-    cpu_cache_mgr->InsertItem(attr_location_, obj);
+    for (auto& pair : attr_index_->attr_index_data()) {
+        cache::DataObjPtr obj = std::static_pointer_cast<cache::DataObj>(pair.second);
+        cpu_cache_mgr->InsertItem(AttrIndexCacheKey(segment_dir, pair.first), obj);
+    }
     return Status::OK();
 }
 
@@ -23,6 +23,7 @@
 #include "db/attr/Attr.h"
 #include "db/attr/AttrIndex.h"
 #include "knowhere/index/vector_index/VecIndex.h"
+#include "knowhere/index/vector_offset_index/IndexIVF_NM.h"
 
 namespace milvus {
 namespace engine {
@@ -57,7 +58,7 @@ class ExecutionEngineImpl : public ExecutionEngine {
     Load(bool to_cache) override;
 
     Status
-    LoadAttr(bool to_cache) override;
+    LoadAttr(const std::vector<std::string>& field_names, bool to_cache) override;
 
     Status
     CopyToGpu(uint64_t device_id, bool hybrid = false) override;
@@ -88,6 +89,11 @@ class ExecutionEngineImpl : public ExecutionEngine {
     Status
     Search(std::vector<int64_t>& ids, std::vector<float>& distances, scheduler::SearchJobPtr job, bool hybrid) override;
 
+    bool
+    SearchRefined() const override {
+        return search_refined_;
+    }
+
     ExecutionEnginePtr
     BuildIndex(const std::string& location, EngineType engine_type) override;
 
@@ -128,13 +134,23 @@ class ExecutionEngineImpl : public ExecutionEngine {
     Load(const std::string& location);
 
     Status
-    ProcessTermQuery(faiss::ConcurrentBitsetPtr& bitset, query::GeneralQueryPtr general_query,
-                     std::unordered_map<std::string, meta::hybrid::DataType>& attr_type);
+    Refine(const knowhere::DatasetPtr& result, const float* queries, int64_t nq, int64_t candidate_k, int64_t topk,
+           float* distances, int64_t* labels);
+
+    // write the inverted lists of a disk mode index built for location next to it, raw_data are the vectors
+    // the index was built from
+    Status
+    MoveListsToDisk(const knowhere::VecIndexPtr& index, const std::string& location, const uint8_t* raw_data);
+
+    // serve the inverted lists of the loaded disk mode index from the file written when it was built
+    Status
+    OpenListsOnDisk();
 
+    // rewrite the segment so that every inverted list of the index covers a contiguous range of offsets,
+    // uids and blacklist are those of the built index and are rearranged the same way
     Status
-    ProcessRangeQuery(const meta::hybrid::DataType data_type, const std::string& operand,
-                      const query::CompareOperator& com_operator, knowhere::IndexPtr& index_ptr,
-                      faiss::ConcurrentBitsetPtr& bitset);
+    ArrangeInListOrder(knowhere::IVF_NM& index, std::vector<segment::doc_id_t>& uids,
+                       faiss::ConcurrentBitsetPtr& blacklist);
 
     void
     HybridLoad() const;
@@ -157,6 +173,7 @@ class ExecutionEngineImpl : public ExecutionEngine {
 
     milvus::json index_params_;
     int64_t gpu_num_ = 0;
+    bool search_refined_ = false;
 };
 
 }  // namespace engine
@@ -0,0 +1,486 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "db/engine/QueryEvaluator.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "knowhere/index/structured_index/StructuredIndex.h"
+#include "knowhere/index/structured_index/StructuredIndexBitmap.h"
+#include "knowhere/index/structured_index/StructuredIndexSort.h"
+
+namespace milvus {
+namespace engine {
+
+namespace {
+
+// the attribute index of a field is built for the field's type, one of the two structured index kinds
+template <typename T>
+knowhere::StructuredIndex<T>*
+CastStructuredIndex(knowhere::Index* index) {
+    auto& type = typeid(*index);
+    if (type == typeid(knowhere::StructuredIndexSort<T>) || type == typeid(knowhere::StructuredIndexBitmap<T>)) {
+        return static_cast<knowhere::StructuredIndex<T>*>(index);
+    }
+    return nullptr;
+}
+
+// an integral operand outside of the field type is clamped to it, clamped is 1 if it was above the type and -1 if
+// it was below
+template <typename T>
+Status
+ParseOperand(const std::string& operand, T& value, int& clamped) {
+    clamped = 0;
+    if (std::is_integral<T>::value) {
+        char* end = nullptr;
+        errno = 0;
+        int64_t parsed = std::strtoll(operand.c_str(), &end, 10);
+        if (end == operand.c_str()) {
+            return Status{SERVER_INVALID_DSL_PARAMETER, "Invalid range operand: " + operand};
+        }
+        if (parsed > static_cast<int64_t>(std::numeric_limits<T>::max()) ||
+            (errno == ERANGE && parsed == std::numeric_limits<int64_t>::max())) {
+            clamped = 1;
+            parsed = std::numeric_limits<T>::max();
+        } else if (parsed < static_cast<int64_t>(std::numeric_limits<T>::lowest()) ||
+                   (errno == ERANGE && parsed == std::numeric_limits<int64_t>::lowest())) {
+            clamped = -1;
+            parsed = std::numeric_limits<T>::lowest();
+        }
+        value = static_cast<T>(parsed);
+    } else {
+        std::istringstream iss(operand);
+        if (!(iss >> value)) {
+            return Status{SERVER_INVALID_DSL_PARAMETER, "Invalid range operand: " + operand};
+        }
+    }
+    return Status::OK();
+}
+
+template <typename T>
+class TermPredicate {
+ public:
+    explicit TermPredicate(std::vector<T> values) : values_(std::move(values)) {
+    }
+
+    Status
+    operator()(knowhere::Index* index, int64_t entity_count, faiss::ConcurrentBitsetPtr& bitset) const {
+        auto typed_index = CastStructuredIndex<T>(index);
+        if (typed_index == nullptr) {
+            return Status{SERVER_INVALID_ARGUMENT, "Attribute's type is wrong"};
+        }
+        bitset = typed_index->In(values_.size(), values_.data());
+        return Status::OK();
+    }
+
+ private:
+    std::vector<T> values_;
+};
+
+// compare expressions of one field, lower and upper bounds are merged so that a closed range is a single scan
+template <typename T>
+class RangePredicate {
+ public:
+
+    void
+    AddCompare(query::CompareOperator op, T value) {
+        switch (op) {
+            case query::CompareOperator::GT:
+            case query::CompareOperator::GTE: {
+                bool inclusive = (op == query::CompareOperator::GTE);
+                if (!has_lower_ || value > lower_ || (value == lower_ && !inclusive)) {
+                    has_lower_ = true;
+                    lower_ = value;
+                    lower_inclusive_ = inclusive;
+                }
+                break;
+            }
+            case query::CompareOperator::LT:
+            case query::CompareOperator::LTE: {
+                bool inclusive = (op == query::CompareOperator::LTE);
+                if (!has_upper_ || value < upper_ || (value == upper_ && !inclusive)) {
+                    has_upper_ = true;
+                    upper_ = value;
+                    upper_inclusive_ = inclusive;
+                }
+                break;
+            }
+            case query::CompareOperator::EQ:
+                equal_values_.push_back(value);
+                break;
+            case query::CompareOperator::NE:
+                not_equal_values_.push_back(value);
+                break;
+            default:
+                break;
+        }
+    }
+
+    Status
+    operator()(knowhere::Index* attr_index, int64_t entity_count, faiss::ConcurrentBitsetPtr& bitset) const {
+        auto index = CastStructuredIndex<T>(attr_index);
+        if (index == nullptr) {
+            return Status{SERVER_INVALID_ARGUMENT, "Attribute's type is wrong"};
+        }
+
+        bitset = nullptr;
+        if (has_lower_ && has_upper_ &&
+            (lower_ > upper_ || (lower_ == upper_ && !(lower_inclusive_ && upper_inclusive_)))) {
+            bitset = std::make_shared<faiss::ConcurrentBitset>(entity_count);
+            return Status::OK();
+        }
+        if (has_lower_ && has_upper_) {
+            bitset = index->Range(lower_, lower_inclusive_, upper_, upper_inclusive_);
+        } else if (has_lower_) {
+            bitset = index->Range(lower_, lower_inclusive_ ? knowhere::OperatorType::GE : knowhere::OperatorType::GT);
+        } else if (has_upper_) {
+            bitset = index->Range(upper_, upper_inclusive_ ? knowhere::OperatorType::LE : knowhere::OperatorType::LT);
+        }
+        for (auto& value : equal_values_) {
+            Intersect(bitset, index->In(1, &value));
+        }
+        for (auto& value : not_equal_values_) {
+            Intersect(bitset, index->NotIn(1, &value));
+        }
+        if (bitset == nullptr) {
+            bitset = std::make_shared<faiss::ConcurrentBitset>(entity_count);
+        }
+        return Status::OK();
+    }
+
+ private:
+    static void
+    Intersect(faiss::ConcurrentBitsetPtr& bitset, const faiss::ConcurrentBitsetPtr& other) {
+        if (bitset == nullptr) {
+            bitset = other;
+        } else {
+            (*bitset) &= (*other);
+        }
+    }
+
+ private:
+    bool has_lower_ = false;
+    bool lower_inclusive_ = false;
+    T lower_ = T();
+    bool has_upper_ = false;
+    bool upper_inclusive_ = false;
+    T upper_ = T();
+    std::vector<T> equal_values_;
+    std::vector<T> not_equal_values_;
+};
+
+template <typename T>
+QueryEvaluator::Predicate
+CompileTerm(const query::TermQueryPtr& term_query) {
+    std::vector<T> values(term_query->field_value.size() / sizeof(T));
+    memcpy(values.data(), term_query->field_value.data(), values.size() * sizeof(T));
+    return TermPredicate<T>(std::move(values));
+}
+
+template <typename T>
+Status
+CompileRange(const query::RangeQueryPtr& range_query, QueryEvaluator::Predicate& predicate) {
+    RangePredicate<T> range_predicate;
+    for (auto& expr : range_query->compare_expr) {
+        T value;
+        int clamped = 0;
+        auto status = ParseOperand(expr.operand, value, clamped);
+        if (!status.ok()) {
+            return status;
+        }
+
+        // a bound outside of the type becomes the type's limit: "< 300" on INT8 keeps 127, "> 300" and "== 300" keep
+        // nothing, "!= 300" keeps everything
+        auto op = expr.compare_operator;
+        if (clamped != 0) {
+            bool above = (clamped > 0);
+            switch (op) {
+                case query::CompareOperator::GT:
+                case query::CompareOperator::GTE:
+                    op = above ? query::CompareOperator::GT : query::CompareOperator::GTE;
+                    break;
+                case query::CompareOperator::LT:
+                case query::CompareOperator::LTE:
+                    op = above ? query::CompareOperator::LTE : query::CompareOperator::LT;
+                    break;
+                case query::CompareOperator::EQ:
+                    op = above ? query::CompareOperator::GT : query::CompareOperator::LT;
+                    break;
+                case query::CompareOperator::NE:
+                    op = above ? query::CompareOperator::LTE : query::CompareOperator::GTE;
+                    break;
+                default:
+                    break;
+            }
+        }
+        range_predicate.AddCompare(op, value);
+    }
+    predicate = range_predicate;
+    return Status::OK();
+}
+
+Status
+GetFieldType(const std::unordered_map<std::string, meta::hybrid::DataType>& attr_type, const std::string& field_name,
+             meta::hybrid::DataType& type) {
+    auto iter = attr_type.find(field_name);
+    if (iter == attr_type.end()) {
+        return Status{SERVER_INVALID_BINARY_QUERY, "Attribute's field_name is wrong: " + field_name};
+    }
+    type = iter->second;
+    return Status::OK();
+}
+
+Status
+CompileTermQuery(const query::TermQueryPtr& term_query,
+                 const std::unordered_map<std::string, meta::hybrid::DataType>& attr_type,
+                 QueryEvaluator::Predicate& predicate) {
+    meta::hybrid::DataType type;
+    auto status = GetFieldType(attr_type, term_query->field_name, type);
+    if (!status.ok()) {
+        return status;
+    }
+    switch (type) {
+        case meta::hybrid::DataType::INT8:
+            predicate = CompileTerm<int8_t>(term_query);
+            break;
+        case meta::hybrid::DataType::INT16:
+            predicate = CompileTerm<int16_t>(term_query);
+            break;
+        case meta::hybrid::DataType::INT32:
+            predicate = CompileTerm<int32_t>(term_query);
+            break;
+        case meta::hybrid::DataType::INT64:
+            predicate = CompileTerm<int64_t>(term_query);
+            break;
+        case meta::hybrid::DataType::FLOAT:
+            predicate = CompileTerm<float>(term_query);
+            break;
+        case meta::hybrid::DataType::DOUBLE:
+            predicate = CompileTerm<double>(term_query);
+            break;
+        default:
+            return Status{SERVER_INVALID_BINARY_QUERY, "Attribute's type is wrong"};
+    }
+    return Status::OK();
+}
+
+Status
+CompileRangeQuery(const query::RangeQueryPtr& range_query,
+                  const std::unordered_map<std::string, meta::hybrid::DataType>& attr_type,
+                  QueryEvaluator::Predicate& predicate) {
+    meta::hybrid::DataType type;
+    auto status = GetFieldType(attr_type, range_query->field_name, type);
+    if (!status.ok()) {
+        return status;
+    }
+    switch (type) {
+        case meta::hybrid::DataType::INT8:
+            return CompileRange<int8_t>(range_query, predicate);
+        case meta::hybrid::DataType::INT16:
+            return CompileRange<int16_t>(range_query, predicate);
+        case meta::hybrid::DataType::INT32:
+            return CompileRange<int32_t>(range_query, predicate);
+        case meta::hybrid::DataType::INT64:
+            return CompileRange<int64_t>(range_query, predicate);
+        case meta::hybrid::DataType::FLOAT:
+            return CompileRange<float>(range_query, predicate);
+        case meta::hybrid::DataType::DOUBLE:
+            return CompileRange<double>(range_query, predicate);
+        default:
+            return Status{SERVER_INVALID_BINARY_QUERY, "Attribute's type is wrong"};
+    }
+}
+
+// append the program of general_query, pushed tells whether it leaves a bitset on the stack
+Status
+AppendQuery(const query::GeneralQueryPtr& general_query,
+            const std::unordered_map<std::string, meta::hybrid::DataType>& attr_type, QueryEvaluator& evaluator,
+            std::string& vector_placeholder, bool& pushed) {
+    pushed = false;
+    if (general_query == nullptr) {
+        return Status::OK();
+    }
+
+    Status status;
+    if (general_query->leaf != nullptr) {
+        auto& leaf = general_query->leaf;
+        QueryEvaluator::Predicate predicate;
+        std::string field_name;
+        if (leaf->term_query != nullptr) {
+            status = CompileTermQuery(leaf->term_query, attr_type, predicate);
+            if (!status.ok()) {
+                return status;
+            }
+            field_name = leaf->term_query->field_name;
+        }
+        if (leaf->range_query != nullptr) {
+            status = CompileRangeQuery(leaf->range_query, attr_type, predicate);
+            if (!status.ok()) {
+                return status;
+            }
+            field_name = leaf->range_query->field_name;
+        }
+        if (!leaf->vector_placeholder.empty()) {
+            vector_placeholder = leaf->vector_placeholder;
+        } else if (predicate) {
+            evaluator.AddPredicate(field_name, std::move(predicate));
+            pushed = true;
+        }
+        return Status::OK();
+    }
+
+    if (general_query->bin == nullptr) {
+        return Status::OK();
+    }
+
+    bool left_pushed = false, right_pushed = false;
+    status = AppendQuery(general_query->bin->left_query, attr_type, evaluator, vector_placeholder, left_pushed);
+    if (!status.ok()) {
+        return status;
+    }
+    status = AppendQuery(general_query->bin->right_query, attr_type, evaluator, vector_placeholder, right_pushed);
+    if (!status.ok()) {
+        return status;
+    }
+
+    // a side without attribute predicate does not filter
+    pushed = left_pushed || right_pushed;
+    if (!left_pushed || !right_pushed) {
+        return Status::OK();
+    }
+
+    switch (general_query->bin->relation) {
+        case query::QueryRelation::AND:
+        case query::QueryRelation::R1:
+        case query::QueryRelation::OR:
+        case query::QueryRelation::R2:
+        case query::QueryRelation::R3:
+        case query::QueryRelation::R4:
+            evaluator.AddRelation(general_query->bin->relation);
+            return Status::OK();
+        default:
+            return Status{SERVER_INVALID_ARGUMENT, "Invalid QueryRelation in RangeQuery"};
+    }
+}
+
+}  // namespace
+
+void
+QueryEvaluator::AddPredicate(const std::string& field_name, Predicate predicate) {
+    steps_.push_back(Step{field_name, std::move(predicate), query::QueryRelation::AND});
+}
+
+void
+QueryEvaluator::AddRelation(query::QueryRelation relation) {
+    steps_.push_back(Step{std::string(), Predicate(), relation});
+}
+
+Status
+QueryEvaluator::Evaluate(const AttrIndexMap& attr_indexes, int64_t entity_count,
+                         faiss::ConcurrentBitsetPtr& bitset) const {
+    std::vector<faiss::ConcurrentBitsetPtr> stack;
+    for (auto& step : steps_) {
+        if (step.predicate) {
+            auto iter = attr_indexes.find(step.field_name);
+            if (iter == attr_indexes.end()) {
+                return Status{SERVER_INVALID_BINARY_QUERY, "Attribute's field_name is wrong"};
+            }
+            faiss::ConcurrentBitsetPtr result;
+            auto status = step.predicate(iter->second.get(), entity_count, result);
+            if (!status.ok()) {
+                return status;
+            }
+            stack.emplace_back(std::move(result));
+            continue;
+        }
+
+        auto right = std::move(stack.back());
+        stack.pop_back();
+        auto& left = stack.back();
+        switch (step.relation) {
+            case query::QueryRelation::AND:
+            case query::QueryRelation::R1: {
+                left = (*left) & right;
+                break;
+            }
+            case query::QueryRelation::OR:
+            case query::QueryRelation::R2:
+            case query::QueryRelation::R3: {
+                left = (*left) | right;
+                break;
+            }
+            case query::QueryRelation::R4: {
+                auto difference = std::make_shared<faiss::ConcurrentBitset>(entity_count);
+                for (int64_t i = 0; i < entity_count; ++i) {
+                    if (left->test(i) && !right->test(i)) {
+                        difference->set(i);
+                    }
+                }
+                left = difference;
+                break;
+            }
+            default:
+                return Status{SERVER_INVALID_ARGUMENT, "Invalid QueryRelation in RangeQuery"};
+        }
+    }
+
+    bitset = stack.empty() ? nullptr : stack.back();
+    return Status::OK();
+}
+
+Status
+CompileQuery(const query::GeneralQueryPtr& general_query,
+             const std::unordered_map<std::string, meta::hybrid::DataType>& attr_type, QueryEvaluatorPtr& evaluator,
+             std::string& vector_placeholder) {
+    auto program = std::make_shared<QueryEvaluator>();
+    bool pushed = false;
+    auto status = AppendQuery(general_query, attr_type, *program, vector_placeholder, pushed);
+    evaluator = (status.ok() && pushed) ? program : nullptr;
+    return status;
+}
+
+void
+CollectQueryFields(const query::GeneralQueryPtr& general_query, std::vector<std::string>& field_names) {
+    if (general_query == nullptr) {
+        return;
+    }
+
+    auto add_field = [&](const std::string& field_name) {
+        if (std::find(field_names.begin(), field_names.end(), field_name) == field_names.end()) {
+            field_names.push_back(field_name);
+        }
+    };
+    if (general_query->leaf != nullptr) {
+        if (general_query->leaf->term_query != nullptr) {
+            add_field(general_query->leaf->term_query->field_name);
+        }
+        if (general_query->leaf->range_query != nullptr) {
+            add_field(general_query->leaf->range_query->field_name);
+        }
+        return;
+    }
+    if (general_query->bin != nullptr) {
+        CollectQueryFields(general_query->bin->left_query, field_names);
+        CollectQueryFields(general_query->bin->right_query, field_names);
+    }
+}
+
+}  // namespace engine
+}  // namespace milvus
@@ -0,0 +1,74 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <faiss/utils/ConcurrentBitset.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "db/meta/MetaTypes.h"
+#include "knowhere/index/Index.h"
+#include "query/GeneralQuery.h"
+#include "utils/Status.h"
+
+namespace milvus {
+namespace engine {
+
+using AttrIndexMap = std::unordered_map<std::string, knowhere::IndexPtr>;
+
+// Attribute predicates of a GeneralQuery, compiled once per query into a postfix program: each predicate is bound
+// to the structured index type of its field, with the term values and range operands already converted to it.
+// Evaluate runs the program on the attribute indexes of one segment.
+class QueryEvaluator {
+ public:
+    using Predicate =
+        std::function<Status(knowhere::Index* index, int64_t entity_count, faiss::ConcurrentBitsetPtr& bitset)>;
+
+    // push the bitset of a predicate on the attribute index of field_name
+    void
+    AddPredicate(const std::string& field_name, Predicate predicate);
+
+    // replace the two bitsets on top by their combination
+    void
+    AddRelation(query::QueryRelation relation);
+
+    Status
+    Evaluate(const AttrIndexMap& attr_indexes, int64_t entity_count, faiss::ConcurrentBitsetPtr& bitset) const;
+
+ private:
+    struct Step {
+        std::string field_name;
+        Predicate predicate;  // empty for a relation
+        query::QueryRelation relation;
+    };
+
+    std::vector<Step> steps_;
+};
+
+using QueryEvaluatorPtr = std::shared_ptr<QueryEvaluator>;
+
+// evaluator is nullptr if the query has no attribute predicate
+Status
+CompileQuery(const query::GeneralQueryPtr& general_query,
+             const std::unordered_map<std::string, meta::hybrid::DataType>& attr_type, QueryEvaluatorPtr& evaluator,
+             std::string& vector_placeholder);
+
+// names of the attribute fields the predicates of the query read, without duplicates
+void
+CollectQueryFields(const query::GeneralQueryPtr& general_query, std::vector<std::string>& field_names);
+
+}  // namespace engine
+}  // namespace milvus
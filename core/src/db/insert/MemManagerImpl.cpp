@@ -12,7 +12,9 @@
 #include "db/insert/MemManagerImpl.h"
 
 #include <fiu-local.h>
+#include <future>
 #include <thread>
+#include <utility>
 
 #include "VectorSource.h"
 #include "db/Constants.h"
@@ -35,13 +37,8 @@ MemManagerImpl::GetMemByTable(const std::string& collection_id) {
 Status
 MemManagerImpl::InsertVectors(const std::string& collection_id, int64_t length, const IDNumber* vector_ids, int64_t dim,
                               const float* vectors, uint64_t lsn) {
-    VectorsData vectors_data;
-    vectors_data.vector_count_ = length;
-    vectors_data.float_data_.resize(length * dim);
-    memcpy(vectors_data.float_data_.data(), vectors, length * dim * sizeof(float));
-    vectors_data.id_array_.resize(length);
-    memcpy(vectors_data.id_array_.data(), vector_ids, length * sizeof(IDNumber));
-    VectorSourcePtr source = std::make_shared<VectorSource>(vectors_data);
+    // the source is consumed before returning, so it can read the caller's buffers directly
+    VectorSourcePtr source = std::make_shared<VectorSource>(length, vector_ids, vectors);
 
     std::unique_lock<std::mutex> lock(mutex_);
 
@@ -51,13 +48,8 @@ MemManagerImpl::InsertVectors(const std::string& collection_id, int64_t length,
 Status
 MemManagerImpl::InsertVectors(const std::string& collection_id, int64_t length, const IDNumber* vector_ids, int64_t dim,
                               const uint8_t* vectors, uint64_t lsn) {
-    VectorsData vectors_data;
-    vectors_data.vector_count_ = length;
-    vectors_data.binary_data_.resize(length * dim);
-    memcpy(vectors_data.binary_data_.data(), vectors, length * dim * sizeof(uint8_t));
-    vectors_data.id_array_.resize(length);
-    memcpy(vectors_data.id_array_.data(), vector_ids, length * sizeof(IDNumber));
-    VectorSourcePtr source = std::make_shared<VectorSource>(vectors_data);
+    // the source is consumed before returning, so it can read the caller's buffers directly
+    VectorSourcePtr source = std::make_shared<VectorSource>(length, vector_ids, vectors);
 
     std::unique_lock<std::mutex> lock(mutex_);
 
@@ -151,17 +143,7 @@ MemManagerImpl::Flush(const std::string& collection_id) {
 
     std::unique_lock<std::mutex> lock(serialization_mtx_);
     auto max_lsn = GetMaxLSN(temp_immutable_list);
-    for (auto& mem : temp_immutable_list) {
-        LOG_ENGINE_DEBUG_ << "Flushing collection: " << mem->GetTableId();
-        auto status = mem->Serialize(max_lsn, true);
-        if (!status.ok()) {
-            LOG_ENGINE_ERROR_ << "Flush collection " << mem->GetTableId() << " failed";
-            return status;
-        }
-        LOG_ENGINE_DEBUG_ << "Flushed collection: " << mem->GetTableId();
-    }
-
-    return Status::OK();
+    return SerializeMemList(temp_immutable_list, max_lsn);
 }
 
 Status
@@ -177,15 +159,12 @@ MemManagerImpl::Flush(std::set<std::string>& collection_ids) {
     std::unique_lock<std::mutex> lock(serialization_mtx_);
     collection_ids.clear();
     auto max_lsn = GetMaxLSN(temp_immutable_list);
+    auto status = SerializeMemList(temp_immutable_list, max_lsn);
+    if (!status.ok()) {
+        return status;
+    }
     for (auto& mem : temp_immutable_list) {
-        LOG_ENGINE_DEBUG_ << "Flushing collection: " << mem->GetTableId();
-        auto status = mem->Serialize(max_lsn, true);
-        if (!status.ok()) {
-            LOG_ENGINE_ERROR_ << "Flush collection " << mem->GetTableId() << " failed";
-            return status;
-        }
         collection_ids.insert(mem->GetTableId());
-        LOG_ENGINE_DEBUG_ << "Flushed collection: " << mem->GetTableId();
     }
 
     meta_->SetGlobalLastLSN(max_lsn);
@@ -286,6 +265,46 @@ MemManagerImpl::GetMaxLSN(const MemList& tables) {
     return max_lsn;
 }
 
+Status
+MemManagerImpl::SerializeMemList(const MemList& mem_list, uint64_t max_lsn) {
+    // a collection may appear more than once, its mem tables are serialized in order by the same task
+    std::map<std::string, MemList> collection_mems;
+    for (auto& mem : mem_list) {
+        collection_mems[mem->GetTableId()].push_back(mem);
+    }
+
+    auto serialize = [max_lsn](const MemList& mems) -> Status {
+        for (auto& mem : mems) {
+            LOG_ENGINE_DEBUG_ << "Flushing collection: " << mem->GetTableId();
+            auto status = mem->Serialize(max_lsn, true);
+            if (!status.ok()) {
+                LOG_ENGINE_ERROR_ << "Flush collection " << mem->GetTableId() << " failed";
+                return status;
+            }
+            LOG_ENGINE_DEBUG_ << "Flushed collection: " << mem->GetTableId();
+        }
+        return Status::OK();
+    };
+
+    if (collection_mems.size() <= 1) {
+        return collection_mems.empty() ? Status::OK() : serialize(collection_mems.begin()->second);
+    }
+
+    std::vector<std::future<Status>> results;
+    for (auto& pair : collection_mems) {
+        results.emplace_back(serialize_thread_pool_.enqueue(serialize, std::cref(pair.second)));
+    }
+
+    Status status;
+    for (auto& result : results) {
+        auto serialize_status = result.get();
+        if (!serialize_status.ok() && status.ok()) {
+            status = serialize_status;
+        }
+    }
+    return status;
+}
+
 void
 MemManagerImpl::OnInsertBufferSizeChanged(int64_t value) {
     options_.insert_buffer_size_ = value * GB;
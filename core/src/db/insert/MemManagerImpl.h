@@ -26,6 +26,7 @@
 #include "db/insert/MemTable.h"
 #include "db/meta/Meta.h"
 #include "utils/Status.h"
+#include "utils/ThreadPool.h"
 
 namespace milvus {
 namespace engine {
@@ -36,7 +37,8 @@ class MemManagerImpl : public MemManager, public server::CacheConfigHandler {
     using MemIdMap = std::map<std::string, MemTablePtr>;
     using MemList = std::vector<MemTablePtr>;
 
-    MemManagerImpl(const meta::MetaPtr& meta, const DBOptions& options) : meta_(meta), options_(options) {
+    MemManagerImpl(const meta::MetaPtr& meta, const DBOptions& options)
+        : meta_(meta), options_(options), serialize_thread_pool_(SERIALIZE_THREAD_NUM) {
         SetIdentity("MemManagerImpl");
         AddInsertBufferSizeListener();
     }
@@ -105,12 +107,19 @@ class MemManagerImpl : public MemManager, public server::CacheConfigHandler {
     uint64_t
     GetMaxLSN(const MemList& tables);
 
+    // serialize the mem tables of different collections in parallel, caller holds serialization_mtx_
+    Status
+    SerializeMemList(const MemList& mem_list, uint64_t max_lsn);
+
+    static constexpr size_t SERIALIZE_THREAD_NUM = 4;
+
     MemIdMap mem_id_map_;
     MemList immu_mem_list_;
     meta::MetaPtr meta_;
     DBOptions options_;
     std::mutex mutex_;
     std::mutex serialization_mtx_;
+    ThreadPool serialize_thread_pool_;
 };  // NewMemManager
 
 }  // namespace engine
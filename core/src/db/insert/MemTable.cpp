@@ -20,6 +20,7 @@
 #include "db/insert/MemTable.h"
 #include "db/meta/FilesHolder.h"
 #include "knowhere/index/vector_index/VecIndex.h"
+#include "segment/SegmentLock.h"
 #include "segment/SegmentReader.h"
 #include "utils/Log.h"
 #include "utils/TimeRecorder.h"
@@ -140,6 +141,11 @@ MemTable::Serialize(uint64_t wal_lsn, bool apply_delete) {
     for (auto mem_table_file = mem_table_file_list_.begin(); mem_table_file != mem_table_file_list_.end();) {
         auto status = (*mem_table_file)->Serialize(wal_lsn);
         update_files.push_back((*mem_table_file)->GetSegmentSchema());
+
+        meta::SegmentSchema index_file_schema;
+        if ((*mem_table_file)->GetIndexSegmentSchema(index_file_schema)) {
+            update_files.push_back(index_file_schema);
+        }
         if (!status.ok()) {
             return status;
         }
@@ -260,6 +266,8 @@ MemTable::ApplyDeletes() {
 
         std::string segment_dir;
         utils::GetParentPath(file.location_, segment_dir);
+        auto segment_lock = segment::GetSegmentLock(segment_dir);
+        std::lock_guard<std::mutex> lock(*segment_lock);
         segment::SegmentReader segment_reader(segment_dir);
 
         auto& segment_id = file.segment_id_;
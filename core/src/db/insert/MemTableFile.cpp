@@ -12,21 +12,41 @@
 #include "db/insert/MemTableFile.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <iterator>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "db/Constants.h"
 #include "db/Utils.h"
 #include "db/engine/EngineFactory.h"
+#include "knowhere/index/vector_index/ConfAdapterMgr.h"
+#include "knowhere/index/vector_index/VecIndexFactory.h"
+#include "knowhere/index/vector_index/adapter/VectorAdapter.h"
+#include "knowhere/index/vector_index/helpers/IndexParameter.h"
 #include "metrics/Metrics.h"
 #include "segment/SegmentReader.h"
+#include "utils/CommonUtil.h"
 #include "utils/Log.h"
+#include "utils/ThreadPool.h"
 
 namespace milvus {
 namespace engine {
 
+namespace {
+
+// graphs of all insert buffers are linked here, every update is parallel inside
+ThreadPool&
+IncrementalIndexThreadPool() {
+    static ThreadPool pool(1);
+    return pool;
+}
+
+}  // namespace
+
 MemTableFile::MemTableFile(const std::string& collection_id, const meta::MetaPtr& meta, const DBOptions& options)
     : collection_id_(collection_id), meta_(meta), options_(options) {
     current_mem_ = 0;
@@ -38,12 +58,21 @@ MemTableFile::MemTableFile(const std::string& collection_id, const meta::MetaPtr
         std::string directory;
         utils::GetParentPath(table_file_schema_.location_, directory);
         segment_writer_ptr_ = std::make_shared<segment::SegmentWriter>(directory);
+        InitVectorsDataType();
+
+        if (options_.incremental_hnsw_) {
+            CreateIncrementalIndex();
+        }
     }
 
     SetIdentity("MemTableFile");
     AddCacheInsertDataListener();
 }
 
+MemTableFile::~MemTableFile() {
+    WaitIncrementalIndex();
+}
+
 Status
 MemTableFile::CreateCollectionFile() {
     meta::SegmentSchema table_file_schema;
@@ -58,6 +87,223 @@ MemTableFile::CreateCollectionFile() {
     return status;
 }
 
+void
+MemTableFile::InitVectorsDataType() {
+    // vector type is a property of the collection, partitions follow their owner
+    meta::CollectionSchema collection_schema;
+    collection_schema.collection_id_ = collection_id_;
+    auto status = meta_->DescribeCollection(collection_schema);
+    if (status.ok() && !collection_schema.owner_collection_.empty()) {
+        collection_schema.collection_id_ = collection_schema.owner_collection_;
+        status = meta_->DescribeCollection(collection_schema);
+    }
+    if (!status.ok()) {
+        LOG_ENGINE_ERROR_ << "MemTableFile::InitVectorsDataType failed: " << status.ToString();
+        return;
+    }
+
+    segment::SegmentPtr segment_ptr;
+    segment_writer_ptr_->GetSegment(segment_ptr);
+    if (collection_schema.flag_ & meta::FLAG_MASK_FP16_VECTOR) {
+        segment_ptr->vectors_ptr_->SetDataType(segment::VectorsDataType::FP16);
+    } else if (collection_schema.flag_ & meta::FLAG_MASK_BF16_VECTOR) {
+        segment_ptr->vectors_ptr_->SetDataType(segment::VectorsDataType::BF16);
+    }
+}
+
+void
+MemTableFile::InitAttrsDataType() {
+    // fields are defined on the collection, partitions follow their owner
+    meta::CollectionSchema collection_schema;
+    collection_schema.collection_id_ = collection_id_;
+    auto status = meta_->DescribeCollection(collection_schema);
+    if (status.ok() && !collection_schema.owner_collection_.empty()) {
+        collection_schema.collection_id_ = collection_schema.owner_collection_;
+    }
+
+    meta::hybrid::FieldsSchema fields_schema;
+    status = meta_->DescribeHybridCollection(collection_schema, fields_schema);
+    if (!status.ok()) {
+        LOG_ENGINE_ERROR_ << "MemTableFile::InitAttrsDataType failed: " << status.ToString();
+        return;
+    }
+
+    std::unordered_map<std::string, meta::hybrid::DataType> attr_type;
+    for (auto& field_schema : fields_schema.fields_schema_) {
+        if (field_schema.field_type_ != (int32_t)meta::hybrid::DataType::VECTOR) {
+            attr_type.insert(
+                std::make_pair(field_schema.field_name_, (meta::hybrid::DataType)field_schema.field_type_));
+        }
+    }
+    segment_writer_ptr_->SetAttrsType(attr_type);
+}
+
+void
+MemTableFile::CreateIncrementalIndex() {
+    if (table_file_schema_.engine_type_ != (int32_t)EngineType::HNSW) {
+        return;
+    }
+
+    segment::SegmentPtr segment_ptr;
+    segment_writer_ptr_->GetSegment(segment_ptr);
+    if (segment_ptr->vectors_ptr_->GetDataType() != segment::VectorsDataType::FLOAT) {
+        return;
+    }
+
+    if (table_file_schema_.metric_type_ != (int32_t)MetricType::L2 &&
+        table_file_schema_.metric_type_ != (int32_t)MetricType::IP) {
+        return;
+    }
+
+    try {
+        milvus::json conf;
+        if (!table_file_schema_.index_params_.empty()) {
+            conf = milvus::json::parse(table_file_schema_.index_params_);
+        }
+        // graph capacity starts from one sixteenth of the buffer and grows while vectors arrive
+        int64_t capacity = MAX_TABLE_FILE_MEM / (table_file_schema_.dimension_ * FLOAT_TYPE_SIZE);
+        capacity = std::max<int64_t>(capacity / 16, 1);
+        conf[knowhere::meta::DIM] = table_file_schema_.dimension_;
+        conf[knowhere::meta::ROWS] = capacity;
+        if (table_file_schema_.metric_type_ == (int32_t)MetricType::IP) {
+            conf[knowhere::Metric::TYPE] = knowhere::Metric::IP;
+        } else {
+            conf[knowhere::Metric::TYPE] = knowhere::Metric::L2;
+        }
+
+        auto index = knowhere::VecIndexFactory::GetInstance().CreateVecIndex(knowhere::IndexEnum::INDEX_HNSW);
+        auto adapter = knowhere::AdapterMgr::GetInstance().GetAdapter(index->index_type());
+        if (!adapter->CheckTrain(conf, index->index_mode())) {
+            LOG_ENGINE_WARNING_ << "Illegal hnsw params for incremental index: " << conf.dump();
+            return;
+        }
+
+        auto dataset = knowhere::GenDataset(capacity, table_file_schema_.dimension_, nullptr);
+        index->Train(dataset, conf);
+        incremental_index_ = index;
+        incremental_index_conf_ = conf;
+    } catch (std::exception& ex) {
+        LOG_ENGINE_ERROR_ << "Failed to create incremental index for file " << table_file_schema_.file_id_ << ": "
+                          << ex.what();
+        incremental_index_ = nullptr;
+    }
+}
+
+void
+MemTableFile::ReserveVectors(size_t single_vector_mem_size) {
+    segment::SegmentPtr segment_ptr;
+    segment_writer_ptr_->GetSegment(segment_ptr);
+    auto& vectors = segment_ptr->vectors_ptr_;
+    if (vectors->GetCount() > 0) {
+        return;
+    }
+
+    // Size the raw buffer for a full file up front. The allocation is big enough to be mapped lazily, pages are only
+    // committed once vectors land on them, and the buffer is never copied by a regrowth while the file fills up.
+    size_t code_length = single_vector_mem_size;
+    if (vectors->GetDataType() != segment::VectorsDataType::FLOAT) {
+        code_length = table_file_schema_.dimension_ * sizeof(uint16_t);
+    }
+    vectors->Reserve(MAX_TABLE_FILE_MEM / single_vector_mem_size, code_length);
+}
+
+void
+MemTableFile::UpdateIncrementalIndex(bool wait) {
+    if (incremental_index_task_.valid()) {
+        if (!wait && incremental_index_task_.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return;  // the running update is followed by the next insert or the flush
+        }
+        WaitIncrementalIndex();
+    }
+    if (incremental_index_ == nullptr) {
+        return;
+    }
+
+    segment::SegmentPtr segment_ptr;
+    segment_writer_ptr_->GetSegment(segment_ptr);
+    auto& vectors = segment_ptr->vectors_ptr_;
+    int64_t count = vectors->GetCount();
+    if (count <= incremental_index_->Count()) {
+        return;
+    }
+
+    // the whole buffer is passed each time, the index only adds the vectors past its own count
+    auto index = incremental_index_;
+    auto conf = incremental_index_conf_;
+    auto dataset = knowhere::GenDataset(count, table_file_schema_.dimension_, vectors->GetData().data());
+    auto task = [index, dataset, conf]() { index->AddWithoutIds(dataset, conf); };
+    if (wait) {
+        incremental_index_task_ = std::async(std::launch::deferred, task);
+        WaitIncrementalIndex();
+    } else {
+        incremental_index_task_ = IncrementalIndexThreadPool().enqueue(task);
+    }
+}
+
+void
+MemTableFile::WaitIncrementalIndexBeforeGrowth(size_t bytes) {
+    // the background update reads the buffer in place, it must finish before the buffer moves
+    segment::SegmentPtr segment_ptr;
+    segment_writer_ptr_->GetSegment(segment_ptr);
+    auto& data = segment_ptr->vectors_ptr_->GetData();
+    if (data.size() + bytes > data.capacity()) {
+        WaitIncrementalIndex();
+    }
+}
+
+void
+MemTableFile::WaitIncrementalIndex() {
+    if (!incremental_index_task_.valid()) {
+        return;
+    }
+    try {
+        incremental_index_task_.get();
+    } catch (std::exception& ex) {
+        LOG_ENGINE_ERROR_ << "Failed to update incremental index for file " << table_file_schema_.file_id_ << ": "
+                          << ex.what();
+        incremental_index_ = nullptr;
+    }
+}
+
+Status
+MemTableFile::SerializeIncrementalIndex() {
+    segment::SegmentPtr segment_ptr;
+    segment_writer_ptr_->GetSegment(segment_ptr);
+    incremental_index_->SetUids(segment_ptr->vectors_ptr_->GetMutableUids());
+
+    STATUS_CHECK(segment_writer_ptr_->SetVectorIndex(incremental_index_));
+    if (table_file_schema_.file_type_ == meta::SegmentSchema::RAW) {
+        return segment_writer_ptr_->WriteVectorIndex(utils::GetIncrementalIndexPath(table_file_schema_.location_));
+    }
+
+    meta::SegmentSchema index_file_schema;
+    index_file_schema.collection_id_ = table_file_schema_.collection_id_;
+    index_file_schema.segment_id_ = table_file_schema_.file_id_;
+    index_file_schema.date_ = table_file_schema_.date_;
+    index_file_schema.file_type_ = meta::SegmentSchema::NEW_INDEX;
+    auto status = meta_->CreateCollectionFile(index_file_schema);
+    if (!status.ok()) {
+        return status;
+    }
+
+    status = segment_writer_ptr_->WriteVectorIndex(index_file_schema.location_);
+    if (!status.ok()) {
+        index_file_schema.file_type_ = meta::SegmentSchema::TO_DELETE;
+        meta_->UpdateCollectionFile(index_file_schema);
+        return status;
+    }
+
+    index_file_schema.file_type_ = meta::SegmentSchema::INDEX;
+    index_file_schema.file_size_ = CommonUtil::GetFileSize(index_file_schema.location_);
+    index_file_schema.row_count_ = table_file_schema_.row_count_;
+    index_file_schema_ = index_file_schema;
+
+    LOG_ENGINE_DEBUG_ << "New index file " << index_file_schema_.file_id_ << " of size "
+                      << index_file_schema_.file_size_ << " bytes from incremental index of file "
+                      << table_file_schema_.file_id_;
+    return Status::OK();
+}
+
 Status
 MemTableFile::Add(const VectorSourcePtr& source) {
     if (table_file_schema_.dimension_ <= 0) {
@@ -73,11 +319,14 @@ MemTableFile::Add(const VectorSourcePtr& source) {
     if (mem_left >= single_vector_mem_size) {
         size_t num_vectors_to_add = std::ceil(mem_left / single_vector_mem_size);
         size_t num_vectors_added;
+        ReserveVectors(single_vector_mem_size);
+        WaitIncrementalIndexBeforeGrowth(num_vectors_to_add * single_vector_mem_size);
 
         auto status = source->Add(/*execution_engine_,*/ segment_writer_ptr_, table_file_schema_, num_vectors_to_add,
                                   num_vectors_added);
         if (status.ok()) {
             current_mem_ += (num_vectors_added * single_vector_mem_size);
+            UpdateIncrementalIndex(false);
         }
         return status;
     }
@@ -99,12 +348,18 @@ MemTableFile::AddEntities(const VectorSourcePtr& source) {
     if (mem_left >= single_entity_mem_size) {
         size_t num_entities_to_add = std::ceil(mem_left / single_entity_mem_size);
         size_t num_entities_added;
+        size_t single_vector_mem_size = source->SingleVectorSize(table_file_schema_.dimension_);
+        if (single_vector_mem_size > 0) {
+            ReserveVectors(single_vector_mem_size);
+            WaitIncrementalIndexBeforeGrowth(num_entities_to_add * single_vector_mem_size);
+        }
 
         auto status =
             source->AddEntities(segment_writer_ptr_, table_file_schema_, num_entities_to_add, num_entities_added);
 
         if (status.ok()) {
             current_mem_ += (num_entities_added * single_entity_mem_size);
+            UpdateIncrementalIndex(false);
         }
         return status;
     }
@@ -119,6 +374,10 @@ MemTableFile::Delete(segment::doc_id_t doc_id) {
     auto uids = segment_ptr->vectors_ptr_->GetUids();
     auto found = std::find(uids.begin(), uids.end(), doc_id);
     if (found != uids.end()) {
+        // erase shifts the offsets linked by the graph, the index will be built from scratch later
+        WaitIncrementalIndex();
+        incremental_index_ = nullptr;
+
         auto offset = std::distance(uids.begin(), found);
         segment_ptr->vectors_ptr_->Erase(offset);
     }
@@ -145,6 +404,10 @@ MemTableFile::Delete(const std::vector<segment::doc_id_t>& doc_ids) {
     size_t loop = uids.size();
     for (size_t i = 0; i < loop; ++i) {
         if (std::binary_search(temp.begin(), temp.end(), uids[i])) {
+            if (deleted == 0) {
+                WaitIncrementalIndex();
+                incremental_index_ = nullptr;
+            }
             segment_ptr->vectors_ptr_->Erase(i - deleted);
             ++deleted;
         }
@@ -184,6 +447,13 @@ MemTableFile::Serialize(uint64_t wal_lsn) {
     int64_t size = GetCurrentMem();
     server::CollectSerializeMetrics metrics(size);
 
+    // only hybrid collections carry attributes, their types drive the zone maps
+    segment::SegmentPtr segment_ptr;
+    segment_writer_ptr_->GetSegment(segment_ptr);
+    if (!segment_ptr->attrs_ptr_->attrs.empty()) {
+        InitAttrsDataType();
+    }
+
     auto status = segment_writer_ptr_->Serialize();
     if (!status.ok()) {
         LOG_ENGINE_ERROR_ << "Failed to serialize segment: " << table_file_schema_.segment_id_;
@@ -218,6 +488,20 @@ MemTableFile::Serialize(uint64_t wal_lsn) {
         table_file_schema_.file_type_ = meta::SegmentSchema::RAW;
     }
 
+    // link the vectors the background updates have not reached yet, then persist the graph, a sealed segment gets
+    // it as its index, a raw one keeps it next to the raw data for searching
+    UpdateIncrementalIndex(true);
+    if (incremental_index_ != nullptr && incremental_index_->Count() == (int64_t)table_file_schema_.row_count_) {
+        auto index_status = SerializeIncrementalIndex();
+        if (!index_status.ok()) {
+            LOG_ENGINE_ERROR_ << "Failed to serialize incremental index of file " << table_file_schema_.file_id_
+                              << ": " << index_status.message();
+        } else if (table_file_schema_.file_type_ == meta::SegmentSchema::TO_INDEX) {
+            table_file_schema_.file_type_ = meta::SegmentSchema::BACKUP;
+        }
+    }
+    incremental_index_ = nullptr;
+
     LOG_ENGINE_DEBUG_ << "New " << ((table_file_schema_.file_type_ == meta::SegmentSchema::RAW) ? "raw" : "to_index")
                       << " file " << table_file_schema_.file_id_ << " of size " << size << " bytes, lsn = " << wal_lsn;
 
@@ -244,6 +528,15 @@ MemTableFile::GetSegmentSchema() const {
     return table_file_schema_;
 }
 
+bool
+MemTableFile::GetIndexSegmentSchema(meta::SegmentSchema& index_file_schema) const {
+    if (index_file_schema_.file_type_ != meta::SegmentSchema::INDEX) {
+        return false;
+    }
+    index_file_schema = index_file_schema_;
+    return true;
+}
+
 void
 MemTableFile::OnCacheInsertDataChanged(bool value) {
     options_.insert_cache_immediately_ = value;
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -19,6 +20,7 @@
 #include "db/engine/ExecutionEngine.h"
 #include "db/insert/VectorSource.h"
 #include "db/meta/Meta.h"
+#include "knowhere/index/vector_index/VecIndex.h"
 #include "segment/SegmentWriter.h"
 #include "utils/Status.h"
 
@@ -29,7 +31,7 @@ class MemTableFile : public server::CacheConfigHandler {
  public:
     MemTableFile(const std::string& collection_id, const meta::MetaPtr& meta, const DBOptions& options);
 
-    ~MemTableFile() = default;
+    ~MemTableFile();
 
  public:
     Status
@@ -62,6 +64,10 @@ class MemTableFile : public server::CacheConfigHandler {
     meta::SegmentSchema
     GetSegmentSchema() const;
 
+    // valid only when the incremental graph was persisted as index file of this segment
+    bool
+    GetIndexSegmentSchema(meta::SegmentSchema& index_file_schema) const;
+
  protected:
     void
     OnCacheInsertDataChanged(bool value) override;
@@ -70,6 +76,31 @@ class MemTableFile : public server::CacheConfigHandler {
     Status
     CreateCollectionFile();
 
+    void
+    InitVectorsDataType();
+
+    void
+    InitAttrsDataType();
+
+    void
+    ReserveVectors(size_t single_vector_mem_size);
+
+    void
+    CreateIncrementalIndex();
+
+    // links the new vectors in the background, or on the calling thread with wait
+    void
+    UpdateIncrementalIndex(bool wait);
+
+    void
+    WaitIncrementalIndex();
+
+    void
+    WaitIncrementalIndexBeforeGrowth(size_t bytes);
+
+    Status
+    SerializeIncrementalIndex();
+
  private:
     const std::string collection_id_;
     meta::SegmentSchema table_file_schema_;
@@ -79,6 +110,12 @@ class MemTableFile : public server::CacheConfigHandler {
 
     //    ExecutionEnginePtr execution_engine_;
     segment::SegmentWriterPtr segment_writer_ptr_;
+
+    // hnsw graph maintained along with inserted vectors, see DBOptions::incremental_hnsw_
+    knowhere::VecIndexPtr incremental_index_ = nullptr;
+    milvus::json incremental_index_conf_;
+    std::future<void> incremental_index_task_;
+    meta::SegmentSchema index_file_schema_;
 };  // MemTableFile
 
 using MemTableFilePtr = std::shared_ptr<MemTableFile>;
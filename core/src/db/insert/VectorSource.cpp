@@ -11,6 +11,7 @@
 
 #include "db/insert/VectorSource.h"
 
+#include <faiss/utils/half_precision.h>
 #include <utility>
 #include <vector>
 
@@ -24,7 +25,15 @@ namespace milvus {
 namespace engine {
 
 VectorSource::VectorSource(VectorsData vectors) : vectors_(std::move(vectors)) {
-    current_num_vectors_added = 0;
+    BindData();
+}
+
+VectorSource::VectorSource(uint64_t count, const IDNumber* ids, const float* float_data)
+    : vector_count_(count), id_data_(ids), float_data_(float_data) {
+}
+
+VectorSource::VectorSource(uint64_t count, const IDNumber* ids, const uint8_t* binary_data)
+    : vector_count_(count), id_data_(ids), binary_data_(binary_data) {
 }
 
 VectorSource::VectorSource(milvus::engine::VectorsData vectors,
@@ -32,20 +41,27 @@ VectorSource::VectorSource(milvus::engine::VectorsData vectors,
                            const std::unordered_map<std::string, uint64_t>& attr_size,
                            const std::unordered_map<std::string, std::vector<uint8_t>>& attr_data)
     : vectors_(std::move(vectors)), attr_nbytes_(attr_nbytes), attr_size_(attr_size), attr_data_(attr_data) {
-    current_num_vectors_added = 0;
-    current_num_attrs_added = 0;
+    BindData();
+}
+
+void
+VectorSource::BindData() {
+    vector_count_ = vectors_.vector_count_;
+    id_data_ = vectors_.id_array_.empty() ? nullptr : vectors_.id_array_.data();
+    float_data_ = vectors_.float_data_.empty() ? nullptr : vectors_.float_data_.data();
+    binary_data_ = vectors_.binary_data_.empty() ? nullptr : vectors_.binary_data_.data();
 }
 
 Status
 VectorSource::Add(const segment::SegmentWriterPtr& segment_writer_ptr, const meta::SegmentSchema& table_file_schema,
                   const size_t& num_vectors_to_add, size_t& num_vectors_added) {
-    uint64_t n = vectors_.vector_count_;
+    uint64_t n = vector_count_;
     server::CollectAddMetrics metrics(n, table_file_schema.dimension_);
 
     num_vectors_added =
         current_num_vectors_added + num_vectors_to_add <= n ? num_vectors_to_add : n - current_num_vectors_added;
     IDNumbers vector_ids_to_add;
-    if (vectors_.id_array_.empty()) {
+    if (id_data_ == nullptr) {
         SafeIDGenerator& id_generator = SafeIDGenerator::GetInstance();
         Status status = id_generator.GetNextIDNumbers(num_vectors_added, vector_ids_to_add);
         if (!status.ok()) {
@@ -53,24 +69,19 @@ VectorSource::Add(const segment::SegmentWriterPtr& segment_writer_ptr, const met
             return status;
         }
     } else {
-        vector_ids_to_add.resize(num_vectors_added);
-        for (size_t pos = current_num_vectors_added; pos < current_num_vectors_added + num_vectors_added; pos++) {
-            vector_ids_to_add[pos - current_num_vectors_added] = vectors_.id_array_[pos];
-        }
+        vector_ids_to_add.assign(id_data_ + current_num_vectors_added,
+                                 id_data_ + current_num_vectors_added + num_vectors_added);
     }
 
     Status status;
-    if (!vectors_.float_data_.empty()) {
+    if (float_data_ != nullptr) {
         LOG_ENGINE_DEBUG_ << LogOut("[%s][%ld]", "insert", 0) << "Insert float data into segment";
-        auto size = num_vectors_added * table_file_schema.dimension_ * sizeof(float);
-        float* ptr = vectors_.float_data_.data() + current_num_vectors_added * table_file_schema.dimension_;
-        status = segment_writer_ptr->AddVectors(table_file_schema.file_id_, (uint8_t*)ptr, size, vector_ids_to_add);
-    } else if (!vectors_.binary_data_.empty()) {
+        const float* ptr = float_data_ + current_num_vectors_added * table_file_schema.dimension_;
+        status = AddFloatVectors(segment_writer_ptr, table_file_schema, ptr, num_vectors_added, vector_ids_to_add);
+    } else if (binary_data_ != nullptr) {
         LOG_ENGINE_DEBUG_ << LogOut("[%s][%ld]", "insert", 0) << "Insert binary data into segment";
-        std::vector<uint8_t> vectors;
         auto size = num_vectors_added * SingleVectorSize(table_file_schema.dimension_) * sizeof(uint8_t);
-        uint8_t* ptr =
-            vectors_.binary_data_.data() + current_num_vectors_added * SingleVectorSize(table_file_schema.dimension_);
+        const uint8_t* ptr = binary_data_ + current_num_vectors_added * SingleVectorSize(table_file_schema.dimension_);
         status = segment_writer_ptr->AddVectors(table_file_schema.file_id_, ptr, size, vector_ids_to_add);
     }
 
@@ -87,26 +98,48 @@ VectorSource::Add(const segment::SegmentWriterPtr& segment_writer_ptr, const met
     return status;
 }
 
+Status
+VectorSource::AddFloatVectors(const segment::SegmentWriterPtr& segment_writer_ptr,
+                              const meta::SegmentSchema& file_schema, const float* data, size_t count,
+                              const IDNumbers& vector_ids) {
+    segment::SegmentPtr segment_ptr;
+    segment_writer_ptr->GetSegment(segment_ptr);
+    auto data_type = segment_ptr->vectors_ptr_->GetDataType();
+    auto n = count * file_schema.dimension_;
+    if (data_type == segment::VectorsDataType::FLOAT) {
+        return segment_writer_ptr->AddVectors(file_schema.file_id_, (const uint8_t*)data, n * sizeof(float),
+                                              vector_ids);
+    }
+
+    // collection keeps raw vectors in half precision
+    std::vector<uint8_t> half_vectors(n * sizeof(uint16_t));
+    auto half_ptr = reinterpret_cast<uint16_t*>(half_vectors.data());
+    if (data_type == segment::VectorsDataType::FP16) {
+        faiss::fvec_to_fp16(data, half_ptr, n);
+    } else {
+        faiss::fvec_to_bf16(data, half_ptr, n);
+    }
+    return segment_writer_ptr->AddVectors(file_schema.file_id_, half_vectors, vector_ids);
+}
+
 Status
 VectorSource::AddEntities(const milvus::segment::SegmentWriterPtr& segment_writer_ptr,
                           const milvus::engine::meta::SegmentSchema& collection_file_schema,
                           const size_t& num_entities_to_add, size_t& num_entities_added) {
     // TODO: n = vectors_.vector_count_;???
-    uint64_t n = vectors_.vector_count_;
+    uint64_t n = vector_count_;
     num_entities_added =
         current_num_attrs_added + num_entities_to_add <= n ? num_entities_to_add : n - current_num_attrs_added;
     IDNumbers vector_ids_to_add;
-    if (vectors_.id_array_.empty()) {
+    if (id_data_ == nullptr) {
         SafeIDGenerator& id_generator = SafeIDGenerator::GetInstance();
         Status status = id_generator.GetNextIDNumbers(num_entities_added, vector_ids_to_add);
         if (!status.ok()) {
             return status;
         }
     } else {
-        vector_ids_to_add.resize(num_entities_added);
-        for (size_t pos = current_num_attrs_added; pos < current_num_attrs_added + num_entities_added; pos++) {
-            vector_ids_to_add[pos - current_num_attrs_added] = vectors_.id_array_[pos];
-        }
+        vector_ids_to_add.assign(id_data_ + current_num_attrs_added,
+                                 id_data_ + current_num_attrs_added + num_entities_added);
     }
 
     Status status;
@@ -120,13 +153,9 @@ VectorSource::AddEntities(const milvus::segment::SegmentWriterPtr& segment_write
         return status;
     }
 
-    std::vector<uint8_t> vectors;
-    auto size = num_entities_added * collection_file_schema.dimension_ * sizeof(float);
-    vectors.resize(size);
-    memcpy(vectors.data(), vectors_.float_data_.data() + current_num_vectors_added * collection_file_schema.dimension_,
-           size);
+    auto ptr = float_data_ + current_num_vectors_added * collection_file_schema.dimension_;
     LOG_ENGINE_DEBUG_ << LogOut("[%s][%ld]", "insert", 0) << "Insert into segment";
-    status = segment_writer_ptr->AddVectors(collection_file_schema.file_id_, vectors, vector_ids_to_add);
+    status = AddFloatVectors(segment_writer_ptr, collection_file_schema, ptr, num_entities_added, vector_ids_to_add);
     if (status.ok()) {
         current_num_vectors_added += num_entities_added;
         vector_ids_.insert(vector_ids_.end(), std::make_move_iterator(vector_ids_to_add.begin()),
@@ -149,9 +178,9 @@ VectorSource::GetNumVectorsAdded() {
 
 size_t
 VectorSource::SingleVectorSize(uint16_t dimension) {
-    if (!vectors_.float_data_.empty()) {
+    if (float_data_ != nullptr) {
         return dimension * FLOAT_TYPE_SIZE;
-    } else if (!vectors_.binary_data_.empty()) {
+    } else if (binary_data_ != nullptr) {
         return dimension / 8;
     }
 
@@ -172,7 +201,7 @@ VectorSource::SingleEntitySize(uint16_t dimension) {
 
 bool
 VectorSource::AllAdded() {
-    return (current_num_vectors_added == vectors_.vector_count_);
+    return (current_num_vectors_added == vector_count_);
 }
 
 IDNumbers
@@ -31,6 +31,11 @@ class VectorSource {
  public:
     explicit VectorSource(VectorsData vectors);
 
+    // Borrow the caller's buffers instead of copying them, the source must be consumed before they are released
+    VectorSource(uint64_t count, const IDNumber* ids, const float* float_data);
+
+    VectorSource(uint64_t count, const IDNumber* ids, const uint8_t* binary_data);
+
     VectorSource(VectorsData vectors, const std::unordered_map<std::string, uint64_t>& attr_nbytes,
                  const std::unordered_map<std::string, uint64_t>& attr_size,
                  const std::unordered_map<std::string, std::vector<uint8_t>>& attr_data);
@@ -58,15 +63,33 @@ class VectorSource {
     IDNumbers
     GetVectorIds();
 
+    // No copy and move, the data pointers may refer to vectors_
+    VectorSource(const VectorSource&) = delete;
+    VectorSource&
+    operator=(const VectorSource&) = delete;
+
+ private:
+    void
+    BindData();
+
+    // float vectors are stored in the precision of the segment
+    Status
+    AddFloatVectors(const segment::SegmentWriterPtr& segment_writer_ptr, const meta::SegmentSchema& file_schema,
+                    const float* data, size_t count, const IDNumbers& vector_ids);
+
  private:
     VectorsData vectors_;
+    uint64_t vector_count_ = 0;
+    const IDNumber* id_data_ = nullptr;
+    const float* float_data_ = nullptr;
+    const uint8_t* binary_data_ = nullptr;
     IDNumbers vector_ids_;
     const std::unordered_map<std::string, uint64_t> attr_nbytes_;
     std::unordered_map<std::string, uint64_t> attr_size_;
     std::unordered_map<std::string, std::vector<uint8_t>> attr_data_;
 
-    size_t current_num_vectors_added;
-    size_t current_num_attrs_added;
+    size_t current_num_vectors_added = 0;
+    size_t current_num_attrs_added = 0;
 };  // VectorSource
 
 using VectorSourcePtr = std::shared_ptr<VectorSource>;
@@ -0,0 +1,448 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "db/meta/CachedMetaImpl.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "utils/Log.h"
+
+namespace milvus {
+namespace engine {
+namespace meta {
+
+CachedMetaImpl::CachedMetaImpl(MetaPtr meta) : meta_(std::move(meta)) {
+}
+
+uint64_t
+CachedMetaImpl::CacheVersion() {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    return version_;
+}
+
+uint64_t
+CachedMetaImpl::CollectionVersion(const std::string& collection_id) {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    return VersionOf(collection_id);
+}
+
+uint64_t
+CachedMetaImpl::VersionOf(const std::string& root) {
+    auto iter = collection_versions_.find(root);
+    if (iter == collection_versions_.end()) {
+        return floor_version_;
+    }
+    return std::max(floor_version_, iter->second);
+}
+
+void
+CachedMetaImpl::Invalidate() {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    ++version_;
+    floor_version_ = version_;
+    files_cache_.clear();
+    partitions_cache_.clear();
+}
+
+void
+CachedMetaImpl::Invalidate(const std::vector<std::string>& roots) {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    ++version_;
+    for (auto& root : roots) {
+        collection_versions_[root] = version_;
+        files_cache_.erase(root);
+        partitions_cache_.erase(root);
+    }
+}
+
+std::string
+CachedMetaImpl::RootOf(const std::string& collection_id) {
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+        auto iter = owners_.find(collection_id);
+        if (iter != owners_.end()) {
+            return iter->second;
+        }
+    }
+
+    CollectionSchema schema;
+    schema.collection_id_ = collection_id;
+    if (!meta_->DescribeCollection(schema).ok()) {
+        return collection_id;
+    }
+    auto root = schema.owner_collection_.empty() ? collection_id : schema.owner_collection_;
+
+    // the owner of a collection never changes
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    owners_[collection_id] = root;
+    return root;
+}
+
+std::vector<std::string>
+CachedMetaImpl::RootsOf(const SegmentsSchema& files) {
+    std::vector<std::string> roots;
+    for (auto& file : files) {
+        auto root = RootOf(file.collection_id_);
+        if (std::find(roots.begin(), roots.end(), root) == roots.end()) {
+            roots.emplace_back(root);
+        }
+    }
+    return roots;
+}
+
+bool
+CachedMetaImpl::GetCachedFiles(const std::string& root, const std::string& key, FilesHolder& files_holder,
+                               uint64_t& version) {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    version = VersionOf(root);
+    auto root_iter = files_cache_.find(root);
+    if (root_iter == files_cache_.end()) {
+        return false;
+    }
+    auto iter = root_iter->second.find(key);
+    if (iter == root_iter->second.end()) {
+        return false;
+    }
+    files_holder.MarkFiles(iter->second);
+    return true;
+}
+
+void
+CachedMetaImpl::CacheFiles(const std::string& root, const std::string& key, const FilesHolder& files_holder,
+                           uint64_t version) {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    // the root changed while reading from the backend, the result may be stale
+    if (version != VersionOf(root)) {
+        return;
+    }
+    files_cache_[root][key] = files_holder.HoldFiles();
+}
+
+Status
+CachedMetaImpl::CreateCollection(CollectionSchema& table_schema) {
+    auto status = meta_->CreateCollection(table_schema);
+    Invalidate({table_schema.collection_id_});
+    return status;
+}
+
+Status
+CachedMetaImpl::DescribeCollection(CollectionSchema& table_schema) {
+    return meta_->DescribeCollection(table_schema);
+}
+
+Status
+CachedMetaImpl::HasCollection(const std::string& collection_id, bool& has_or_not, bool is_root) {
+    return meta_->HasCollection(collection_id, has_or_not, is_root);
+}
+
+Status
+CachedMetaImpl::AllCollections(std::vector<CollectionSchema>& table_schema_array, bool is_root) {
+    return meta_->AllCollections(table_schema_array, is_root);
+}
+
+Status
+CachedMetaImpl::UpdateCollectionFlag(const std::string& collection_id, int64_t flag) {
+    return meta_->UpdateCollectionFlag(collection_id, flag);
+}
+
+Status
+CachedMetaImpl::UpdateCollectionFlushLSN(const std::string& collection_id, uint64_t flush_lsn) {
+    // the files a flush makes searchable are created and updated on their own
+    return meta_->UpdateCollectionFlushLSN(collection_id, flush_lsn);
+}
+
+Status
+CachedMetaImpl::GetCollectionFlushLSN(const std::string& collection_id, uint64_t& flush_lsn) {
+    return meta_->GetCollectionFlushLSN(collection_id, flush_lsn);
+}
+
+Status
+CachedMetaImpl::DropCollections(const std::vector<std::string>& collection_id_array) {
+    std::vector<std::string> roots;
+    for (auto& collection_id : collection_id_array) {
+        roots.emplace_back(RootOf(collection_id));
+    }
+    auto status = meta_->DropCollections(collection_id_array);
+    Invalidate(roots);
+    return status;
+}
+
+Status
+CachedMetaImpl::DeleteCollectionFiles(const std::vector<std::string>& collection_id_array) {
+    std::vector<std::string> roots;
+    for (auto& collection_id : collection_id_array) {
+        roots.emplace_back(RootOf(collection_id));
+    }
+    auto status = meta_->DeleteCollectionFiles(collection_id_array);
+    Invalidate(roots);
+    return status;
+}
+
+Status
+CachedMetaImpl::GetCollectionFiles(const std::string& collection_id, const std::vector<size_t>& ids,
+                                   FilesHolder& files_holder) {
+    return meta_->GetCollectionFiles(collection_id, ids, files_holder);
+}
+
+Status
+CachedMetaImpl::GetCollectionFilesBySegmentId(const std::string& segment_id, FilesHolder& files_holder) {
+    return meta_->GetCollectionFilesBySegmentId(segment_id, files_holder);
+}
+
+Status
+CachedMetaImpl::UpdateCollectionFile(SegmentSchema& file_schema) {
+    auto root = RootOf(file_schema.collection_id_);
+    auto status = meta_->UpdateCollectionFile(file_schema);
+    Invalidate({root});
+    return status;
+}
+
+Status
+CachedMetaImpl::UpdateCollectionFiles(SegmentsSchema& files) {
+    auto roots = RootsOf(files);
+    auto status = meta_->UpdateCollectionFiles(files);
+    Invalidate(roots);
+    return status;
+}
+
+Status
+CachedMetaImpl::UpdateCollectionFilesRowCount(SegmentsSchema& files) {
+    auto roots = RootsOf(files);
+    auto status = meta_->UpdateCollectionFilesRowCount(files);
+    Invalidate(roots);
+    return status;
+}
+
+Status
+CachedMetaImpl::UpdateCollectionIndex(const std::string& collection_id, const CollectionIndex& index) {
+    auto root = RootOf(collection_id);
+    auto status = meta_->UpdateCollectionIndex(collection_id, index);
+    Invalidate({root});
+    return status;
+}
+
+Status
+CachedMetaImpl::UpdateCollectionFilesToIndex(const std::string& collection_id) {
+    auto root = RootOf(collection_id);
+    auto status = meta_->UpdateCollectionFilesToIndex(collection_id);
+    Invalidate({root});
+    return status;
+}
+
+Status
+CachedMetaImpl::DescribeCollectionIndex(const std::string& collection_id, CollectionIndex& index) {
+    return meta_->DescribeCollectionIndex(collection_id, index);
+}
+
+Status
+CachedMetaImpl::DropCollectionIndex(const std::string& collection_id) {
+    auto root = RootOf(collection_id);
+    auto status = meta_->DropCollectionIndex(collection_id);
+    Invalidate({root});
+    return status;
+}
+
+Status
+CachedMetaImpl::CreatePartition(const std::string& collection_name, const std::string& partition_name,
+                                const std::string& tag, uint64_t lsn) {
+    auto root = RootOf(collection_name);
+    auto status = meta_->CreatePartition(collection_name, partition_name, tag, lsn);
+    Invalidate({root});
+    return status;
+}
+
+Status
+CachedMetaImpl::HasPartition(const std::string& collection_id, const std::string& tag, bool& has_or_not) {
+    return meta_->HasPartition(collection_id, tag, has_or_not);
+}
+
+Status
+CachedMetaImpl::DropPartition(const std::string& partition_name) {
+    auto root = RootOf(partition_name);
+    auto status = meta_->DropPartition(partition_name);
+    Invalidate({root});
+    return status;
+}
+
+Status
+CachedMetaImpl::GetPartitionName(const std::string& collection_name, const std::string& tag,
+                                 std::string& partition_name) {
+    return meta_->GetPartitionName(collection_name, tag, partition_name);
+}
+
+Status
+CachedMetaImpl::FilesToMerge(const std::string& collection_id, FilesHolder& files_holder) {
+    return meta_->FilesToMerge(collection_id, files_holder);
+}
+
+Status
+CachedMetaImpl::FilesToIndex(FilesHolder& files_holder) {
+    return meta_->FilesToIndex(files_holder);
+}
+
+Status
+CachedMetaImpl::FilesByType(const std::string& collection_id, const std::vector<int>& file_types,
+                            FilesHolder& files_holder) {
+    return meta_->FilesByType(collection_id, file_types, files_holder);
+}
+
+Status
+CachedMetaImpl::FilesByTypeEx(const std::vector<meta::CollectionSchema>& collections,
+                              const std::vector<int>& file_types, FilesHolder& files_holder) {
+    return meta_->FilesByTypeEx(collections, file_types, files_holder);
+}
+
+Status
+CachedMetaImpl::FilesByID(const std::vector<size_t>& ids, FilesHolder& files_holder) {
+    return meta_->FilesByID(ids, files_holder);
+}
+
+Status
+CachedMetaImpl::Size(uint64_t& result) {
+    return meta_->Size(result);
+}
+
+Status
+CachedMetaImpl::Archive() {
+    auto status = meta_->Archive();
+    Invalidate();
+    return status;
+}
+
+Status
+CachedMetaImpl::CleanUpShadowFiles() {
+    return meta_->CleanUpShadowFiles();
+}
+
+Status
+CachedMetaImpl::CleanUpFilesWithTTL(uint64_t seconds) {
+    return meta_->CleanUpFilesWithTTL(seconds);
+}
+
+Status
+CachedMetaImpl::DropAll() {
+    auto status = meta_->DropAll();
+    Invalidate();
+    return status;
+}
+
+Status
+CachedMetaImpl::Count(const std::string& collection_id, uint64_t& result) {
+    return meta_->Count(collection_id, result);
+}
+
+Status
+CachedMetaImpl::SetGlobalLastLSN(uint64_t lsn) {
+    return meta_->SetGlobalLastLSN(lsn);
+}
+
+Status
+CachedMetaImpl::GetGlobalLastLSN(uint64_t& lsn) {
+    return meta_->GetGlobalLastLSN(lsn);
+}
+
+Status
+CachedMetaImpl::CreateHybridCollection(CollectionSchema& collection_schema, hybrid::FieldsSchema& fields_schema) {
+    auto status = meta_->CreateHybridCollection(collection_schema, fields_schema);
+    Invalidate({collection_schema.collection_id_});
+    return status;
+}
+
+Status
+CachedMetaImpl::DescribeHybridCollection(CollectionSchema& collection_schema, hybrid::FieldsSchema& fields_schema) {
+    return meta_->DescribeHybridCollection(collection_schema, fields_schema);
+}
+
+Status
+CachedMetaImpl::CreateCollectionFile(SegmentSchema& file_schema) {
+    // new, new_merge and new_index files are invisible to search
+    if (file_schema.file_type_ == SegmentSchema::RAW || file_schema.file_type_ == SegmentSchema::TO_INDEX ||
+        file_schema.file_type_ == SegmentSchema::INDEX) {
+        auto root = RootOf(file_schema.collection_id_);
+        auto status = meta_->CreateCollectionFile(file_schema);
+        Invalidate({root});
+        return status;
+    }
+    auto status = meta_->CreateCollectionFile(file_schema);
+    return status;
+}
+
+Status
+CachedMetaImpl::ShowPartitions(const std::string& collection_name,
+                               std::vector<meta::CollectionSchema>& partition_schema_array) {
+    auto root = RootOf(collection_name);
+    uint64_t version;
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+        version = VersionOf(root);
+        if (root == collection_name) {
+            auto iter = partitions_cache_.find(root);
+            if (iter != partitions_cache_.end()) {
+                partition_schema_array = iter->second;
+                return Status::OK();
+            }
+        }
+    }
+
+    auto status = meta_->ShowPartitions(collection_name, partition_schema_array);
+    if (status.ok() && root == collection_name) {
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+        if (version == VersionOf(root)) {
+            partitions_cache_[root] = partition_schema_array;
+        }
+    }
+    return status;
+}
+
+Status
+CachedMetaImpl::FilesToSearch(const std::string& collection_id, FilesHolder& files_holder) {
+    auto root = RootOf(collection_id);
+    uint64_t version;
+    if (GetCachedFiles(root, collection_id, files_holder, version)) {
+        return Status::OK();
+    }
+
+    FilesHolder holder;
+    auto status = meta_->FilesToSearch(collection_id, holder);
+    files_holder.MarkFiles(holder.HoldFiles());
+    if (status.ok()) {
+        CacheFiles(root, collection_id, holder, version);
+    }
+    return status;
+}
+
+Status
+CachedMetaImpl::FilesToSearchEx(const std::string& root_collection, const std::set<std::string>& partition_id_array,
+                                FilesHolder& files_holder) {
+    // collection and partition ids never contain '/'
+    std::string key = root_collection + "/";
+    for (auto& partition_id : partition_id_array) {
+        key += partition_id + "/";
+    }
+
+    uint64_t version;
+    if (GetCachedFiles(root_collection, key, files_holder, version)) {
+        return Status::OK();
+    }
+
+    FilesHolder holder;
+    auto status = meta_->FilesToSearchEx(root_collection, partition_id_array, holder);
+    files_holder.MarkFiles(holder.HoldFiles());
+    if (status.ok()) {
+        CacheFiles(root_collection, key, holder, version);
+    }
+    return status;
+}
+
+}  // namespace meta
+}  // namespace engine
+}  // namespace milvus
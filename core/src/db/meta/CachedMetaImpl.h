@@ -0,0 +1,213 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Meta.h"
+
+namespace milvus {
+namespace engine {
+namespace meta {
+
+// Keeps the results of FilesToSearch, FilesToSearchEx and ShowPartitions in memory so that the search path does not
+// run sql for every query. The lists are kept per root collection, a partition counts for its owner. Meta mutations
+// are written through to the backend and then drop the cached lists of the roots they concern, recording a new
+// version on those roots, see CollectionVersion. A list read from the backend is only kept if its root did not
+// change in between. Only valid when this process is the single writer of the meta.
+class CachedMetaImpl : public Meta {
+ public:
+    explicit CachedMetaImpl(MetaPtr meta);
+    ~CachedMetaImpl() = default;
+
+    Status
+    CreateCollection(CollectionSchema& table_schema) override;
+
+    Status
+    DescribeCollection(CollectionSchema& table_schema) override;
+
+    Status
+    HasCollection(const std::string& collection_id, bool& has_or_not, bool is_root = false) override;
+
+    Status
+    AllCollections(std::vector<CollectionSchema>& table_schema_array, bool is_root = false) override;
+
+    Status
+    UpdateCollectionFlag(const std::string& collection_id, int64_t flag) override;
+
+    Status
+    UpdateCollectionFlushLSN(const std::string& collection_id, uint64_t flush_lsn) override;
+
+    Status
+    GetCollectionFlushLSN(const std::string& collection_id, uint64_t& flush_lsn) override;
+
+    Status
+    DropCollections(const std::vector<std::string>& collection_id_array) override;
+
+    Status
+    DeleteCollectionFiles(const std::vector<std::string>& collection_id_array) override;
+
+    Status
+    CreateCollectionFile(SegmentSchema& file_schema) override;
+
+    Status
+    GetCollectionFiles(const std::string& collection_id, const std::vector<size_t>& ids,
+                       FilesHolder& files_holder) override;
+
+    Status
+    GetCollectionFilesBySegmentId(const std::string& segment_id, FilesHolder& files_holder) override;
+
+    Status
+    UpdateCollectionFile(SegmentSchema& file_schema) override;
+
+    Status
+    UpdateCollectionFiles(SegmentsSchema& files) override;
+
+    Status
+    UpdateCollectionFilesRowCount(SegmentsSchema& files) override;
+
+    Status
+    UpdateCollectionIndex(const std::string& collection_id, const CollectionIndex& index) override;
+
+    Status
+    UpdateCollectionFilesToIndex(const std::string& collection_id) override;
+
+    Status
+    DescribeCollectionIndex(const std::string& collection_id, CollectionIndex& index) override;
+
+    Status
+    DropCollectionIndex(const std::string& collection_id) override;
+
+    Status
+    CreatePartition(const std::string& collection_name, const std::string& partition_name, const std::string& tag,
+                    uint64_t lsn) override;
+
+    Status
+    HasPartition(const std::string& collection_id, const std::string& tag, bool& has_or_not) override;
+
+    Status
+    DropPartition(const std::string& partition_name) override;
+
+    Status
+    ShowPartitions(const std::string& collection_name,
+                   std::vector<meta::CollectionSchema>& partition_schema_array) override;
+
+    Status
+    GetPartitionName(const std::string& collection_name, const std::string& tag, std::string& partition_name) override;
+
+    Status
+    FilesToSearch(const std::string& collection_id, FilesHolder& files_holder) override;
+
+    Status
+    FilesToSearchEx(const std::string& root_collection, const std::set<std::string>& partition_id_array,
+                    FilesHolder& files_holder) override;
+
+    Status
+    FilesToMerge(const std::string& collection_id, FilesHolder& files_holder) override;
+
+    Status
+    FilesToIndex(FilesHolder& files_holder) override;
+
+    Status
+    FilesByType(const std::string& collection_id, const std::vector<int>& file_types,
+                FilesHolder& files_holder) override;
+
+    Status
+    FilesByTypeEx(const std::vector<meta::CollectionSchema>& collections, const std::vector<int>& file_types,
+                  FilesHolder& files_holder) override;
+
+    Status
+    FilesByID(const std::vector<size_t>& ids, FilesHolder& files_holder) override;
+
+    Status
+    Size(uint64_t& result) override;
+
+    Status
+    Archive() override;
+
+    Status
+    CleanUpShadowFiles() override;
+
+    Status
+    CleanUpFilesWithTTL(uint64_t seconds) override;
+
+    Status
+    DropAll() override;
+
+    Status
+    Count(const std::string& collection_id, uint64_t& result) override;
+
+    Status
+    SetGlobalLastLSN(uint64_t lsn) override;
+
+    Status
+    GetGlobalLastLSN(uint64_t& lsn) override;
+
+    Status
+    CreateHybridCollection(CollectionSchema& collection_schema, hybrid::FieldsSchema& fields_schema) override;
+
+    Status
+    DescribeHybridCollection(CollectionSchema& collection_schema, hybrid::FieldsSchema& fields_schema) override;
+
+    uint64_t
+    CacheVersion();
+
+    // moves on whenever the searchable files or row counts of the collection or of one of its partitions change
+    uint64_t
+    CollectionVersion(const std::string& collection_id);
+
+ private:
+    void
+    Invalidate();
+
+    // roots are the collections whose version moves, partitions count for their owner
+    void
+    Invalidate(const std::vector<std::string>& roots);
+
+    // resolved before a mutation, a dropped partition can't be described any more
+    std::string
+    RootOf(const std::string& collection_id);
+
+    std::vector<std::string>
+    RootsOf(const SegmentsSchema& files);
+
+    // the caller holds cache_mutex_
+    uint64_t
+    VersionOf(const std::string& root);
+
+    bool
+    GetCachedFiles(const std::string& root, const std::string& key, FilesHolder& files_holder, uint64_t& version);
+
+    void
+    CacheFiles(const std::string& root, const std::string& key, const FilesHolder& files_holder, uint64_t version);
+
+ private:
+    MetaPtr meta_;
+
+    std::mutex cache_mutex_;
+    uint64_t version_ = 0;
+    uint64_t floor_version_ = 0;  // version of the last drop that concerned all collections
+    std::unordered_map<std::string, uint64_t> collection_versions_;
+    std::unordered_map<std::string, std::string> owners_;
+    // by root, then by the collection or partitions searched
+    std::unordered_map<std::string, std::unordered_map<std::string, SegmentsSchema>> files_cache_;
+    std::unordered_map<std::string, std::vector<CollectionSchema>> partitions_cache_;
+};  // CachedMetaImpl
+
+}  // namespace meta
+}  // namespace engine
+}  // namespace milvus
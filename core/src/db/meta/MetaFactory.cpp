@@ -10,6 +10,7 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include "db/meta/MetaFactory.h"
+#include "CachedMetaImpl.h"
 #include "MySQLMetaImpl.h"
 #include "SqliteMetaImpl.h"
 #include "db/Utils.h"
@@ -55,16 +56,23 @@ MetaFactory::Build(const DBMetaOptions& meta_options, const int& mode) {
         throw InvalidArgumentException("Wrong URI format ");
     }
 
+    meta::MetaPtr meta_ptr;
     if (strcasecmp(uri_info.dialect_.c_str(), "mysql") == 0) {
         LOG_ENGINE_INFO_ << "Using MySQL";
-        return std::make_shared<meta::MySQLMetaImpl>(meta_options, mode);
+        meta_ptr = std::make_shared<meta::MySQLMetaImpl>(meta_options, mode);
     } else if (strcasecmp(uri_info.dialect_.c_str(), "sqlite") == 0) {
         LOG_ENGINE_INFO_ << "Using SQLite";
-        return std::make_shared<meta::SqliteMetaImpl>(meta_options);
+        meta_ptr = std::make_shared<meta::SqliteMetaImpl>(meta_options);
     } else {
         LOG_ENGINE_ERROR_ << "Invalid dialect in URI: dialect = " << uri_info.dialect_;
         throw InvalidArgumentException("URI dialect is not mysql / sqlite");
     }
+
+    // readonly nodes see meta changes made by the writable node, they can't cache
+    if (mode == DBOptions::MODE::CLUSTER_READONLY) {
+        return meta_ptr;
+    }
+    return std::make_shared<meta::CachedMetaImpl>(meta_ptr);
 }
 
 }  // namespace engine
@@ -42,17 +42,21 @@ enum class EngineType {
     ANNOY = 12,
     FAISS_IVFSQ8NR = 13,
     HNSW_SQ8NR = 14,
-    MAX_VALUE = HNSW_SQ8NR,
+    FAISS_IVFPQFS = 15,
+    DISKANN = 16,
+    MAX_VALUE = DISKANN,
 };
 
 static std::map<std::string, EngineType> s_map_engine_type = {
     {knowhere::IndexEnum::INDEX_FAISS_IDMAP, EngineType::FAISS_IDMAP},
     {knowhere::IndexEnum::INDEX_FAISS_IVFFLAT, EngineType::FAISS_IVFFLAT},
     {knowhere::IndexEnum::INDEX_FAISS_IVFPQ, EngineType::FAISS_PQ},
+    {knowhere::IndexEnum::INDEX_FAISS_IVFPQFS, EngineType::FAISS_IVFPQFS},
     {knowhere::IndexEnum::INDEX_FAISS_IVFSQ8, EngineType::FAISS_IVFSQ8},
     {knowhere::IndexEnum::INDEX_FAISS_IVFSQ8NR, EngineType::FAISS_IVFSQ8NR},
     {knowhere::IndexEnum::INDEX_FAISS_IVFSQ8H, EngineType::FAISS_IVFSQ8H},
     {knowhere::IndexEnum::INDEX_NSG, EngineType::NSG_MIX},
+    {knowhere::IndexEnum::INDEX_DISKANN, EngineType::DISKANN},
 #ifdef MILVUS_SUPPORT_SPTAG
     {knowhere::IndexEnum::INDEX_SPTAG_KDT_RNT, EngineType::SPTAG_KDT},
     {knowhere::IndexEnum::INDEX_SPTAG_BKT_RNT, EngineType::SPTAG_BKT},
@@ -81,6 +85,9 @@ constexpr char CURRENT_VERSION[] = MILVUS_VERSION;
 
 constexpr int64_t FLAG_MASK_NO_USERID = 0x1;
 constexpr int64_t FLAG_MASK_HAS_USERID = 0x1 << 1;
+// raw vectors of the collection are stored in half precision, only FAISS_IDMAP also searches them that way
+constexpr int64_t FLAG_MASK_FP16_VECTOR = 0x1 << 2;
+constexpr int64_t FLAG_MASK_BF16_VECTOR = 0x1 << 3;
 
 using DateT = int;
 const DateT EmptyDate = -1;
@@ -2614,6 +2614,7 @@ MySQLMetaImpl::CleanUpFilesWithTTL(uint64_t seconds /*, CleanUpFilter* filter*/)
                 // because GetCollectionFilePath won't able to generate file path after the file is deleted
                 utils::GetCollectionFilePath(options_, collection_file);
                 utils::EraseFromCache(collection_file.location_);
+                utils::EraseFromCache(utils::GetIncrementalIndexPath(collection_file.location_));
 
                 if (collection_file.file_type_ == (int)SegmentSchema::TO_DELETE) {
                     // delete file from disk storage
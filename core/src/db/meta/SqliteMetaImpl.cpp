@@ -1867,6 +1867,7 @@ SqliteMetaImpl::CleanUpFilesWithTTL(uint64_t seconds /*, CleanUpFilter* filter*/
                 // TODO(zhiru): clean up
                 utils::GetCollectionFilePath(options_, collection_file);
                 utils::EraseFromCache(collection_file.location_);
+                utils::EraseFromCache(utils::GetIncrementalIndexPath(collection_file.location_));
 
                 if (collection_file.file_type_ == (int)SegmentSchema::TO_DELETE) {
                     // delete file from meta
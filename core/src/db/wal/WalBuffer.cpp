@@ -11,6 +11,11 @@
 
 #include "db/wal/WalBuffer.h"
 
+#include <lz4.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include <algorithm>
 #include <cstring>
 #include <utility>
 #include <vector>
@@ -38,8 +43,8 @@ ParserLsn(uint64_t lsn, uint32_t& file_no, uint32_t& offset) {
     offset = uint32_t(lsn & LSN_OFFSET_MASK);
 }
 
-MXLogBuffer::MXLogBuffer(const std::string& mxlog_path, const uint32_t buffer_size)
-    : mxlog_buffer_size_(buffer_size * UNIT_MB), mxlog_writer_(mxlog_path) {
+MXLogBuffer::MXLogBuffer(const std::string& mxlog_path, const uint32_t buffer_size, bool compression_enable)
+    : mxlog_buffer_size_(buffer_size * UNIT_MB), mxlog_writer_(mxlog_path), compression_enable_(compression_enable) {
 }
 
 MXLogBuffer::~MXLogBuffer() {
@@ -72,7 +77,9 @@ MXLogBuffer::Init(uint64_t start_lsn, uint64_t end_lsn) {
         uint32_t buffer_size_need = 0;
         for (auto i = mxlog_buffer_reader_.file_no; i < mxlog_buffer_writer_.file_no; i++) {
             file_handler.SetFileName(ToFileName(i));
-            auto file_size = file_handler.GetFileSize();
+            file_handler.SetFileOpenMode("r");
+            auto file_size = LogicalFileSize(file_handler);
+            file_handler.CloseFile();
             if (file_size == 0) {
                 LOG_WAL_ERROR_ << "bad wal file " << i;
                 return false;
@@ -102,6 +109,7 @@ MXLogBuffer::Init(uint64_t start_lsn, uint64_t end_lsn) {
         mxlog_writer_.SetFileName(ToFileName(mxlog_buffer_writer_.file_no));
         if (mxlog_buffer_writer_.buf_offset == 0) {
             mxlog_writer_.SetFileOpenMode("w");
+            writer_compressed_ = compression_enable_;
 
         } else {
             mxlog_writer_.SetFileOpenMode("r+");
@@ -112,7 +120,7 @@ MXLogBuffer::Init(uint64_t start_lsn, uint64_t end_lsn) {
 
             auto read_offset = mxlog_buffer_reader_.buf_offset;
             auto read_size = mxlog_buffer_writer_.buf_offset - mxlog_buffer_reader_.buf_offset;
-            if (!mxlog_writer_.Load(buf_[0].get() + read_offset, read_offset, read_size)) {
+            if (!LoadWriterFile(buf_[0].get(), read_offset, read_size)) {
                 LOG_WAL_ERROR_ << "load wal file error " << read_offset << " " << read_size;
                 return false;
             }
@@ -127,8 +135,10 @@ MXLogBuffer::Init(uint64_t start_lsn, uint64_t end_lsn) {
         file_handler.SetFileOpenMode("r");
 
         auto read_offset = mxlog_buffer_reader_.buf_offset;
-        auto read_size = file_handler.Load(buf_[0].get() + read_offset, read_offset);
-        mxlog_buffer_reader_.max_offset = read_size + read_offset;
+        if (!LoadFile(file_handler, buf_[0].get(), read_offset, mxlog_buffer_reader_.max_offset)) {
+            LOG_WAL_ERROR_ << "load wal file error " << mxlog_buffer_reader_.file_no;
+            return false;
+        }
         file_handler.CloseFile();
 
         // write buffer
@@ -140,7 +150,7 @@ MXLogBuffer::Init(uint64_t start_lsn, uint64_t end_lsn) {
             LOG_WAL_ERROR_ << "wal file not exist " << mxlog_buffer_writer_.file_no;
             return false;
         }
-        if (!mxlog_writer_.Load(buf_[1].get(), 0, mxlog_buffer_writer_.buf_offset)) {
+        if (!LoadWriterFile(buf_[1].get(), 0, mxlog_buffer_writer_.buf_offset)) {
             LOG_WAL_ERROR_ << "load wal file error " << mxlog_buffer_writer_.file_no;
             return false;
         }
@@ -170,6 +180,7 @@ MXLogBuffer::Reset(uint64_t lsn) {
     mxlog_writer_.CloseFile();
     mxlog_writer_.SetFileName(ToFileName(mxlog_buffer_writer_.file_no));
     mxlog_writer_.SetFileOpenMode("w");
+    writer_compressed_ = compression_enable_;
 
     SetFileNoFrom(mxlog_buffer_reader_.file_no);
 }
@@ -233,6 +244,7 @@ MXLogBuffer::Append(MXLogRecord& record) {
             LOG_WAL_ERROR_ << "ReBorn wal file error " << mxlog_buffer_writer_.file_no;
             return WAL_FILE_ERROR;
         }
+        writer_compressed_ = compression_enable_;
     }
 
     // point to the offset of current record in wal file
@@ -269,7 +281,7 @@ MXLogBuffer::Append(MXLogRecord& record) {
         current_write_offset += record.data_size;
     }
 
-    bool write_rst = mxlog_writer_.Write(current_write_buf + mxlog_buffer_writer_.buf_offset, record_size);
+    bool write_rst = WriteRecord(current_write_buf + mxlog_buffer_writer_.buf_offset, record_size);
     if (!write_rst) {
         LOG_WAL_ERROR_ << "write wal file error";
         return WAL_FILE_ERROR;
@@ -311,6 +323,7 @@ MXLogBuffer::AppendEntity(milvus::engine::wal::MXLogRecord& record) {
             LOG_WAL_ERROR_ << "ReBorn wal file error " << mxlog_buffer_writer_.file_no;
             return WAL_FILE_ERROR;
         }
+        writer_compressed_ = compression_enable_;
     }
 
     // point to the offset of current record in wal file
@@ -379,7 +392,7 @@ MXLogBuffer::AppendEntity(milvus::engine::wal::MXLogRecord& record) {
         }
     }
 
-    bool write_rst = mxlog_writer_.Write(current_write_buf + mxlog_buffer_writer_.buf_offset, record_size);
+    bool write_rst = WriteRecord(current_write_buf + mxlog_buffer_writer_.buf_offset, record_size);
     if (!write_rst) {
         LOG_WAL_ERROR_ << "write wal file error";
         return WAL_FILE_ERROR;
@@ -421,8 +434,8 @@ MXLogBuffer::Next(const uint64_t last_applied_lsn, MXLogRecord& record) {
         MXLogFileHandler mxlog_reader(mxlog_writer_.GetFilePath());
         mxlog_reader.SetFileName(ToFileName(mxlog_buffer_reader_.file_no));
         mxlog_reader.SetFileOpenMode("r");
-        uint32_t file_size = mxlog_reader.Load(buf_[mxlog_buffer_reader_.buf_idx].get(), 0);
-        if (file_size == 0) {
+        uint32_t file_size = 0;
+        if (!LoadFile(mxlog_reader, buf_[mxlog_buffer_reader_.buf_idx].get(), 0, file_size) || file_size == 0) {
             LOG_WAL_ERROR_ << "load wal file error " << mxlog_buffer_reader_.file_no;
             return WAL_FILE_ERROR;
         }
@@ -501,8 +514,8 @@ MXLogBuffer::NextEntity(const uint64_t last_applied_lsn, milvus::engine::wal::MX
         MXLogFileHandler mxlog_reader(mxlog_writer_.GetFilePath());
         mxlog_reader.SetFileName(ToFileName(mxlog_buffer_reader_.file_no));
         mxlog_reader.SetFileOpenMode("r");
-        uint32_t file_size = mxlog_reader.Load(buf_[mxlog_buffer_reader_.buf_idx].get(), 0);
-        if (file_size == 0) {
+        uint32_t file_size = 0;
+        if (!LoadFile(mxlog_reader, buf_[mxlog_buffer_reader_.buf_idx].get(), 0, file_size) || file_size == 0) {
             LOG_WAL_ERROR_ << "load wal file error " << mxlog_buffer_reader_.file_no;
             return WAL_FILE_ERROR;
         }
@@ -603,6 +616,149 @@ MXLogBuffer::NextEntity(const uint64_t last_applied_lsn, milvus::engine::wal::MX
     return WAL_SUCCESS;
 }
 
+bool
+MXLogBuffer::IsCompressedFile(MXLogFileHandler& file_handler) {
+    char magic[SizeOfMXLogCompressedMagic];
+    if (file_handler.GetFileSize() < SizeOfMXLogCompressedMagic ||
+        !file_handler.Load(magic, 0, SizeOfMXLogCompressedMagic)) {
+        return false;
+    }
+    // a raw wal file starts with the lsn of its first record, whose high bytes are the file No.
+    return memcmp(magic, MXLogCompressedMagic, SizeOfMXLogCompressedMagic) == 0;
+}
+
+uint32_t
+MXLogBuffer::LogicalFileSize(MXLogFileHandler& file_handler) {
+    if (!IsCompressedFile(file_handler)) {
+        return file_handler.GetFileSize();
+    }
+
+    // only frame headers are read, a torn frame at the tail is not counted
+    uint32_t file_size = file_handler.GetFileSize();
+    uint32_t physical_offset = SizeOfMXLogCompressedMagic;
+    uint32_t logical_size = 0;
+    MXLogFrameHeader frame;
+    while (physical_offset + SizeOfMXLogFrameHeader <= file_size) {
+        file_handler.Load((char*)&frame, physical_offset, SizeOfMXLogFrameHeader);
+        physical_offset += SizeOfMXLogFrameHeader;
+        if (file_size - physical_offset < frame.compressed_size) {
+            break;
+        }
+        physical_offset += frame.compressed_size;
+        logical_size += frame.raw_size;
+    }
+    return logical_size;
+}
+
+bool
+MXLogBuffer::DecodeFile(MXLogFileHandler& file_handler, char* buf, uint32_t logical_limit, uint32_t& logical_size,
+                        uint32_t& physical_size) {
+    std::vector<char> file_data(file_handler.GetFileSize());
+    uint32_t file_size = file_handler.Load(file_data.data(), 0);
+
+    logical_size = 0;
+    physical_size = SizeOfMXLogCompressedMagic;
+    while (logical_size < logical_limit && physical_size + SizeOfMXLogFrameHeader <= file_size) {
+        MXLogFrameHeader frame;
+        memcpy(&frame, file_data.data() + physical_size, SizeOfMXLogFrameHeader);
+        const char* payload = file_data.data() + physical_size + SizeOfMXLogFrameHeader;
+        if (file_size - physical_size - SizeOfMXLogFrameHeader < frame.compressed_size) {
+            // the last append was interrupted, nothing behind it was acknowledged
+            LOG_WAL_WARNING_ << "torn frame at the tail of wal file " << file_handler.GetFileName();
+            break;
+        }
+        if (frame.raw_size > mxlog_buffer_size_ - logical_size) {
+            LOG_WAL_ERROR_ << "wal file " << file_handler.GetFileName() << " exceeds buffer size";
+            return false;
+        }
+
+        char* dst = buf + logical_size;
+        if (frame.compressed_size == frame.raw_size) {
+            memcpy(dst, payload, frame.raw_size);
+        } else if (LZ4_decompress_safe(payload, dst, frame.compressed_size, frame.raw_size) != (int)frame.raw_size) {
+            LOG_WAL_ERROR_ << "decompress wal frame error, file " << file_handler.GetFileName() << " offset "
+                           << physical_size;
+            return false;
+        }
+        if (crc32(0L, (const Bytef*)dst, frame.raw_size) != frame.crc) {
+            LOG_WAL_ERROR_ << "wal frame crc mismatch, file " << file_handler.GetFileName() << " offset "
+                           << physical_size;
+            return false;
+        }
+
+        logical_size += frame.raw_size;
+        physical_size += SizeOfMXLogFrameHeader + frame.compressed_size;
+    }
+    return true;
+}
+
+bool
+MXLogBuffer::LoadFile(MXLogFileHandler& file_handler, char* buf, uint32_t data_offset, uint32_t& file_end) {
+    if (!IsCompressedFile(file_handler)) {
+        file_end = data_offset + file_handler.Load(buf + data_offset, data_offset);
+        return true;
+    }
+
+    uint32_t physical_size = 0;
+    return DecodeFile(file_handler, buf, UINT32_MAX, file_end, physical_size);
+}
+
+bool
+MXLogBuffer::LoadWriterFile(char* buf, uint32_t data_offset, uint32_t data_size) {
+    writer_compressed_ = IsCompressedFile(mxlog_writer_);
+    if (!writer_compressed_) {
+        return mxlog_writer_.Load(buf + data_offset, data_offset, data_size);
+    }
+
+    uint32_t logical_size = 0;
+    uint32_t physical_size = 0;
+    if (!DecodeFile(mxlog_writer_, buf, data_offset + data_size, logical_size, physical_size) ||
+        logical_size != data_offset + data_size) {
+        return false;
+    }
+
+    // frames behind the write lsn are dropped, the same as a raw file overwrites them
+    if (logical_size == 0) {
+        physical_size = 0;
+    }
+    mxlog_writer_.CloseFile();
+    if (truncate((mxlog_writer_.GetFilePath() + mxlog_writer_.GetFileName()).c_str(), physical_size) != 0) {
+        return false;
+    }
+    mxlog_writer_.SetFileOpenMode("a");
+    return mxlog_writer_.OpenFile();
+}
+
+bool
+MXLogBuffer::WriteRecord(char* data, uint32_t data_size) {
+    if (!writer_compressed_) {
+        return mxlog_writer_.Write(data, data_size);
+    }
+
+    // the first record of a file carries the file magic, so that one fwrite covers the whole frame
+    uint32_t magic_size = (mxlog_buffer_writer_.buf_offset == 0) ? SizeOfMXLogCompressedMagic : 0;
+    int bound = (data_size <= LZ4_MAX_INPUT_SIZE) ? LZ4_compressBound(data_size) : 0;
+    frame_buf_.resize(magic_size + SizeOfMXLogFrameHeader + std::max((uint32_t)bound, data_size));
+    memcpy(frame_buf_.data(), MXLogCompressedMagic, magic_size);
+
+    MXLogFrameHeader frame;
+    frame.raw_size = data_size;
+    frame.crc = crc32(0L, (const Bytef*)data, data_size);
+
+    char* payload = frame_buf_.data() + magic_size + SizeOfMXLogFrameHeader;
+    int compressed_size = (bound > 0) ? LZ4_compress_default(data, payload, data_size, bound) : 0;
+    if (compressed_size > 0 && (uint32_t)compressed_size < data_size) {
+        frame.compressed_size = compressed_size;
+    } else {
+        // incompressible, store it as is
+        memcpy(payload, data, data_size);
+        frame.compressed_size = data_size;
+    }
+    memcpy(frame_buf_.data() + magic_size, &frame, SizeOfMXLogFrameHeader);
+
+    return mxlog_writer_.Write(frame_buf_.data(), magic_size + SizeOfMXLogFrameHeader + frame.compressed_size);
+}
+
 uint64_t
 MXLogBuffer::GetReadLsn() {
     uint64_t read_lsn;
@@ -633,7 +789,7 @@ MXLogBuffer::ResetWriteLsn(uint64_t lsn) {
         LOG_WAL_ERROR_ << "reborn file error " << mxlog_buffer_writer_.file_no;
         return false;
     }
-    if (!mxlog_writer_.Load(buf_[mxlog_buffer_writer_.buf_idx].get(), 0, mxlog_buffer_writer_.buf_offset)) {
+    if (!LoadWriterFile(buf_[mxlog_buffer_writer_.buf_idx].get(), 0, mxlog_buffer_writer_.buf_offset)) {
         LOG_WAL_ERROR_ << "load file error";
         return false;
     }
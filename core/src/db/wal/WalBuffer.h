@@ -47,8 +47,21 @@ struct MXLogAttrRecordHeader {
     std::vector<uint64_t> attr_nbytes;
 };
 
+// A compressed wal file starts with MXLogCompressedMagic followed by one frame per appended record.
+// Lsn offsets stay the offsets of the raw records, frames only exist on disk.
+struct MXLogFrameHeader {
+    uint32_t raw_size;
+    uint32_t compressed_size;  // equal to raw_size if the record is stored uncompressed
+    uint32_t crc;              // crc32 of the raw record
+};
+
+const uint32_t SizeOfMXLogFrameHeader = sizeof(MXLogFrameHeader);
+
 #pragma pack(pop)
 
+const char MXLogCompressedMagic[] = "MXLOGZ01";
+const uint32_t SizeOfMXLogCompressedMagic = sizeof(MXLogCompressedMagic) - 1;
+
 struct MXLogBufferHandler {
     uint32_t max_offset;
     uint32_t file_no;
@@ -60,7 +73,7 @@ using BufferPtr = std::shared_ptr<char[]>;
 
 class MXLogBuffer {
  public:
-    MXLogBuffer(const std::string& mxlog_path, const uint32_t buffer_size);
+    MXLogBuffer(const std::string& mxlog_path, const uint32_t buffer_size, bool compression_enable = false);
     ~MXLogBuffer();
 
     bool
@@ -109,6 +122,29 @@ class MXLogBuffer {
     EntityRecordSize(const milvus::engine::wal::MXLogRecord& record, uint32_t attr_num,
                      std::vector<uint32_t>& field_name_size);
 
+    bool
+    IsCompressedFile(MXLogFileHandler& file_handler);
+
+    // raw size of a wal file, the sum of the frame sizes for compressed files
+    uint32_t
+    LogicalFileSize(MXLogFileHandler& file_handler);
+
+    // decode the frames of a compressed file into buf until logical_limit is reached
+    bool
+    DecodeFile(MXLogFileHandler& file_handler, char* buf, uint32_t logical_limit, uint32_t& logical_size,
+               uint32_t& physical_size);
+
+    // load a wal file into buf from data_offset, file_end is the raw end offset of the file
+    bool
+    LoadFile(MXLogFileHandler& file_handler, char* buf, uint32_t data_offset, uint32_t& file_end);
+
+    // load [data_offset, data_offset + data_size) of the opened writer file and prepare appending after it
+    bool
+    LoadWriterFile(char* buf, uint32_t data_offset, uint32_t data_size);
+
+    bool
+    WriteRecord(char* data, uint32_t data_size);
+
  private:
     uint32_t mxlog_buffer_size_;  // from config
     BufferPtr buf_[2];
@@ -117,6 +153,9 @@ class MXLogBuffer {
     MXLogBufferHandler mxlog_buffer_reader_;
     MXLogBufferHandler mxlog_buffer_writer_;
     MXLogFileHandler mxlog_writer_;
+    bool compression_enable_;  // from config, applies to new wal files
+    bool writer_compressed_ = false;
+    std::vector<char> frame_buf_;
 };
 
 using MXLogBufferPtr = std::shared_ptr<MXLogBuffer>;
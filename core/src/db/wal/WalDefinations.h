@@ -51,6 +51,7 @@ struct MXLogRecord {
 
 struct MXLogConfiguration {
     bool recovery_error_ignore;
+    bool compression_enable = false;  // new wal files are written as lz4 frames
     uint32_t buffer_size;
     std::string mxlog_path;
 };
@@ -57,6 +57,7 @@ WalManager::Init(const meta::MetaPtr& meta) {
     p_meta_handler_ = std::make_shared<MXLogMetaHandler>(mxlog_config_.mxlog_path);
     if (p_meta_handler_ != nullptr) {
         p_meta_handler_->GetMXLogInternalMeta(applied_lsn);
+        p_meta_handler_->GetMXLogCheckpoint(checkpoint_);
     }
 
     uint64_t recovery_start = 0;
@@ -84,7 +85,7 @@ WalManager::Init(const meta::MetaPtr& meta) {
             for (auto& col_schema : collention_schema_array) {
                 auto& collection = collections_[col_schema.collection_id_];
                 auto& default_part = collection[""];
-                default_part.flush_lsn = col_schema.flush_lsn_;
+                default_part.flush_lsn = CheckpointedLsn(col_schema.collection_id_, "", col_schema.flush_lsn_);
                 update_limit_lsn(default_part.flush_lsn);
 
                 std::vector<meta::CollectionSchema> partition_schema_array;
@@ -94,7 +95,8 @@ WalManager::Init(const meta::MetaPtr& meta) {
                 }
                 for (auto& par_schema : partition_schema_array) {
                     auto& partition = collection[par_schema.partition_tag_];
-                    partition.flush_lsn = par_schema.flush_lsn_;
+                    partition.flush_lsn =
+                        CheckpointedLsn(col_schema.collection_id_, par_schema.partition_tag_, par_schema.flush_lsn_);
                     update_limit_lsn(partition.flush_lsn);
                 }
             }
@@ -122,7 +124,8 @@ WalManager::Init(const meta::MetaPtr& meta) {
     }
 
     ErrorCode error_code = WAL_ERROR;
-    p_buffer_ = std::make_shared<MXLogBuffer>(mxlog_config_.mxlog_path, mxlog_config_.buffer_size);
+    p_buffer_ = std::make_shared<MXLogBuffer>(mxlog_config_.mxlog_path, mxlog_config_.buffer_size,
+                                              mxlog_config_.compression_enable);
     if (p_buffer_ != nullptr) {
         if (p_buffer_->Init(recovery_start, applied_lsn)) {
             error_code = WAL_SUCCESS;
@@ -138,6 +141,7 @@ WalManager::Init(const meta::MetaPtr& meta) {
     mxlog_config_.buffer_size = p_buffer_->GetBufferSize();
 
     last_applied_lsn_ = applied_lsn;
+    LOG_WAL_INFO_ << "wal recovery starts from lsn " << recovery_start << ", applied lsn " << applied_lsn;
     return error_code;
 }
 
@@ -147,6 +151,7 @@ WalManager::Init() {
     p_meta_handler_ = std::make_shared<MXLogMetaHandler>(mxlog_config_.mxlog_path);
     if (p_meta_handler_ != nullptr) {
         p_meta_handler_->GetMXLogInternalMeta(applied_lsn);
+        p_meta_handler_->GetMXLogCheckpoint(checkpoint_);
     }
 
     uint64_t recovery_start = 0;
@@ -178,7 +183,7 @@ WalManager::Init() {
                 return WAL_META_ERROR;
             }
 
-            default_part.flush_lsn = ss->GetMaxLsn();
+            default_part.flush_lsn = CheckpointedLsn(col_name, "", ss->GetMaxLsn());
             update_limit_lsn(default_part.flush_lsn);
 
             std::vector<std::string> partition_names = ss->GetPartitionNames();
@@ -190,7 +195,7 @@ WalManager::Init() {
                     return WAL_META_ERROR;
                 }
 
-                partition.flush_lsn = ss_part->GetLsn();
+                partition.flush_lsn = CheckpointedLsn(col_name, part_name, ss_part->GetLsn());
                 update_limit_lsn(partition.flush_lsn);
             }
         }
@@ -217,7 +222,8 @@ WalManager::Init() {
     }
 
     ErrorCode error_code = WAL_ERROR;
-    p_buffer_ = std::make_shared<MXLogBuffer>(mxlog_config_.mxlog_path, mxlog_config_.buffer_size);
+    p_buffer_ = std::make_shared<MXLogBuffer>(mxlog_config_.mxlog_path, mxlog_config_.buffer_size,
+                                              mxlog_config_.compression_enable);
     if (p_buffer_ != nullptr) {
         if (p_buffer_->Init(recovery_start, applied_lsn)) {
             error_code = WAL_SUCCESS;
@@ -233,6 +239,7 @@ WalManager::Init() {
     mxlog_config_.buffer_size = p_buffer_->GetBufferSize();
 
     last_applied_lsn_ = applied_lsn;
+    LOG_WAL_INFO_ << "wal recovery starts from lsn " << recovery_start << ", applied lsn " << applied_lsn;
     return error_code;
 }
 
@@ -255,12 +262,12 @@ WalManager::GetNextRecovery(MXLogRecord& record) {
             break;
         }
 
-        // background thread has not started.
+        // background thread has not started and recovery workers never touch the lsns,
         // so, needn't lock here.
         auto it_col = collections_.find(record.collection_id);
         if (it_col != collections_.end()) {
             auto it_part = it_col->second.find(record.partition_tag);
-            if (it_part->second.flush_lsn < record.lsn) {
+            if (it_part == it_col->second.end() || it_part->second.flush_lsn < record.lsn) {
                 break;
             }
         }
@@ -294,12 +301,12 @@ WalManager::GetNextEntityRecovery(milvus::engine::wal::MXLogRecord& record) {
             break;
         }
 
-        // background thread has not started.
+        // background thread has not started and recovery workers never touch the lsns,
         // so, needn't lock here.
         auto it_col = collections_.find(record.collection_id);
         if (it_col != collections_.end()) {
             auto it_part = it_col->second.find(record.partition_tag);
-            if (it_part->second.flush_lsn < record.lsn) {
+            if (it_part == it_col->second.end() || it_part->second.flush_lsn < record.lsn) {
                 break;
             }
         }
@@ -760,6 +767,41 @@ WalManager::Flush(const std::string& collection_id) {
     return lsn;
 }
 
+void
+WalManager::Checkpoint() {
+    MXLogCheckpoint checkpoint;
+    {
+        std::lock_guard<std::mutex> lck(mutex_);
+        for (auto& col : collections_) {
+            for (auto& part : col.second) {
+                checkpoint[col.first][part.first] = part.second.flush_lsn;
+            }
+        }
+    }
+
+    // flushes are applied by one thread at a time, skip when nothing changed since the last checkpoint
+    if (checkpoint == checkpoint_ || p_meta_handler_ == nullptr) {
+        return;
+    }
+    if (p_meta_handler_->SetMXLogCheckpoint(checkpoint)) {
+        checkpoint_.swap(checkpoint);
+    } else {
+        LOG_WAL_WARNING_ << "failed to write wal checkpoint";
+    }
+}
+
+uint64_t
+WalManager::CheckpointedLsn(const std::string& collection_id, const std::string& partition_tag, uint64_t lsn) {
+    auto it_col = checkpoint_.find(collection_id);
+    if (it_col != checkpoint_.end()) {
+        auto it_part = it_col->second.find(partition_tag);
+        if (it_part != it_col->second.end() && it_part->second > lsn) {
+            return it_part->second;
+        }
+    }
+    return lsn;
+}
+
 void
 WalManager::RemoveOldFiles(uint64_t flushed_lsn) {
     if (p_buffer_ != nullptr) {
@@ -190,10 +190,21 @@ class WalManager {
     void
     RemoveOldFiles(uint64_t flushed_lsn);
 
+    /*
+     * Persist the flushed lsn of every partition, so the next recovery skips what is flushed.
+     * Collections without new data keep an old flushed lsn in meta, only the checkpoint knows
+     * a later flush covered them.
+     */
+    void
+    Checkpoint();
+
  private:
     WalManager
     operator=(WalManager&);
 
+    uint64_t
+    CheckpointedLsn(const std::string& collection_id, const std::string& partition_tag, uint64_t lsn);
+
     MXLogConfiguration mxlog_config_;
 
     MXLogBufferPtr p_buffer_;
@@ -206,6 +217,7 @@ class WalManager {
     std::mutex mutex_;
     std::map<std::string, std::map<std::string, TableLsn>> collections_;
     std::atomic<uint64_t> last_applied_lsn_;
+    MXLogCheckpoint checkpoint_;
 
     // if multi-thread call Flush(), use list
     struct FlushInfo {
@@ -11,6 +11,7 @@
 
 #include "db/wal/WalMetaHandler.h"
 
+#include <cstdio>
 #include <cstring>
 
 namespace milvus {
@@ -18,8 +19,32 @@ namespace engine {
 namespace wal {
 
 const char* WAL_META_FILE_NAME = "mxlog.meta";
+const char* WAL_CHECKPOINT_FILE_NAME = "mxlog.checkpoint";
 
-MXLogMetaHandler::MXLogMetaHandler(const std::string& internal_meta_file_path) {
+namespace {
+
+constexpr uint64_t CHECKPOINT_MAGIC = 0x4d584c4f47434b50;  // "MXLOGCKP"
+
+bool
+WriteString(FILE* fp, const std::string& str) {
+    uint32_t len = str.length();
+    return fwrite(&len, sizeof(len), 1, fp) == 1 && (len == 0 || fwrite(str.data(), len, 1, fp) == 1);
+}
+
+bool
+ReadString(FILE* fp, std::string& str) {
+    uint32_t len = 0;
+    if (fread(&len, sizeof(len), 1, fp) != 1) {
+        return false;
+    }
+    str.resize(len);
+    return len == 0 || fread(&str[0], len, 1, fp) == 1;
+}
+
+}  // namespace
+
+MXLogMetaHandler::MXLogMetaHandler(const std::string& internal_meta_file_path)
+    : checkpoint_file_path_(internal_meta_file_path + WAL_CHECKPOINT_FILE_NAME) {
     std::string file_full_path = internal_meta_file_path + WAL_META_FILE_NAME;
 
     wal_meta_fp_ = fopen(file_full_path.c_str(), "r+");
@@ -67,6 +92,66 @@ MXLogMetaHandler::SetMXLogInternalMeta(uint64_t wal_lsn) {
     return false;
 }
 
+bool
+MXLogMetaHandler::GetMXLogCheckpoint(MXLogCheckpoint& checkpoint) {
+    checkpoint.clear();
+    FILE* fp = fopen(checkpoint_file_path_.c_str(), "rb");
+    if (fp == nullptr) {
+        return false;
+    }
+
+    // layout: magic, entry count, (collection id, partition tag, flushed lsn) per entry, magic
+    uint64_t magic = 0, count = 0;
+    bool ok = fread(&magic, sizeof(magic), 1, fp) == 1 && magic == CHECKPOINT_MAGIC &&
+              fread(&count, sizeof(count), 1, fp) == 1;
+    for (uint64_t i = 0; ok && i < count; ++i) {
+        std::string collection_id, partition_tag;
+        uint64_t lsn = 0;
+        ok = ReadString(fp, collection_id) && ReadString(fp, partition_tag) && fread(&lsn, sizeof(lsn), 1, fp) == 1;
+        if (ok) {
+            checkpoint[collection_id][partition_tag] = lsn;
+        }
+    }
+    ok = ok && fread(&magic, sizeof(magic), 1, fp) == 1 && magic == CHECKPOINT_MAGIC;
+    fclose(fp);
+
+    if (!ok) {
+        checkpoint.clear();
+    }
+    return ok;
+}
+
+bool
+MXLogMetaHandler::SetMXLogCheckpoint(const MXLogCheckpoint& checkpoint) {
+    std::string tmp_path = checkpoint_file_path_ + ".tmp";
+    FILE* fp = fopen(tmp_path.c_str(), "wb");
+    if (fp == nullptr) {
+        return false;
+    }
+
+    uint64_t count = 0;
+    for (auto& col : checkpoint) {
+        count += col.second.size();
+    }
+    bool ok = fwrite(&CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC), 1, fp) == 1 &&
+              fwrite(&count, sizeof(count), 1, fp) == 1;
+    for (auto& col : checkpoint) {
+        for (auto& part : col.second) {
+            ok = ok && WriteString(fp, col.first) && WriteString(fp, part.first) &&
+                 fwrite(&part.second, sizeof(part.second), 1, fp) == 1;
+        }
+    }
+    ok = ok && fwrite(&CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC), 1, fp) == 1;
+    ok = (fflush(fp) == 0) && ok;
+    fclose(fp);
+
+    if (!ok || rename(tmp_path.c_str(), checkpoint_file_path_.c_str()) != 0) {
+        remove(tmp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
 }  // namespace wal
 }  // namespace engine
 }  // namespace milvus
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -26,6 +27,10 @@ namespace engine {
 namespace wal {
 
 extern const char* WAL_META_FILE_NAME;
+extern const char* WAL_CHECKPOINT_FILE_NAME;
+
+// flushed lsn of every partition, keyed by collection id and partition tag
+using MXLogCheckpoint = std::map<std::string, std::map<std::string, uint64_t>>;
 
 class MXLogMetaHandler {
  public:
@@ -38,7 +43,22 @@ class MXLogMetaHandler {
     bool
     SetMXLogInternalMeta(uint64_t wal_lsn);
 
+    /*
+     * Read the last checkpoint, empty if there is none or it is damaged
+     * @param checkpoint[out]: flushed lsns
+     */
+    bool
+    GetMXLogCheckpoint(MXLogCheckpoint& checkpoint);
+
+    /*
+     * Replace the checkpoint, written to a temporary file and renamed so a crash keeps the old one
+     * @param checkpoint: flushed lsns
+     */
+    bool
+    SetMXLogCheckpoint(const MXLogCheckpoint& checkpoint);
+
  private:
+    std::string checkpoint_file_path_;
     FILE* wal_meta_fp_;
     uint64_t latest_wal_lsn_ = 0;
 };
@@ -49,7 +49,7 @@ struct TableStruct_milvus_2eproto {
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[51]
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[52]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
   static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
@@ -145,6 +145,9 @@ extern HSearchParamPBDefaultTypeInternal _HSearchParamPB_default_instance_;
 class IndexParam;
 class IndexParamDefaultTypeInternal;
 extern IndexParamDefaultTypeInternal _IndexParam_default_instance_;
+class InsertPackedParam;
+class InsertPackedParamDefaultTypeInternal;
+extern InsertPackedParamDefaultTypeInternal _InsertPackedParam_default_instance_;
 class InsertParam;
 class InsertParamDefaultTypeInternal;
 extern InsertParamDefaultTypeInternal _InsertParam_default_instance_;
@@ -243,6 +246,7 @@ template<> ::milvus::grpc::HSearchInSegmentsParam* Arena::CreateMaybeMessage<::m
 template<> ::milvus::grpc::HSearchParam* Arena::CreateMaybeMessage<::milvus::grpc::HSearchParam>(Arena*);
 template<> ::milvus::grpc::HSearchParamPB* Arena::CreateMaybeMessage<::milvus::grpc::HSearchParamPB>(Arena*);
 template<> ::milvus::grpc::IndexParam* Arena::CreateMaybeMessage<::milvus::grpc::IndexParam>(Arena*);
+template<> ::milvus::grpc::InsertPackedParam* Arena::CreateMaybeMessage<::milvus::grpc::InsertPackedParam>(Arena*);
 template<> ::milvus::grpc::InsertParam* Arena::CreateMaybeMessage<::milvus::grpc::InsertParam>(Arena*);
 template<> ::milvus::grpc::KeyValuePair* Arena::CreateMaybeMessage<::milvus::grpc::KeyValuePair>(Arena*);
 template<> ::milvus::grpc::Mapping* Arena::CreateMaybeMessage<::milvus::grpc::Mapping>(Arena*);
@@ -8579,6 +8583,197 @@ class HIndexParam :
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_milvus_2eproto;
 };
+// -------------------------------------------------------------------
+
+class InsertPackedParam :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:milvus.grpc.InsertPackedParam) */ {
+ public:
+  InsertPackedParam();
+  virtual ~InsertPackedParam();
+
+  InsertPackedParam(const InsertPackedParam& from);
+  InsertPackedParam(InsertPackedParam&& from) noexcept
+    : InsertPackedParam() {
+    *this = ::std::move(from);
+  }
+
+  inline InsertPackedParam& operator=(const InsertPackedParam& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InsertPackedParam& operator=(InsertPackedParam&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const InsertPackedParam& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const InsertPackedParam* internal_default_instance() {
+    return reinterpret_cast<const InsertPackedParam*>(
+               &_InsertPackedParam_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    51;
+
+  friend void swap(InsertPackedParam& a, InsertPackedParam& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InsertPackedParam* other) {
+    if (other == this) return;
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline InsertPackedParam* New() const final {
+    return CreateMaybeMessage<InsertPackedParam>(nullptr);
+  }
+
+  InsertPackedParam* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<InsertPackedParam>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const InsertPackedParam& from);
+  void MergeFrom(const InsertPackedParam& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(InsertPackedParam* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "milvus.grpc.InsertPackedParam";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_milvus_2eproto);
+    return ::descriptor_table_milvus_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRowIdArrayFieldNumber = 5,
+    kCollectionNameFieldNumber = 1,
+    kVectorDataFieldNumber = 4,
+    kPartitionTagFieldNumber = 6,
+    kDimensionFieldNumber = 2,
+    kRowCountFieldNumber = 3,
+  };
+  // repeated int64 row_id_array = 5;
+  int row_id_array_size() const;
+  void clear_row_id_array();
+  ::PROTOBUF_NAMESPACE_ID::int64 row_id_array(int index) const;
+  void set_row_id_array(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_row_id_array(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      row_id_array() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_row_id_array();
+
+  // string collection_name = 1;
+  void clear_collection_name();
+  const std::string& collection_name() const;
+  void set_collection_name(const std::string& value);
+  void set_collection_name(std::string&& value);
+  void set_collection_name(const char* value);
+  void set_collection_name(const char* value, size_t size);
+  std::string* mutable_collection_name();
+  std::string* release_collection_name();
+  void set_allocated_collection_name(std::string* collection_name);
+
+  // bytes vector_data = 4;
+  void clear_vector_data();
+  const std::string& vector_data() const;
+  void set_vector_data(const std::string& value);
+  void set_vector_data(std::string&& value);
+  void set_vector_data(const char* value);
+  void set_vector_data(const void* value, size_t size);
+  std::string* mutable_vector_data();
+  std::string* release_vector_data();
+  void set_allocated_vector_data(std::string* vector_data);
+
+  // string partition_tag = 6;
+  void clear_partition_tag();
+  const std::string& partition_tag() const;
+  void set_partition_tag(const std::string& value);
+  void set_partition_tag(std::string&& value);
+  void set_partition_tag(const char* value);
+  void set_partition_tag(const char* value, size_t size);
+  std::string* mutable_partition_tag();
+  std::string* release_partition_tag();
+  void set_allocated_partition_tag(std::string* partition_tag);
+
+  // int64 dimension = 2;
+  void clear_dimension();
+  ::PROTOBUF_NAMESPACE_ID::int64 dimension() const;
+  void set_dimension(::PROTOBUF_NAMESPACE_ID::int64 value);
+
+  // int64 row_count = 3;
+  void clear_row_count();
+  ::PROTOBUF_NAMESPACE_ID::int64 row_count() const;
+  void set_row_count(::PROTOBUF_NAMESPACE_ID::int64 value);
+
+  // @@protoc_insertion_point(class_scope:milvus.grpc.InsertPackedParam)
+ private:
+  class _Internal;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > row_id_array_;
+  mutable std::atomic<int> _row_id_array_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr collection_name_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr vector_data_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr partition_tag_;
+  ::PROTOBUF_NAMESPACE_ID::int64 dimension_;
+  ::PROTOBUF_NAMESPACE_ID::int64 row_count_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_milvus_2eproto;
+};
 // ===================================================================
 
 
@@ -14711,6 +14906,221 @@ HIndexParam::extra_params() const {
   return extra_params_;
 }
 
+// -------------------------------------------------------------------
+
+// InsertPackedParam
+
+// string collection_name = 1;
+inline void InsertPackedParam::clear_collection_name() {
+  collection_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& InsertPackedParam::collection_name() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.InsertPackedParam.collection_name)
+  return collection_name_.GetNoArena();
+}
+inline void InsertPackedParam::set_collection_name(const std::string& value) {
+  
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.InsertPackedParam.collection_name)
+}
+inline void InsertPackedParam::set_collection_name(std::string&& value) {
+  
+  collection_name_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.InsertPackedParam.collection_name)
+}
+inline void InsertPackedParam::set_collection_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.InsertPackedParam.collection_name)
+}
+inline void InsertPackedParam::set_collection_name(const char* value, size_t size) {
+  
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.InsertPackedParam.collection_name)
+}
+inline std::string* InsertPackedParam::mutable_collection_name() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.InsertPackedParam.collection_name)
+  return collection_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* InsertPackedParam::release_collection_name() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.InsertPackedParam.collection_name)
+  
+  return collection_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void InsertPackedParam::set_allocated_collection_name(std::string* collection_name) {
+  if (collection_name != nullptr) {
+    
+  } else {
+    
+  }
+  collection_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), collection_name);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.InsertPackedParam.collection_name)
+}
+
+// int64 dimension = 2;
+inline void InsertPackedParam::clear_dimension() {
+  dimension_ = PROTOBUF_LONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 InsertPackedParam::dimension() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.InsertPackedParam.dimension)
+  return dimension_;
+}
+inline void InsertPackedParam::set_dimension(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  
+  dimension_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.InsertPackedParam.dimension)
+}
+
+// int64 row_count = 3;
+inline void InsertPackedParam::clear_row_count() {
+  row_count_ = PROTOBUF_LONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 InsertPackedParam::row_count() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.InsertPackedParam.row_count)
+  return row_count_;
+}
+inline void InsertPackedParam::set_row_count(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  
+  row_count_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.InsertPackedParam.row_count)
+}
+
+// bytes vector_data = 4;
+inline void InsertPackedParam::clear_vector_data() {
+  vector_data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& InsertPackedParam::vector_data() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.InsertPackedParam.vector_data)
+  return vector_data_.GetNoArena();
+}
+inline void InsertPackedParam::set_vector_data(const std::string& value) {
+  
+  vector_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.InsertPackedParam.vector_data)
+}
+inline void InsertPackedParam::set_vector_data(std::string&& value) {
+  
+  vector_data_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.InsertPackedParam.vector_data)
+}
+inline void InsertPackedParam::set_vector_data(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  vector_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.InsertPackedParam.vector_data)
+}
+inline void InsertPackedParam::set_vector_data(const void* value, size_t size) {
+  
+  vector_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.InsertPackedParam.vector_data)
+}
+inline std::string* InsertPackedParam::mutable_vector_data() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.InsertPackedParam.vector_data)
+  return vector_data_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* InsertPackedParam::release_vector_data() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.InsertPackedParam.vector_data)
+  
+  return vector_data_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void InsertPackedParam::set_allocated_vector_data(std::string* vector_data) {
+  if (vector_data != nullptr) {
+    
+  } else {
+    
+  }
+  vector_data_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), vector_data);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.InsertPackedParam.vector_data)
+}
+
+// repeated int64 row_id_array = 5;
+inline int InsertPackedParam::row_id_array_size() const {
+  return row_id_array_.size();
+}
+inline void InsertPackedParam::clear_row_id_array() {
+  row_id_array_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 InsertPackedParam::row_id_array(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.InsertPackedParam.row_id_array)
+  return row_id_array_.Get(index);
+}
+inline void InsertPackedParam::set_row_id_array(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  row_id_array_.Set(index, value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.InsertPackedParam.row_id_array)
+}
+inline void InsertPackedParam::add_row_id_array(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  row_id_array_.Add(value);
+  // @@protoc_insertion_point(field_add:milvus.grpc.InsertPackedParam.row_id_array)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+InsertPackedParam::row_id_array() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.InsertPackedParam.row_id_array)
+  return row_id_array_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+InsertPackedParam::mutable_row_id_array() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.InsertPackedParam.row_id_array)
+  return &row_id_array_;
+}
+
+// string partition_tag = 6;
+inline void InsertPackedParam::clear_partition_tag() {
+  partition_tag_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& InsertPackedParam::partition_tag() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.InsertPackedParam.partition_tag)
+  return partition_tag_.GetNoArena();
+}
+inline void InsertPackedParam::set_partition_tag(const std::string& value) {
+  
+  partition_tag_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.InsertPackedParam.partition_tag)
+}
+inline void InsertPackedParam::set_partition_tag(std::string&& value) {
+  
+  partition_tag_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.InsertPackedParam.partition_tag)
+}
+inline void InsertPackedParam::set_partition_tag(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  partition_tag_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.InsertPackedParam.partition_tag)
+}
+inline void InsertPackedParam::set_partition_tag(const char* value, size_t size) {
+  
+  partition_tag_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.InsertPackedParam.partition_tag)
+}
+inline std::string* InsertPackedParam::mutable_partition_tag() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.InsertPackedParam.partition_tag)
+  return partition_tag_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* InsertPackedParam::release_partition_tag() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.InsertPackedParam.partition_tag)
+  
+  return partition_tag_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void InsertPackedParam::set_allocated_partition_tag(std::string* partition_tag) {
+  if (partition_tag != nullptr) {
+    
+  } else {
+    
+  }
+  partition_tag_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), partition_tag);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.InsertPackedParam.partition_tag)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -14814,6 +15224,8 @@ HIndexParam::extra_params() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -40,6 +40,8 @@ static std::unordered_map<int32_t, std::string> old_index_type_str_map = {
     {(int32_t)OldIndexType::ANNOY, IndexEnum::INDEX_ANNOY},
     {(int32_t)OldIndexType::HNSW_SQ8NR, IndexEnum::INDEX_HNSW_SQ8NR},
     {(int32_t)OldIndexType::FAISS_IVFSQ8NR, IndexEnum::INDEX_FAISS_IVFSQ8NR},
+    {(int32_t)OldIndexType::FAISS_IVFPQFS, IndexEnum::INDEX_FAISS_IVFPQFS},
+    {(int32_t)OldIndexType::DISKANN, IndexEnum::INDEX_DISKANN},
     {(int32_t)OldIndexType::FAISS_BIN_IDMAP, IndexEnum::INDEX_FAISS_BIN_IDMAP},
     {(int32_t)OldIndexType::FAISS_BIN_IVFLAT_CPU, IndexEnum::INDEX_FAISS_BIN_IVFFLAT},
 };
@@ -60,6 +62,8 @@ static std::unordered_map<std::string, int32_t> str_old_index_type_map = {
     {IndexEnum::INDEX_ANNOY, (int32_t)OldIndexType::ANNOY},
     {IndexEnum::INDEX_FAISS_IVFSQ8NR, (int32_t)OldIndexType::FAISS_IVFSQ8NR},
     {IndexEnum::INDEX_HNSW_SQ8NR, (int32_t)OldIndexType::HNSW_SQ8NR},
+    {IndexEnum::INDEX_FAISS_IVFPQFS, (int32_t)OldIndexType::FAISS_IVFPQFS},
+    {IndexEnum::INDEX_DISKANN, (int32_t)OldIndexType::DISKANN},
     {IndexEnum::INDEX_FAISS_BIN_IDMAP, (int32_t)OldIndexType::FAISS_BIN_IDMAP},
     {IndexEnum::INDEX_FAISS_BIN_IVFFLAT, (int32_t)OldIndexType::FAISS_BIN_IVFLAT_CPU},
 };
@@ -70,6 +74,7 @@ const char* INVALID = "";
 const char* INDEX_FAISS_IDMAP = "IDMAP";
 const char* INDEX_FAISS_IVFFLAT = "IVF_FLAT";
 const char* INDEX_FAISS_IVFPQ = "IVF_PQ";
+const char* INDEX_FAISS_IVFPQFS = "IVF_PQ_FS";
 const char* INDEX_FAISS_IVFSQ8 = "IVF_SQ8";
 const char* INDEX_FAISS_IVFSQ8NR = "IVF_SQ8NR";
 const char* INDEX_FAISS_IVFSQ8H = "IVF_SQ8_HYBRID";
@@ -83,6 +88,7 @@ const char* INDEX_SPTAG_BKT_RNT = "SPTAG_BKT_RNT";
 const char* INDEX_HNSW = "HNSW";
 const char* INDEX_ANNOY = "ANNOY";
 const char* INDEX_HNSW_SQ8NR = "HNSW_SQ8NR";
+const char* INDEX_DISKANN = "DISKANN";
 }  // namespace IndexEnum
 
 std::string
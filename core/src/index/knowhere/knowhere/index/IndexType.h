@@ -37,6 +37,8 @@ enum class OldIndexType {
     ANNOY,
     FAISS_IVFSQ8NR,
     HNSW_SQ8NR,
+    FAISS_IVFPQFS,
+    DISKANN,
     FAISS_BIN_IDMAP = 100,
     FAISS_BIN_IVFLAT_CPU = 101,
 };
@@ -49,6 +51,7 @@ extern const char* INVALID;
 extern const char* INDEX_FAISS_IDMAP;
 extern const char* INDEX_FAISS_IVFFLAT;
 extern const char* INDEX_FAISS_IVFPQ;
+extern const char* INDEX_FAISS_IVFPQFS;
 extern const char* INDEX_FAISS_IVFSQ8;
 extern const char* INDEX_FAISS_IVFSQ8NR;
 extern const char* INDEX_FAISS_IVFSQ8H;
@@ -62,6 +65,7 @@ extern const char* INDEX_SPTAG_BKT_RNT;
 extern const char* INDEX_HNSW;
 extern const char* INDEX_ANNOY;
 extern const char* INDEX_HNSW_SQ8NR;
+extern const char* INDEX_DISKANN;
 }  // namespace IndexEnum
 
 enum class IndexMode { MODE_CPU = 0, MODE_GPU = 1 };
@@ -0,0 +1,206 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "knowhere/index/structured_index/StructuredIndexBitmap.h"
+
+namespace milvus {
+namespace knowhere {
+
+template <typename T>
+StructuredIndexBitmap<T>::StructuredIndexBitmap() : count_(0) {
+}
+
+template <typename T>
+StructuredIndexBitmap<T>::StructuredIndexBitmap(const size_t n, const T* values) : count_(0) {
+    Build(n, values);
+}
+
+template <typename T>
+StructuredIndexBitmap<T>::~StructuredIndexBitmap() {
+}
+
+template <typename T>
+bool
+StructuredIndexBitmap<T>::IsLowCardinality(const size_t n, const T* values, size_t max_cardinality) {
+    std::unordered_set<T> distinct;
+    for (size_t i = 0; i < n; ++i) {
+        distinct.insert(values[i]);
+        if (distinct.size() > max_cardinality) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+void
+StructuredIndexBitmap<T>::Build(const size_t n, const T* values) {
+    if (n == 0) {
+        KNOWHERE_THROW_MSG("StructuredIndexBitmap cannot build null values!");
+    }
+
+    count_ = n;
+    values_.assign(values, values + n);
+    std::sort(values_.begin(), values_.end());
+    values_.erase(std::unique(values_.begin(), values_.end()), values_.end());
+
+    auto words = WordCount();
+    bitmaps_.assign(values_.size() * words, 0);
+    for (size_t i = 0; i < n; ++i) {
+        auto pos = std::lower_bound(values_.begin(), values_.end(), values[i]) - values_.begin();
+        bitmaps_[pos * words + (i >> 6)] |= (uint64_t)1 << (i & 63);
+    }
+}
+
+template <typename T>
+BinarySet
+StructuredIndexBitmap<T>::Serialize(const milvus::knowhere::Config& config) {
+    auto values_size = values_.size() * sizeof(T);
+    std::shared_ptr<uint8_t[]> values_data(new uint8_t[values_size]);
+    memcpy(values_data.get(), values_.data(), values_size);
+
+    auto bitmap_size = bitmaps_.size() * sizeof(uint64_t);
+    std::shared_ptr<uint8_t[]> bitmap_data(new uint8_t[bitmap_size]);
+    memcpy(bitmap_data.get(), bitmaps_.data(), bitmap_size);
+
+    std::shared_ptr<uint8_t[]> bitmap_length(new uint8_t[sizeof(size_t)]);
+    memcpy(bitmap_length.get(), &count_, sizeof(size_t));
+
+    BinarySet res_set;
+    res_set.Append("bitmap_values", values_data, values_size);
+    res_set.Append("bitmap_data", bitmap_data, bitmap_size);
+    res_set.Append("bitmap_length", bitmap_length, sizeof(size_t));
+    return res_set;
+}
+
+template <typename T>
+void
+StructuredIndexBitmap<T>::Load(const milvus::knowhere::BinarySet& index_binary) {
+    try {
+        auto bitmap_length = index_binary.GetByName("bitmap_length");
+        memcpy(&count_, bitmap_length->data.get(), sizeof(size_t));
+
+        auto values_data = index_binary.GetByName("bitmap_values");
+        values_.resize(values_data->size / sizeof(T));
+        memcpy(values_.data(), values_data->data.get(), (size_t)values_data->size);
+
+        auto bitmap_data = index_binary.GetByName("bitmap_data");
+        bitmaps_.resize(bitmap_data->size / sizeof(uint64_t));
+        memcpy(bitmaps_.data(), bitmap_data->data.get(), (size_t)bitmap_data->size);
+    } catch (...) {
+        KNOHWERE_ERROR_MSG("StructuredIndexBitmap Load failed!");
+    }
+}
+
+template <typename T>
+void
+StructuredIndexBitmap<T>::Collect(size_t value_pos, std::vector<uint64_t>& words) {
+    auto word_count = WordCount();
+    const uint64_t* bitmap = bitmaps_.data() + value_pos * word_count;
+    for (size_t w = 0; w < word_count; ++w) {
+        words[w] |= bitmap[w];
+    }
+}
+
+template <typename T>
+const faiss::ConcurrentBitsetPtr
+StructuredIndexBitmap<T>::Collect(size_t begin, size_t end) {
+    std::vector<uint64_t> words(WordCount(), 0);
+    for (size_t pos = begin; pos < end; ++pos) {
+        Collect(pos, words);
+    }
+
+    return std::make_shared<faiss::ConcurrentBitset>(count_, reinterpret_cast<const uint8_t*>(words.data()));
+}
+
+template <typename T>
+const faiss::ConcurrentBitsetPtr
+StructuredIndexBitmap<T>::In(const size_t n, const T* values) {
+    std::vector<uint64_t> words(WordCount(), 0);
+    for (size_t i = 0; i < n; ++i) {
+        auto iter = std::lower_bound(values_.begin(), values_.end(), values[i]);
+        if (iter != values_.end() && *iter == values[i]) {
+            Collect(iter - values_.begin(), words);
+        }
+    }
+
+    return std::make_shared<faiss::ConcurrentBitset>(count_, reinterpret_cast<const uint8_t*>(words.data()));
+}
+
+template <typename T>
+const faiss::ConcurrentBitsetPtr
+StructuredIndexBitmap<T>::NotIn(const size_t n, const T* values) {
+    auto in = In(n, values);
+    std::vector<uint8_t> data(in->data(), in->data() + in->size());
+    for (auto& byte : data) {
+        byte = ~byte;
+    }
+    // the bits past count_ in the last byte are no rows, keep them clear
+    if (count_ & 7) {
+        data.back() &= (uint8_t)((1 << (count_ & 7)) - 1);
+    }
+    return std::make_shared<faiss::ConcurrentBitset>(count_, data.data());
+}
+
+template <typename T>
+const faiss::ConcurrentBitsetPtr
+StructuredIndexBitmap<T>::Range(const T value, const OperatorType op) {
+    size_t begin = 0;
+    size_t end = values_.size();
+    switch (op) {
+        case OperatorType::LT:
+            end = std::lower_bound(values_.begin(), values_.end(), value) - values_.begin();
+            break;
+        case OperatorType::LE:
+            end = std::upper_bound(values_.begin(), values_.end(), value) - values_.begin();
+            break;
+        case OperatorType::GT:
+            begin = std::upper_bound(values_.begin(), values_.end(), value) - values_.begin();
+            break;
+        case OperatorType::GE:
+            begin = std::lower_bound(values_.begin(), values_.end(), value) - values_.begin();
+            break;
+        default:
+            KNOWHERE_THROW_MSG("Invalid OperatorType:" + std::to_string((int)op) + "!");
+    }
+    return Collect(begin, end);
+}
+
+template <typename T>
+const faiss::ConcurrentBitsetPtr
+StructuredIndexBitmap<T>::Range(T lower_bound_value, bool lb_inclusive, T upper_bound_value, bool ub_inclusive) {
+    // an inverted or half open point range has no value
+    if (lower_bound_value > upper_bound_value ||
+        (lower_bound_value == upper_bound_value && !(lb_inclusive && ub_inclusive))) {
+        return std::make_shared<faiss::ConcurrentBitset>(count_);
+    }
+    size_t begin, end;
+    if (lb_inclusive) {
+        begin = std::lower_bound(values_.begin(), values_.end(), lower_bound_value) - values_.begin();
+    } else {
+        begin = std::upper_bound(values_.begin(), values_.end(), lower_bound_value) - values_.begin();
+    }
+    if (ub_inclusive) {
+        end = std::upper_bound(values_.begin(), values_.end(), upper_bound_value) - values_.begin();
+    } else {
+        end = std::lower_bound(values_.begin(), values_.end(), upper_bound_value) - values_.begin();
+    }
+    return Collect(begin, end);
+}
+
+}  // namespace knowhere
+}  // namespace milvus
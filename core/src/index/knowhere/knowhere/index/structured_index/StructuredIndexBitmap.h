@@ -0,0 +1,95 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "knowhere/common/Exception.h"
+#include "knowhere/index/structured_index/StructuredIndex.h"
+
+namespace milvus {
+namespace knowhere {
+
+// attributes with at most this many distinct values get a bitmap index instead of a sorted one
+constexpr size_t BITMAP_INDEX_MAX_CARDINALITY = 64;
+
+// One bitmap per distinct value, rows of a value are found without touching the other values.
+// In/NotIn/Range OR the bitmaps of the selected values word by word.
+template <typename T>
+class StructuredIndexBitmap : public StructuredIndex<T> {
+ public:
+    StructuredIndexBitmap();
+    StructuredIndexBitmap(const size_t n, const T* values);
+    ~StructuredIndexBitmap();
+
+    BinarySet
+    Serialize(const Config& config = Config()) override;
+
+    void
+    Load(const BinarySet& index_binary) override;
+
+    void
+    Build(const size_t n, const T* values) override;
+
+    const faiss::ConcurrentBitsetPtr
+    In(const size_t n, const T* values) override;
+
+    const faiss::ConcurrentBitsetPtr
+    NotIn(const size_t n, const T* values) override;
+
+    const faiss::ConcurrentBitsetPtr
+    Range(const T value, const OperatorType op) override;
+
+    const faiss::ConcurrentBitsetPtr
+    Range(T lower_bound_value, bool lb_inclusive, T upper_bound_value, bool ub_inclusive) override;
+
+    int64_t
+    Size() override {
+        return (int64_t)(values_.size() * sizeof(T) + bitmaps_.size() * sizeof(uint64_t));
+    }
+
+    size_t
+    Cardinality() const {
+        return values_.size();
+    }
+
+    // true if values has no more than max_cardinality distinct values
+    static bool
+    IsLowCardinality(const size_t n, const T* values, size_t max_cardinality = BITMAP_INDEX_MAX_CARDINALITY);
+
+ private:
+    size_t
+    WordCount() const {
+        return (count_ + 63) >> 6;
+    }
+
+    // OR the bitmaps of values [begin, end) into a bitset of count_ bits
+    const faiss::ConcurrentBitsetPtr
+    Collect(size_t begin, size_t end);
+
+    void
+    Collect(size_t value_pos, std::vector<uint64_t>& words);
+
+ private:
+    size_t count_;
+    std::vector<T> values_;          // sorted distinct values
+    std::vector<uint64_t> bitmaps_;  // WordCount() words per value, in the order of values_
+};
+
+template <typename T>
+using StructuredIndexBitmapPtr = std::shared_ptr<StructuredIndexBitmap<T>>;
+}  // namespace knowhere
+}  // namespace milvus
+
+#include "knowhere/index/structured_index/StructuredIndexBitmap-inl.h"
@@ -173,9 +173,10 @@ StructuredIndexSort<T>::Range(T lower_bound_value, bool lb_inclusive, T upper_bo
         build();
     }
     faiss::ConcurrentBitsetPtr bitset = std::make_shared<faiss::ConcurrentBitset>(data_.size());
-    if (lower_bound_value > upper_bound_value) {
-        std::swap(lower_bound_value, upper_bound_value);
-        std::swap(lb_inclusive, ub_inclusive);
+    // an inverted or half open point range has no value
+    if (lower_bound_value > upper_bound_value ||
+        (lower_bound_value == upper_bound_value && !(lb_inclusive && ub_inclusive))) {
+        return bitset;
     }
     auto lb = data_.begin();
     auto ub = data_.end();
@@ -195,6 +195,50 @@ IVFPQConfAdapter::GetValidMList(int64_t dimension, std::vector<int64_t>& resset)
     }
 }
 
+bool
+IVFPQFastScanConfAdapter::CheckTrain(Config& oricfg, const IndexMode mode) {
+    static int64_t MAX_NLIST = 999999;
+    static int64_t MIN_NLIST = 1;
+    static std::vector<std::string> METRICS{knowhere::Metric::L2, knowhere::Metric::IP};
+
+    CheckStrByValues(knowhere::Metric::TYPE, METRICS);
+    CheckIntByRange(knowhere::meta::DIM, DEFAULT_MIN_DIM, DEFAULT_MAX_DIM);
+    CheckIntByRange(knowhere::meta::ROWS, DEFAULT_MIN_ROWS, DEFAULT_MAX_ROWS);
+    CheckIntByRange(knowhere::IndexParams::nlist, MIN_NLIST, MAX_NLIST);
+
+    // auto tune params
+    oricfg[knowhere::IndexParams::nlist] =
+        MatchNlist(oricfg[knowhere::meta::ROWS].get<int64_t>(), oricfg[knowhere::IndexParams::nlist].get<int64_t>());
+
+    std::vector<int64_t> resset;
+    int64_t dimension = oricfg[knowhere::meta::DIM].get<int64_t>();
+    IVFPQFastScanConfAdapter::GetValidMList(dimension, resset);
+
+    CheckIntByValues(knowhere::IndexParams::m, resset);
+
+    if (oricfg.contains(knowhere::IndexParams::rerank) && !oricfg[knowhere::IndexParams::rerank].is_boolean()) {
+        return false;
+    }
+
+    return true;
+}
+
+void
+IVFPQFastScanConfAdapter::GetValidMList(int64_t dimension, std::vector<int64_t>& resset) {
+    resset.clear();
+    /*
+     * 4-bit sub-quantizers are scanned with in-register tables, any number of dims per
+     * sub-quantizer works. Sums are accumulated on uint16, hence at most 256 sub-quantizers.
+     */
+    static int64_t MAX_SUBQUANTIZER = 256;
+
+    for (int64_t subquantizer_num = 1; subquantizer_num <= std::min(dimension, MAX_SUBQUANTIZER); ++subquantizer_num) {
+        if (!(dimension % subquantizer_num)) {
+            resset.push_back(subquantizer_num);
+        }
+    }
+}
+
 bool
 NSGConfAdapter::CheckTrain(Config& oricfg, const IndexMode mode) {
     static int64_t MIN_KNNG = 5;
@@ -214,6 +258,19 @@ NSGConfAdapter::CheckTrain(Config& oricfg, const IndexMode mode) {
     CheckIntByRange(knowhere::IndexParams::out_degree, MIN_OUT_DEGREE, MAX_OUT_DEGREE);
     CheckIntByRange(knowhere::IndexParams::candidate, MIN_CANDIDATE_POOL_SIZE, MAX_CANDIDATE_POOL_SIZE);
 
+    if (oricfg.contains(knowhere::IndexParams::compact_graph) &&
+        !oricfg[knowhere::IndexParams::compact_graph].is_boolean()) {
+        return false;
+    }
+    if (oricfg.contains(knowhere::IndexParams::colocate_vectors) &&
+        !oricfg[knowhere::IndexParams::colocate_vectors].is_boolean()) {
+        return false;
+    }
+    if (oricfg.contains(knowhere::IndexParams::nn_descent) &&
+        !oricfg[knowhere::IndexParams::nn_descent].is_boolean()) {
+        return false;
+    }
+
     // auto tune params
     oricfg[knowhere::IndexParams::nlist] = MatchNlist(oricfg[knowhere::meta::ROWS].get<int64_t>(), 8192);
 
@@ -330,5 +387,73 @@ ANNOYConfAdapter::CheckSearch(Config& oricfg, const IndexType type, const IndexM
     return ConfAdapter::CheckSearch(oricfg, type, mode);
 }
 
+bool
+DiskANNConfAdapter::CheckTrain(Config& oricfg, const IndexMode mode) {
+    static int64_t MIN_OUT_DEGREE = 4;
+    static int64_t MAX_OUT_DEGREE = 128;
+    static int64_t MIN_SEARCH_LENGTH = 10;
+    static int64_t MAX_SEARCH_LENGTH = 500;
+    static int64_t MIN_CANDIDATE_POOL_SIZE = 50;
+    static int64_t MAX_CANDIDATE_POOL_SIZE = 1000;
+    static int64_t MAX_CACHE_NODES = 1000000;
+    static float MIN_ALPHA = 1.0f;
+    static float MAX_ALPHA = 2.0f;
+    static float DEFAULT_ALPHA = 1.2f;
+    static std::vector<std::string> METRICS{knowhere::Metric::L2};
+
+    CheckStrByValues(knowhere::Metric::TYPE, METRICS);
+    CheckIntByRange(knowhere::meta::DIM, DEFAULT_MIN_DIM, DEFAULT_MAX_DIM);
+    CheckIntByRange(knowhere::meta::ROWS, DEFAULT_MIN_ROWS, DEFAULT_MAX_ROWS);
+    CheckIntByRange(knowhere::IndexParams::out_degree, MIN_OUT_DEGREE, MAX_OUT_DEGREE);
+    CheckIntByRange(knowhere::IndexParams::search_length, MIN_SEARCH_LENGTH, MAX_SEARCH_LENGTH);
+    CheckIntByRange(knowhere::IndexParams::candidate, MIN_CANDIDATE_POOL_SIZE, MAX_CANDIDATE_POOL_SIZE);
+
+    std::vector<int64_t> resset;
+    DiskANNConfAdapter::GetValidMList(oricfg[knowhere::meta::DIM].get<int64_t>(), resset);
+    CheckIntByValues(knowhere::IndexParams::m, resset);
+
+    if (!oricfg.contains(knowhere::IndexParams::alpha)) {
+        oricfg[knowhere::IndexParams::alpha] = DEFAULT_ALPHA;
+    } else if (!oricfg[knowhere::IndexParams::alpha].is_number() ||
+               oricfg[knowhere::IndexParams::alpha].get<float>() < MIN_ALPHA ||
+               oricfg[knowhere::IndexParams::alpha].get<float>() > MAX_ALPHA) {
+        return false;
+    }
+
+    if (oricfg.contains(knowhere::IndexParams::cache_nodes)) {
+        CheckIntByRange(knowhere::IndexParams::cache_nodes, 0, MAX_CACHE_NODES);
+    }
+
+    return true;
+}
+
+bool
+DiskANNConfAdapter::CheckSearch(Config& oricfg, const IndexType type, const IndexMode mode) {
+    static int64_t MAX_SEARCH_LENGTH = 4096;
+    static int64_t MIN_BEAM_WIDTH = 1;
+    static int64_t MAX_BEAM_WIDTH = 64;
+    static int64_t DEFAULT_BEAM_WIDTH = 4;
+
+    CheckIntByRange(knowhere::IndexParams::search_length, oricfg[knowhere::meta::TOPK], MAX_SEARCH_LENGTH);
+
+    if (!oricfg.contains(knowhere::IndexParams::beam_width)) {
+        oricfg[knowhere::IndexParams::beam_width] = DEFAULT_BEAM_WIDTH;
+    }
+    CheckIntByRange(knowhere::IndexParams::beam_width, MIN_BEAM_WIDTH, MAX_BEAM_WIDTH);
+
+    return ConfAdapter::CheckSearch(oricfg, type, mode);
+}
+
+void
+DiskANNConfAdapter::GetValidMList(int64_t dimension, std::vector<int64_t>& resset) {
+    resset.clear();
+    // one byte of PQ code per sub-quantizer routes the search, more bytes route it closer
+    for (int64_t subquantizer_num = 1; subquantizer_num <= dimension; ++subquantizer_num) {
+        if (!(dimension % subquantizer_num)) {
+            resset.push_back(subquantizer_num);
+        }
+    }
+}
+
 }  // namespace knowhere
 }  // namespace milvus
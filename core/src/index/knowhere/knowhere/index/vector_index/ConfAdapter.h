@@ -55,6 +55,15 @@ class IVFPQConfAdapter : public IVFConfAdapter {
     GetValidMList(int64_t dimension, std::vector<int64_t>& resset);
 };
 
+class IVFPQFastScanConfAdapter : public IVFConfAdapter {
+ public:
+    bool
+    CheckTrain(Config& oricfg, const IndexMode mode) override;
+
+    static void
+    GetValidMList(int64_t dimension, std::vector<int64_t>& resset);
+};
+
 class NSGConfAdapter : public IVFConfAdapter {
  public:
     bool
@@ -103,6 +112,18 @@ class HNSWSQ8NRConfAdapter : public ConfAdapter {
     CheckSearch(Config& oricfg, const IndexType type, const IndexMode mode) override;
 };
 
+class DiskANNConfAdapter : public ConfAdapter {
+ public:
+    bool
+    CheckTrain(Config& oricfg, const IndexMode mode) override;
+
+    bool
+    CheckSearch(Config& oricfg, const IndexType type, const IndexMode mode) override;
+
+    static void
+    GetValidMList(int64_t dimension, std::vector<int64_t>& resset);
+};
+
 class IVFSQ8NRConfAdapter : public IVFConfAdapter {
  public:
     bool
@@ -118,24 +118,7 @@ IndexAnnoy::Query(const DatasetPtr& dataset_ptr, const Config& config) {
     auto p_dist = (float*)malloc(all_num * sizeof(float));
     faiss::ConcurrentBitsetPtr blacklist = GetBlacklist();
 
-#pragma omp parallel for
-    for (unsigned int i = 0; i < rows; ++i) {
-        std::vector<int64_t> result;
-        result.reserve(k);
-        std::vector<float> distances;
-        distances.reserve(k);
-        index_->get_nns_by_vector((const float*)p_data + i * dim, k, search_k, &result, &distances, blacklist);
-
-        int64_t result_num = result.size();
-        auto local_p_id = p_id + k * i;
-        auto local_p_dist = p_dist + k * i;
-        memcpy(local_p_id, result.data(), result_num * sizeof(int64_t));
-        memcpy(local_p_dist, distances.data(), result_num * sizeof(float));
-        for (; result_num < k; result_num++) {
-            local_p_id[result_num] = -1;
-            local_p_dist[result_num] = 1.0 / 0.0;
-        }
-    }
+    index_->get_nns_by_vectors((const float*)p_data, rows, k, search_k, p_id, p_dist, blacklist);
 
     auto ret_ds = std::make_shared<Dataset>();
     ret_ds->Set(meta::IDS, p_id);
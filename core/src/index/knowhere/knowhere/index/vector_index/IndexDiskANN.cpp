@@ -0,0 +1,170 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "knowhere/index/vector_index/IndexDiskANN.h"
+
+#include <string>
+
+#include "knowhere/common/Exception.h"
+#include "knowhere/index/vector_index/adapter/VectorAdapter.h"
+#include "knowhere/index/vector_index/helpers/FaissIO.h"
+#include "knowhere/index/vector_index/helpers/IndexParameter.h"
+#include "knowhere/index/vector_index/impl/diskann/DiskANN.h"
+
+namespace milvus {
+namespace knowhere {
+
+BinarySet
+IndexDiskANN::Serialize(const Config& config) {
+    if (!index_) {
+        KNOWHERE_THROW_MSG("index not initialize or trained");
+    }
+
+    try {
+        std::lock_guard<std::mutex> lk(mutex_);
+        MemoryIOWriter writer;
+        index_->Write(writer);
+        std::shared_ptr<uint8_t[]> data(writer.data_);
+
+        BinarySet res_set;
+        res_set.Append("DISKANN", data, writer.rp);
+        res_set.Append(SECTOR_DATA, index_->GetSectors(), index_->SectorsSize());
+        return res_set;
+    } catch (std::exception& e) {
+        KNOWHERE_THROW_MSG(e.what());
+    }
+}
+
+void
+IndexDiskANN::Load(const BinarySet& index_binary) {
+    try {
+        std::lock_guard<std::mutex> lk(mutex_);
+        auto binary = index_binary.GetByName("DISKANN");
+
+        MemoryIOReader reader;
+        reader.total = binary->size;
+        reader.data_ = binary->data.get();
+
+        auto index = std::make_shared<impl::DiskANNIndex>();
+        index->Read(reader);
+        if (index_binary.binary_map_.count(SECTOR_FILE) > 0) {
+            auto path = index_binary.GetByName(SECTOR_FILE);
+            index->OpenSectors(
+                std::make_shared<SectorFile>(std::string(reinterpret_cast<const char*>(path->data.get()), path->size)));
+            index->CacheNodes(index->cache_nodes);
+        } else if (index_binary.binary_map_.count(SECTOR_DATA) > 0) {
+            auto sectors = index_binary.GetByName(SECTOR_DATA);
+            index->SetSectors(sectors->data, sectors->size);
+        }
+        index_ = index;
+    } catch (std::exception& e) {
+        KNOWHERE_THROW_MSG(e.what());
+    }
+}
+
+void
+IndexDiskANN::SetSectorReader(const SectorReaderPtr& reader) {
+    if (!index_) {
+        KNOWHERE_THROW_MSG("index not initialize");
+    }
+
+    try {
+        std::lock_guard<std::mutex> lk(mutex_);
+        index_->OpenSectors(reader);
+        index_->CacheNodes(index_->cache_nodes);
+    } catch (std::exception& e) {
+        KNOWHERE_THROW_MSG(e.what());
+    }
+}
+
+void
+IndexDiskANN::Train(const DatasetPtr& dataset_ptr, const Config& config) {
+    if (config[Metric::TYPE].get<std::string>() != Metric::L2) {
+        KNOWHERE_THROW_MSG("Metric is not supported");
+    }
+
+    GETTENSORWITHIDS(dataset_ptr)
+
+    impl::VamanaBuildParams b_params;
+    b_params.max_degree = config[IndexParams::out_degree].get<int64_t>();
+    b_params.search_list_size = config[IndexParams::search_length].get<int64_t>();
+    b_params.candidate_pool_size = config[IndexParams::candidate].get<int64_t>();
+    b_params.alpha = config[IndexParams::alpha].get<float>();
+
+    auto index = std::make_shared<impl::DiskANNIndex>(dim, b_params.max_degree, config[IndexParams::m].get<int64_t>());
+    if (config.contains(IndexParams::cache_nodes)) {
+        index->cache_nodes = config[IndexParams::cache_nodes].get<int64_t>();
+    }
+    index->Build(rows, static_cast<const float*>(p_data), p_ids, b_params);
+
+    std::lock_guard<std::mutex> lk(mutex_);
+    index_ = index;
+}
+
+DatasetPtr
+IndexDiskANN::Query(const DatasetPtr& dataset_ptr, const Config& config) {
+    if (!index_) {
+        KNOWHERE_THROW_MSG("index not initialize or trained");
+    }
+
+    GETTENSOR(dataset_ptr)
+
+    try {
+        auto k = config[meta::TOPK].get<int64_t>();
+        auto p_id = static_cast<int64_t*>(malloc(sizeof(int64_t) * rows * k));
+        auto p_dist = static_cast<float*>(malloc(sizeof(float) * rows * k));
+
+        impl::DiskANNSearchParams s_params;
+        s_params.search_list_size = config[IndexParams::search_length].get<int64_t>();
+        s_params.beam_width = config[IndexParams::beam_width].get<int64_t>();
+
+        index_->Search(static_cast<const float*>(p_data), rows, k, p_dist, p_id, s_params, GetBlacklist());
+
+        auto ret_ds = std::make_shared<Dataset>();
+        ret_ds->Set(meta::IDS, p_id);
+        ret_ds->Set(meta::DISTANCE, p_dist);
+        return ret_ds;
+    } catch (std::exception& e) {
+        KNOWHERE_THROW_MSG(e.what());
+    }
+}
+
+int64_t
+IndexDiskANN::Count() {
+    if (!index_) {
+        KNOWHERE_THROW_MSG("index not initialize");
+    }
+    return index_->ntotal;
+}
+
+int64_t
+IndexDiskANN::Dim() {
+    if (!index_) {
+        KNOWHERE_THROW_MSG("index not initialize");
+    }
+    return index_->dimension;
+}
+
+int64_t
+IndexDiskANN::IndexSize() {
+    if (!index_) {
+        KNOWHERE_THROW_MSG("index not initialize");
+    }
+    return index_->MemorySize();
+}
+
+int64_t
+IndexDiskANN::SectorReads() const {
+    return index_ ? index_->SectorReads() : 0;
+}
+
+}  // namespace knowhere
+}  // namespace milvus
@@ -0,0 +1,94 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+
+#include "knowhere/common/Exception.h"
+#include "knowhere/index/vector_index/VecIndex.h"
+#include "knowhere/index/vector_index/helpers/SectorReader.h"
+
+namespace milvus {
+namespace knowhere {
+
+namespace impl {
+class DiskANNIndex;
+}
+
+/**
+ * Vamana graph with its vectors and neighbor lists in SSD sectors, only PQ codes stay in memory.
+ *
+ * Serialize puts the sectors apart under SECTOR_DATA so the codec can keep them in a file of
+ * their own. Load serves them from the local file given as SECTOR_FILE, from memory when they
+ * are given as SECTOR_DATA; with neither, they are read through SetSectorReader.
+ */
+class IndexDiskANN : public VecIndex {
+ public:
+    IndexDiskANN() {
+        index_type_ = IndexEnum::INDEX_DISKANN;
+    }
+
+    BinarySet
+    Serialize(const Config& config = Config()) override;
+
+    void
+    Load(const BinarySet& index_binary) override;
+
+    /// serve the sectors from reader, when Load was given neither SECTOR_FILE nor SECTOR_DATA
+    void
+    SetSectorReader(const SectorReaderPtr& reader);
+
+    void
+    BuildAll(const DatasetPtr& dataset_ptr, const Config& config) override {
+        Train(dataset_ptr, config);
+    }
+
+    void
+    Train(const DatasetPtr& dataset_ptr, const Config& config) override;
+
+    void
+    Add(const DatasetPtr&, const Config&) override {
+        KNOWHERE_THROW_MSG("Incremental index is not supported");
+    }
+
+    void
+    AddWithoutIds(const DatasetPtr&, const Config&) override {
+        KNOWHERE_THROW_MSG("Addwithoutids is not supported");
+    }
+
+    DatasetPtr
+    Query(const DatasetPtr& dataset_ptr, const Config& config) override;
+
+    int64_t
+    Count() override;
+
+    int64_t
+    Dim() override;
+
+    /// memory held by the index, the sectors on disk are not part of it
+    int64_t
+    IndexSize() override;
+
+    /// sectors read from disk by all searches so far
+    int64_t
+    SectorReads() const;
+
+ private:
+    std::mutex mutex_;
+    std::shared_ptr<impl::DiskANNIndex> index_;
+};
+
+using IndexDiskANNPtr = std::shared_ptr<IndexDiskANN>;
+
+}  // namespace knowhere
+}  // namespace milvus
@@ -17,6 +17,7 @@
 #include <faiss/clone_index.h>
 #include <faiss/index_factory.h>
 #include <faiss/index_io.h>
+#include <faiss/utils/distances.h>
 #ifdef MILVUS_GPU_VERSION
 #include <faiss/gpu/GpuCloner.h>
 #endif
@@ -105,7 +106,7 @@ IDMAP::Query(const DatasetPtr& dataset_ptr, const Config& config) {
     auto p_id = (int64_t*)malloc(p_id_size);
     auto p_dist = (float*)malloc(p_dist_size);
 
-    QueryImpl(rows, (float*)p_data, k, p_dist, p_id, Config());
+    QueryImpl(rows, (float*)p_data, k, p_dist, p_id, config);
 
     auto ret_ds = std::make_shared<Dataset>();
     ret_ds->Set(meta::IDS, p_id);
@@ -221,7 +222,35 @@ IDMAP::GetVectorById(const DatasetPtr& dataset_ptr, const Config& config) {
 
 void
 IDMAP::QueryImpl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels, const Config& config) {
-    index_->search(n, (float*)data, k, distances, labels, bitset_);
+    auto id_map_index = dynamic_cast<faiss::IndexIDMap*>(index_.get());
+    auto flat_index = id_map_index ? dynamic_cast<faiss::IndexFlat*>(id_map_index->index) : nullptr;
+    bool bounded = config.contains(meta::TOPK_BOUNDS) && flat_index != nullptr &&
+                   (flat_index->metric_type == faiss::METRIC_L2 ||
+                    flat_index->metric_type == faiss::METRIC_INNER_PRODUCT);
+    if (!bounded) {
+        index_->search(n, (float*)data, k, distances, labels, bitset_);
+        return;
+    }
+
+    // the heaps start from the k-th distance found in the other segments, worse vectors never enter them
+    auto heap_thresholds = config[meta::TOPK_BOUNDS].get<std::vector<float>>();
+    if (heap_thresholds.size() != (size_t)n) {
+        KNOWHERE_THROW_MSG("topk bounds do not match the number of queries");
+    }
+    if (flat_index->metric_type == faiss::METRIC_INNER_PRODUCT) {
+        faiss::float_minheap_array_t res = {size_t(n), size_t(k), labels, distances};
+        faiss::knn_inner_product(data, flat_index->xb.data(), flat_index->d, n, flat_index->ntotal, &res, bitset_,
+                                 heap_thresholds.data());
+    } else {
+        faiss::float_maxheap_array_t res = {size_t(n), size_t(k), labels, distances};
+        faiss::knn_L2sqr(data, flat_index->xb.data(), flat_index->d, n, flat_index->ntotal, &res, bitset_,
+                         heap_thresholds.data());
+    }
+    for (int64_t i = 0; i < n * k; i++) {
+        if (labels[i] >= 0) {
+            labels[i] = id_map_index->id_map[labels[i]];
+        }
+    }
 }
 
 }  // namespace knowhere
@@ -0,0 +1,205 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "knowhere/index/vector_index/IndexIDMAPHalf.h"
+
+#include <faiss/FaissHook.h>
+#include <faiss/utils/Heap.h>
+#include <faiss/utils/half_precision.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "knowhere/common/Exception.h"
+#include "knowhere/index/vector_index/adapter/VectorAdapter.h"
+#include "knowhere/index/vector_index/helpers/IndexParameter.h"
+
+namespace milvus {
+namespace knowhere {
+
+BinarySet
+IDMAPHalf::Serialize(const Config& config) {
+    KNOWHERE_THROW_MSG("IDMAPHalf does not support Serialize");
+}
+
+void
+IDMAPHalf::Load(const BinarySet& binary_set) {
+    KNOWHERE_THROW_MSG("IDMAPHalf does not support Load");
+}
+
+void
+IDMAPHalf::Train(const DatasetPtr& dataset_ptr, const Config& config) {
+    faiss::MetricType metric_type = GetMetricType(config[Metric::TYPE].get<std::string>());
+    if (metric_type != faiss::METRIC_L2 && metric_type != faiss::METRIC_INNER_PRODUCT) {
+        KNOWHERE_THROW_MSG("IDMAPHalf only supports L2 and IP");
+    }
+
+    std::lock_guard<std::mutex> lk(mutex_);
+    dim_ = config[meta::DIM].get<int64_t>();
+    is_ip_ = (metric_type == faiss::METRIC_INNER_PRODUCT);
+    data_.clear();
+    ids_.clear();
+    trained_ = true;
+}
+
+void
+IDMAPHalf::Add(const DatasetPtr& dataset_ptr, const Config& config) {
+    if (!trained_) {
+        KNOWHERE_THROW_MSG("index not initialize");
+    }
+
+    std::lock_guard<std::mutex> lk(mutex_);
+    GETTENSORWITHIDS(dataset_ptr)
+    auto p_half = reinterpret_cast<const uint16_t*>(p_data);
+    data_.insert(data_.end(), p_half, p_half + rows * dim_);
+    ids_.insert(ids_.end(), p_ids, p_ids + rows);
+}
+
+void
+IDMAPHalf::AddWithoutIds(const DatasetPtr& dataset_ptr, const Config& config) {
+    if (!trained_) {
+        KNOWHERE_THROW_MSG("index not initialize");
+    }
+
+    std::lock_guard<std::mutex> lk(mutex_);
+    auto rows = dataset_ptr->Get<int64_t>(meta::ROWS);
+    auto p_half = reinterpret_cast<const uint16_t*>(dataset_ptr->Get<const void*>(meta::TENSOR));
+
+    int64_t offset = ids_.size();
+    data_.insert(data_.end(), p_half, p_half + rows * dim_);
+    for (int64_t i = 0; i < rows; ++i) {
+        ids_.push_back(offset + i);
+    }
+}
+
+DatasetPtr
+IDMAPHalf::Query(const DatasetPtr& dataset_ptr, const Config& config) {
+    if (!trained_) {
+        KNOWHERE_THROW_MSG("index not initialize");
+    }
+    GETTENSOR(dataset_ptr)
+
+    int64_t k = config[meta::TOPK].get<int64_t>();
+    auto elems = rows * k;
+    auto p_id = (int64_t*)malloc(sizeof(int64_t) * elems);
+    auto p_dist = (float*)malloc(sizeof(float) * elems);
+
+    QueryImpl(rows, (float*)p_data, k, p_dist, p_id, config);
+
+    auto ret_ds = std::make_shared<Dataset>();
+    ret_ds->Set(meta::IDS, p_id);
+    ret_ds->Set(meta::DISTANCE, p_dist);
+    return ret_ds;
+}
+
+int64_t
+IDMAPHalf::Count() {
+    if (!trained_) {
+        KNOWHERE_THROW_MSG("index not initialize");
+    }
+    return ids_.size();
+}
+
+int64_t
+IDMAPHalf::Dim() {
+    if (!trained_) {
+        KNOWHERE_THROW_MSG("index not initialize");
+    }
+    return dim_;
+}
+
+const float*
+IDMAPHalf::GetRawVectors() {
+    KNOWHERE_THROW_MSG("IDMAPHalf keeps no float vectors, decode them with DecodeRawVectors");
+}
+
+void
+IDMAPHalf::DecodeRawVectors(float* data) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    if (half_type_ == HalfType::FP16) {
+        faiss::fp16_to_fvec(data_.data(), data, data_.size());
+    } else {
+        faiss::bf16_to_fvec(data_.data(), data, data_.size());
+    }
+}
+
+const int64_t*
+IDMAPHalf::GetRawIds() {
+    return ids_.data();
+}
+
+void
+IDMAPHalf::QueryImpl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels,
+                     const Config& config) {
+    faiss::hvec_func_ptr distance_func;
+    if (half_type_ == HalfType::FP16) {
+        distance_func = is_ip_ ? faiss::fvec_inner_product_fp16 : faiss::fvec_L2sqr_fp16;
+    } else {
+        distance_func = is_ip_ ? faiss::fvec_inner_product_bf16 : faiss::fvec_L2sqr_bf16;
+    }
+
+    int64_t ntotal = ids_.size();
+    auto bitset = GetBlacklist();
+    std::vector<float> heap_thresholds;
+    if (config.contains(meta::TOPK_BOUNDS)) {
+        heap_thresholds = config[meta::TOPK_BOUNDS].get<std::vector<float>>();
+        if (heap_thresholds.size() != (size_t)n) {
+            KNOWHERE_THROW_MSG("topk bounds do not match the number of queries");
+        }
+    }
+
+#pragma omp parallel for
+    for (int64_t i = 0; i < n; i++) {
+        const float* query = data + i * dim_;
+        float* res_dis = distances + i * k;
+        int64_t* res_ids = labels + i * k;
+
+        // keep offsets in the heap, map them to ids once sorted
+        if (is_ip_) {
+            faiss::minheap_heapify(k, res_dis, res_ids);
+        } else {
+            faiss::maxheap_heapify(k, res_dis, res_ids);
+        }
+        if (!heap_thresholds.empty()) {
+            std::fill(res_dis, res_dis + k, heap_thresholds[i]);
+        }
+        for (int64_t j = 0; j < ntotal; j++) {
+            if (bitset != nullptr && bitset->test(j)) {
+                continue;
+            }
+            float dis = distance_func(query, data_.data() + j * dim_, dim_);
+            if (is_ip_ ? dis > res_dis[0] : dis < res_dis[0]) {
+                if (is_ip_) {
+                    faiss::minheap_pop(k, res_dis, res_ids);
+                    faiss::minheap_push(k, res_dis, res_ids, dis, j);
+                } else {
+                    faiss::maxheap_pop(k, res_dis, res_ids);
+                    faiss::maxheap_push(k, res_dis, res_ids, dis, j);
+                }
+            }
+        }
+        if (is_ip_) {
+            faiss::minheap_reorder(k, res_dis, res_ids);
+        } else {
+            faiss::maxheap_reorder(k, res_dis, res_ids);
+        }
+
+        for (int64_t j = 0; j < k; j++) {
+            if (res_ids[j] >= 0) {
+                res_ids[j] = ids_[res_ids[j]];
+            }
+        }
+    }
+}
+
+}  // namespace knowhere
+}  // namespace milvus
@@ -0,0 +1,95 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "knowhere/index/vector_index/IndexIDMAP.h"
+
+namespace milvus {
+namespace knowhere {
+
+enum class HalfType {
+    FP16 = 1,
+    BF16 = 2,
+};
+
+// Brute force search over raw vectors kept in half precision. The TENSOR of the datasets given to Add and
+// AddWithoutIds holds uint16_t components, queries are float. Only used for raw segments, it is never serialized.
+class IDMAPHalf : public IDMAP {
+ public:
+    explicit IDMAPHalf(HalfType half_type) : IDMAP(), half_type_(half_type) {
+    }
+
+    BinarySet
+    Serialize(const Config& config = Config()) override;
+
+    void
+    Load(const BinarySet&) override;
+
+    void
+    Train(const DatasetPtr&, const Config&) override;
+
+    void
+    Add(const DatasetPtr&, const Config&) override;
+
+    void
+    AddWithoutIds(const DatasetPtr&, const Config&) override;
+
+    DatasetPtr
+    Query(const DatasetPtr&, const Config&) override;
+
+    int64_t
+    Count() override;
+
+    int64_t
+    Dim() override;
+
+    int64_t
+    IndexSize() override {
+        return Count() * Dim() * sizeof(uint16_t);
+    }
+
+    // the vectors are only kept in half precision, use DecodeRawVectors
+    const float*
+    GetRawVectors() override;
+
+    // decode the Count() * Dim() components into the caller's buffer
+    void
+    DecodeRawVectors(float* data);
+
+    const int64_t*
+    GetRawIds() override;
+
+    HalfType
+    half_type() const {
+        return half_type_;
+    }
+
+ protected:
+    void
+    QueryImpl(int64_t, const float*, int64_t, float*, int64_t*, const Config&) override;
+
+ private:
+    HalfType half_type_;
+    int64_t dim_ = 0;
+    bool is_ip_ = false;
+    bool trained_ = false;
+    std::vector<uint16_t> data_;
+    std::vector<int64_t> ids_;
+};
+
+using IDMAPHalfPtr = std::shared_ptr<IDMAPHalf>;
+
+}  // namespace knowhere
+}  // namespace milvus
@@ -51,8 +51,12 @@ IVF::Serialize(const Config& config) {
     if (!index_ || !index_->is_trained) {
         KNOWHERE_THROW_MSG("index not initialize or trained");
     }
-
     std::lock_guard<std::mutex> lk(mutex_);
+    if (disk_lists_ == nullptr) {
+        return SerializeImpl(index_type_);
+    }
+    // the lists stay in the file they were written to
+    ScopedEmptyLists empty_lists(dynamic_cast<faiss::IndexIVF*>(index_.get()));
     return SerializeImpl(index_type_);
 }
 
@@ -241,6 +245,9 @@ IVF::Seal() {
 
 VecIndexPtr
 IVF::CopyCpuToGpu(const int64_t device_id, const Config& config) {
+    if (disk_lists_ != nullptr) {
+        KNOWHERE_THROW_MSG("index with inverted lists on disk can not be copied to GPU");
+    }
 #ifdef MILVUS_GPU_VERSION
     if (auto res = FaissGpuResourceMgr::GetInstance().GetRes(device_id)) {
         ResScope rs(res, device_id, false);
@@ -258,6 +265,40 @@ IVF::CopyCpuToGpu(const int64_t device_id, const Config& config) {
 #endif
 }
 
+void
+IVF::MoveListsToDisk(const std::string& path, int64_t cache_size) {
+    if (!index_ || !index_->is_trained) {
+        KNOWHERE_THROW_MSG("index not initialize or trained");
+    }
+
+    std::lock_guard<std::mutex> lk(mutex_);
+    auto ivf_index = dynamic_cast<faiss::IndexIVF*>(index_.get());
+    DiskInvertedLists::Write(ivf_index->invlists, path);
+    disk_lists_ = new DiskInvertedLists(ivf_index->nlist, ivf_index->code_size, path, cache_size);
+    ivf_index->replace_invlists(disk_lists_, true);
+
+    // only the coarse quantizer and the hot lists stay in memory
+    SetIndexSize(ivf_index->nlist * ivf_index->d * sizeof(float) + cache_size);
+}
+
+void
+IVF::OpenListsOnDisk(const std::string& path, int64_t cache_size) {
+    if (!index_ || !index_->is_trained) {
+        KNOWHERE_THROW_MSG("index not initialize or trained");
+    }
+
+    std::lock_guard<std::mutex> lk(mutex_);
+    auto ivf_index = dynamic_cast<faiss::IndexIVF*>(index_.get());
+    auto lists = std::make_unique<DiskInvertedLists>(ivf_index->nlist, ivf_index->code_size, path, cache_size);
+    if (lists->compute_ntotal() != (size_t)ivf_index->ntotal) {
+        KNOWHERE_THROW_MSG("inverted lists file " + path + " does not match the index");
+    }
+    disk_lists_ = lists.release();
+    ivf_index->replace_invlists(disk_lists_, true);
+
+    SetIndexSize(ivf_index->nlist * ivf_index->d * sizeof(float) + cache_size);
+}
+
 void
 IVF::GenGraph(const float* data, const int64_t k, GraphType& graph, const Config& config) {
     int64_t K = k + 1;
@@ -314,7 +355,24 @@ IVF::QueryImpl(int64_t n, const float* data, int64_t k, float* distances, int64_
     } else {
         ivf_index->parallel_mode = 0;
     }
-    ivf_index->search(n, (float*)data, k, distances, labels, bitset_);
+    if (config.contains(meta::TOPK_BOUNDS)) {
+        // the heaps start from the k-th distance found in the other segments, worse vectors never enter them
+        auto heap_thresholds = config[meta::TOPK_BOUNDS].get<std::vector<float>>();
+        if (heap_thresholds.size() != (size_t)n) {
+            KNOWHERE_THROW_MSG("topk bounds do not match the number of queries");
+        }
+        std::vector<int64_t> coarse_ids(n * params->nprobe);
+        std::vector<float> coarse_dis(n * params->nprobe);
+        ivf_index->quantizer->search(n, data, params->nprobe, coarse_dis.data(), coarse_ids.data());
+        ivf_index->invlists->prefetch_lists(coarse_ids.data(), n * params->nprobe);
+
+        params->max_codes = ivf_index->max_codes;
+        params->heap_thresholds = heap_thresholds.data();
+        ivf_index->search_preassigned(n, data, k, coarse_ids.data(), coarse_dis.data(), distances, labels, false,
+                                      params.get(), bitset_);
+    } else {
+        ivf_index->search(n, (float*)data, k, distances, labels, bitset_);
+    }
     stdclock::time_point after = stdclock::now();
     double search_cost = (std::chrono::duration<double, std::micro>(after - before)).count();
     LOG_KNOWHERE_DEBUG_ << "IVF search cost: " << search_cost
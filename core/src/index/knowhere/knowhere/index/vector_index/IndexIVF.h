@@ -13,6 +13,7 @@
 
 #include <memory>
 #include <mutex>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -21,6 +22,7 @@
 #include "knowhere/common/Typedef.h"
 #include "knowhere/index/vector_index/FaissBaseIndex.h"
 #include "knowhere/index/vector_index/VecIndex.h"
+#include "knowhere/index/vector_index/helpers/DiskInvertedLists.h"
 
 namespace milvus {
 namespace knowhere {
@@ -78,6 +80,20 @@ class IVF : public VecIndex, public FaissBaseIndex {
     virtual void
     GenGraph(const float* data, const int64_t k, GraphType& graph, const Config& config);
 
+    /// write the inverted lists to path and serve them from there, probed lists are read on demand
+    /// through an LRU of cache_size bytes; the index serializes only its coarse quantizer afterwards
+    void
+    MoveListsToDisk(const std::string& path, int64_t cache_size);
+
+    /// serve the inverted lists that MoveListsToDisk wrote to path when the index was built
+    void
+    OpenListsOnDisk(const std::string& path, int64_t cache_size);
+
+    const DiskInvertedLists*
+    GetDiskLists() const {
+        return disk_lists_;
+    }
+
  protected:
     virtual std::shared_ptr<faiss::IVFSearchParameters>
     GenParams(const Config&);
@@ -90,6 +106,7 @@ class IVF : public VecIndex, public FaissBaseIndex {
 
  protected:
     std::mutex mutex_;
+    DiskInvertedLists* disk_lists_ = nullptr;  // owned by index_
 };
 
 using IVFPtr = std::shared_ptr<IVF>;
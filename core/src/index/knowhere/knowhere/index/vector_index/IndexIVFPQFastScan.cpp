@@ -0,0 +1,299 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <faiss/FaissHook.h>
+#include <faiss/IndexFlat.h>
+#include <faiss/IndexIVFPQ.h>
+#include <faiss/utils/Heap.h>
+#include <faiss/utils/pq4_fast_scan.h>
+
+#include "knowhere/common/Exception.h"
+#include "knowhere/common/Log.h"
+#include "knowhere/index/vector_index/IndexIVFPQFastScan.h"
+#include "knowhere/index/vector_index/adapter/VectorAdapter.h"
+#include "knowhere/index/vector_index/helpers/IndexParameter.h"
+
+namespace milvus {
+namespace knowhere {
+
+using stdclock = std::chrono::high_resolution_clock;
+
+BinarySet
+IVFPQFastScan::Serialize(const Config& config) {
+    if (!index_ || !index_->is_trained) {
+        KNOWHERE_THROW_MSG("index not initialize or trained");
+    }
+
+    std::lock_guard<std::mutex> lk(mutex_);
+    RestoreCodes();
+    auto res_set = SerializeImpl(index_type_);
+    ReleaseCodes();
+    return res_set;
+}
+
+void
+IVFPQFastScan::Load(const BinarySet& binary_set) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    packed_codes_.clear();
+    codes_released_ = false;
+    LoadImpl(binary_set, index_type_);
+
+    // raw vectors are optional, they are only used to re-rank the candidates
+    auto iter = binary_set.binary_map_.find(RAW_DATA);
+    if (iter != binary_set.binary_map_.end() && iter->second != nullptr) {
+        raw_data_ = iter->second->data;
+        raw_rows_ = iter->second->size / (index_->d * sizeof(float));
+    } else {
+        raw_data_ = nullptr;
+        raw_rows_ = 0;
+    }
+}
+
+void
+IVFPQFastScan::Train(const DatasetPtr& dataset_ptr, const Config& config) {
+    GETTENSOR(dataset_ptr)
+
+    faiss::MetricType metric_type = GetMetricType(config[Metric::TYPE].get<std::string>());
+    faiss::Index* coarse_quantizer = new faiss::IndexFlat(dim, metric_type);
+    auto nlist = config[IndexParams::nlist].get<int64_t>();
+    auto m = config[IndexParams::m].get<int64_t>();
+    index_ = std::shared_ptr<faiss::Index>(new faiss::IndexIVFPQ(coarse_quantizer, dim, nlist, m, 4, metric_type));
+
+    index_->train(rows, (float*)p_data);
+    packed_codes_.clear();
+    codes_released_ = false;
+}
+
+void
+IVFPQFastScan::Add(const DatasetPtr& dataset_ptr, const Config& config) {
+    if (!index_ || !index_->is_trained) {
+        KNOWHERE_THROW_MSG("index not initialize or trained");
+    }
+
+    std::lock_guard<std::mutex> lk(mutex_);
+    GETTENSORWITHIDS(dataset_ptr)
+    RestoreCodes();
+    index_->add_with_ids(rows, (float*)p_data, p_ids);
+    PackCodes();
+}
+
+void
+IVFPQFastScan::AddWithoutIds(const DatasetPtr& dataset_ptr, const Config& config) {
+    if (!index_ || !index_->is_trained) {
+        KNOWHERE_THROW_MSG("index not initialize or trained");
+    }
+
+    std::lock_guard<std::mutex> lk(mutex_);
+    GETTENSOR(dataset_ptr)
+    RestoreCodes();
+    index_->add(rows, (float*)p_data);
+    PackCodes();
+}
+
+VecIndexPtr
+IVFPQFastScan::CopyCpuToGpu(const int64_t device_id, const Config& config) {
+    KNOWHERE_THROW_MSG("IVFPQFastScan does not support CopyCpuToGpu");
+}
+
+void
+IVFPQFastScan::QueryImpl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels,
+                         const Config& config) {
+    auto ivfpq_index = dynamic_cast<faiss::IndexIVFPQ*>(index_.get());
+    auto invlists = ivfpq_index->invlists;
+    const faiss::ProductQuantizer& pq = ivfpq_index->pq;
+    size_t M = pq.M;
+    int64_t d = ivfpq_index->d;
+    bool is_ip = ivfpq_index->metric_type == faiss::METRIC_INNER_PRODUCT;
+
+    int64_t nprobe = std::min(config[IndexParams::nprobe].get<int64_t>(), (int64_t)ivfpq_index->nlist);
+    // with raw vectors attached, topk * refine_factor candidates are re-ranked with exact distances
+    int64_t refine_factor = 1;
+    if (raw_data_ != nullptr && config.contains(IndexParams::refine_factor)) {
+        refine_factor = std::max(config[IndexParams::refine_factor].get<int64_t>(), (int64_t)1);
+    }
+    int64_t pool_size = k * refine_factor;
+    auto raw_data = reinterpret_cast<const float*>(raw_data_.get());
+
+    stdclock::time_point before = stdclock::now();
+    std::vector<int64_t> coarse_ids(n * nprobe);
+    std::vector<float> coarse_dis(n * nprobe);
+    ivfpq_index->quantizer->search(n, data, nprobe, coarse_dis.data(), coarse_ids.data());
+
+#pragma omp parallel for
+    for (int64_t i = 0; i < n; i++) {
+        const float* query = data + i * d;
+
+        // approximate distances are kept "smaller is better", inner products are negated
+        std::vector<float> pool_dis(pool_size);
+        std::vector<int64_t> pool_ids(pool_size);
+        faiss::maxheap_heapify(pool_size, pool_dis.data(), pool_ids.data());
+
+        std::vector<float> residual(d);
+        std::vector<float> lut(M * 16);
+        std::vector<uint8_t> qlut(M * 16);
+        std::vector<uint16_t> sums;
+
+        // inner products do not depend on the list, only the coarse term of every list is added
+        float scale = 1, lut_bias = 0;
+        if (is_ip) {
+            pq.compute_inner_prod_table(query, lut.data());
+            for (auto& v : lut) {
+                v = -v;
+            }
+            faiss::pq4_quantize_LUT(M, lut.data(), qlut.data(), scale, lut_bias);
+        }
+
+        for (int64_t p = 0; p < nprobe; p++) {
+            int64_t list_no = coarse_ids[i * nprobe + p];
+            if (list_no < 0) {
+                continue;
+            }
+            size_t list_size = invlists->list_size(list_no);
+            if (list_size == 0) {
+                continue;
+            }
+
+            float bias;
+            if (is_ip) {
+                bias = lut_bias - coarse_dis[i * nprobe + p];
+            } else {
+                ivfpq_index->quantizer->compute_residual(query, residual.data(), list_no);
+                pq.compute_distance_table(residual.data(), lut.data());
+                faiss::pq4_quantize_LUT(M, lut.data(), qlut.data(), scale, lut_bias);
+                bias = lut_bias;
+            }
+
+            size_t nblocks = (list_size + faiss::PQ4_BLOCK_SIZE - 1) / faiss::PQ4_BLOCK_SIZE;
+            sums.resize(nblocks * faiss::PQ4_BLOCK_SIZE);
+            faiss::pq4_accumulate(nblocks, M, packed_codes_[list_no].data(), qlut.data(), sums.data());
+
+            faiss::InvertedLists::ScopedIds ids(invlists, list_no);
+            for (size_t j = 0; j < list_size; j++) {
+                float dis = bias + sums[j] / scale;
+                if (dis >= pool_dis[0]) {
+                    continue;
+                }
+                if (bitset_ != nullptr && bitset_->test(ids[j])) {
+                    continue;
+                }
+                faiss::maxheap_pop(pool_size, pool_dis.data(), pool_ids.data());
+                faiss::maxheap_push(pool_size, pool_dis.data(), pool_ids.data(), dis, ids[j]);
+            }
+        }
+
+        float* res_dis = distances + i * k;
+        int64_t* res_ids = labels + i * k;
+        if (raw_data != nullptr) {
+            // exact distances of the candidates, the best k of them are returned
+            faiss::maxheap_heapify(k, res_dis, res_ids);
+            for (int64_t j = 0; j < pool_size; j++) {
+                int64_t id = pool_ids[j];
+                if (id < 0 || id >= raw_rows_) {
+                    continue;
+                }
+                const float* raw = raw_data + id * d;
+                float dis = is_ip ? -faiss::fvec_inner_product(query, raw, d) : faiss::fvec_L2sqr(query, raw, d);
+                if (dis < res_dis[0]) {
+                    faiss::maxheap_pop(k, res_dis, res_ids);
+                    faiss::maxheap_push(k, res_dis, res_ids, dis, id);
+                }
+            }
+        } else {
+            std::copy(pool_dis.begin(), pool_dis.end(), res_dis);
+            std::copy(pool_ids.begin(), pool_ids.end(), res_ids);
+        }
+        faiss::maxheap_reorder(k, res_dis, res_ids);
+
+        if (is_ip) {
+            for (int64_t j = 0; j < k; j++) {
+                res_dis[j] = -res_dis[j];
+            }
+        }
+    }
+
+    stdclock::time_point after = stdclock::now();
+    double search_cost = (std::chrono::duration<double, std::micro>(after - before)).count();
+    LOG_KNOWHERE_DEBUG_ << "IVFPQFastScan search cost: " << search_cost << ", nq: " << n << ", nprobe: " << nprobe;
+}
+
+void
+IVFPQFastScan::SealImpl() {
+    PackCodes();
+}
+
+void
+IVFPQFastScan::PackCodes() {
+    if (codes_released_) {
+        // codes are already in the blocked layout
+        return;
+    }
+
+    auto ivfpq_index = dynamic_cast<faiss::IndexIVFPQ*>(index_.get());
+    if (ivfpq_index == nullptr) {
+        KNOWHERE_THROW_MSG("index is not IVFPQ");
+    }
+    if (ivfpq_index->pq.nbits != 4) {
+        KNOWHERE_THROW_MSG("IVFPQFastScan requires 4-bit sub-quantizers");
+    }
+
+    auto invlists = ivfpq_index->invlists;
+    size_t M = ivfpq_index->pq.M;
+    packed_codes_.resize(invlists->nlist);
+    for (size_t i = 0; i < invlists->nlist; i++) {
+        size_t list_size = invlists->list_size(i);
+        packed_codes_[i].resize(faiss::pq4_packed_size(list_size, M));
+        if (list_size > 0) {
+            faiss::InvertedLists::ScopedCodes codes(invlists, i);
+            faiss::pq4_pack_codes(codes.get(), list_size, M, packed_codes_[i].data());
+        }
+    }
+    ReleaseCodes();
+}
+
+void
+IVFPQFastScan::RestoreCodes() {
+    if (!codes_released_) {
+        return;
+    }
+
+    auto ivfpq_index = dynamic_cast<faiss::IndexIVFPQ*>(index_.get());
+    auto ails = dynamic_cast<faiss::ArrayInvertedLists*>(ivfpq_index->invlists);
+    size_t M = ivfpq_index->pq.M;
+    for (size_t i = 0; i < ails->nlist; i++) {
+        size_t list_size = ails->ids[i].size();
+        ails->codes[i].resize(list_size * ails->code_size);
+        faiss::pq4_unpack_codes(packed_codes_[i].data(), list_size, M, ails->codes[i].data());
+    }
+    codes_released_ = false;
+}
+
+void
+IVFPQFastScan::ReleaseCodes() {
+    // the blocked copy is all the scan needs, drop the faiss codes to keep the
+    // memory footprint of IVF_PQ; they are rebuilt on Serialize and Add
+    auto ivfpq_index = dynamic_cast<faiss::IndexIVFPQ*>(index_.get());
+    auto ails = dynamic_cast<faiss::ArrayInvertedLists*>(ivfpq_index->invlists);
+    if (ails == nullptr || codes_released_) {
+        return;
+    }
+    for (auto& codes : ails->codes) {
+        std::vector<uint8_t>().swap(codes);
+    }
+    codes_released_ = true;
+}
+
+}  // namespace knowhere
+}  // namespace milvus
@@ -0,0 +1,81 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "knowhere/index/vector_index/IndexIVFPQ.h"
+
+namespace milvus {
+namespace knowhere {
+
+// IVF_PQ with 4-bit sub-quantizers. Codes of every inverted list are kept in the
+// blocked layout of faiss/utils/pq4_fast_scan.h and scanned with in-register tables.
+// When RAW_DATA is attached on Load, topk * refine_factor candidates are re-ranked with exact distances.
+class IVFPQFastScan : public IVFPQ {
+ public:
+    IVFPQFastScan() : IVFPQ() {
+        index_type_ = IndexEnum::INDEX_FAISS_IVFPQFS;
+    }
+
+    explicit IVFPQFastScan(std::shared_ptr<faiss::Index> index) : IVFPQ(std::move(index)) {
+        index_type_ = IndexEnum::INDEX_FAISS_IVFPQFS;
+    }
+
+    BinarySet
+    Serialize(const Config& config = Config()) override;
+
+    void
+    Load(const BinarySet&) override;
+
+    void
+    Train(const DatasetPtr&, const Config&) override;
+
+    void
+    Add(const DatasetPtr&, const Config&) override;
+
+    void
+    AddWithoutIds(const DatasetPtr&, const Config&) override;
+
+    VecIndexPtr
+    CopyCpuToGpu(const int64_t, const Config&) override;
+
+ protected:
+    void
+    QueryImpl(int64_t, const float*, int64_t, float*, int64_t*, const Config&) override;
+
+    void
+    SealImpl() override;
+
+ private:
+    void
+    PackCodes();
+
+    void
+    RestoreCodes();
+
+    void
+    ReleaseCodes();
+
+ private:
+    std::vector<std::vector<uint8_t>> packed_codes_;
+    bool codes_released_ = false;
+    std::shared_ptr<uint8_t[]> raw_data_ = nullptr;
+    int64_t raw_rows_ = 0;
+};
+
+using IVFPQFastScanPtr = std::shared_ptr<IVFPQFastScan>;
+
+}  // namespace knowhere
+}  // namespace milvus
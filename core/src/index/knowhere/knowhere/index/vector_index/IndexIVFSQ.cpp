@@ -53,6 +53,9 @@ IVFSQ::Train(const DatasetPtr& dataset_ptr, const Config& config) {
 
 VecIndexPtr
 IVFSQ::CopyCpuToGpu(const int64_t device_id, const Config& config) {
+    if (disk_lists_ != nullptr) {
+        KNOWHERE_THROW_MSG("index with inverted lists on disk can not be copied to GPU");
+    }
 #ifdef MILVUS_GPU_VERSION
     if (auto res = FaissGpuResourceMgr::GetInstance().GetRes(device_id)) {
         ResScope rs(res, device_id, false);
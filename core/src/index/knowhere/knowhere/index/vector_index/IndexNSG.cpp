@@ -66,6 +66,8 @@ NSG::Load(const BinarySet& index_binary) {
         reader.data_ = binary->data.get();
 
         auto index = impl::read_index(reader);
+        // NSG keeps no raw data, a co-located index is reloaded without its vectors and saved back that way
+        index->Compact();
         index_.reset(index);
     } catch (std::exception& e) {
         KNOWHERE_THROW_MSG(e.what());
@@ -116,8 +118,12 @@ NSG::Train(const DatasetPtr& dataset_ptr, const Config& config) {
     const float* raw_data = idmap->GetRawVectors();
     const int64_t device_id = config[knowhere::meta::DEVICEID].get<int64_t>();
     const int64_t k = config[IndexParams::knng].get<int64_t>();
+    const bool nn_descent = config.contains(IndexParams::nn_descent) && config[IndexParams::nn_descent].get<bool>();
+    TimeRecorder rc("NSG knng", 1);
 #ifdef MILVUS_GPU_VERSION
-    if (device_id == -1) {
+    if (nn_descent) {
+        // built by the NsgIndex below
+    } else if (device_id == -1) {
         auto preprocess_index = std::make_shared<IVF>();
         preprocess_index->Train(dataset_ptr, config);
         preprocess_index->AddWithoutIds(dataset_ptr, config);
@@ -128,16 +134,25 @@ NSG::Train(const DatasetPtr& dataset_ptr, const Config& config) {
         gpu_idmap->GenGraph(raw_data, k, knng, config);
     }
 #else
-    auto preprocess_index = std::make_shared<IVF>();
-    preprocess_index->Train(dataset_ptr, config);
-    preprocess_index->AddWithoutIds(dataset_ptr, config);
-    preprocess_index->GenGraph(raw_data, k, knng, config);
+    if (!nn_descent) {
+        auto preprocess_index = std::make_shared<IVF>();
+        preprocess_index->Train(dataset_ptr, config);
+        preprocess_index->AddWithoutIds(dataset_ptr, config);
+        preprocess_index->GenGraph(raw_data, k, knng, config);
+    }
 #endif
+    double knng_time = rc.RecordSection("ivf knng") / 1000;
 
     impl::BuildParams b_params;
     b_params.candidate_pool_size = config[IndexParams::candidate];
     b_params.out_degree = config[IndexParams::out_degree];
     b_params.search_length = config[IndexParams::search_length];
+    if (config.contains(IndexParams::compact_graph)) {
+        b_params.compact_graph = config[IndexParams::compact_graph].get<bool>();
+    }
+    if (config.contains(IndexParams::colocate_vectors)) {
+        b_params.colocate_vectors = config[IndexParams::colocate_vectors].get<bool>();
+    }
 
     GETTENSORWITHIDS(dataset_ptr)
 
@@ -152,7 +167,12 @@ NSG::Train(const DatasetPtr& dataset_ptr, const Config& config) {
     }
 
     index_ = std::make_shared<impl::NsgIndex>(dim, rows, metric);
-    index_->SetKnnGraph(knng);
+    if (nn_descent) {
+        index_->BuildKnnGraph(raw_data, k);
+    } else {
+        index_->SetKnnGraph(knng);
+        index_->build_times.knng = knng_time;
+    }
     index_->Build_with_ids(rows, (float*)p_data, (int64_t*)p_ids, b_params);
 }
 
@@ -27,6 +27,8 @@ namespace knowhere {
 
 #define RAW_DATA "RAW_DATA"
 #define SQ8_DATA "SQ8_DATA"
+#define SECTOR_DATA "SECTOR_DATA"
+#define SECTOR_FILE "SECTOR_FILE"
 
 class VecIndex : public Index {
  public:
@@ -92,6 +94,10 @@ class VecIndex : public Index {
     void
     SetBlacklist(faiss::ConcurrentBitsetPtr bitset_ptr) {
         bitset_ = std::move(bitset_ptr);
+        if (bitset_ != nullptr) {
+            // publish the read-only snapshot now so that the first search does not pay for it
+            bitset_->frozen();
+        }
     }
 
     const std::vector<IDType>&
@@ -14,11 +14,13 @@
 #include "knowhere/common/Exception.h"
 #include "knowhere/common/Log.h"
 #include "knowhere/index/vector_index/IndexAnnoy.h"
+#include "knowhere/index/vector_index/IndexDiskANN.h"
 #include "knowhere/index/vector_index/IndexBinaryIDMAP.h"
 #include "knowhere/index/vector_index/IndexBinaryIVF.h"
 #include "knowhere/index/vector_index/IndexIDMAP.h"
 #include "knowhere/index/vector_index/IndexIVF.h"
 #include "knowhere/index/vector_index/IndexIVFPQ.h"
+#include "knowhere/index/vector_index/IndexIVFPQFastScan.h"
 #include "knowhere/index/vector_index/IndexIVFSQ.h"
 #include "knowhere/index/vector_offset_index/IndexHNSW_NM.h"
 #include "knowhere/index/vector_offset_index/IndexHNSW_SQ8NR.h"
@@ -63,6 +65,8 @@ VecIndexFactory::CreateVecIndex(const IndexType& type, const IndexMode mode) {
         }
 #endif
         return std::make_shared<knowhere::IVFPQ>();
+    } else if (type == IndexEnum::INDEX_FAISS_IVFPQFS) {
+        return std::make_shared<knowhere::IVFPQFastScan>();
     } else if (type == IndexEnum::INDEX_FAISS_IVFSQ8) {
 #ifdef MILVUS_GPU_VERSION
         if (mode == IndexMode::MODE_GPU) {
@@ -94,6 +98,8 @@ VecIndexFactory::CreateVecIndex(const IndexType& type, const IndexMode mode) {
         return std::make_shared<knowhere::IVFSQNR_NM>();
     } else if (type == IndexEnum::INDEX_HNSW_SQ8NR) {
         return std::make_shared<knowhere::IndexHNSW_SQ8NR>();
+    } else if (type == IndexEnum::INDEX_DISKANN) {
+        return std::make_shared<knowhere::IndexDiskANN>();
     } else {
         return nullptr;
     }
@@ -0,0 +1,257 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "knowhere/index/vector_index/helpers/DiskInvertedLists.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "knowhere/common/Exception.h"
+
+namespace milvus {
+namespace knowhere {
+
+namespace {
+
+void
+WriteAll(int fd, const void* data, size_t length, int64_t offset) {
+    auto ptr = static_cast<const uint8_t*>(data);
+    while (length > 0) {
+        ssize_t written = pwrite(fd, ptr, length, offset);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            KNOWHERE_THROW_MSG("failed to write inverted lists: " + std::string(strerror(errno)));
+        }
+        ptr += written;
+        offset += written;
+        length -= written;
+    }
+}
+
+void
+ReadAll(int fd, void* data, size_t length, int64_t offset) {
+    auto ptr = static_cast<uint8_t*>(data);
+    while (length > 0) {
+        ssize_t read = pread(fd, ptr, length, offset);
+        if (read < 0 && errno == EINTR) {
+            continue;
+        }
+        if (read <= 0) {
+            KNOWHERE_THROW_MSG("failed to read inverted lists: " + std::string(read < 0 ? strerror(errno) : "eof"));
+        }
+        ptr += read;
+        offset += read;
+        length -= read;
+    }
+}
+
+}  // namespace
+
+DiskInvertedLists::DiskInvertedLists(size_t nlist, size_t code_size, const std::string& path, int64_t cache_size)
+    : InvertedLists(nlist, code_size), cache_size_(cache_size), sizes_(nlist, 0), offsets_(nlist, 0) {
+    fd_ = open(path.c_str(), O_RDONLY);
+    if (fd_ < 0) {
+        KNOWHERE_THROW_MSG("failed to open inverted lists file " + path + ": " + std::string(strerror(errno)));
+    }
+
+    std::vector<uint64_t> sizes(nlist);
+    int64_t header_size = nlist * sizeof(uint64_t);
+    struct stat file_stat;
+    if (fstat(fd_, &file_stat) != 0 || file_stat.st_size < header_size) {
+        close(fd_);
+        KNOWHERE_THROW_MSG("inverted lists file " + path + " does not match the index");
+    }
+    try {
+        ReadAll(fd_, sizes.data(), header_size, 0);
+    } catch (...) {
+        close(fd_);
+        throw;
+    }
+
+    int64_t offset = header_size;
+    for (size_t i = 0; i < nlist; i++) {
+        sizes_[i] = sizes[i];
+        offsets_[i] = offset;
+        offset += sizes[i] * (code_size + sizeof(idx_t));
+    }
+    file_size_ = offset - header_size;
+    if (offset != file_stat.st_size) {
+        close(fd_);
+        KNOWHERE_THROW_MSG("inverted lists file " + path + " does not match the index");
+    }
+}
+
+DiskInvertedLists::~DiskInvertedLists() {
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+}
+
+void
+DiskInvertedLists::Write(const faiss::InvertedLists* src, const std::string& path, const ListCodes& list_codes) {
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        KNOWHERE_THROW_MSG("failed to create inverted lists file " + path + ": " + std::string(strerror(errno)));
+    }
+
+    try {
+        std::vector<uint64_t> sizes(src->nlist);
+        for (size_t i = 0; i < src->nlist; i++) {
+            sizes[i] = src->list_size(i);
+        }
+        int64_t offset = 0;
+        WriteAll(fd, sizes.data(), sizes.size() * sizeof(uint64_t), offset);
+        offset += sizes.size() * sizeof(uint64_t);
+
+        std::vector<uint8_t> codes;
+        for (size_t i = 0; i < src->nlist; i++) {
+            if (sizes[i] == 0) {
+                continue;
+            }
+            faiss::InvertedLists::ScopedIds ids(src, i);
+            if (list_codes != nullptr) {
+                list_codes(i, codes);
+                WriteAll(fd, codes.data(), sizes[i] * src->code_size, offset);
+            } else {
+                faiss::InvertedLists::ScopedCodes list(src, i);
+                WriteAll(fd, list.get(), sizes[i] * src->code_size, offset);
+            }
+            offset += sizes[i] * src->code_size;
+            WriteAll(fd, ids.get(), sizes[i] * sizeof(idx_t), offset);
+            offset += sizes[i] * sizeof(idx_t);
+        }
+    } catch (...) {
+        close(fd);
+        unlink(path.c_str());
+        throw;
+    }
+    close(fd);
+}
+
+size_t
+DiskInvertedLists::list_size(size_t list_no) const {
+    return sizes_[list_no];
+}
+
+const uint8_t*
+DiskInvertedLists::get_codes(size_t list_no) const {
+    return Pin(list_no)->data();
+}
+
+const faiss::InvertedLists::idx_t*
+DiskInvertedLists::get_ids(size_t list_no) const {
+    return reinterpret_cast<const idx_t*>(Pin(list_no)->data() + sizes_[list_no] * code_size);
+}
+
+void
+DiskInvertedLists::release_codes(size_t list_no, const uint8_t* codes) const {
+    Unpin(list_no);
+}
+
+void
+DiskInvertedLists::release_ids(size_t list_no, const idx_t* ids) const {
+    Unpin(list_no);
+}
+
+size_t
+DiskInvertedLists::add_entries(size_t list_no, size_t n_entry, const idx_t* ids, const uint8_t* code) {
+    KNOWHERE_THROW_MSG("inverted lists on disk are read only");
+}
+
+void
+DiskInvertedLists::update_entries(size_t list_no, size_t offset, size_t n_entry, const idx_t* ids,
+                                  const uint8_t* code) {
+    KNOWHERE_THROW_MSG("inverted lists on disk are read only");
+}
+
+void
+DiskInvertedLists::resize(size_t list_no, size_t new_size) {
+    KNOWHERE_THROW_MSG("inverted lists on disk are read only");
+}
+
+DiskInvertedLists::ListBuffer
+DiskInvertedLists::Pin(size_t list_no) const {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto pinned = pinned_.find(list_no);
+        if (pinned != pinned_.end()) {
+            pinned->second.count++;
+            cache_hits_++;
+            return pinned->second.buffer;
+        }
+
+        auto cached = cache_.find(list_no);
+        if (cached != cache_.end()) {
+            lru_.splice(lru_.begin(), lru_, cached->second.lru_pos);
+            auto& pin = pinned_[list_no];
+            pin.buffer = cached->second.buffer;
+            pin.count = 1;
+            cache_hits_++;
+            return pin.buffer;
+        }
+    }
+
+    // read outside of the lock so that other lists can be served meanwhile
+    auto buffer = ReadList(list_no);
+    cache_misses_++;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& pin = pinned_[list_no];
+    if (pin.buffer != nullptr) {
+        // another search read the same list first
+        pin.count++;
+        return pin.buffer;
+    }
+    pin.buffer = buffer;
+    pin.count = 1;
+
+    auto bytes = static_cast<int64_t>(buffer->size());
+    if (bytes <= cache_size_ && cache_.find(list_no) == cache_.end()) {
+        lru_.push_front(list_no);
+        cache_[list_no] = CacheEntry{buffer, lru_.begin()};
+        cached_bytes_ += bytes;
+        while (cached_bytes_ > cache_size_) {
+            auto victim = cache_.find(lru_.back());
+            cached_bytes_ -= static_cast<int64_t>(victim->second.buffer->size());
+            cache_.erase(victim);
+            lru_.pop_back();
+        }
+    }
+    return buffer;
+}
+
+void
+DiskInvertedLists::Unpin(size_t list_no) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto pinned = pinned_.find(list_no);
+    if (pinned != pinned_.end() && --pinned->second.count <= 0) {
+        pinned_.erase(pinned);
+    }
+}
+
+DiskInvertedLists::ListBuffer
+DiskInvertedLists::ReadList(size_t list_no) const {
+    size_t size = sizes_[list_no];
+    auto buffer = std::make_shared<std::vector<uint8_t>>(size * (code_size + sizeof(idx_t)));
+    if (size > 0) {
+        ReadAll(fd_, buffer->data(), buffer->size(), offsets_[list_no]);
+    }
+    return buffer;
+}
+
+}  // namespace knowhere
+}  // namespace milvus
@@ -0,0 +1,160 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <faiss/IndexIVF.h>
+#include <faiss/InvertedLists.h>
+
+#include <atomic>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace milvus {
+namespace knowhere {
+
+/**
+ * Read-only inverted lists kept in a file instead of memory.
+ *
+ * The file starts with the size of every list, followed by the lists in list_no order. Every list
+ * is stored as codes[size * code_size] followed by ids[size], the same layout as
+ * faiss::OnDiskInvertedLists. A probed list is read with a single pread and kept in an LRU of
+ * hot lists bounded by cache_size bytes; lists in use by a search stay pinned until released.
+ *
+ * The file is written once when the index is built, loads of the index only open it.
+ */
+class DiskInvertedLists : public faiss::InvertedLists {
+ public:
+    /// codes of list_no, for indexes that keep their codes outside of the inverted lists
+    using ListCodes = std::function<void(size_t list_no, std::vector<uint8_t>& codes)>;
+
+    /// open the lists written to path by Write
+    DiskInvertedLists(size_t nlist, size_t code_size, const std::string& path, int64_t cache_size);
+
+    ~DiskInvertedLists() override;
+
+    /// write the lists of src to path, the codes are taken from list_codes when it is given
+    static void
+    Write(const faiss::InvertedLists* src, const std::string& path, const ListCodes& list_codes = nullptr);
+
+    size_t
+    list_size(size_t list_no) const override;
+
+    const uint8_t*
+    get_codes(size_t list_no) const override;
+
+    const idx_t*
+    get_ids(size_t list_no) const override;
+
+    void
+    release_codes(size_t list_no, const uint8_t* codes) const override;
+
+    void
+    release_ids(size_t list_no, const idx_t* ids) const override;
+
+    size_t
+    add_entries(size_t list_no, size_t n_entry, const idx_t* ids, const uint8_t* code) override;
+
+    void
+    update_entries(size_t list_no, size_t offset, size_t n_entry, const idx_t* ids, const uint8_t* code) override;
+
+    void
+    resize(size_t list_no, size_t new_size) override;
+
+    int64_t
+    CacheSize() const {
+        return cache_size_;
+    }
+
+    /// bytes of all lists in the file
+    int64_t
+    FileSize() const {
+        return file_size_;
+    }
+
+    /// accesses to the codes or ids of a list served without reading the file
+    int64_t
+    CacheHits() const {
+        return cache_hits_;
+    }
+
+    /// accesses to the codes or ids of a list that read it from the file
+    int64_t
+    CacheMisses() const {
+        return cache_misses_;
+    }
+
+ private:
+    using ListBuffer = std::shared_ptr<std::vector<uint8_t>>;
+
+    struct CacheEntry {
+        ListBuffer buffer;
+        std::list<size_t>::iterator lru_pos;
+    };
+
+    struct PinnedList {
+        ListBuffer buffer;
+        int64_t count = 0;
+    };
+
+    ListBuffer
+    Pin(size_t list_no) const;
+
+    void
+    Unpin(size_t list_no) const;
+
+    ListBuffer
+    ReadList(size_t list_no) const;
+
+ private:
+    int fd_ = -1;
+    int64_t file_size_ = 0;
+    int64_t cache_size_ = 0;
+    std::vector<size_t> sizes_;
+    std::vector<int64_t> offsets_;
+
+    mutable std::mutex mutex_;
+    mutable std::list<size_t> lru_;
+    mutable std::unordered_map<size_t, CacheEntry> cache_;
+    mutable std::unordered_map<size_t, PinnedList> pinned_;
+    mutable int64_t cached_bytes_ = 0;
+    mutable std::atomic<int64_t> cache_hits_{0};
+    mutable std::atomic<int64_t> cache_misses_{0};
+};
+
+/**
+ * Lends an IVF index empty inverted lists while it is written, so that an index whose lists are on
+ * disk serializes only its quantizer. The lists in the file are restored when the scope ends.
+ */
+class ScopedEmptyLists {
+ public:
+    explicit ScopedEmptyLists(faiss::IndexIVF* index)
+        : index_(index), lists_(index->invlists), empty_(index->nlist, index->code_size) {
+        index_->invlists = &empty_;
+    }
+
+    ~ScopedEmptyLists() {
+        index_->invlists = lists_;
+    }
+
+ private:
+    faiss::IndexIVF* index_;
+    faiss::InvertedLists* lists_;
+    faiss::ArrayInvertedLists empty_;
+};
+
+}  // namespace knowhere
+}  // namespace milvus
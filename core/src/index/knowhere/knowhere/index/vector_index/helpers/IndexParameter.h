@@ -25,20 +25,33 @@ constexpr const char* IDS = "ids";
 constexpr const char* DISTANCE = "distance";
 constexpr const char* TOPK = "k";
 constexpr const char* DEVICEID = "gpu_id";
+// per query distance a result must beat, known from other segments of the same search
+constexpr const char* TOPK_BOUNDS = "topk_bounds";
 };  // namespace meta
 
 namespace IndexParams {
 // IVF Params
 constexpr const char* nprobe = "nprobe";
 constexpr const char* nlist = "nlist";
-constexpr const char* m = "m";          // PQ
-constexpr const char* nbits = "nbits";  // PQ/SQ
+constexpr const char* m = "m";                              // PQ
+constexpr const char* nbits = "nbits";                      // PQ/SQ
+constexpr const char* rerank = "rerank";                    // PQ fast scan
+constexpr const char* disk_mode = "disk_mode";              // inverted lists read from disk
+constexpr const char* disk_cache_size = "disk_cache_size";  // MB of hot lists cached in disk mode
 
 // NSG Params
 constexpr const char* knng = "knng";
 constexpr const char* search_length = "search_length";
 constexpr const char* out_degree = "out_degree";
 constexpr const char* candidate = "candidate_pool_size";
+constexpr const char* compact_graph = "compact_graph";
+constexpr const char* colocate_vectors = "colocate_vectors";
+constexpr const char* nn_descent = "nn_descent";
+
+// DiskANN Params
+constexpr const char* alpha = "alpha";
+constexpr const char* beam_width = "beam_width";
+constexpr const char* cache_nodes = "cache_nodes";
 
 // HNSW Params
 constexpr const char* efConstruction = "efConstruction";
@@ -48,6 +61,9 @@ constexpr const char* ef = "ef";
 // Annoy Params
 constexpr const char* n_trees = "n_trees";
 constexpr const char* search_k = "search_k";
+
+// Refine Params
+constexpr const char* refine_factor = "refine_factor";
 }  // namespace IndexParams
 
 namespace Metric {
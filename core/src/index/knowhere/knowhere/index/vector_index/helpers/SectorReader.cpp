@@ -0,0 +1,62 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "knowhere/index/vector_index/helpers/SectorReader.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "knowhere/common/Exception.h"
+
+namespace milvus {
+namespace knowhere {
+
+SectorFile::SectorFile(const std::string& path) : path_(path) {
+    // hot nodes are cached by the index itself; some file systems refuse O_DIRECT
+    fd_ = open(path.c_str(), O_RDONLY | O_DIRECT);
+    if (fd_ < 0) {
+        fd_ = open(path.c_str(), O_RDONLY);
+    }
+    if (fd_ < 0) {
+        KNOWHERE_THROW_MSG("failed to open sectors " + path + ": " + std::string(strerror(errno)));
+    }
+    size_ = lseek(fd_, 0, SEEK_END);
+}
+
+SectorFile::~SectorFile() {
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+}
+
+void
+SectorFile::Read(void* data, size_t length, int64_t offset) const {
+    auto ptr = static_cast<uint8_t*>(data);
+    while (length > 0) {
+        ssize_t read = pread(fd_, ptr, length, offset);
+        if (read < 0 && errno == EINTR) {
+            continue;
+        }
+        if (read <= 0) {
+            KNOWHERE_THROW_MSG("failed to read sectors " + path_ + ": " +
+                               std::string(read < 0 ? strerror(errno) : "eof"));
+        }
+        ptr += read;
+        offset += read;
+        length -= read;
+    }
+}
+
+}  // namespace knowhere
+}  // namespace milvus
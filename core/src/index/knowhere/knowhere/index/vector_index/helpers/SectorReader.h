@@ -0,0 +1,66 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace milvus {
+namespace knowhere {
+
+/**
+ * Positional reads of the sectors of a disk resident index. Concurrent searches call Read at once,
+ * implementations must not keep a file position between calls.
+ */
+class SectorReader {
+ public:
+    virtual ~SectorReader() = default;
+
+    /// bytes of all sectors
+    virtual int64_t
+    Size() const = 0;
+
+    /// read length bytes at offset into data, throws when they can not be read
+    virtual void
+    Read(void* data, size_t length, int64_t offset) const = 0;
+};
+
+using SectorReaderPtr = std::shared_ptr<SectorReader>;
+
+/**
+ * Sectors in a local file. The page cache is bypassed when the file system allows O_DIRECT, the
+ * buffers and offsets of Read must then be aligned to the sector size.
+ */
+class SectorFile : public SectorReader {
+ public:
+    explicit SectorFile(const std::string& path);
+
+    ~SectorFile() override;
+
+    int64_t
+    Size() const override {
+        return size_;
+    }
+
+    void
+    Read(void* data, size_t length, int64_t offset) const override;
+
+ private:
+    std::string path_;
+    int fd_ = -1;
+    int64_t size_ = 0;
+};
+
+}  // namespace knowhere
+}  // namespace milvus
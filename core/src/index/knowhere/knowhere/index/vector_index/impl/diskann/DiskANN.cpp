@@ -0,0 +1,415 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "knowhere/index/vector_index/impl/diskann/DiskANN.h"
+
+#include <faiss/FaissHook.h>
+#include <faiss/utils/distances.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <queue>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+#include "knowhere/common/Exception.h"
+
+namespace milvus {
+namespace knowhere {
+namespace impl {
+
+namespace {
+
+constexpr size_t PQ_NBITS = 8;
+constexpr size_t MAX_PQ_TRAIN_SIZE = 100000;
+
+// O_DIRECT reads need sector aligned buffers
+using AlignedBuffer = std::unique_ptr<uint8_t, decltype(&free)>;
+
+AlignedBuffer
+AllocAligned(size_t size) {
+    void* ptr = nullptr;
+    if (posix_memalign(&ptr, DISKANN_SECTOR_SIZE, size) != 0) {
+        throw std::bad_alloc();
+    }
+    return AlignedBuffer(static_cast<uint8_t*>(ptr), &free);
+}
+
+}  // namespace
+
+DiskANNIndex::DiskANNIndex(size_t dimension, size_t max_degree, size_t pq_m)
+    : dimension(dimension), max_degree(max_degree), pq_(dimension, pq_m, PQ_NBITS) {
+}
+
+size_t
+DiskANNIndex::NodeSize() const {
+    return dimension * sizeof(float) + sizeof(uint32_t) + max_degree * sizeof(uint32_t);
+}
+
+size_t
+DiskANNIndex::NodesPerSector() const {
+    return DISKANN_SECTOR_SIZE / NodeSize();
+}
+
+size_t
+DiskANNIndex::ReadSize() const {
+    if (NodesPerSector() > 0) {
+        return DISKANN_SECTOR_SIZE;
+    }
+    return (NodeSize() + DISKANN_SECTOR_SIZE - 1) / DISKANN_SECTOR_SIZE * DISKANN_SECTOR_SIZE;
+}
+
+int64_t
+DiskANNIndex::NodeOffset(uint32_t id) const {
+    auto per_sector = NodesPerSector();
+    if (per_sector > 0) {
+        return static_cast<int64_t>(id / per_sector) * DISKANN_SECTOR_SIZE;
+    }
+    return static_cast<int64_t>(id) * ReadSize();
+}
+
+void
+DiskANNIndex::WriteNode(uint8_t* sectors, uint32_t id, const float* vec, const std::vector<uint32_t>& neighbors) const {
+    auto per_sector = NodesPerSector();
+    uint8_t* node = sectors + NodeOffset(id) + (per_sector > 0 ? (id % per_sector) * NodeSize() : 0);
+    memcpy(node, vec, dimension * sizeof(float));
+    auto count = static_cast<uint32_t>(neighbors.size());
+    memcpy(node + dimension * sizeof(float), &count, sizeof(count));
+    memcpy(node + dimension * sizeof(float) + sizeof(count), neighbors.data(), count * sizeof(uint32_t));
+}
+
+void
+DiskANNIndex::Build(size_t n, const float* data, const int64_t* ids, const VamanaBuildParams& params) {
+    ntotal = n;
+
+    // the codebooks need at least ksub training vectors, small segments are repeated to get them
+    size_t train_size = std::max(std::min(n, MAX_PQ_TRAIN_SIZE), pq_.ksub);
+    std::vector<float> train(train_size * dimension);
+    for (size_t i = 0; i < train_size; i++) {
+        size_t row = n > train_size ? i * (n / train_size) : i % n;
+        memcpy(train.data() + i * dimension, data + row * dimension, dimension * sizeof(float));
+    }
+    pq_.train(train_size, train.data());
+    codes_.resize(n * pq_.code_size);
+    pq_.compute_codes(data, codes_.data(), n);
+
+    ids_.resize(n);
+    if (ids != nullptr) {
+        memcpy(ids_.data(), ids, n * sizeof(int64_t));
+    } else {
+        std::iota(ids_.begin(), ids_.end(), 0);
+    }
+
+    VamanaGraph graph;
+    medoid = BuildVamanaGraph(data, n, dimension, params, graph);
+
+    int64_t size = n > 0 ? NodeOffset(n - 1) + ReadSize() : 0;
+    std::shared_ptr<uint8_t[]> sectors(new uint8_t[size]());
+    for (size_t i = 0; i < n; i++) {
+        WriteNode(sectors.get(), i, data + i * dimension, graph[i]);
+    }
+    SetSectors(sectors, size);
+}
+
+void
+DiskANNIndex::Write(MemoryIOWriter& writer) const {
+    writer(&dimension, sizeof(dimension), 1);
+    writer(&ntotal, sizeof(ntotal), 1);
+    writer(&max_degree, sizeof(max_degree), 1);
+    writer(&medoid, sizeof(medoid), 1);
+    writer(&cache_nodes, sizeof(cache_nodes), 1);
+    writer(&pq_.M, sizeof(pq_.M), 1);
+    writer(&pq_.nbits, sizeof(pq_.nbits), 1);
+    writer(pq_.centroids.data(), sizeof(float), pq_.centroids.size());
+    writer(codes_.data(), sizeof(uint8_t), codes_.size());
+    writer(ids_.data(), sizeof(int64_t), ids_.size());
+}
+
+void
+DiskANNIndex::Read(MemoryIOReader& reader) {
+    size_t pq_m, pq_nbits;
+    reader(&dimension, sizeof(dimension), 1);
+    reader(&ntotal, sizeof(ntotal), 1);
+    reader(&max_degree, sizeof(max_degree), 1);
+    reader(&medoid, sizeof(medoid), 1);
+    reader(&cache_nodes, sizeof(cache_nodes), 1);
+    reader(&pq_m, sizeof(pq_m), 1);
+    reader(&pq_nbits, sizeof(pq_nbits), 1);
+
+    pq_ = faiss::ProductQuantizer(dimension, pq_m, pq_nbits);
+    reader(pq_.centroids.data(), sizeof(float), pq_.centroids.size());
+    codes_.resize(ntotal * pq_.code_size);
+    reader(codes_.data(), sizeof(uint8_t), codes_.size());
+    ids_.resize(ntotal);
+    reader(ids_.data(), sizeof(int64_t), ids_.size());
+}
+
+void
+DiskANNIndex::SetSectors(std::shared_ptr<uint8_t[]> sectors, int64_t size) {
+    reader_ = nullptr;
+    cache_pos_.clear();
+    cache_data_.clear();
+    sectors_ = std::move(sectors);
+    sectors_size_ = size;
+}
+
+void
+DiskANNIndex::OpenSectors(const SectorReaderPtr& reader) {
+    int64_t expected = ntotal > 0 ? NodeOffset(ntotal - 1) + ReadSize() : 0;
+    if (reader->Size() != expected) {
+        KNOWHERE_THROW_MSG("sectors do not match the index");
+    }
+    cache_pos_.clear();
+    cache_data_.clear();
+    sectors_ = nullptr;
+    sectors_size_ = expected;
+    reader_ = reader;
+}
+
+std::shared_ptr<uint8_t[]>
+DiskANNIndex::GetSectors() const {
+    if (sectors_ != nullptr || reader_ == nullptr) {
+        return sectors_;
+    }
+
+    auto buffer = AllocAligned(sectors_size_);
+    reader_->Read(buffer.get(), sectors_size_, 0);
+    return std::shared_ptr<uint8_t[]>(buffer.release(), &free);
+}
+
+int64_t
+DiskANNIndex::SectorsSize() const {
+    return sectors_size_;
+}
+
+const uint8_t*
+DiskANNIndex::CachedNode(uint32_t id) const {
+    if (sectors_ != nullptr) {
+        auto per_sector = NodesPerSector();
+        return sectors_.get() + NodeOffset(id) + (per_sector > 0 ? (id % per_sector) * NodeSize() : 0);
+    }
+    auto pos = cache_pos_.find(id);
+    return pos == cache_pos_.end() ? nullptr : cache_data_.data() + pos->second * NodeSize();
+}
+
+void
+DiskANNIndex::ReadNodes(const std::vector<uint32_t>& ids, uint8_t* buffer, std::vector<const uint8_t*>& nodes) const {
+    nodes.resize(ids.size());
+    if (ids.empty()) {
+        return;
+    }
+
+    if (reader_ == nullptr) {
+        KNOWHERE_THROW_MSG("sectors are not opened");
+    }
+
+    std::vector<std::pair<int64_t, size_t>> offsets(ids.size());
+    for (size_t i = 0; i < ids.size(); i++) {
+        offsets[i] = {NodeOffset(ids[i]), i};
+    }
+    std::sort(offsets.begin(), offsets.end());
+
+    // one buffer slot per distinct sector, adjacent sectors are fetched with a single read
+    auto read_size = ReadSize();
+    auto per_sector = NodesPerSector();
+    size_t slot = 0, run_begin = 0;
+    int64_t run_offset = offsets[0].first;
+    for (size_t i = 0; i < offsets.size(); i++) {
+        if (i > 0 && offsets[i].first != offsets[i - 1].first) {
+            slot++;
+            if (offsets[i].first != offsets[i - 1].first + static_cast<int64_t>(read_size)) {
+                reader_->Read(buffer + run_begin * read_size, (slot - run_begin) * read_size, run_offset);
+                sector_reads_++;
+                run_begin = slot;
+                run_offset = offsets[i].first;
+            }
+        }
+        auto id = ids[offsets[i].second];
+        nodes[offsets[i].second] = buffer + slot * read_size + (per_sector > 0 ? (id % per_sector) * NodeSize() : 0);
+    }
+    reader_->Read(buffer + run_begin * read_size, (slot + 1 - run_begin) * read_size, run_offset);
+    sector_reads_++;
+}
+
+void
+DiskANNIndex::CacheNodes(size_t count) {
+    cache_pos_.clear();
+    cache_data_.clear();
+    count = std::min(count, ntotal);
+    if (reader_ == nullptr || count == 0) {
+        return;
+    }
+
+    // breadth first from the medoid, every search passes through these hops
+    auto node_size = NodeSize();
+    auto buffer = AllocAligned(ReadSize());
+    std::vector<const uint8_t*> nodes;
+    std::queue<uint32_t> frontier;
+    frontier.push(medoid);
+    cache_pos_[medoid] = 0;
+    cache_data_.reserve(count * node_size);
+    while (!frontier.empty()) {
+        uint32_t id = frontier.front();
+        frontier.pop();
+        ReadNodes({id}, buffer.get(), nodes);
+        cache_data_.insert(cache_data_.end(), nodes[0], nodes[0] + node_size);
+
+        uint32_t neighbor_count;
+        memcpy(&neighbor_count, nodes[0] + dimension * sizeof(float), sizeof(neighbor_count));
+        auto neighbors = reinterpret_cast<const uint32_t*>(nodes[0] + dimension * sizeof(float) + sizeof(uint32_t));
+        for (uint32_t i = 0; i < neighbor_count && cache_pos_.size() < count; i++) {
+            if (cache_pos_.emplace(neighbors[i], cache_pos_.size()).second) {
+                frontier.push(neighbors[i]);
+            }
+        }
+    }
+}
+
+int64_t
+DiskANNIndex::MemorySize() const {
+    int64_t size = codes_.size() + ids_.size() * sizeof(int64_t) + pq_.centroids.size() * sizeof(float);
+    size += cache_data_.size();
+    if (sectors_ != nullptr) {
+        size += sectors_size_;
+    }
+    return size;
+}
+
+void
+DiskANNIndex::Search(const float* queries, size_t nq, size_t k, float* distances, int64_t* labels,
+                     const DiskANNSearchParams& params, const faiss::ConcurrentBitsetPtr& bitset) const {
+    auto blacklist = faiss::frozen_blacklist(bitset);
+    auto list_size = std::max(params.search_list_size, k);
+    auto beam_width = std::max<size_t>(params.beam_width, 1);
+    size_t code_size = pq_.code_size;
+    size_t ksub = pq_.ksub;
+    size_t vec_size = dimension * sizeof(float);
+
+    // exceptions can not leave the parallel loop, the first one is rethrown once it is done
+    bool interrupt = false;
+    std::mutex exception_mutex;
+    std::string exception_string;
+
+#pragma omp parallel for
+    for (size_t q = 0; q < nq; q++) {
+        if (interrupt) {
+            continue;
+        }
+        try {
+            const float* query = queries + q * dimension;
+            std::vector<float> table(pq_.M * ksub);
+            pq_.compute_distance_table(query, table.data());
+            auto pq_distance = [&](uint32_t id) {
+                const uint8_t* code = codes_.data() + id * code_size;
+                float dist = 0;
+                for (size_t m = 0; m < code_size; m++) {
+                    dist += table[m * ksub + code[m]];
+                }
+                return dist;
+            };
+
+            std::vector<Candidate> list;
+            list.reserve(list_size + 1);
+            std::unordered_set<uint32_t> visited;
+            std::vector<std::pair<float, uint32_t>> exact;
+            // sectors in memory are never read, the buffer is only needed when they are on disk
+            AlignedBuffer buffer(nullptr, &free);
+            if (sectors_ == nullptr) {
+                buffer = AllocAligned(beam_width * ReadSize());
+            }
+            std::vector<uint32_t> beam, to_read;
+            std::vector<const uint8_t*> beam_nodes, read_nodes;
+
+            if (ntotal > 0) {
+                visited.insert(medoid);
+                list.push_back({medoid, pq_distance(medoid), false});
+            }
+            while (true) {
+                beam.clear();
+                for (auto& c : list) {
+                    if (!c.expanded) {
+                        c.expanded = true;
+                        beam.push_back(c.id);
+                        if (beam.size() >= beam_width) {
+                            break;
+                        }
+                    }
+                }
+                if (beam.empty()) {
+                    break;
+                }
+
+                to_read.clear();
+                beam_nodes.resize(beam.size());
+                for (size_t i = 0; i < beam.size(); i++) {
+                    beam_nodes[i] = CachedNode(beam[i]);
+                    if (beam_nodes[i] == nullptr) {
+                        to_read.push_back(beam[i]);
+                    }
+                }
+                ReadNodes(to_read, buffer.get(), read_nodes);
+                for (size_t i = 0, r = 0; i < beam.size(); i++) {
+                    if (beam_nodes[i] == nullptr) {
+                        beam_nodes[i] = read_nodes[r++];
+                    }
+                }
+
+                for (size_t i = 0; i < beam.size(); i++) {
+                    const uint8_t* node = beam_nodes[i];
+                    if (blacklist == nullptr || !blacklist->test(ids_[beam[i]])) {
+                        exact.emplace_back(faiss::fvec_L2sqr(query, reinterpret_cast<const float*>(node), dimension),
+                                           beam[i]);
+                    }
+
+                    uint32_t neighbor_count;
+                    memcpy(&neighbor_count, node + vec_size, sizeof(neighbor_count));
+                    auto neighbors = reinterpret_cast<const uint32_t*>(node + vec_size + sizeof(uint32_t));
+                    for (uint32_t j = 0; j < neighbor_count; j++) {
+                        if (visited.insert(neighbors[j]).second) {
+                            InsertCandidate(list, list_size, {neighbors[j], pq_distance(neighbors[j]), false});
+                        }
+                    }
+                }
+            }
+
+            size_t found = std::min(k, exact.size());
+            std::partial_sort(exact.begin(), exact.begin() + found, exact.end());
+            for (size_t i = 0; i < k; i++) {
+                if (i < found) {
+                    distances[q * k + i] = exact[i].first;
+                    labels[q * k + i] = ids_[exact[i].second];
+                } else {
+                    distances[q * k + i] = std::numeric_limits<float>::max();
+                    labels[q * k + i] = -1;
+                }
+            }
+        } catch (const std::exception& e) {
+            std::lock_guard<std::mutex> lock(exception_mutex);
+            if (!interrupt) {
+                exception_string = e.what();
+                interrupt = true;
+            }
+        }
+    }
+
+    if (interrupt) {
+        KNOWHERE_THROW_MSG(exception_string);
+    }
+}
+
+}  // namespace impl
+}  // namespace knowhere
+}  // namespace milvus
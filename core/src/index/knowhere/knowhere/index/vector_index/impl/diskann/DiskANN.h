@@ -0,0 +1,142 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <faiss/impl/ProductQuantizer.h>
+#include <faiss/utils/ConcurrentBitset.h>
+
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "knowhere/index/vector_index/helpers/FaissIO.h"
+#include "knowhere/index/vector_index/helpers/SectorReader.h"
+#include "knowhere/index/vector_index/impl/diskann/Vamana.h"
+
+namespace milvus {
+namespace knowhere {
+namespace impl {
+
+constexpr size_t DISKANN_SECTOR_SIZE = 4096;
+
+struct DiskANNSearchParams {
+    size_t search_list_size;  // L, candidates kept by the beam search
+    size_t beam_width;        // W, nodes read from disk per hop
+};
+
+/**
+ * Vamana graph served from sectors on disk, routed with PQ codes kept in memory.
+ *
+ * Every node is stored as its full vector, its neighbor count and max_degree neighbor slots.
+ * Nodes never straddle a sector: small nodes are packed several per 4 KB sector, large nodes
+ * take whole sectors of their own, so a node is always fetched with one aligned read.
+ *
+ * A search expands the W closest unexpanded candidates per hop, the sectors of the whole beam
+ * are read as one batch. Candidates are ranked with PQ distances, the expanded nodes with the
+ * exact distance of the vector read along with their neighbors.
+ */
+class DiskANNIndex {
+ public:
+    DiskANNIndex() = default;
+
+    DiskANNIndex(size_t dimension, size_t max_degree, size_t pq_m);
+
+    void
+    Build(size_t n, const float* data, const int64_t* ids, const VamanaBuildParams& params);
+
+    void
+    Search(const float* queries, size_t nq, size_t k, float* distances, int64_t* labels,
+           const DiskANNSearchParams& params, const faiss::ConcurrentBitsetPtr& bitset) const;
+
+    /// everything but the sectors
+    void
+    Write(MemoryIOWriter& writer) const;
+
+    void
+    Read(MemoryIOReader& reader);
+
+    /// serve the sectors from memory, as left by Build
+    void
+    SetSectors(std::shared_ptr<uint8_t[]> sectors, int64_t size);
+
+    /// serve the sectors from a reader of the content of GetSectors
+    void
+    OpenSectors(const SectorReaderPtr& reader);
+
+    /// the sectors in memory, read back through the reader when they are served from disk
+    std::shared_ptr<uint8_t[]>
+    GetSectors() const;
+
+    int64_t
+    SectorsSize() const;
+
+    /// keep the nodes closest to the medoid in hops in memory
+    void
+    CacheNodes(size_t count);
+
+    /// bytes held in memory, PQ codes, ids and cached nodes
+    int64_t
+    MemorySize() const;
+
+    int64_t
+    SectorReads() const {
+        return sector_reads_;
+    }
+
+ public:
+    size_t dimension = 0;
+    size_t ntotal = 0;
+    size_t max_degree = 0;
+    uint32_t medoid = 0;
+    size_t cache_nodes = 0;
+
+ private:
+    size_t
+    NodeSize() const;
+
+    size_t
+    NodesPerSector() const;
+
+    size_t
+    ReadSize() const;
+
+    int64_t
+    NodeOffset(uint32_t id) const;
+
+    void
+    WriteNode(uint8_t* sectors, uint32_t id, const float* vec, const std::vector<uint32_t>& neighbors) const;
+
+    const uint8_t*
+    CachedNode(uint32_t id) const;
+
+    void
+    ReadNodes(const std::vector<uint32_t>& ids, uint8_t* buffer, std::vector<const uint8_t*>& nodes) const;
+
+ private:
+    faiss::ProductQuantizer pq_;
+    std::vector<uint8_t> codes_;
+    std::vector<int64_t> ids_;
+
+    std::shared_ptr<uint8_t[]> sectors_;
+    int64_t sectors_size_ = 0;
+    SectorReaderPtr reader_;
+
+    std::unordered_map<uint32_t, size_t> cache_pos_;
+    std::vector<uint8_t> cache_data_;
+
+    mutable std::atomic<int64_t> sector_reads_{0};
+};
+
+}  // namespace impl
+}  // namespace knowhere
+}  // namespace milvus
@@ -0,0 +1,339 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "knowhere/index/vector_index/impl/diskann/Vamana.h"
+
+#include <faiss/BuilderSuspend.h>
+#include <faiss/FaissHook.h>
+#include <faiss/utils/distances.h>
+
+#include <algorithm>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <queue>
+#include <random>
+
+namespace milvus {
+namespace knowhere {
+namespace impl {
+
+namespace {
+
+// nodes a search already computed the distance of, reset in O(1) between searches
+class VisitedTags {
+ public:
+    explicit VisitedTags(size_t n) : tags_(n, 0) {
+    }
+
+    void
+    Reset() {
+        if (++current_ == 0) {
+            std::fill(tags_.begin(), tags_.end(), 0);
+            current_ = 1;
+        }
+    }
+
+    bool
+    TestAndSet(uint32_t id) {
+        if (tags_[id] == current_) {
+            return true;
+        }
+        tags_[id] = current_;
+        return false;
+    }
+
+ private:
+    std::vector<uint32_t> tags_;
+    uint32_t current_ = 0;
+};
+
+inline float
+L2(const float* data, size_t dim, uint32_t a, const float* b) {
+    return faiss::fvec_L2sqr(data + a * dim, b, dim);
+}
+
+uint32_t
+FindMedoid(const float* data, size_t n, size_t dim) {
+    std::vector<double> sum(dim, 0.0);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < dim; j++) {
+            sum[j] += data[i * dim + j];
+        }
+    }
+    std::vector<float> centroid(dim);
+    for (size_t j = 0; j < dim; j++) {
+        centroid[j] = static_cast<float>(sum[j] / n);
+    }
+
+    uint32_t medoid = 0;
+    float best = std::numeric_limits<float>::max();
+    for (size_t i = 0; i < n; i++) {
+        float dist = L2(data, dim, i, centroid.data());
+        if (dist < best) {
+            best = dist;
+            medoid = i;
+        }
+    }
+    return medoid;
+}
+
+// greedy search from start towards query, returns every expanded node with its distance
+void
+GreedySearch(const float* data, size_t dim, const VamanaGraph& graph, std::vector<std::mutex>& locks, uint32_t start,
+             const float* query, size_t list_size, VisitedTags& visited, std::vector<Candidate>& expanded) {
+    std::vector<Candidate> list;
+    list.reserve(list_size + 1);
+    visited.Reset();
+    visited.TestAndSet(start);
+    list.push_back({start, L2(data, dim, start, query), false});
+
+    std::vector<uint32_t> neighbors;
+    size_t cursor = 0;
+    while (cursor < list.size()) {
+        auto& current = list[cursor];
+        current.expanded = true;
+        expanded.push_back(current);
+        {
+            std::lock_guard<std::mutex> lock(locks[current.id]);
+            neighbors = graph[current.id];
+        }
+
+        size_t next = list.size();
+        for (auto id : neighbors) {
+            if (visited.TestAndSet(id)) {
+                continue;
+            }
+            auto pos = InsertCandidate(list, list_size, {id, L2(data, dim, id, query), false});
+            next = std::min(next, pos);
+        }
+
+        if (next <= cursor) {
+            cursor = next;
+        } else {
+            while (++cursor < list.size() && list[cursor].expanded) {
+            }
+        }
+    }
+}
+
+// keep the closest candidates that are not occluded by an already kept, closer neighbor
+void
+RobustPrune(const float* data, size_t dim, uint32_t node, std::vector<Candidate>& pool, float alpha,
+            const VamanaBuildParams& params, std::vector<uint32_t>& result) {
+    std::sort(pool.begin(), pool.end(), [](const Candidate& a, const Candidate& b) {
+        return a.id < b.id || (a.id == b.id && a.distance < b.distance);
+    });
+    pool.erase(std::unique(pool.begin(), pool.end(), [](const Candidate& a, const Candidate& b) { return a.id == b.id; }),
+               pool.end());
+    std::sort(pool.begin(), pool.end(), [](const Candidate& a, const Candidate& b) { return a.distance < b.distance; });
+    if (pool.size() > params.candidate_pool_size) {
+        pool.resize(params.candidate_pool_size);
+    }
+
+    result.clear();
+    for (auto& c : pool) {
+        if (c.id == node) {
+            continue;
+        }
+        bool occluded = false;
+        for (auto kept : result) {
+            if (alpha * L2(data, dim, kept, data + c.id * dim) <= c.distance) {
+                occluded = true;
+                break;
+            }
+        }
+        if (!occluded) {
+            result.push_back(c.id);
+            if (result.size() >= params.max_degree) {
+                break;
+            }
+        }
+    }
+}
+
+void
+InitRandomGraph(size_t n, size_t degree, VamanaGraph& graph) {
+    std::mt19937 rng(n);
+    std::uniform_int_distribution<uint32_t> dist(0, n - 1);
+    for (size_t i = 0; i < n; i++) {
+        auto& neighbors = graph[i];
+        while (neighbors.size() < degree) {
+            uint32_t id = dist(rng);
+            if (id != i && std::find(neighbors.begin(), neighbors.end(), id) == neighbors.end()) {
+                neighbors.push_back(id);
+            }
+        }
+    }
+}
+
+// mark every node reachable from root that is not marked yet
+void
+MarkReachable(const VamanaGraph& graph, uint32_t root, std::vector<bool>& reached) {
+    std::queue<uint32_t> frontier;
+    reached[root] = true;
+    frontier.push(root);
+    while (!frontier.empty()) {
+        uint32_t id = frontier.front();
+        frontier.pop();
+        for (auto neighbor : graph[id]) {
+            if (!reached[neighbor]) {
+                reached[neighbor] = true;
+                frontier.push(neighbor);
+            }
+        }
+    }
+}
+
+// back edge pruning can drop every in-edge of a node, link such nodes from their closest reachable node
+void
+ConnectUnreachable(const float* data, size_t n, size_t dim, uint32_t medoid, const VamanaBuildParams& params,
+                   VamanaGraph& graph) {
+    std::vector<std::mutex> locks(n);
+    VisitedTags visited(n);
+    std::vector<Candidate> expanded;
+    while (true) {
+        std::vector<bool> reached(n, false);
+        MarkReachable(graph, medoid, reached);
+        if (std::find(reached.begin(), reached.end(), false) == reached.end()) {
+            break;
+        }
+
+        std::vector<uint32_t> in_degree(n, 0);
+        for (auto& neighbors : graph) {
+            for (auto id : neighbors) {
+                in_degree[id]++;
+            }
+        }
+
+        for (uint32_t node = 0; node < n; node++) {
+            if (reached[node]) {
+                continue;
+            }
+            faiss::BuilderSuspend::check_wait();
+            expanded.clear();
+            GreedySearch(data, dim, graph, locks, medoid, data + node * dim, params.search_list_size, visited,
+                         expanded);
+            auto closest = std::min_element(expanded.begin(), expanded.end(),
+                                            [](const Candidate& a, const Candidate& b) {
+                                                return a.distance < b.distance;
+                                            })->id;
+
+            // the slots are fixed, a full list gives up its farthest neighbor that has another in-edge
+            auto& neighbors = graph[closest];
+            if (neighbors.size() < params.max_degree) {
+                neighbors.push_back(node);
+            } else {
+                auto victim = neighbors.size() - 1;
+                while (victim > 0 && in_degree[neighbors[victim]] <= 1) {
+                    victim--;
+                }
+                in_degree[neighbors[victim]]--;
+                neighbors[victim] = node;
+            }
+            in_degree[node]++;
+            MarkReachable(graph, node, reached);
+        }
+    }
+}
+
+}  // namespace
+
+size_t
+InsertCandidate(std::vector<Candidate>& list, size_t capacity, const Candidate& c) {
+    if (list.size() >= capacity && c.distance >= list.back().distance) {
+        return capacity;
+    }
+    auto pos = std::upper_bound(list.begin(), list.end(), c,
+                                [](const Candidate& a, const Candidate& b) { return a.distance < b.distance; });
+    auto index = static_cast<size_t>(pos - list.begin());
+    list.insert(pos, c);
+    if (list.size() > capacity) {
+        list.pop_back();
+    }
+    return index;
+}
+
+uint32_t
+BuildVamanaGraph(const float* data, size_t n, size_t dim, const VamanaBuildParams& params, VamanaGraph& graph) {
+    graph.assign(n, std::vector<uint32_t>());
+    if (n <= 1) {
+        return 0;
+    }
+
+    uint32_t medoid = FindMedoid(data, n, dim);
+    InitRandomGraph(n, std::min(params.max_degree, n - 1), graph);
+
+    std::vector<uint32_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), std::mt19937(n));
+
+    std::vector<std::mutex> locks(n);
+    for (float alpha : {1.0f, params.alpha}) {
+#pragma omp parallel
+        {
+            VisitedTags visited(n);
+            std::vector<Candidate> pool;
+            std::vector<uint32_t> pruned;
+            std::vector<Candidate> back_pool;
+            std::vector<uint32_t> back_pruned;
+
+#pragma omp for schedule(dynamic, 64)
+            for (size_t i = 0; i < n; i++) {
+                faiss::BuilderSuspend::check_wait();
+                uint32_t node = order[i];
+                const float* vec = data + node * dim;
+
+                pool.clear();
+                GreedySearch(data, dim, graph, locks, medoid, vec, params.search_list_size, visited, pool);
+                {
+                    std::lock_guard<std::mutex> lock(locks[node]);
+                    for (auto id : graph[node]) {
+                        pool.push_back({id, L2(data, dim, id, vec), false});
+                    }
+                }
+                RobustPrune(data, dim, node, pool, alpha, params, pruned);
+                {
+                    std::lock_guard<std::mutex> lock(locks[node]);
+                    graph[node] = pruned;
+                }
+
+                for (auto id : pruned) {
+                    std::lock_guard<std::mutex> lock(locks[id]);
+                    auto& neighbors = graph[id];
+                    if (std::find(neighbors.begin(), neighbors.end(), node) != neighbors.end()) {
+                        continue;
+                    }
+                    if (neighbors.size() < params.max_degree) {
+                        neighbors.push_back(node);
+                        continue;
+                    }
+
+                    const float* back_vec = data + id * dim;
+                    back_pool.clear();
+                    for (auto neighbor : neighbors) {
+                        back_pool.push_back({neighbor, L2(data, dim, neighbor, back_vec), false});
+                    }
+                    back_pool.push_back({node, L2(data, dim, node, back_vec), false});
+                    RobustPrune(data, dim, id, back_pool, alpha, params, back_pruned);
+                    neighbors = back_pruned;
+                }
+            }
+        }
+    }
+    ConnectUnreachable(data, n, dim, medoid, params, graph);
+
+    return medoid;
+}
+
+}  // namespace impl
+}  // namespace knowhere
+}  // namespace milvus
@@ -0,0 +1,58 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace milvus {
+namespace knowhere {
+namespace impl {
+
+struct VamanaBuildParams {
+    size_t max_degree;           // R, out degree bound of every node
+    size_t search_list_size;     // L, candidate list of the greedy search run for every node
+    size_t candidate_pool_size;  // C, visited nodes considered by the prune
+    float alpha;                 // distance slack of the second pass, > 1 keeps long edges
+};
+
+using VamanaGraph = std::vector<std::vector<uint32_t>>;
+
+struct Candidate {
+    uint32_t id;
+    float distance;
+    bool expanded;
+};
+
+/**
+ * Insert c into list, kept sorted by distance and no longer than capacity.
+ * Returns the position of c, or capacity when it did not make it into the list.
+ */
+size_t
+InsertCandidate(std::vector<Candidate>& list, size_t capacity, const Candidate& c);
+
+/**
+ * Build a Vamana graph over n vectors under L2.
+ *
+ * Starting from a random graph, every node runs a greedy search from the medoid and keeps the
+ * robust-pruned set of visited nodes as its neighbors, back edges are pruned the same way once
+ * a node overflows. A first pass with alpha 1 is followed by a pass with params.alpha.
+ *
+ * Returns the medoid, the entry point of every search.
+ */
+uint32_t
+BuildVamanaGraph(const float* data, size_t n, size_t dim, const VamanaBuildParams& params, VamanaGraph& graph);
+
+}  // namespace impl
+}  // namespace knowhere
+}  // namespace milvus
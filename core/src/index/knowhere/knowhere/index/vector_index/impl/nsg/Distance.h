@@ -11,23 +11,38 @@
 
 #pragma once
 
+#include <cstddef>
+
 namespace milvus {
 namespace knowhere {
 namespace impl {
 
+using DistanceFunc = float (*)(const float*, const float*, size_t);
+
 struct Distance {
     virtual float
     Compare(const float* a, const float* b, unsigned size) const = 0;
 };
 
+// kernels are picked once for the index dimension, Compare must then be called with that size
 struct DistanceL2 : public Distance {
+    explicit DistanceL2(size_t dim = 0);
+
     float
     Compare(const float* a, const float* b, unsigned size) const override;
+
+ private:
+    DistanceFunc func_;
 };
 
 struct DistanceIP : public Distance {
+    explicit DistanceIP(size_t dim = 0);
+
     float
     Compare(const float* a, const float* b, unsigned size) const override;
+
+ private:
+    DistanceFunc func_;
 };
 
 }  // namespace impl
@@ -0,0 +1,196 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "knowhere/index/vector_index/impl/nsg/NNDescent.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+#include "faiss/BuilderSuspend.h"
+#include "knowhere/common/Exception.h"
+#include "knowhere/common/Log.h"
+
+namespace milvus {
+namespace knowhere {
+namespace impl {
+
+NNDescent::NNDescent(const float* data, size_t ntotal, size_t dimension, const Distance* distance)
+    : data_(data), ntotal_(ntotal), dimension_(dimension), distance_(distance) {
+}
+
+void
+NNDescent::Build(const NNDescentParams& params, Graph& knng) {
+    if (params.k == 0 || params.k >= ntotal_) {
+        KNOWHERE_THROW_MSG("NN-descent needs 0 < k < " + std::to_string(ntotal_));
+    }
+    pool_size_ = params.pool_size ? params.pool_size : std::max(params.k + params.k / 2, params.k + 10);
+    pool_size_ = std::min(std::max(pool_size_, params.k), ntotal_ - 1);
+    sample_ = std::min(params.sample, pool_size_);
+
+    nhoods_ = std::vector<Nhood>(ntotal_);
+    Init();
+
+    const size_t threshold = static_cast<size_t>(params.delta * ntotal_ * params.k);
+    for (size_t it = 0; it < params.iterations; ++it) {
+        Update();
+        size_t updates = Join();
+        LOG_KNOWHERE_DEBUG_ << "NN-descent iteration " << it << ", updates: " << updates;
+        if (updates <= threshold) {
+            break;
+        }
+    }
+
+    knng.resize(ntotal_);
+#pragma omp parallel for
+    for (size_t n = 0; n < ntotal_; ++n) {
+        auto& pool = nhoods_[n].pool;
+        auto& node = knng[n];
+        node.resize(std::min(params.k, pool.size()));
+        for (size_t i = 0; i < node.size(); ++i) {
+            node[i] = pool[i].id;
+        }
+    }
+    nhoods_.clear();
+}
+
+void
+NNDescent::Init() {
+#pragma omp parallel for schedule(dynamic, 100)
+    for (size_t n = 0; n < ntotal_; ++n) {
+        // seeded by node, the random start does not depend on the thread layout
+        std::mt19937 rng(n);
+        std::uniform_int_distribution<node_t> uniform(0, ntotal_ - 1);
+        auto& pool = nhoods_[n].pool;
+        pool.reserve(pool_size_ + 1);
+        while (pool.size() < sample_) {
+            node_t id = uniform(rng);
+            if (id == static_cast<node_t>(n) ||
+                std::any_of(pool.begin(), pool.end(), [id](const Neighbor& nn) { return nn.id == id; })) {
+                continue;
+            }
+            pool.emplace_back(id, Compare(n, id), false);
+        }
+        std::sort(pool.begin(), pool.end());
+    }
+}
+
+bool
+NNDescent::Insert(node_t n, node_t id, float dist) {
+    auto& nhood = nhoods_[n];
+    LockGuard lk(nhood.lock);
+    auto& pool = nhood.pool;
+    if (pool.size() >= pool_size_ && dist >= pool.back().distance) {
+        return false;
+    }
+    for (auto& nn : pool) {
+        if (nn.id == id) {
+            return false;
+        }
+    }
+    auto pos = std::upper_bound(pool.begin(), pool.end(), Neighbor(id, dist, false));
+    pool.insert(pos, Neighbor(id, dist, false));
+    if (pool.size() > pool_size_) {
+        pool.pop_back();
+    }
+    return true;
+}
+
+size_t
+NNDescent::Join() {
+    size_t updates = 0;
+#pragma omp parallel for schedule(dynamic, 100) reduction(+ : updates)
+    for (size_t n = 0; n < ntotal_; ++n) {
+        faiss::BuilderSuspend::check_wait();
+        auto& nhood = nhoods_[n];
+        for (size_t i = 0; i < nhood.nn_new.size(); ++i) {
+            node_t u = nhood.nn_new[i];
+            for (size_t j = i + 1; j < nhood.nn_new.size(); ++j) {
+                node_t v = nhood.nn_new[j];
+                if (u == v) {
+                    continue;
+                }
+                float dist = Compare(u, v);
+                updates += Insert(u, v, dist);
+                updates += Insert(v, u, dist);
+            }
+            for (node_t v : nhood.nn_old) {
+                if (u == v) {
+                    continue;
+                }
+                float dist = Compare(u, v);
+                updates += Insert(u, v, dist);
+                updates += Insert(v, u, dist);
+            }
+        }
+    }
+    return updates;
+}
+
+void
+NNDescent::Update() {
+#pragma omp parallel for
+    for (size_t n = 0; n < ntotal_; ++n) {
+        auto& nhood = nhoods_[n];
+        nhood.nn_new.clear();
+        nhood.nn_old.clear();
+        nhood.rnn_new.clear();
+        nhood.rnn_old.clear();
+    }
+
+    // forward samples: the closest neighbors not joined yet become new, the joined ones old
+#pragma omp parallel for schedule(dynamic, 100)
+    for (size_t n = 0; n < ntotal_; ++n) {
+        auto& nhood = nhoods_[n];
+        for (auto& nn : nhood.pool) {
+            if (!nn.has_explored) {
+                if (nhood.nn_new.size() < sample_) {
+                    nn.has_explored = true;
+                    nhood.nn_new.push_back(nn.id);
+                }
+            } else {
+                nhood.nn_old.push_back(nn.id);
+            }
+        }
+        // reverse samples, nodes with many in-edges keep the first ones only
+        for (node_t id : nhood.nn_new) {
+            auto& other = nhoods_[id];
+            LockGuard lk(other.lock);
+            if (other.rnn_new.size() < sample_) {
+                other.rnn_new.push_back(n);
+            }
+        }
+        for (node_t id : nhood.nn_old) {
+            auto& other = nhoods_[id];
+            LockGuard lk(other.lock);
+            if (other.rnn_old.size() < sample_) {
+                other.rnn_old.push_back(n);
+            }
+        }
+    }
+
+#pragma omp parallel for
+    for (size_t n = 0; n < ntotal_; ++n) {
+        auto& nhood = nhoods_[n];
+        auto merge = [](std::vector<node_t>& to, std::vector<node_t>& from) {
+            to.insert(to.end(), from.begin(), from.end());
+            std::sort(to.begin(), to.end());
+            to.erase(std::unique(to.begin(), to.end()), to.end());
+            std::vector<node_t>().swap(from);
+        };
+        merge(nhood.nn_new, nhood.rnn_new);
+        merge(nhood.nn_old, nhood.rnn_old);
+    }
+}
+
+}  // namespace impl
+}  // namespace knowhere
+}  // namespace milvus
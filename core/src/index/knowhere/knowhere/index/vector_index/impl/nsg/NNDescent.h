@@ -0,0 +1,87 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include "Distance.h"
+#include "Neighbor.h"
+
+namespace milvus {
+namespace knowhere {
+namespace impl {
+
+using Graph = std::vector<std::vector<node_t>>;
+
+struct NNDescentParams {
+    size_t k;                 // neighbors kept per node in the result graph
+    size_t pool_size = 0;     // candidates kept per node while iterating, 0 means k + k / 2 (at least k + 10)
+    size_t sample = 10;       // new neighbors of a node joined per iteration
+    size_t iterations = 12;   // upper bound of iterations
+    float delta = 0.002;      // stop once an iteration updates fewer than delta * n * k pool entries
+};
+
+/*
+ * Approximate kNN graph by NN-descent (Dong et al., WWW 2011): a neighbor of a neighbor is likely a neighbor.
+ * Every iteration compares the pairs among the recently found neighbors of each node, in parallel over the nodes.
+ */
+class NNDescent {
+ public:
+    NNDescent(const float* data, size_t ntotal, size_t dimension, const Distance* distance);
+
+    void
+    Build(const NNDescentParams& params, Graph& knng);
+
+ private:
+    struct Nhood {
+        std::mutex lock;
+        std::vector<Neighbor> pool;  // sorted by distance, has_explored is false for neighbors not joined yet
+        std::vector<node_t> nn_new;
+        std::vector<node_t> nn_old;
+        std::vector<node_t> rnn_new;
+        std::vector<node_t> rnn_old;
+    };
+
+    void
+    Init();
+
+    size_t
+    Join();
+
+    void
+    Update();
+
+    // returns whether the pool of node n changed
+    bool
+    Insert(node_t n, node_t id, float dist);
+
+    float
+    Compare(node_t a, node_t b) const {
+        return distance_->Compare(data_ + a * dimension_, data_ + b * dimension_, dimension_);
+    }
+
+ private:
+    const float* data_;
+    size_t ntotal_;
+    size_t dimension_;
+    const Distance* distance_;
+
+    size_t pool_size_ = 0;
+    size_t sample_ = 0;
+    std::vector<Nhood> nhoods_;
+};
+
+}  // namespace impl
+}  // namespace knowhere
+}  // namespace milvus
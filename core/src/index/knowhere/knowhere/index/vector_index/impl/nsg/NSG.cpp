@@ -11,11 +11,12 @@
 
 #include "knowhere/index/vector_index/impl/nsg/NSG.h"
 
+#include <xmmintrin.h>
+
 #include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
-#include <stack>
 #include <string>
 #include <utility>
 
@@ -23,6 +24,7 @@
 #include "knowhere/common/Exception.h"
 #include "knowhere/common/Log.h"
 #include "knowhere/common/Timer.h"
+#include "knowhere/index/vector_index/impl/nsg/NNDescent.h"
 #include "knowhere/index/vector_index/impl/nsg/NSGHelper.h"
 
 namespace milvus {
@@ -31,12 +33,24 @@ namespace impl {
 
 unsigned int seed = 100;
 
+// how many vectors a search loads ahead of the one it is comparing against
+constexpr size_t PREFETCH_DISTANCE = 4;
+
+void
+NsgIndex::PrefetchVector(const float* vector) const {
+    auto line = reinterpret_cast<const char*>(vector);
+    auto end = line + dimension * sizeof(float);
+    for (; line < end; line += 64) {
+        _mm_prefetch(line, _MM_HINT_T0);
+    }
+}
+
 NsgIndex::NsgIndex(const size_t& dimension, const size_t& n, Metric_Type metric)
     : dimension(dimension), ntotal(n), metric_type(metric) {
     if (metric == Metric_Type::Metric_Type_L2) {
-        distance_ = new DistanceL2;
+        distance_ = new DistanceL2(dimension);
     } else if (metric == Metric_Type::Metric_Type_IP) {
-        distance_ = new DistanceIP;
+        distance_ = new DistanceIP(dimension);
     }
 }
 
@@ -57,17 +71,18 @@ NsgIndex::Build_with_ids(size_t nb, float* data, const int64_t* ids, const Build
     search_length = parameters.search_length;
     out_degree = parameters.out_degree;
     candidate_pool_size = parameters.candidate_pool_size;
+    compact_graph = parameters.compact_graph;
+    colocate_vectors = parameters.colocate_vectors;
 
     TimeRecorder rc("NSG", 1);
     InitNavigationPoint(data);
-    rc.RecordSection("init");
+    build_times.init = rc.RecordSection("init") / 1000;
 
     Link(data);
-    rc.RecordSection("Link");
+    build_times.link = rc.RecordSection("Link") / 1000;
 
     CheckConnectivity(data);
-    rc.RecordSection("Connect");
-    rc.ElapseFromBegin("finish");
+    build_times.connect = rc.RecordSection("Connect") / 1000;
 
     is_trained = true;
 
@@ -78,6 +93,14 @@ NsgIndex::Build_with_ids(size_t nb, float* data, const int64_t* ids, const Build
     LOG_KNOWHERE_DEBUG_ << "Graph physical size: " << total_degree * sizeof(node_t) / 1024 / 1024 << "m";
     LOG_KNOWHERE_DEBUG_ << "Average degree: " << total_degree / ntotal;
 
+    Compact(data);
+    build_times.compact = rc.RecordSection("Compact") / 1000;
+    rc.ElapseFromBegin("finish");
+
+    LOG_KNOWHERE_INFO_ << "NSG build phases (ms): knng " << build_times.knng << ", init " << build_times.init
+                       << ", link " << build_times.link << ", connect " << build_times.connect << ", compact "
+                       << build_times.compact;
+
     // Debug code
     // for (size_t i = 0; i < ntotal; i++) {
     //     auto& x = nsg[i];
@@ -461,7 +484,7 @@ NsgIndex::Link(float* data) {
     // }
 
     std::vector<std::mutex> mutex_vec(ntotal);
-#pragma omp for schedule(dynamic, 100)
+#pragma omp parallel for schedule(dynamic, 100)
     for (unsigned n = 0; n < ntotal; ++n) {
         faiss::BuilderSuspend::check_wait();
         InterInsert(data, n, mutex_vec, cut_graph_dist);
@@ -508,14 +531,19 @@ NsgIndex::SyncPrune(float* data, size_t n, std::vector<Neighbor>& pool, boost::d
 //>> Optimize: remove read-lock
 void
 NsgIndex::InterInsert(float* data, unsigned n, std::vector<std::mutex>& mutex_vec, float* cut_graph_dist) {
-    auto& current = n;
-
-    auto& neighbor_id_pool = nsg[current];
-    float* neighbor_dist_pool = cut_graph_dist + current * out_degree;
-    for (size_t i = 0; i < out_degree; ++i) {
-        if (neighbor_dist_pool[i] == -1)
-            break;
+    // other threads link back into nsg[n] meanwhile, work on a copy taken under its lock
+    std::vector<node_t> neighbor_id_pool;
+    std::vector<float> neighbor_dist_pool;
+    {
+        LockGuard lk(mutex_vec[n]);
+        const float* dist_pool = cut_graph_dist + n * out_degree;
+        for (size_t i = 0; i < out_degree && dist_pool[i] != -1; ++i) {
+            neighbor_id_pool.push_back(nsg[n][i]);
+            neighbor_dist_pool.push_back(dist_pool[i]);
+        }
+    }
 
+    for (size_t i = 0; i < neighbor_id_pool.size(); ++i) {
         size_t current_neighbor = neighbor_id_pool[i];  // center's neighbor id
         auto& nsn_id_pool = nsg[current_neighbor];      // nsn => neighbor's neighbor
         float* nsn_dist_pool = cut_graph_dist + current_neighbor * out_degree;
@@ -559,10 +587,14 @@ NsgIndex::InterInsert(float* data, unsigned n, std::vector<std::mutex>& mutex_ve
 
             {
                 LockGuard lk(mutex_vec[current_neighbor]);
+                nsn_id_pool.resize(result.size());
                 for (size_t j = 0; j < result.size(); ++j) {
                     nsn_id_pool[j] = result[j].id;
                     nsn_dist_pool[j] = result[j].distance;
                 }
+                if (result.size() < out_degree) {
+                    nsn_dist_pool[result.size()] = -1;
+                }
             }
         } else {
             LockGuard lk(mutex_vec[current_neighbor]);
@@ -609,90 +641,87 @@ NsgIndex::SelectEdge(float* data, unsigned& cursor, std::vector<Neighbor>& sort_
 
 void
 NsgIndex::CheckConnectivity(float* data) {
-    auto root = navigation_point;
-    boost::dynamic_bitset<> has_linked{ntotal, 0};
+    std::vector<std::atomic<bool>> has_linked(ntotal);
     int64_t linked_count = 0;
-
-    while (linked_count < static_cast<int64_t>(ntotal)) {
-        faiss::BuilderSuspend::check_wait();
-        DFS(root, has_linked, linked_count);
-        if (linked_count >= static_cast<int64_t>(ntotal)) {
-            break;
-        }
-        FindUnconnectedNode(data, has_linked, root);
+    BFS(navigation_point, has_linked, linked_count);
+    if (linked_count >= static_cast<int64_t>(ntotal)) {
+        return;
     }
-}
 
-void
-NsgIndex::DFS(size_t root, boost::dynamic_bitset<>& has_linked, int64_t& linked_count) {
-    size_t start = root;
-    std::stack<size_t> s;
-    s.push(root);
-    if (!has_linked[root]) {
-        linked_count++;  // not link
+    std::vector<node_t> unlinked;
+    for (size_t i = 0; i < ntotal; i++) {
+        if (!has_linked[i]) {
+            unlinked.push_back(i);
+        }
     }
-    has_linked[root] = true;  // link start...
+    LOG_KNOWHERE_DEBUG_ << unlinked.size() << " nodes are not reachable from the navigation point";
 
-    while (!s.empty()) {
-        size_t next = ntotal + 1;
-
-        for (unsigned i = 0; i < nsg[start].size(); i++) {
-            if (has_linked[nsg[start][i]] == false) {  // if not link
-                next = nsg[start][i];
-                break;
+    // search the nearest reachable node of every unreachable one in parallel, the graph is not modified meanwhile
+    std::vector<node_t> parents(unlinked.size(), -1);
+#pragma omp parallel
+    {
+        std::vector<Neighbor> tmp, pool;
+#pragma omp for schedule(dynamic, 10)
+        for (size_t i = 0; i < unlinked.size(); ++i) {
+            faiss::BuilderSuspend::check_wait();
+            tmp.clear();
+            pool.clear();
+            GetNeighbors(data + dimension * unlinked[i], data, tmp, pool);
+            std::sort(pool.begin(), pool.end());
+            for (auto& nn : pool) {
+                if (has_linked[nn.id]) {
+                    parents[i] = nn.id;
+                    break;
+                }
             }
         }
-        if (next == (ntotal + 1)) {
-            s.pop();
-            if (s.empty())
-                break;
-            start = s.top();
+    }
+
+    // one edge per unreachable component: the nodes reached through an earlier edge are skipped
+    for (size_t i = 0; i < unlinked.size(); ++i) {
+        node_t id = unlinked[i];
+        if (has_linked[id]) {
             continue;
         }
-        start = next;
-        has_linked[start] = true;
-        s.push(start);
-        ++linked_count;
+        node_t root = parents[i];
+        while (root < 0) {  // random a linked-node and add unlinked-node as its neighbor
+            node_t rid = rand_r(&seed) % ntotal;
+            if (has_linked[rid]) {
+                root = rid;
+            }
+        }
+        nsg[root].push_back(id);
+        BFS(id, has_linked, linked_count);
     }
 }
 
 void
-NsgIndex::FindUnconnectedNode(float* data, boost::dynamic_bitset<>& has_linked, int64_t& root) {
-    // find any of unlinked-node
-    size_t id = ntotal;
-    for (size_t i = 0; i < ntotal; i++) {  // find not link
-        if (has_linked[i] == false) {
-            id = i;
-            break;
-        }
+NsgIndex::BFS(node_t root, std::vector<std::atomic<bool>>& has_linked, int64_t& linked_count) {
+    if (has_linked[root].exchange(true)) {
+        return;
     }
+    ++linked_count;
 
-    if (id == ntotal)
-        return;  // No Unlinked Node
-
-    // search unlinked-node's neighbor
-    std::vector<Neighbor> tmp, pool;
-    GetNeighbors(data + dimension * id, data, tmp, pool);
-    std::sort(pool.begin(), pool.end());
-
-    size_t found = 0;
-    for (size_t i = 0; i < pool.size(); i++) {  // find nearest neighbor and add unlinked-node as its neighbor
-        if (has_linked[pool[i].id]) {
-            root = pool[i].id;
-            found = 1;
-            break;
-        }
-    }
-    if (found == 0) {
-        while (true) {  // random a linked-node and add unlinked-node as its neighbor
-            size_t rid = rand_r(&seed) % ntotal;
-            if (has_linked[rid]) {
-                root = rid;
-                break;
+    std::vector<node_t> frontier{root};
+    while (!frontier.empty()) {
+        std::vector<node_t> next;
+#pragma omp parallel if (frontier.size() > 1000)
+        {
+            std::vector<node_t> local;
+#pragma omp for schedule(dynamic, 100) nowait
+            for (size_t i = 0; i < frontier.size(); ++i) {
+                for (node_t id : nsg[frontier[i]]) {
+                    if (!has_linked[id].load(std::memory_order_relaxed) && !has_linked[id].exchange(true)) {
+                        local.push_back(id);
+                    }
+                }
             }
+#pragma omp critical
+            next.insert(next.end(), local.begin(), local.end());
         }
+        linked_count += next.size();
+        frontier.swap(next);
     }
-    nsg[root].push_back(id);
 }
 
 // void
@@ -830,19 +859,172 @@ NsgIndex::FindUnconnectedNode(float* data, boost::dynamic_bitset<>& has_linked,
 //     rc.ElapseFromBegin("seach finish");
 // }
 
+void
+NsgIndex::Compact(const float* data) {
+    if (colocate_vectors && data == nullptr) {
+        LOG_KNOWHERE_WARNING_ << "NSG raw data is missing, fall back from the co-located layout to "
+                              << (compact_graph ? "CSR" : "adjacency lists");
+        colocate_vectors = false;
+    }
+    if (!compact_graph && !colocate_vectors) {
+        return;
+    }
+
+    csr_offsets_.clear();
+    csr_edges_.clear();
+    blocks_.reset();
+
+    if (colocate_vectors) {
+        size_t max_degree = 0;
+        for (auto& neighbors : nsg) {
+            max_degree = std::max(max_degree, neighbors.size());
+        }
+        vector_size_ = (dimension * sizeof(float) + sizeof(node_t) - 1) / sizeof(node_t) * sizeof(node_t);
+        block_size_ = vector_size_ + (max_degree + 1) * sizeof(node_t);
+        blocks_.reset(new uint8_t[ntotal * block_size_]);
+        for (size_t i = 0; i < ntotal; ++i) {
+            uint8_t* block = blocks_.get() + i * block_size_;
+            memcpy(block, data + i * dimension, dimension * sizeof(float));
+            auto neighbors = reinterpret_cast<node_t*>(block + vector_size_);
+            neighbors[0] = nsg[i].size();
+            memcpy(neighbors + 1, nsg[i].data(), nsg[i].size() * sizeof(node_t));
+        }
+    } else {
+        csr_offsets_.resize(ntotal + 1);
+        csr_offsets_[0] = 0;
+        for (size_t i = 0; i < ntotal; ++i) {
+            csr_offsets_[i + 1] = csr_offsets_[i] + nsg[i].size();
+        }
+        csr_edges_.resize(csr_offsets_[ntotal]);
+        for (size_t i = 0; i < ntotal; ++i) {
+            memcpy(csr_edges_.data() + csr_offsets_[i], nsg[i].data(), nsg[i].size() * sizeof(node_t));
+        }
+    }
+
+    Graph().swap(nsg);
+}
+
+void
+NsgIndex::GetNeighbors(const float* query, const float* data, std::vector<Neighbor>& resset,
+                       const SearchParams& params) {
+    size_t buffer_size = params.search_length;
+
+    if (buffer_size > ntotal) {
+        KNOWHERE_THROW_MSG("Search Error, search_length > ntotal");
+    }
+
+    std::vector<node_t> init_ids(buffer_size);
+    resset.resize(buffer_size);
+    boost::dynamic_bitset<> has_calculated_dist{ntotal, 0};
+
+    {
+        /*
+         * copy navigation-point neighbor,  pick random node if less than buffer size
+         */
+        size_t count = 0;
+        node_t degree;
+        const node_t* neighbors = NeighborsOf(navigation_point, degree);
+        for (size_t i = 0; i < init_ids.size() && i < static_cast<size_t>(degree); ++i) {
+            init_ids[i] = neighbors[i];
+            has_calculated_dist[init_ids[i]] = true;
+            ++count;
+        }
+        while (count < buffer_size) {
+            node_t id = rand_r(&seed) % ntotal;
+            if (has_calculated_dist[id])
+                continue;  // duplicate id
+            init_ids[count] = id;
+            ++count;
+            has_calculated_dist[id] = true;
+        }
+    }
+
+    for (size_t i = 0; i < init_ids.size() && i < PREFETCH_DISTANCE; ++i) {
+        PrefetchVector(VectorOf(init_ids[i], data));
+    }
+    for (size_t i = 0; i < init_ids.size(); ++i) {
+        node_t id = init_ids[i];
+        if (i + PREFETCH_DISTANCE < init_ids.size()) {
+            PrefetchVector(VectorOf(init_ids[i + PREFETCH_DISTANCE], data));
+        }
+        float dist = distance_->Compare(VectorOf(id, data), query, dimension);
+        resset[i] = Neighbor(id, dist, false);
+    }
+    std::sort(resset.begin(), resset.end());  // sort by distance
+
+    // search nearest neighbor
+    size_t cursor = 0;
+    while (cursor < buffer_size) {
+        size_t nearest_updated_pos = buffer_size;
+
+        if (!resset[cursor].has_explored) {
+            resset[cursor].has_explored = true;
+
+            node_t degree;
+            const node_t* neighbors = NeighborsOf(resset[cursor].id, degree);
+            // keep PREFETCH_DISTANCE unvisited vectors in flight ahead of the distance computation
+            node_t ahead = 0;
+            for (size_t issued = 0; ahead < degree && issued < PREFETCH_DISTANCE; ++ahead) {
+                if (!has_calculated_dist[neighbors[ahead]]) {
+                    PrefetchVector(VectorOf(neighbors[ahead], data));
+                    ++issued;
+                }
+            }
+            for (node_t i = 0; i < degree; ++i) {
+                node_t id = neighbors[i];
+                if (has_calculated_dist[id])
+                    continue;
+                has_calculated_dist[id] = true;
+
+                for (; ahead < degree; ++ahead) {
+                    if (!has_calculated_dist[neighbors[ahead]]) {
+                        PrefetchVector(VectorOf(neighbors[ahead++], data));
+                        break;
+                    }
+                }
+
+                float dist = distance_->Compare(query, VectorOf(id, data), dimension);
+                if (dist >= resset[buffer_size - 1].distance)
+                    continue;
+
+                Neighbor nn(id, dist, false);
+                size_t pos = InsertIntoPool(resset.data(), buffer_size, nn);  // replace with a closer node
+                if (pos < nearest_updated_pos)
+                    nearest_updated_pos = pos;
+
+                // trick: avoid search query search_length < init_ids.size() ...
+                if (buffer_size + 1 < resset.size())
+                    ++buffer_size;
+            }
+        }
+        if (cursor >= nearest_updated_pos) {
+            cursor = nearest_updated_pos;  // re-search from new pos
+        } else {
+            ++cursor;
+        }
+    }
+}
+
 void
 NsgIndex::Search(const float* query, float* data, const unsigned& nq, const unsigned& dim, const unsigned& k,
                  float* dist, int64_t* ids, SearchParams& params, faiss::ConcurrentBitsetPtr bitset) {
+    if (!IsCompacted() && nsg.size() != ntotal) {
+        KNOWHERE_THROW_MSG("Search Error, graph is not built");
+    }
+    if (!IsColocated() && data == nullptr) {
+        KNOWHERE_THROW_MSG("Search Error, raw data is missing");
+    }
+
     std::vector<std::vector<Neighbor>> resset(nq);
 
     TimeRecorder rc("NsgIndex::search", 1);
     if (nq == 1) {
-        GetNeighbors(query, data, resset[0], nsg, &params);
+        GetNeighbors(query, data, resset[0], params);
     } else {
 #pragma omp parallel for
         for (unsigned int i = 0; i < nq; ++i) {
             const float* single_query = query + i * dim;
-            GetNeighbors(single_query, data, resset[i], nsg, &params);
+            GetNeighbors(single_query, data, resset[i], params);
         }
     }
     rc.RecordSection("search");
@@ -873,6 +1055,15 @@ NsgIndex::SetKnnGraph(Graph& g) {
     knng = std::move(g);
 }
 
+void
+NsgIndex::BuildKnnGraph(const float* data, size_t k) {
+    TimeRecorder rc("NN-descent", 1);
+    NNDescentParams params;
+    params.k = k;
+    NNDescent(data, ntotal, dimension, distance_).Build(params, knng);
+    build_times.knng = rc.ElapseFromBegin("knng") / 1000;
+}
+
 }  // namespace impl
 }  // namespace knowhere
 }  // namespace milvus
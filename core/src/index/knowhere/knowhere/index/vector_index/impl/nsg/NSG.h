@@ -12,7 +12,9 @@
 #pragma once
 
 #include <boost/dynamic_bitset.hpp>
+#include <atomic>
 #include <cstddef>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -32,6 +34,17 @@ struct BuildParams {
     size_t search_length;
     size_t out_degree;
     size_t candidate_pool_size;
+    bool compact_graph = false;
+    bool colocate_vectors = false;
+};
+
+// wall time of each build phase, in milliseconds
+struct BuildTimes {
+    double knng = 0;
+    double init = 0;
+    double link = 0;
+    double connect = 0;
+    double compact = 0;
 };
 
 struct SearchParams {
@@ -62,6 +75,12 @@ class NsgIndex {
 
     bool is_trained = false;
 
+    // search layout packs all neighbor lists into one CSR buffer instead of walking nsg
+    bool compact_graph = false;
+
+    // search layout keeps every vector next to its neighbor list, the raw data is not needed to search
+    bool colocate_vectors = false;
+
     /*
      * build and search parameter
      */
@@ -69,6 +88,8 @@ class NsgIndex {
     size_t candidate_pool_size;  // search deepth in fullset
     size_t out_degree;
 
+    BuildTimes build_times;
+
  public:
     explicit NsgIndex(const size_t& dimension, const size_t& n, Metric_Type metric);
 
@@ -79,6 +100,55 @@ class NsgIndex {
     void
     SetKnnGraph(Graph& knng);
 
+    // build the kNN graph with NN-descent instead of taking one from SetKnnGraph
+    void
+    BuildKnnGraph(const float* data, size_t k);
+
+    /*
+     * Move the graph into the search layout selected by compact_graph and colocate_vectors, and release nsg.
+     * Without either flag the adjacency lists stay as they are. colocate_vectors needs data; without it the
+     * flag is cleared, so that the index is written back in the layout it actually searches with.
+     */
+    void
+    Compact(const float* data = nullptr);
+
+    bool
+    IsCompacted() const {
+        return !csr_offsets_.empty() || blocks_ != nullptr;
+    }
+
+    bool
+    IsColocated() const {
+        return blocks_ != nullptr;
+    }
+
+    inline const node_t*
+    NeighborsOf(node_t id, node_t& count) const {
+        if (blocks_ != nullptr) {
+            auto block = reinterpret_cast<const node_t*>(blocks_.get() + id * block_size_ + vector_size_);
+            count = block[0];
+            return block + 1;
+        }
+        if (!csr_offsets_.empty()) {
+            count = csr_offsets_[id + 1] - csr_offsets_[id];
+            return csr_edges_.data() + csr_offsets_[id];
+        }
+        count = nsg[id].size();
+        return nsg[id].data();
+    }
+
+    // load every cache line of a vector, one line is not enough to hide the miss on the rest of it
+    void
+    PrefetchVector(const float* vector) const;
+
+    inline const float*
+    VectorOf(node_t id, const float* data) const {
+        if (blocks_ != nullptr) {
+            return reinterpret_cast<const float*>(blocks_.get() + id * block_size_);
+        }
+        return data + id * dimension;
+    }
+
     void
     Build_with_ids(size_t nb, float* data, const int64_t* ids, const BuildParams& parameters);
 
@@ -117,6 +187,10 @@ class NsgIndex {
     GetNeighbors(const float* query, float* data, std::vector<Neighbor>& resset, Graph& graph,
                  SearchParams* param = nullptr);
 
+    // only for search, on the compacted layout
+    void
+    GetNeighbors(const float* query, const float* data, std::vector<Neighbor>& resset, const SearchParams& params);
+
     // only for search
     // void
     // GetNeighbors(const float* query, node_t* I, float* D, SearchParams* params);
@@ -138,11 +212,19 @@ class NsgIndex {
     void
     CheckConnectivity(float* data);
 
+    // mark every node reachable from root, level by level in parallel
     void
-    DFS(size_t root, boost::dynamic_bitset<>& flags, int64_t& count);
+    BFS(node_t root, std::vector<std::atomic<bool>>& flags, int64_t& count);
 
-    void
-    FindUnconnectedNode(float* data, boost::dynamic_bitset<>& flags, int64_t& root);
+ private:
+    // CSR layout, neighbors of node i are csr_edges_[csr_offsets_[i], csr_offsets_[i + 1])
+    std::vector<node_t> csr_offsets_;
+    std::vector<node_t> csr_edges_;
+
+    // co-located layout, fixed size blocks of [vector][degree][neighbors, padded to the max degree]
+    std::unique_ptr<uint8_t[]> blocks_;
+    size_t block_size_ = 0;
+    size_t vector_size_ = 0;
 };
 
 }  // namespace impl
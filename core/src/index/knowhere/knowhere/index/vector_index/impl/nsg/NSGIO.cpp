@@ -27,10 +27,15 @@ write_index(NsgIndex* index, MemoryIOWriter& writer) {
     writer(index->ids_, sizeof(int64_t) * index->ntotal, 1);
 
     for (unsigned i = 0; i < index->ntotal; ++i) {
-        auto neighbor_num = (node_t)index->nsg[i].size();
+        node_t neighbor_num;
+        const node_t* neighbors = index->NeighborsOf(i, neighbor_num);
         writer(&neighbor_num, sizeof(node_t), 1);
-        writer(index->nsg[i].data(), neighbor_num * sizeof(node_t), 1);
+        writer(neighbors, neighbor_num * sizeof(node_t), 1);
     }
+
+    // appended after the graph so that older indexes, which end here, still load
+    writer(&index->colocate_vectors, sizeof(index->colocate_vectors), 1);
+    writer(&index->compact_graph, sizeof(index->compact_graph), 1);
 }
 
 NsgIndex*
@@ -58,6 +63,12 @@ read_index(MemoryIOReader& reader) {
         index->nsg[i].resize(neighbor_num);
         reader(index->nsg[i].data(), neighbor_num * sizeof(node_t), 1);
     }
+    if (reader.rp < reader.total) {
+        reader(&index->colocate_vectors, sizeof(index->colocate_vectors), 1);
+    }
+    if (reader.rp < reader.total) {
+        reader(&index->compact_graph, sizeof(index->compact_graph), 1);
+    }
 
     index->is_trained = true;
     return index;
@@ -118,6 +118,37 @@ IndexHNSW_NM::Add(const DatasetPtr& dataset_ptr, const Config& config) {
     }
 }
 
+void
+IndexHNSW_NM::AddWithoutIds(const DatasetPtr& dataset_ptr, const Config& config) {
+    if (!index_) {
+        KNOWHERE_THROW_MSG("index not initialize");
+    }
+
+    std::lock_guard<std::mutex> lk(mutex_);
+
+    GETTENSOR(dataset_ptr)
+
+    size_t base = index_->getCurrentElementCount();
+    if (rows <= (int64_t)base) {
+        return;
+    }
+    if ((size_t)rows > index_->max_elements_) {
+        index_->resizeIndex(std::max((size_t)rows, index_->max_elements_ * 2));
+    }
+
+    // offsets are relative to the whole raw data, the graph keeps no vectors of its own
+    auto pp_data = const_cast<void*>(p_data);
+    if (base == 0) {
+        index_->addPoint(pp_data, 0, 0, 0);
+        base = 1;
+    }
+#pragma omp parallel for
+    for (int64_t i = base; i < rows; ++i) {
+        faiss::BuilderSuspend::check_wait();
+        index_->addPoint(pp_data, i, 0, i);
+    }
+}
+
 DatasetPtr
 IndexHNSW_NM::Query(const DatasetPtr& dataset_ptr, const Config& config) {
     if (!index_) {
@@ -41,10 +41,10 @@ class IndexHNSW_NM : public VecIndex {
     void
     Add(const DatasetPtr& dataset_ptr, const Config& config) override;
 
+    // The tensor must hold all raw vectors of the segment starting from offset 0,
+    // rows in [Count(), rows) are linked into the graph, capacity grows on demand.
     void
-    AddWithoutIds(const DatasetPtr&, const Config&) override {
-        KNOWHERE_THROW_MSG("Incremental index is not supported");
-    }
+    AddWithoutIds(const DatasetPtr& dataset_ptr, const Config& config) override;
 
     DatasetPtr
     Query(const DatasetPtr& dataset_ptr, const Config& config) override;
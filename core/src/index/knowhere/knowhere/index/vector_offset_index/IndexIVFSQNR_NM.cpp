@@ -40,11 +40,23 @@ IVFSQNR_NM::Serialize(const Config& config) {
     if (!index_ || !index_->is_trained) {
         KNOWHERE_THROW_MSG("index not initialize or trained");
     }
-
     std::lock_guard<std::mutex> lk(mutex_);
+    if (disk_lists_ != nullptr) {
+        // the codes are in the inverted lists file, only the quantizer is written
+        ScopedEmptyLists empty_lists(dynamic_cast<faiss::IndexIVF*>(index_.get()));
+        return SerializeImpl(index_type_);
+    }
     BinarySet res_set = SerializeImpl(index_type_);
 
     size_t d = index_->d;
+    if (ListsInOffsetOrder()) {
+        // the arranged codes are already in offset order, followed by the trained values
+        auto rows = index_->ntotal;
+        auto code_size = dynamic_cast<faiss::IndexIVFScalarQuantizer*>(index_.get())->code_size;
+        res_set.Append(SQ8_DATA, data_, code_size * rows * sizeof(uint8_t) + 2 * d * sizeof(float));
+        return res_set;
+    }
+
     auto ivfsq_index = dynamic_cast<faiss::IndexIVFScalarQuantizer*>(index_.get());
     auto invlists = ivfsq_index->invlists;
     auto rows = invlists->compute_ntotal();
@@ -73,8 +85,16 @@ IVFSQNR_NM::Serialize(const Config& config) {
 void
 IVFSQNR_NM::Load(const BinarySet& binary_set) {
     std::lock_guard<std::mutex> lk(mutex_);
+    if (binary_set.binary_map_.count(SQ8_DATA) == 0) {
+        // the codes of a disk mode index are in its inverted lists file, see OpenListsOnDisk
+        LoadImpl(binary_set, index_type_);
+        return;
+    }
     data_ = binary_set.GetByName(SQ8_DATA)->data;
     LoadImpl(binary_set, index_type_);
+    if (ListsInOffsetOrder()) {
+        return;
+    }
     // arrange sq8 data
     auto ivfsq_index = dynamic_cast<faiss::IndexIVFScalarQuantizer*>(index_.get());
     auto invlists = ivfsq_index->invlists;
@@ -155,6 +175,9 @@ IVFSQNR_NM::AddWithoutIds(const DatasetPtr& dataset_ptr, const Config& config) {
 
 VecIndexPtr
 IVFSQNR_NM::CopyCpuToGpu(const int64_t device_id, const Config& config) {
+    if (disk_lists_ != nullptr) {
+        KNOWHERE_THROW_MSG("index with inverted lists on disk can not be copied to GPU");
+    }
 #ifdef MILVUS_GPU_VERSION
     if (auto res = FaissGpuResourceMgr::GetInstance().GetRes(device_id)) {
         ResScope rs(res, device_id, false);
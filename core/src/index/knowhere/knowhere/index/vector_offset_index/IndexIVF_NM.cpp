@@ -51,8 +51,12 @@ IVF_NM::Serialize(const Config& config) {
     if (!index_ || !index_->is_trained) {
         KNOWHERE_THROW_MSG("index not initialize or trained");
     }
-
     std::lock_guard<std::mutex> lk(mutex_);
+    if (disk_lists_ == nullptr) {
+        return SerializeImpl(index_type_);
+    }
+    // the lists stay in the file they were written to
+    ScopedEmptyLists empty_lists(dynamic_cast<faiss::IndexIVF*>(index_.get()));
     return SerializeImpl(index_type_);
 }
 
@@ -60,9 +64,19 @@ void
 IVF_NM::Load(const BinarySet& binary_set) {
     std::lock_guard<std::mutex> lk(mutex_);
     LoadImpl(binary_set, index_type_);
+    if (binary_set.binary_map_.count(RAW_DATA) == 0) {
+        // the codes of a disk mode index are in its inverted lists file, see OpenListsOnDisk
+        return;
+    }
 
-    // Construct arranged data from original data
     auto binary = binary_set.GetByName(RAW_DATA);
+    if (ListsInOffsetOrder()) {
+        // the raw data of the segment was written in list order when the index was built, search it in place
+        data_ = binary->data;
+        return;
+    }
+
+    // Construct arranged data from original data
     const float* original_data = (const float*)binary->data.get();
     auto ivf_index = dynamic_cast<faiss::IndexIVF*>(index_.get());
     auto invlists = ivf_index->invlists;
@@ -237,6 +251,9 @@ IVF_NM::Seal() {
 
 VecIndexPtr
 IVF_NM::CopyCpuToGpu(const int64_t device_id, const Config& config) {
+    if (disk_lists_ != nullptr) {
+        KNOWHERE_THROW_MSG("index with inverted lists on disk can not be copied to GPU");
+    }
 #ifdef MILVUS_GPU_VERSION
     if (auto res = FaissGpuResourceMgr::GetInstance().GetRes(device_id)) {
         ResScope rs(res, device_id, false);
@@ -255,6 +272,122 @@ IVF_NM::CopyCpuToGpu(const int64_t device_id, const Config& config) {
 #endif
 }
 
+void
+IVF_NM::MoveListsToDisk(const std::string& path, int64_t cache_size, const uint8_t* raw_data) {
+    if (!index_ || !index_->is_trained) {
+        KNOWHERE_THROW_MSG("index not initialize or trained");
+    }
+    if (data_ == nullptr && raw_data == nullptr) {
+        KNOWHERE_THROW_MSG("codes of the inverted lists are not available");
+    }
+
+    std::lock_guard<std::mutex> lk(mutex_);
+    auto ivf_index = dynamic_cast<faiss::IndexIVF*>(index_.get());
+    auto invlists = ivf_index->invlists;
+    auto code_size = invlists->code_size;
+    std::vector<size_t> list_offset(invlists->nlist, 0);
+    for (size_t i = 1; i < invlists->nlist; i++) {
+        list_offset[i] = list_offset[i - 1] + invlists->list_size(i - 1);
+    }
+
+    DiskInvertedLists::Write(invlists, path, [&](size_t list_no, std::vector<uint8_t>& codes) {
+        auto list_size = invlists->list_size(list_no);
+        if (data_ != nullptr) {
+            // arranged codes are stored list after list
+            auto begin = data_.get() + list_offset[list_no] * code_size;
+            codes.assign(begin, begin + list_size * code_size);
+            return;
+        }
+        codes.resize(list_size * code_size);
+        faiss::InvertedLists::ScopedIds ids(invlists, list_no);
+        for (size_t j = 0; j < list_size; j++) {
+            memcpy(codes.data() + j * code_size, raw_data + ids[j] * code_size, code_size);
+        }
+    });
+    disk_lists_ = new DiskInvertedLists(ivf_index->nlist, code_size, path, cache_size);
+    ivf_index->replace_invlists(disk_lists_, true);
+    data_ = nullptr;
+
+    // only the coarse quantizer and the hot lists stay in memory
+    SetIndexSize(ivf_index->nlist * ivf_index->d * sizeof(float) + cache_size);
+}
+
+void
+IVF_NM::OpenListsOnDisk(const std::string& path, int64_t cache_size) {
+    if (!index_ || !index_->is_trained) {
+        KNOWHERE_THROW_MSG("index not initialize or trained");
+    }
+
+    std::lock_guard<std::mutex> lk(mutex_);
+    auto ivf_index = dynamic_cast<faiss::IndexIVF*>(index_.get());
+    auto lists = std::make_unique<DiskInvertedLists>(ivf_index->nlist, ivf_index->code_size, path, cache_size);
+    if (lists->compute_ntotal() != (size_t)ivf_index->ntotal) {
+        KNOWHERE_THROW_MSG("inverted lists file " + path + " does not match the index");
+    }
+    disk_lists_ = lists.release();
+    ivf_index->replace_invlists(disk_lists_, true);
+    data_ = nullptr;
+
+    SetIndexSize(ivf_index->nlist * ivf_index->d * sizeof(float) + cache_size);
+}
+
+void
+IVF_NM::GetListOrder(std::vector<int64_t>& order) {
+    if (!index_ || !index_->is_trained) {
+        KNOWHERE_THROW_MSG("index not initialize or trained");
+    }
+
+    auto invlists = dynamic_cast<faiss::IndexIVF*>(index_.get())->invlists;
+    order.clear();
+    order.reserve(index_->ntotal);
+    for (size_t i = 0; i < invlists->nlist; i++) {
+        faiss::InvertedLists::ScopedIds ids(invlists, i);
+        order.insert(order.end(), ids.get(), ids.get() + invlists->list_size(i));
+    }
+}
+
+void
+IVF_NM::RenumberInListOrder() {
+    if (!index_ || !index_->is_trained) {
+        KNOWHERE_THROW_MSG("index not initialize or trained");
+    }
+
+    std::lock_guard<std::mutex> lk(mutex_);
+    auto ails = dynamic_cast<faiss::ArrayInvertedLists*>(dynamic_cast<faiss::IndexIVF*>(index_.get())->invlists);
+    if (ails == nullptr) {
+        KNOWHERE_THROW_MSG("only inverted lists in memory can be renumbered");
+    }
+    int64_t offset = 0;
+    for (auto& ids : ails->ids) {
+        for (auto& id : ids) {
+            id = offset++;
+        }
+    }
+}
+
+bool
+IVF_NM::ListsInOffsetOrder() {
+    auto invlists = dynamic_cast<faiss::IndexIVF*>(index_.get())->invlists;
+    prefix_sum.resize(invlists->nlist);
+    bool in_order = true;
+    size_t curr_index = 0;
+    for (size_t i = 0; i < invlists->nlist; i++) {
+        auto list_size = invlists->list_size(i);
+        if (in_order) {
+            faiss::InvertedLists::ScopedIds ids(invlists, i);
+            for (size_t j = 0; j < list_size; j++) {
+                if (ids[j] != (faiss::Index::idx_t)(curr_index + j)) {
+                    in_order = false;
+                    break;
+                }
+            }
+        }
+        prefix_sum[i] = curr_index;
+        curr_index += list_size;
+    }
+    return in_order;
+}
+
 void
 IVF_NM::GenGraph(const float* data, const int64_t k, GraphType& graph, const Config& config) {
     int64_t K = k + 1;
@@ -311,10 +444,16 @@ IVF_NM::QueryImpl(int64_t n, const float* data, int64_t k, float* distances, int
     } else {
         ivf_index->parallel_mode = 0;
     }
-    bool is_sq8 =
-        (index_type_ == IndexEnum::INDEX_FAISS_IVFSQ8 || index_type_ == IndexEnum::INDEX_FAISS_IVFSQ8NR) ? true : false;
-    ivf_index->search_without_codes(n, (float*)data, (const uint8_t*)data_.get(), prefix_sum, is_sq8, k, distances,
-                                    labels, bitset_);
+    if (disk_lists_ != nullptr) {
+        // the arranged codes were moved into the inverted lists on disk
+        ivf_index->search(n, (float*)data, k, distances, labels, bitset_);
+    } else {
+        bool is_sq8 = (index_type_ == IndexEnum::INDEX_FAISS_IVFSQ8 || index_type_ == IndexEnum::INDEX_FAISS_IVFSQ8NR)
+                          ? true
+                          : false;
+        ivf_index->search_without_codes(n, (float*)data, (const uint8_t*)data_.get(), prefix_sum, is_sq8, k,
+                                        distances, labels, bitset_);
+    }
     stdclock::time_point after = stdclock::now();
     double search_cost = (std::chrono::duration<double, std::micro>(after - before)).count();
     LOG_KNOWHERE_DEBUG_ << "IVF_NM search cost: " << search_cost
@@ -13,6 +13,7 @@
 
 #include <memory>
 #include <mutex>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -20,6 +21,7 @@
 
 #include "knowhere/common/Typedef.h"
 #include "knowhere/index/vector_index/VecIndex.h"
+#include "knowhere/index/vector_index/helpers/DiskInvertedLists.h"
 #include "knowhere/index/vector_offset_index/OffsetBaseIndex.h"
 
 namespace milvus {
@@ -78,6 +80,31 @@ class IVF_NM : public VecIndex, public OffsetBaseIndex {
     virtual void
     GenGraph(const float* data, const int64_t k, GraphType& graph, const Config& config);
 
+    /// write the inverted lists to path and serve them from there, probed lists are read on demand
+    /// through an LRU of cache_size bytes; the index serializes only its coarse quantizer afterwards.
+    /// An index built without arranged codes takes them from raw_data, the vectors in offset order
+    void
+    MoveListsToDisk(const std::string& path, int64_t cache_size, const uint8_t* raw_data = nullptr);
+
+    /// serve the inverted lists that MoveListsToDisk wrote to path when the index was built
+    void
+    OpenListsOnDisk(const std::string& path, int64_t cache_size);
+
+    const DiskInvertedLists*
+    GetDiskLists() const {
+        return disk_lists_;
+    }
+
+    /// order[i] is the offset of the vector that moves to offset i when every inverted list covers a
+    /// contiguous range of offsets, the lists following each other
+    void
+    GetListOrder(std::vector<int64_t>& order);
+
+    /// renumber the offsets kept in the inverted lists as GetListOrder arranges them, the raw data
+    /// attached on Load must be arranged the same way
+    void
+    RenumberInListOrder();
+
  protected:
     virtual std::shared_ptr<faiss::IVFSearchParameters>
     GenParams(const Config&);
@@ -88,10 +115,15 @@ class IVF_NM : public VecIndex, public OffsetBaseIndex {
     void
     SealImpl() override;
 
+    // whether list i holds the offsets [prefix_sum[i], prefix_sum[i] + list size) in order, fills prefix_sum
+    bool
+    ListsInOffsetOrder();
+
  protected:
     std::mutex mutex_;
     std::shared_ptr<uint8_t[]> data_ = nullptr;
     std::vector<size_t> prefix_sum;
+    DiskInvertedLists* disk_lists_ = nullptr;  // owned by index_
 };
 
 using IVFNMPtr = std::shared_ptr<IVF_NM>;
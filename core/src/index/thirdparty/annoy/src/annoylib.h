@@ -127,6 +127,7 @@ inline void set_error_from_string(char **error, const char* msg) {
 
 #include <faiss/FaissHook.h>
 #include <faiss/BuilderSuspend.h>
+#include <omp.h>
 
 using std::vector;
 using std::pair;
@@ -219,7 +220,14 @@ inline float dot<float>(const float* x, const float *y, int f) {
   }
   return result;
 #else
-  return faiss::fvec_inner_product(x, y, (size_t)f);
+  // one index has one dimension, so the kernel picked for it is kept per thread
+  static thread_local int kernel_dim = -1;
+  static thread_local faiss::fvec_func_ptr kernel = nullptr;
+  if (f != kernel_dim) {
+    kernel = faiss::fvec_inner_product_for_dim((size_t)f);
+    kernel_dim = f;
+  }
+  return kernel(x, y, (size_t)f);
 #endif
 }
 
@@ -277,7 +285,13 @@ inline float euclidean_distance<float>(const float* x, const float* y, int f) {
   }
   return result;
 #else
-  return faiss::fvec_L2sqr(x, y, (size_t)f);
+  static thread_local int kernel_dim = -1;
+  static thread_local faiss::fvec_func_ptr kernel = nullptr;
+  if (f != kernel_dim) {
+    kernel = faiss::fvec_L2sqr_for_dim((size_t)f);
+    kernel_dim = f;
+  }
+  return kernel(x, y, (size_t)f);
 #endif
 }
 
@@ -841,6 +855,9 @@ class AnnoyIndexInterface {
                                faiss::ConcurrentBitsetPtr& bitset = nullptr) const = 0;
   virtual void get_nns_by_vector(const T* w, size_t n, int64_t search_k, vector<S>* result, vector<T>* distances,
                                faiss::ConcurrentBitsetPtr& bitset = nullptr) const = 0;
+  // nq queries at once, results of query i at result + i * n, padded with -1 / infinity
+  virtual void get_nns_by_vectors(const T* w, size_t nq, size_t n, int64_t search_k, S* result, T* distances,
+                                  faiss::ConcurrentBitsetPtr& bitset = nullptr) const = 0;
   virtual S get_n_items() const = 0;
   virtual S get_dim() const = 0;
   virtual S get_n_trees() const = 0;
@@ -880,6 +897,20 @@ protected:
   int _fd;
   bool _on_disk;
   bool _built;
+
+  // nodes of one tree, numbered from _n_items on, until the tree is moved to the end of _nodes
+  struct TreeArena {
+    vector<char> nodes;
+    S n_nodes = 0;
+  };
+
+  // buffers of _get_all_nns, reused by the queries of a batch
+  struct SearchBuffers {
+    vector<pair<T, S> > q;
+    vector<S> nns;
+    vector<pair<T, S> > nns_dist;
+    vector<char> v_node;
+  };
 public:
 
    AnnoyIndex(int f) : _f(f), _random() {
@@ -961,7 +992,17 @@ public:
 
     D::template preprocess<T, S, Node>(_nodes, _s, _n_items, _f);
 
+    vector<S> indices;
+    for (S i = 0; i < _n_items; i++) {
+      if (_get(i)->n_descendants >= 1) // Issue #223
+        indices.push_back(i);
+    }
+
+    // Trees are built in parallel (omp_set_num_threads bounds the threads), each one in its own arena and
+    // with its own random generator, then appended to _nodes one after the other so that every tree stays
+    // contiguous. Without q, rounds of one tree per thread run until the forest takes 2x the items.
     _n_nodes = _n_items;
+    const size_t n_threads = omp_get_max_threads();
     while (1) {
       if (q == -1 && _n_nodes >= _n_items * 2)
         break;
@@ -969,13 +1010,19 @@ public:
         break;
       if (_verbose) showUpdate("pass %zd...\n", _roots.size());
 
-      vector<S> indices;
-      for (S i = 0; i < _n_items; i++) {
-        if (_get(i)->n_descendants >= 1) // Issue #223
-          indices.push_back(i);
-      }
+      const size_t n_trees = (q == -1) ? n_threads : (size_t)q - _roots.size();
+      vector<TreeArena> trees(n_trees);
+      vector<S> roots(n_trees);
+      vector<Random> randoms;
+      for (size_t t = 0; t < n_trees; t++)
+        randoms.emplace_back(_random.kiss() | 1);
 
-      _roots.push_back(_make_tree(indices, true));
+#pragma omp parallel for schedule(dynamic, 1)
+      for (size_t t = 0; t < n_trees; t++)
+        roots[t] = _make_tree(indices, true, trees[t], randoms[t]);
+
+      for (size_t t = 0; t < n_trees; t++)
+        _append_tree(trees[t], roots[t]);
     }
 
     // Also, copy the roots into the last segment of the array
@@ -1187,6 +1234,28 @@ public:
     _get_all_nns(w, n, search_k, result, distances, bitset);
   }
 
+  void get_nns_by_vectors(const T* w, size_t nq, size_t n, int64_t search_k, S* result, T* distances,
+                          faiss::ConcurrentBitsetPtr& bitset) const {
+#pragma omp parallel
+    {
+      SearchBuffers buffers;
+#pragma omp for
+      for (size_t i = 0; i < nq; i++) {
+        size_t p = _search(w + i * _f, n, search_k, buffers, bitset);
+        S* result_i = result + i * n;
+        T* distances_i = distances + i * n;
+        for (size_t j = 0; j < p; j++) {
+          distances_i[j] = D::normalized_distance(buffers.nns_dist[j].first);
+          result_i[j] = buffers.nns_dist[j].second;
+        }
+        for (size_t j = p; j < n; j++) {
+          distances_i[j] = numeric_limits<T>::infinity();
+          result_i[j] = -1;
+        }
+      }
+    }
+  }
+
   S get_n_items() const {
     return _n_items;
   }
@@ -1246,7 +1315,33 @@ protected:
     return get_node_ptr<S, Node>(_nodes, _s, i);
   }
 
-  S _make_tree(const vector<S >& indices, bool is_root) {
+  S _add_tree_node(TreeArena& tree, const Node* m) const {
+    S item = _n_items + tree.n_nodes++;
+    tree.nodes.resize((size_t)tree.n_nodes * _s);
+    memcpy(&tree.nodes[(size_t)(item - _n_items) * _s], m, _s);
+    return item;
+  }
+
+  void _append_tree(TreeArena& tree, S root) {
+    // local numbers of split nodes become _nodes offsets, items and leaf contents keep their ids
+    const S shift = _n_nodes - _n_items;
+    _allocate_size(_n_nodes + tree.n_nodes);
+    memcpy(_get(_n_nodes), tree.nodes.data(), (size_t)tree.n_nodes * _s);
+    for (S i = _n_nodes; i < _n_nodes + tree.n_nodes; i++) {
+      Node* nd = _get(i);
+      if (nd->n_descendants > _K) {
+        for (int side = 0; side < 2; side++) {
+          if (nd->children[side] >= _n_items)
+            nd->children[side] += shift;
+        }
+      }
+    }
+    _roots.push_back(root >= _n_items ? root + shift : root);
+    _n_nodes += tree.n_nodes;
+    vector<char>().swap(tree.nodes);
+  }
+
+  S _make_tree(const vector<S >& indices, bool is_root, TreeArena& tree, Random& random) {
     // The basic rule is that if we have <= _K items, then it's a leaf node, otherwise it's a split node.
     // There's some regrettable complications caused by the problem that root nodes have to be "special":
     // 1. We identify root nodes by the arguable logic that _n_items == n->n_descendants, regardless of how many descendants they actually have
@@ -1256,9 +1351,8 @@ protected:
       return indices[0];
 
     if (indices.size() <= (size_t)_K && (!is_root || (size_t)_n_items <= (size_t)_K || indices.size() == 1)) {
-      _allocate_size(_n_nodes + 1);
-      S item = _n_nodes++;
-      Node* m = _get(item);
+      Node* m = (Node*)alloca(_s);
+      memset(m, 0, _s);
       m->n_descendants = is_root ? _n_items : (S)indices.size();
 
       // Using std::copy instead of a loop seems to resolve issues #3 and #13,
@@ -1267,7 +1361,7 @@ protected:
       // Only copy when necessary to avoid crash in MSVC 9. #293
       if (!indices.empty())
         memcpy(m->children, &indices[0], indices.size() * sizeof(S));
-      return item;
+      return _add_tree_node(tree, m);
     }
 
     vector<Node*> children;
@@ -1280,14 +1374,15 @@ protected:
 
     vector<S> children_indices[2];
     Node* m = (Node*)alloca(_s);
-    D::create_split(children, _f, _s, _random, m);
+    memset(m, 0, _s);
+    D::create_split(children, _f, _s, random, m);
     faiss::BuilderSuspend::check_wait();
 
     for (size_t i = 0; i < indices.size(); i++) {
       S j = indices[i];
       Node* n = _get(j);
       if (n) {
-        bool side = D::side(m, n->v, _f, _random);
+        bool side = D::side(m, n->v, _f, random);
         children_indices[side].push_back(j);
       } else {
         showUpdate("No node for index %ld?\n", j);
@@ -1312,7 +1407,7 @@ protected:
       for (size_t i = 0; i < indices.size(); i++) {
         S j = indices[i];
         // Just randomize...
-        children_indices[_random.flip()].push_back(j);
+        children_indices[random.flip()].push_back(j);
       }
     }
 
@@ -1322,40 +1417,53 @@ protected:
     for (int side = 0; side < 2; side++) {
       // run _make_tree for the smallest child first (for cache locality)
       faiss::BuilderSuspend::check_wait();
-      m->children[side^flip] = _make_tree(children_indices[side^flip], false);
+      m->children[side^flip] = _make_tree(children_indices[side^flip], false, tree, random);
     }
 
-    _allocate_size(_n_nodes + 1);
-    S item = _n_nodes++;
-    memcpy(_get(item), m, _s);
-
-    return item;
+    return _add_tree_node(tree, m);
   }
 
   void _get_all_nns(const T* v, size_t n, int64_t search_k, vector<S>* result, vector<T>* distances,
                     faiss::ConcurrentBitsetPtr& bitset) const {
-    Node* v_node = (Node *)alloca(_s);
+    SearchBuffers buffers;
+    size_t p = _search(v, n, search_k, buffers, bitset);
+    for (size_t i = 0; i < p; i++) {
+      if (distances)
+        distances->push_back(D::normalized_distance(buffers.nns_dist[i].first));
+      result->push_back(buffers.nns_dist[i].second);
+    }
+  }
+
+  // leaves the p = min(n, candidates) nearest items at the front of buffers.nns_dist and returns p
+  size_t _search(const T* v, size_t n, int64_t search_k, SearchBuffers& buffers,
+                 faiss::ConcurrentBitsetPtr& bitset) const {
+    buffers.v_node.resize(_s);
+    Node* v_node = (Node *)buffers.v_node.data();
     D::template zero_value<Node>(v_node);
     memcpy(v_node->v, v, sizeof(T) * _f);
     D::init_node(v_node, _f);
 
-    std::priority_queue<pair<T, S> > q;
+    // max-heap of the nodes to visit, as std::priority_queue<pair<T, S> > but on a reused vector
+    vector<pair<T, S> >& q = buffers.q;
+    q.clear();
 
     if (search_k <= 0) {
       search_k = std::max(int64_t(n * _roots.size()), int64_t(_n_items * 5 / 100));
     }
 
     for (size_t i = 0; i < _roots.size(); i++) {
-      q.push(make_pair(Distance::template pq_initial_value<T>(), _roots[i]));
+      q.push_back(make_pair(Distance::template pq_initial_value<T>(), _roots[i]));
+      std::push_heap(q.begin(), q.end());
     }
 
-    std::vector<S> nns;
+    vector<S>& nns = buffers.nns;
+    nns.clear();
     while (nns.size() < (size_t)search_k && !q.empty()) {
-      const pair<T, S>& top = q.top();
-      T d = top.first;
-      S i = top.second;
+      std::pop_heap(q.begin(), q.end());
+      T d = q.back().first;
+      S i = q.back().second;
+      q.pop_back();
       Node* nd = _get(i);
-      q.pop();
       if (nd->n_descendants == 1 && i < _n_items) { // raw data
         if (bitset == nullptr || !bitset->test((faiss::ConcurrentBitset::id_type_t)i))
           nns.push_back(i);
@@ -1368,15 +1476,18 @@ protected:
         }
       } else {
         T margin = D::margin(nd, v, _f);
-        q.push(make_pair(D::pq_distance(d, margin, 1), static_cast<S>(nd->children[1])));
-        q.push(make_pair(D::pq_distance(d, margin, 0), static_cast<S>(nd->children[0])));
+        q.push_back(make_pair(D::pq_distance(d, margin, 1), static_cast<S>(nd->children[1])));
+        std::push_heap(q.begin(), q.end());
+        q.push_back(make_pair(D::pq_distance(d, margin, 0), static_cast<S>(nd->children[0])));
+        std::push_heap(q.begin(), q.end());
       }
     }
 
     // Get distances for all items
     // To avoid calculating distance multiple times for any items, sort by id
     std::sort(nns.begin(), nns.end());
-    vector<pair<T, S> > nns_dist;
+    vector<pair<T, S> >& nns_dist = buffers.nns_dist;
+    nns_dist.clear();
     S last = -1;
     for (size_t i = 0; i < nns.size(); i++) {
       S j = nns[i];
@@ -1390,11 +1501,7 @@ protected:
     size_t m = nns_dist.size();
     size_t p = n < m ? n : m; // Return this many items
     std::partial_sort(nns_dist.begin(), nns_dist.begin() + p, nns_dist.end());
-    for (size_t i = 0; i < p; i++) {
-      if (distances)
-        distances->push_back(D::normalized_distance(nns_dist[i].first));
-      result->push_back(nns_dist[i].second);
-    }
+    return p;
   }
 };
 
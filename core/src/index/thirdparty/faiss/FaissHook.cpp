@@ -9,10 +9,19 @@
 #include <faiss/impl/ScalarQuantizerDC.h>
 #include <faiss/impl/ScalarQuantizerDC_avx.h>
 #include <faiss/impl/ScalarQuantizerDC_avx512.h>
+#include <faiss/utils/BinaryDistance.h>
+#include <faiss/utils/binary_distances_avx.h>
+#include <faiss/utils/binary_distances_avx512.h>
 #include <faiss/utils/distances.h>
 #include <faiss/utils/distances_avx.h>
 #include <faiss/utils/distances_avx512.h>
+#include <faiss/utils/half_precision.h>
+#include <faiss/utils/half_precision_avx.h>
+#include <faiss/utils/half_precision_avx512.h>
 #include <faiss/utils/instruction_set.h>
+#include <faiss/utils/pq4_fast_scan.h>
+#include <faiss/utils/pq4_fast_scan_avx.h>
+#include <faiss/utils/pq4_fast_scan_avx512.h>
 
 namespace faiss {
 
@@ -26,10 +35,24 @@ fvec_func_ptr fvec_L2sqr = fvec_L2sqr_avx;
 fvec_func_ptr fvec_L1 = fvec_L1_avx;
 fvec_func_ptr fvec_Linf = fvec_Linf_avx;
 
+fvec_fixed_func_ptr fvec_L2sqr_fixed = fvec_L2sqr_fixed_avx;
+fvec_fixed_func_ptr fvec_inner_product_fixed = fvec_inner_product_fixed_avx;
+
 sq_get_distance_computer_func_ptr sq_get_distance_computer = sq_get_distance_computer_avx;
 sq_sel_quantizer_func_ptr sq_sel_quantizer = sq_select_quantizer_avx;
 sq_sel_inv_list_scanner_func_ptr sq_sel_inv_list_scanner = sq_select_inverted_list_scanner_avx;
 
+pq4_accumulate_func_ptr pq4_accumulate = pq4_accumulate_avx;
+
+hvec_func_ptr fvec_L2sqr_fp16 = fvec_L2sqr_fp16_avx;
+hvec_func_ptr fvec_inner_product_fp16 = fvec_inner_product_fp16_avx;
+hvec_func_ptr fvec_L2sqr_bf16 = fvec_L2sqr_bf16_avx;
+hvec_func_ptr fvec_inner_product_bf16 = fvec_inner_product_bf16_avx;
+
+bvec_hamming_func_ptr bvec_hamming = bvec_hamming_avx;
+bvec_jaccard_func_ptr bvec_jaccard = bvec_jaccard_avx;
+bvec_contains_func_ptr bvec_contains = bvec_contains_avx;
+
 /*****************************************************************************/
 
 bool support_avx512() {
@@ -41,6 +64,13 @@ bool support_avx512() {
             instruction_set_inst.AVX512BW());
 }
 
+bool support_avx512_vpopcntdq() {
+    if (!support_avx512()) return false;
+
+    InstructionSet& instruction_set_inst = InstructionSet::GetInstance();
+    return (instruction_set_inst.AVX512VPOPCNTDQ());
+}
+
 bool support_avx2() {
     if (!faiss_use_avx2) return false;
 
@@ -65,12 +95,33 @@ bool hook_init(std::string& cpu_flag) {
         fvec_L2sqr = fvec_L2sqr_avx512;
         fvec_L1 = fvec_L1_avx512;
         fvec_Linf = fvec_Linf_avx512;
+        fvec_L2sqr_fixed = fvec_L2sqr_fixed_avx512;
+        fvec_inner_product_fixed = fvec_inner_product_fixed_avx512;
 
         /* for IVFSQ */
         sq_get_distance_computer = sq_get_distance_computer_avx512;
         sq_sel_quantizer = sq_select_quantizer_avx512;
         sq_sel_inv_list_scanner = sq_select_inverted_list_scanner_avx512;
 
+        /* for IVFPQ fast scan */
+        pq4_accumulate = pq4_accumulate_avx512;
+
+        /* for half precision raw vectors */
+        fvec_L2sqr_fp16 = fvec_L2sqr_fp16_avx512;
+        fvec_inner_product_fp16 = fvec_inner_product_fp16_avx512;
+        fvec_L2sqr_bf16 = fvec_L2sqr_bf16_avx512;
+        fvec_inner_product_bf16 = fvec_inner_product_bf16_avx512;
+
+        /* for binary vectors, popcount needs VPOPCNTDQ on top of AVX512 */
+        if (support_avx512_vpopcntdq()) {
+            bvec_hamming = bvec_hamming_avx512;
+            bvec_jaccard = bvec_jaccard_avx512;
+        } else {
+            bvec_hamming = bvec_hamming_avx;
+            bvec_jaccard = bvec_jaccard_avx;
+        }
+        bvec_contains = bvec_contains_avx512;
+
         cpu_flag = "AVX512";
     } else if (support_avx2()) {
         /* for IVFFLAT */
@@ -78,12 +129,28 @@ bool hook_init(std::string& cpu_flag) {
         fvec_L2sqr = fvec_L2sqr_avx;
         fvec_L1 = fvec_L1_avx;
         fvec_Linf = fvec_Linf_avx;
+        fvec_L2sqr_fixed = fvec_L2sqr_fixed_avx;
+        fvec_inner_product_fixed = fvec_inner_product_fixed_avx;
 
         /* for IVFSQ */
         sq_get_distance_computer = sq_get_distance_computer_avx;
         sq_sel_quantizer = sq_select_quantizer_avx;
         sq_sel_inv_list_scanner = sq_select_inverted_list_scanner_avx;
 
+        /* for IVFPQ fast scan */
+        pq4_accumulate = pq4_accumulate_avx;
+
+        /* for half precision raw vectors */
+        fvec_L2sqr_fp16 = fvec_L2sqr_fp16_avx;
+        fvec_inner_product_fp16 = fvec_inner_product_fp16_avx;
+        fvec_L2sqr_bf16 = fvec_L2sqr_bf16_avx;
+        fvec_inner_product_bf16 = fvec_inner_product_bf16_avx;
+
+        /* for binary vectors */
+        bvec_hamming = bvec_hamming_avx;
+        bvec_jaccard = bvec_jaccard_avx;
+        bvec_contains = bvec_contains_avx;
+
         cpu_flag = "AVX2";
     } else if (support_sse()) {
         /* for IVFFLAT */
@@ -91,12 +158,28 @@ bool hook_init(std::string& cpu_flag) {
         fvec_L2sqr = fvec_L2sqr_sse;
         fvec_L1 = fvec_L1_sse;
         fvec_Linf = fvec_Linf_sse;
+        fvec_L2sqr_fixed = nullptr;
+        fvec_inner_product_fixed = nullptr;
 
         /* for IVFSQ */
         sq_get_distance_computer = sq_get_distance_computer_ref;
         sq_sel_quantizer = sq_select_quantizer_ref;
         sq_sel_inv_list_scanner = sq_select_inverted_list_scanner_ref;
 
+        /* for IVFPQ fast scan */
+        pq4_accumulate = pq4_accumulate_ref;
+
+        /* for half precision raw vectors */
+        fvec_L2sqr_fp16 = fvec_L2sqr_fp16_ref;
+        fvec_inner_product_fp16 = fvec_inner_product_fp16_ref;
+        fvec_L2sqr_bf16 = fvec_L2sqr_bf16_ref;
+        fvec_inner_product_bf16 = fvec_inner_product_bf16_ref;
+
+        /* for binary vectors */
+        bvec_hamming = bvec_hamming_ref;
+        bvec_jaccard = bvec_jaccard_ref;
+        bvec_contains = bvec_contains_ref;
+
         cpu_flag = "SSE42";
     } else {
         cpu_flag = "UNSUPPORTED";
@@ -106,4 +189,14 @@ bool hook_init(std::string& cpu_flag) {
     return true;
 }
 
+fvec_func_ptr fvec_L2sqr_for_dim(size_t d) {
+    fvec_func_ptr func = fvec_L2sqr_fixed ? fvec_L2sqr_fixed(d) : nullptr;
+    return func ? func : fvec_L2sqr;
+}
+
+fvec_func_ptr fvec_inner_product_for_dim(size_t d) {
+    fvec_func_ptr func = fvec_inner_product_fixed ? fvec_inner_product_fixed(d) : nullptr;
+    return func ? func : fvec_inner_product;
+}
+
 } // namespace faiss
@@ -13,11 +13,20 @@
 namespace faiss {
 
 typedef float (*fvec_func_ptr)(const float*, const float*, size_t);
+typedef fvec_func_ptr (*fvec_fixed_func_ptr)(size_t);
 
 typedef SQDistanceComputer* (*sq_get_distance_computer_func_ptr)(MetricType, QuantizerType, size_t, const std::vector<float>&);
 typedef Quantizer* (*sq_sel_quantizer_func_ptr)(QuantizerType, size_t, const std::vector<float>&);
 typedef InvertedListScanner* (*sq_sel_inv_list_scanner_func_ptr)(MetricType, const ScalarQuantizer*, const Index*, size_t, bool, bool);
 
+typedef void (*pq4_accumulate_func_ptr)(size_t, size_t, const uint8_t*, const uint8_t*, uint16_t*);
+
+typedef float (*hvec_func_ptr)(const float*, const uint16_t*, size_t);
+
+typedef int (*bvec_hamming_func_ptr)(const uint8_t*, const uint8_t*, size_t);
+typedef void (*bvec_jaccard_func_ptr)(const uint8_t*, const uint8_t*, size_t, int*, int*);
+typedef bool (*bvec_contains_func_ptr)(const uint8_t*, const uint8_t*, size_t);
+
 extern bool faiss_use_avx512;
 extern bool faiss_use_avx2;
 extern bool faiss_use_sse;
@@ -27,14 +36,35 @@ extern fvec_func_ptr fvec_L2sqr;
 extern fvec_func_ptr fvec_L1;
 extern fvec_func_ptr fvec_Linf;
 
+/* kernels unrolled for a fixed dimension, not set when the CPU has no such kernels */
+extern fvec_fixed_func_ptr fvec_L2sqr_fixed;
+extern fvec_fixed_func_ptr fvec_inner_product_fixed;
+
 extern sq_get_distance_computer_func_ptr sq_get_distance_computer;
 extern sq_sel_quantizer_func_ptr sq_sel_quantizer;
 extern sq_sel_inv_list_scanner_func_ptr sq_sel_inv_list_scanner;
 
+extern pq4_accumulate_func_ptr pq4_accumulate;
+
+extern hvec_func_ptr fvec_L2sqr_fp16;
+extern hvec_func_ptr fvec_inner_product_fp16;
+extern hvec_func_ptr fvec_L2sqr_bf16;
+extern hvec_func_ptr fvec_inner_product_bf16;
+
+extern bvec_hamming_func_ptr bvec_hamming;
+extern bvec_jaccard_func_ptr bvec_jaccard;
+extern bvec_contains_func_ptr bvec_contains;
+
 extern bool support_avx512();
+extern bool support_avx512_vpopcntdq();
 extern bool support_avx2();
 extern bool support_sse();
 
 extern bool hook_init(std::string& cpu_flag);
 
+/* the fastest L2 / IP kernel for vectors of dimension d, to be resolved once
+ * per index instead of going through the generic hook on every call */
+extern fvec_func_ptr fvec_L2sqr_for_dim(size_t d);
+extern fvec_func_ptr fvec_inner_product_for_dim(size_t d);
+
 } // namespace faiss
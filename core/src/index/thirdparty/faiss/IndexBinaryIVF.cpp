@@ -470,9 +470,10 @@ BinaryInvertedListScanner *select_IVFBinaryScannerL2 (size_t code_size) {
         case 16: HC(HammingComputer16);
         case 20: HC(HammingComputer20);
         case 32: HC(HammingComputer32);
-        case 64: HC(HammingComputer64);
         default:
-            if (code_size % 8 == 0) {
+            if (code_size >= 64) {
+                HC(HammingComputerHook);
+            } else if (code_size % 8 == 0) {
                 HC(HammingComputerM8);
             } else if (code_size % 4 == 0) {
                 HC(HammingComputerM4);
@@ -491,12 +492,12 @@ BinaryInvertedListScanner *select_IVFBinaryScannerJaccard (size_t code_size) {
         return new IVFBinaryScannerJaccard<JaccardComputer ## cs, store_pairs> (cs);
      HANDLE_CS(16)
      HANDLE_CS(32)
-     HANDLE_CS(64)
-     HANDLE_CS(128)
-     HANDLE_CS(256)
-     HANDLE_CS(512)
 #undef HANDLE_CS
     default:
+        if (code_size >= 64) {
+            return new IVFBinaryScannerJaccard<JaccardComputerHook,
+                store_pairs>(code_size);
+        }
         return new IVFBinaryScannerJaccard<JaccardComputerDefault,
             store_pairs>(code_size);
     }
@@ -795,10 +796,12 @@ void search_knn_hamming_count_1 (
       HANDLE_CS(16);
       HANDLE_CS(20);
       HANDLE_CS(32);
-      HANDLE_CS(64);
 #undef HANDLE_CS
     default:
-        if (ivf.code_size % 8 == 0) {
+        if (ivf.code_size >= 64) {
+            search_knn_hamming_count<HammingComputerHook, store_pairs>
+                (ivf, nx, x, keys, k, distances, labels, params, bitset);
+        } else if (ivf.code_size % 8 == 0) {
             search_knn_hamming_count<HammingComputerM8, store_pairs>
                 (ivf, nx, x, keys, k, distances, labels, params, bitset);
         } else if (ivf.code_size % 4 == 0) {
@@ -390,6 +390,7 @@ void IndexIVF::search_preassigned (idx_t n, const float *x, idx_t k,
 {
     long nprobe = params ? params->nprobe : this->nprobe;
     long max_codes = params ? params->max_codes : this->max_codes;
+    const float *heap_thresholds = params ? params->heap_thresholds : nullptr;
 
     size_t nlistv = 0, ndis = 0, nheap = 0;
 
@@ -398,6 +399,13 @@ void IndexIVF::search_preassigned (idx_t n, const float *x, idx_t k,
 
     bool interrupt = false;
 
+    // one read-only blacklist snapshot shared by all scanners, when no id is
+    // deleted the scanners get no bitset and skip the test altogether
+    auto frozen = frozen_blacklist(bitset);
+    if (frozen == nullptr) {
+        bitset = nullptr;
+    }
+
     int pmode = this->parallel_mode & ~PARALLEL_MODE_NO_HEAP_INIT;
     bool do_heap_init = !(this->parallel_mode & PARALLEL_MODE_NO_HEAP_INIT);
 
@@ -411,6 +419,7 @@ void IndexIVF::search_preassigned (idx_t n, const float *x, idx_t k,
     {
         InvertedListScanner *scanner = get_InvertedListScanner(store_pairs);
         ScopeDeleter1<InvertedListScanner> del(scanner);
+        scanner->frozen_bitset = frozen.get();
 
         /*****************************************************
          * Depending on parallel_mode, there are two possible ways
@@ -420,13 +429,18 @@ void IndexIVF::search_preassigned (idx_t n, const float *x, idx_t k,
 
         // intialize + reorder a result heap
 
-        auto init_result = [&](float *simi, idx_t *idxi) {
+        auto init_result = [&](float *simi, idx_t *idxi, size_t i) {
             if (!do_heap_init) return;
             if (metric_type == METRIC_INNER_PRODUCT) {
                 heap_heapify<HeapForIP> (k, simi, idxi);
             } else {
                 heap_heapify<HeapForL2> (k, simi, idxi);
             }
+            if (heap_thresholds) {
+                for (idx_t j = 0; j < k; j++) {
+                    simi[j] = heap_thresholds[i];
+                }
+            }
         };
 
         auto reorder_result = [&] (float *simi, idx_t *idxi) {
@@ -497,7 +511,7 @@ void IndexIVF::search_preassigned (idx_t n, const float *x, idx_t k,
                 float * simi = distances + i * k;
                 idx_t * idxi = labels + i * k;
 
-                init_result (simi, idxi);
+                init_result (simi, idxi, i);
 
                 long nscan = 0;
 
@@ -529,7 +543,7 @@ void IndexIVF::search_preassigned (idx_t n, const float *x, idx_t k,
 
             for (size_t i = 0; i < n; i++) {
                 scanner->set_query (x + i * d);
-                init_result (local_dis.data(), local_idx.data());
+                init_result (local_dis.data(), local_idx.data(), i);
 
 #pragma omp for schedule(dynamic)
                 for (size_t ik = 0; ik < nprobe; ik++) {
@@ -545,7 +559,7 @@ void IndexIVF::search_preassigned (idx_t n, const float *x, idx_t k,
                 float * simi = distances + i * k;
                 idx_t * idxi = labels + i * k;
 #pragma omp single
-                init_result (simi, idxi);
+                init_result (simi, idxi, i);
 
 #pragma omp barrier
 #pragma omp critical
@@ -603,6 +617,13 @@ void IndexIVF::search_preassigned_without_codes (idx_t n, const float *x,
 
     bool interrupt = false;
 
+    // one read-only blacklist snapshot shared by all scanners, when no id is
+    // deleted the scanners get no bitset and skip the test altogether
+    auto frozen = frozen_blacklist(bitset);
+    if (frozen == nullptr) {
+        bitset = nullptr;
+    }
+
     int pmode = this->parallel_mode & ~PARALLEL_MODE_NO_HEAP_INIT;
     bool do_heap_init = !(this->parallel_mode & PARALLEL_MODE_NO_HEAP_INIT);
 
@@ -616,6 +637,7 @@ void IndexIVF::search_preassigned_without_codes (idx_t n, const float *x,
     {
         InvertedListScanner *scanner = get_InvertedListScanner(store_pairs);
         ScopeDeleter1<InvertedListScanner> del(scanner);
+        scanner->frozen_bitset = frozen.get();
 
         /*****************************************************
          * Depending on parallel_mode, there are two possible ways
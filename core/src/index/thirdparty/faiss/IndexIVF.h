@@ -69,6 +69,9 @@ struct Level1Quantizer {
 struct IVFSearchParameters {
     size_t nprobe;            ///< number of probes at query time
     size_t max_codes;         ///< max nb of codes to visit to do a query
+    /// optional, size n: the result heaps of each query start from this
+    /// distance, only better results are returned (others have label -1)
+    const float *heap_thresholds = nullptr;
     virtual ~IVFSearchParameters () {}
 };
 
@@ -356,6 +359,10 @@ struct InvertedListScanner {
 
     using idx_t = Index::idx_t;
 
+    /// read-only snapshot of the search blacklist, set by the search loop.
+    /// When set, scanners test it instead of the atomic bitset argument
+    const FrozenBitset *frozen_bitset = nullptr;
+
     /// from now on we handle this query.
     virtual void set_query (const float *query_vector) = 0;
 
@@ -394,6 +401,14 @@ struct InvertedListScanner {
                                    RangeQueryResult &result,
                                    ConcurrentBitsetPtr bitset = nullptr) const;
 
+    /// true if id is deleted for the current search
+    inline bool is_blacklisted (idx_t id, const ConcurrentBitsetPtr &bitset) const {
+        if (frozen_bitset) {
+            return frozen_bitset->test(id);
+        }
+        return bitset && bitset->test(id);
+    }
+
     virtual ~InvertedListScanner () {}
 
 };
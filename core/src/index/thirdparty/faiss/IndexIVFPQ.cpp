@@ -801,11 +801,18 @@ struct KnnSearchResults {
 
     size_t nup;
 
+    // read-only blacklist snapshot, preferred over bitset when set
+    const FrozenBitset * frozen_bitset;
+
     inline void add (idx_t j, float dis, ConcurrentBitsetPtr bitset = nullptr) {
         if (C::cmp (heap_sim[0], dis)) {
             idx_t id = ids ? ids[j] : lo_build (key, j);
-            if (bitset != nullptr && bitset->test((faiss::ConcurrentBitset::id_type_t)id))
+            if (frozen_bitset != nullptr) {
+                if (frozen_bitset->test(id))
+                    return;
+            } else if (bitset != nullptr && bitset->test((faiss::ConcurrentBitset::id_type_t)id)) {
                 return;
+            }
             heap_swap_top<C> (k, heap_sim, heap_ids, dis, id);
             nup++;
         }
@@ -1083,7 +1090,8 @@ struct IVFPQScanner:
             /* k */        k,
             /* heap_sim */ heap_sim,
             /* heap_ids */ heap_ids,
-            /* nup */      0
+            /* nup */      0,
+            /* frozen_bitset */ this->frozen_bitset
         };
 
         if (this->polysemous_ht > 0) {
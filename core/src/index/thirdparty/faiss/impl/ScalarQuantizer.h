@@ -119,7 +119,7 @@ struct IVFSQScannerIP: InvertedListScanner {
         size_t nup = 0;
 
         for (size_t j = 0; j < list_size; j++) {
-            if(!bitset || !bitset->test(ids[j])){
+            if(!is_blacklisted(ids[j], bitset)){
                 float accu = accu0 + dc.query_to_code (codes);
 
                 if (accu > simi [0]) {
@@ -206,7 +206,7 @@ struct IVFSQScannerL2: InvertedListScanner {
     {
         size_t nup = 0;
         for (size_t j = 0; j < list_size; j++) {
-            if(!bitset || !bitset->test(ids[j])){
+            if(!is_blacklisted(ids[j], bitset)){
                 float dis = dc.query_to_code (codes);
 
                 if (dis < simi [0]) {
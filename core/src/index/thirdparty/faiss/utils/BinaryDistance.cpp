@@ -17,6 +17,53 @@ namespace faiss {
 
 static const size_t size_1M = 1 * 1024 * 1024;
 static const size_t batch_size = 65536;
+/* queries scanned together, so that every database code is fetched and
+ * checked against the bitset once per block instead of once per query */
+static const size_t query_block_size = 8;
+
+static inline uint64_t load64 (const uint8_t * p) {
+    uint64_t x;
+    memcpy (&x, p, sizeof(x));
+    return x;
+}
+
+int bvec_hamming_ref (const uint8_t * a, const uint8_t * b, size_t n) {
+    int accu = 0;
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        accu += popcount64 (load64 (a + i) ^ load64 (b + i));
+    for (; i < n; i++)
+        accu += popcount64 (a[i] ^ b[i]);
+    return accu;
+}
+
+void bvec_jaccard_ref (const uint8_t * a, const uint8_t * b, size_t n, int * num, int * den) {
+    int accu_num = 0, accu_den = 0;
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint64_t x = load64 (a + i), y = load64 (b + i);
+        accu_num += popcount64 (x & y);
+        accu_den += popcount64 (x | y);
+    }
+    for (; i < n; i++) {
+        accu_num += popcount64 (a[i] & b[i]);
+        accu_den += popcount64 (a[i] | b[i]);
+    }
+    *num = accu_num;
+    *den = accu_den;
+}
+
+bool bvec_contains_ref (const uint8_t * a, const uint8_t * b, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint64_t x = load64 (a + i);
+        if ((x & load64 (b + i)) != x) return false;
+    }
+    for (; i < n; i++) {
+        if ((a[i] & b[i]) != a[i]) return false;
+    }
+    return true;
+}
 
 template <class T>
 static
@@ -28,7 +75,7 @@ void binary_distence_knn_hc(
         size_t n2,
         bool order = true,
         bool init_heap = true,
-        ConcurrentBitsetPtr bitset = nullptr)
+        const FrozenBitset * bitset = nullptr)
 {
     size_t k = ha->k;
 
@@ -94,22 +141,28 @@ void binary_distence_knn_hc(
         if (init_heap) ha->heapify ();
 
         const size_t block_size = batch_size;
+        const size_t nqb = (ha->nh + query_block_size - 1) / query_block_size;
         for (size_t j0 = 0; j0 < n2; j0 += block_size) {
             const size_t j1 = std::min(j0 + block_size, n2);
 #pragma omp parallel for
-            for (size_t i = 0; i < ha->nh; i++) {
-                T hc (bs1 + i * bytes_per_code, bytes_per_code);
+            for (size_t qb = 0; qb < nqb; qb++) {
+                const size_t i0 = qb * query_block_size;
+                const size_t i1 = std::min(i0 + query_block_size, ha->nh);
+
+                T hc[query_block_size];
+                for (size_t i = i0; i < i1; i++) {
+                    hc[i - i0].set (bs1 + i * bytes_per_code, bytes_per_code);
+                }
 
                 const uint8_t * bs2_ = bs2 + j0 * bytes_per_code;
-                tadis_t dis;
-                tadis_t * __restrict bh_val_ = ha->val + i * k;
-                int64_t * __restrict bh_ids_ = ha->ids + i * k;
-                size_t j;
-                for (j = j0; j < j1; j++, bs2_+= bytes_per_code) {
+                for (size_t j = j0; j < j1; j++, bs2_+= bytes_per_code) {
                     if(!bitset || !bitset->test(j)){
-                        dis = hc.compute (bs2_);
-                        if (dis < bh_val_[0]) {
-                            faiss::maxheap_swap_top<tadis_t> (k, bh_val_, bh_ids_, dis, j);
+                        for (size_t i = i0; i < i1; i++) {
+                            tadis_t dis = hc[i - i0].compute (bs2_);
+                            tadis_t * __restrict bh_val_ = ha->val + i * k;
+                            if (dis < bh_val_[0]) {
+                                faiss::maxheap_swap_top<tadis_t> (k, bh_val_, ha->ids + i * k, dis, j);
+                            }
                         }
                     }
                 }
@@ -131,6 +184,7 @@ void binary_distence_knn_hc (
         int order,
         ConcurrentBitsetPtr bitset)
 {
+    auto frozen = frozen_blacklist(bitset);
     switch (metric_type) {
     case METRIC_Jaccard:
     case METRIC_Tanimoto:
@@ -138,19 +192,20 @@ void binary_distence_knn_hc (
 #define binary_distence_knn_hc_jaccard(ncodes) \
         case ncodes: \
             binary_distence_knn_hc<faiss::JaccardComputer ## ncodes> \
-                (ncodes, ha, a, b, nb, order, true, bitset); \
+                (ncodes, ha, a, b, nb, order, true, frozen.get()); \
         break;
         binary_distence_knn_hc_jaccard(8);
         binary_distence_knn_hc_jaccard(16);
         binary_distence_knn_hc_jaccard(32);
-        binary_distence_knn_hc_jaccard(64);
-        binary_distence_knn_hc_jaccard(128);
-        binary_distence_knn_hc_jaccard(256);
-        binary_distence_knn_hc_jaccard(512);
 #undef binary_distence_knn_hc_jaccard
         default:
-            binary_distence_knn_hc<faiss::JaccardComputerDefault>
-                    (ncodes, ha, a, b, nb, order, true, bitset);
+            if (ncodes >= 64) {
+                binary_distence_knn_hc<faiss::JaccardComputerHook>
+                        (ncodes, ha, a, b, nb, order, true, frozen.get());
+            } else {
+                binary_distence_knn_hc<faiss::JaccardComputerDefault>
+                        (ncodes, ha, a, b, nb, order, true, frozen.get());
+            }
             break;
         }
         break;
@@ -171,7 +226,7 @@ void binary_distence_knn_mc(
         size_t k,
         float *distances,
         int64_t *labels,
-        ConcurrentBitsetPtr bitset)
+        const FrozenBitset * bitset)
 {
     if ((bytes_per_code + sizeof(size_t) + k * sizeof(int64_t)) * n1 < size_1M) {
         int thread_max_num = omp_get_max_threads();
@@ -235,27 +290,46 @@ void binary_distence_knn_mc(
         }
 
         const size_t block_size = batch_size;
+        const size_t nqb = (n1 + query_block_size - 1) / query_block_size;
         for (size_t j0 = 0; j0 < n2; j0 += block_size) {
             const size_t j1 = std::min(j0 + block_size, n2);
 #pragma omp parallel for
-            for (size_t i = 0; i < n1; i++) {
-                size_t num_i = num[i];
-                if (num_i == k) continue;
-                float * dis = distances + i * k;
-                int64_t * lab = labels + i * k;
+            for (size_t qb = 0; qb < nqb; qb++) {
+                const size_t i0 = qb * query_block_size;
+                const size_t i1 = std::min(i0 + query_block_size, n1);
+
+                // queries of the block which still need matches
+                T hc[query_block_size];
+                size_t active[query_block_size];
+                size_t n_active = 0;
+                for (size_t i = i0; i < i1; i++) {
+                    if (num[i] < k) {
+                        hc[n_active].set (bs1 + i * bytes_per_code, bytes_per_code);
+                        active[n_active++] = i;
+                    }
+                }
 
-                T hc (bs1 + i * bytes_per_code, bytes_per_code);
                 const uint8_t * bs2_ = bs2 + j0 * bytes_per_code;
-                for (size_t j = j0; j < j1; j++, bs2_ += bytes_per_code) {
+                for (size_t j = j0; j < j1 && n_active > 0; j++, bs2_ += bytes_per_code) {
                     if(!bitset || !bitset->test(j)){
-                        if (hc.compute (bs2_)) {
-                            dis[num_i] = 0;
-                            lab[num_i] = j;
-                            if (++num_i == k) break;
+                        for (size_t a = 0; a < n_active; ) {
+                            size_t i = active[a];
+                            if (hc[a].compute (bs2_)) {
+                                size_t &num_i = num[i];
+                                distances[i * k + num_i] = 0;
+                                labels[i * k + num_i] = j;
+                                if (++num_i == k) {
+                                    // query is full, drop it from the block
+                                    n_active--;
+                                    hc[a] = hc[n_active];
+                                    active[a] = active[n_active];
+                                    continue;
+                                }
+                            }
+                            a++;
                         }
                     }
                 }
-                num[i] = num_i;
             }
         }
 
@@ -283,6 +357,7 @@ void binary_distence_knn_mc (
         float *distances,
         int64_t *labels,
         ConcurrentBitsetPtr bitset) {
+    auto frozen = frozen_blacklist(bitset);
 
     switch (metric_type) {
     case METRIC_Substructure:
@@ -290,19 +365,20 @@ void binary_distence_knn_mc (
 #define binary_distence_knn_mc_Substructure(ncodes) \
         case ncodes: \
             binary_distence_knn_mc<faiss::SubstructureComputer ## ncodes> \
-                (ncodes, a, b, na, nb, k, distances, labels, bitset); \
+                (ncodes, a, b, na, nb, k, distances, labels, frozen.get()); \
         break;
         binary_distence_knn_mc_Substructure(8);
         binary_distence_knn_mc_Substructure(16);
         binary_distence_knn_mc_Substructure(32);
-        binary_distence_knn_mc_Substructure(64);
-        binary_distence_knn_mc_Substructure(128);
-        binary_distence_knn_mc_Substructure(256);
-        binary_distence_knn_mc_Substructure(512);
 #undef binary_distence_knn_mc_Substructure
         default:
-            binary_distence_knn_mc<faiss::SubstructureComputerDefault>
-                    (ncodes, a, b, na, nb, k, distances, labels, bitset);
+            if (ncodes >= 64) {
+                binary_distence_knn_mc<faiss::SubstructureComputerHook>
+                        (ncodes, a, b, na, nb, k, distances, labels, frozen.get());
+            } else {
+                binary_distence_knn_mc<faiss::SubstructureComputerDefault>
+                        (ncodes, a, b, na, nb, k, distances, labels, frozen.get());
+            }
             break;
         }
         break;
@@ -312,19 +388,20 @@ void binary_distence_knn_mc (
 #define binary_distence_knn_mc_Superstructure(ncodes) \
         case ncodes: \
             binary_distence_knn_mc<faiss::SuperstructureComputer ## ncodes> \
-                (ncodes, a, b, na, nb, k, distances, labels, bitset); \
+                (ncodes, a, b, na, nb, k, distances, labels, frozen.get()); \
         break;
         binary_distence_knn_mc_Superstructure(8);
         binary_distence_knn_mc_Superstructure(16);
         binary_distence_knn_mc_Superstructure(32);
-        binary_distence_knn_mc_Superstructure(64);
-        binary_distence_knn_mc_Superstructure(128);
-        binary_distence_knn_mc_Superstructure(256);
-        binary_distence_knn_mc_Superstructure(512);
 #undef binary_distence_knn_mc_Superstructure
         default:
-            binary_distence_knn_mc<faiss::SuperstructureComputerDefault>
-                    (ncodes, a, b, na, nb, k, distances, labels, bitset);
+            if (ncodes >= 64) {
+                binary_distence_knn_mc<faiss::SuperstructureComputerHook>
+                        (ncodes, a, b, na, nb, k, distances, labels, frozen.get());
+            } else {
+                binary_distence_knn_mc<faiss::SuperstructureComputerDefault>
+                        (ncodes, a, b, na, nb, k, distances, labels, frozen.get());
+            }
             break;
         }
         break;
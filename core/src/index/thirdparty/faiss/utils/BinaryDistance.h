@@ -8,6 +8,7 @@
 #include <stdint.h>
 
 #include <faiss/utils/Heap.h>
+#include <faiss/FaissHook.h>
 
 /* The binary distance type */
 typedef float tadis_t;
@@ -53,6 +54,98 @@ namespace faiss {
             int64_t *labels,
             ConcurrentBitsetPtr bitset);
 
+/// scalar popcount kernels, used by the hook when the CPU has no AVX2
+    int bvec_hamming_ref (const uint8_t * a, const uint8_t * b, size_t n);
+    void bvec_jaccard_ref (const uint8_t * a, const uint8_t * b, size_t n, int * num, int * den);
+    bool bvec_contains_ref (const uint8_t * a, const uint8_t * b, size_t n);
+
+/** Computers going through the popcount kernels selected by hook_init.
+ * They pay an indirect call per vector, so they are only used for codes
+ * long enough (>= 64 bytes) to keep the SIMD kernel busy. */
+    struct HammingComputerHook {
+        const uint8_t *a;
+        size_t n;
+
+        HammingComputerHook () {}
+
+        HammingComputerHook (const uint8_t *a8, int code_size) {
+            set (a8, code_size);
+        }
+
+        void set (const uint8_t *a8, int code_size) {
+            a = a8;
+            n = code_size;
+        }
+
+        inline int hamming (const uint8_t *b8) const {
+            return bvec_hamming (a, b8, n);
+        }
+    };
+
+    struct JaccardComputerHook {
+        const uint8_t *a;
+        size_t n;
+
+        JaccardComputerHook () {}
+
+        JaccardComputerHook (const uint8_t *a8, int code_size) {
+            set (a8, code_size);
+        }
+
+        void set (const uint8_t *a8, int code_size) {
+            a = a8;
+            n = code_size;
+        }
+
+        inline float compute (const uint8_t *b8) const {
+            int accu_num, accu_den;
+            bvec_jaccard (a, b8, n, &accu_num, &accu_den);
+            if (accu_num == 0)
+                return 1.0;
+            return 1.0 - (float)(accu_num) / (float)(accu_den);
+        }
+    };
+
+    struct SubstructureComputerHook {
+        const uint8_t *a;
+        size_t n;
+
+        SubstructureComputerHook () {}
+
+        SubstructureComputerHook (const uint8_t *a8, int code_size) {
+            set (a8, code_size);
+        }
+
+        void set (const uint8_t *a8, int code_size) {
+            a = a8;
+            n = code_size;
+        }
+
+        inline bool compute (const uint8_t *b8) const {
+            return bvec_contains (a, b8, n);
+        }
+    };
+
+    struct SuperstructureComputerHook {
+        const uint8_t *a;
+        size_t n;
+
+        SuperstructureComputerHook () {}
+
+        SuperstructureComputerHook (const uint8_t *a8, int code_size) {
+            set (a8, code_size);
+        }
+
+        void set (const uint8_t *a8, int code_size) {
+            a = a8;
+            n = code_size;
+        }
+
+        inline bool compute (const uint8_t *b8) const {
+            return bvec_contains (b8, a, n);
+        }
+    };
+
 } // namespace faiss
 
 #include <faiss/utils/jaccard-inl.h>
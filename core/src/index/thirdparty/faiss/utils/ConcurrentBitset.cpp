@@ -20,14 +20,60 @@
 
 namespace faiss {
 
+FrozenBitset::FrozenBitset(const uint8_t* data, size_t capacity)
+    : capacity_(capacity), words_((capacity + 64 - 1) >> 6, 0) {
+    size_t n8 = (capacity + 8 - 1) >> 3;
+    memcpy(words_.data(), data, n8);
+
+    // bits past capacity are never tested, drop them so that any() and count() stay exact
+    size_t tail = capacity & 63;
+    if (tail != 0) {
+        words_.back() &= (uint64_t(1) << tail) - 1;
+    }
+
+    for (auto word : words_) {
+        count_ += __builtin_popcountll(word);
+    }
+}
+
+bool
+FrozenBitset::any(id_type_t begin, id_type_t end) const {
+    if (count_ == 0 || begin >= end) {
+        return false;
+    }
+
+    id_type_t first = begin >> 6;
+    id_type_t last = (end - 1) >> 6;
+    uint64_t head_mask = ~uint64_t(0) << (begin & 63);
+    uint64_t tail_mask = ~uint64_t(0) >> (63 - ((end - 1) & 63));
+
+    if (first == last) {
+        return (words_[first] & head_mask & tail_mask) != 0;
+    }
+    if (words_[first] & head_mask) {
+        return true;
+    }
+    for (id_type_t i = first + 1; i < last; i++) {
+        if (words_[i]) {
+            return true;
+        }
+    }
+    return (words_[last] & tail_mask) != 0;
+}
+
 ConcurrentBitset::ConcurrentBitset(id_type_t capacity, uint8_t init_value) : capacity_(capacity), bitset_(((capacity + 8 - 1) >> 3)) {
     if (init_value) {
-        memset(mutable_data(), init_value, (capacity + 8 - 1) >> 3);
+        memset(bitset_.data(), init_value, (capacity + 8 - 1) >> 3);
     }
 }
 
+ConcurrentBitset::ConcurrentBitset(id_type_t capacity, const uint8_t* data) : capacity_(capacity), bitset_(((capacity + 8 - 1) >> 3)) {
+    memcpy(bitset_.data(), data, (capacity + 8 - 1) >> 3);
+}
+
 std::vector<std::atomic<uint8_t>>&
 ConcurrentBitset::bitset() {
+    open_for_write();
     return bitset_;
 }
 
@@ -56,6 +102,7 @@ ConcurrentBitset::operator&=(ConcurrentBitset& bitset) {
         u8_1[i] &= u8_2[i];
     }
 
+    invalidate_frozen();
     return *this;
 }
 
@@ -105,7 +152,7 @@ ConcurrentBitset::operator|=(ConcurrentBitset& bitset) {
     size_t n64 = n8 / 8;
 
     for (size_t i = 0; i < n64; i++) {
-        u64_1[i] &= u64_2[i];
+        u64_1[i] |= u64_2[i];
     }
 
     size_t remain = n8 % 8;
@@ -115,6 +162,7 @@ ConcurrentBitset::operator|=(ConcurrentBitset& bitset) {
         u8_1[i] |= u8_2[i];
     }
 
+    invalidate_frozen();
     return *this;
 }
 
@@ -134,7 +182,7 @@ ConcurrentBitset::operator|(std::shared_ptr<ConcurrentBitset>& bitset) {
     size_t n64 = n8 / 8;
 
     for (size_t i = 0; i < n64; i++) {
-        result_64[i] = u64_1[i] & u64_2[i];
+        result_64[i] = u64_1[i] | u64_2[i];
     }
 
     size_t remain = n8 % 8;
@@ -163,7 +211,7 @@ ConcurrentBitset::operator^=(ConcurrentBitset& bitset) {
     size_t n64 = n8 / 8;
 
     for (size_t i = 0; i < n64; i++) {
-        u64_1[i] &= u64_2[i];
+        u64_1[i] ^= u64_2[i];
     }
 
     size_t remain = n8 % 8;
@@ -173,6 +221,7 @@ ConcurrentBitset::operator^=(ConcurrentBitset& bitset) {
         u8_1[i] ^= u8_2[i];
     }
 
+    invalidate_frozen();
     return *this;
 }
 
@@ -184,11 +233,13 @@ ConcurrentBitset::test(id_type_t id) {
 void
 ConcurrentBitset::set(id_type_t id) {
     bitset_[id >> 3].fetch_or(0x1 << (id & 0x7));
+    invalidate_frozen();
 }
 
 void
 ConcurrentBitset::clear(id_type_t id) {
     bitset_[id >> 3].fetch_and(~(0x1 << (id & 0x7)));
+    invalidate_frozen();
 }
 
 size_t
@@ -208,6 +259,22 @@ ConcurrentBitset::data() {
 
 uint8_t*
 ConcurrentBitset::mutable_data() {
+    open_for_write();
     return reinterpret_cast<uint8_t*>(bitset_.data());
 }
+
+FrozenBitsetPtr
+ConcurrentBitset::frozen() {
+    if (open_for_write_.load(std::memory_order_acquire)) {
+        // the caller of mutable_data() or bitset() may write at any time, a cached snapshot could go stale unnoticed
+        return std::make_shared<FrozenBitset>(data(), capacity_);
+    }
+
+    std::lock_guard<std::mutex> lock(frozen_mutex_);
+    // mark valid before copying, a writer racing with the copy flips it back after its write
+    if (!frozen_valid_.exchange(true, std::memory_order_acq_rel) || frozen_ == nullptr) {
+        frozen_ = std::make_shared<FrozenBitset>(data(), capacity_);
+    }
+    return frozen_;
+}
 }  // namespace faiss
@@ -18,17 +18,72 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace faiss {
 
+/** Read-only snapshot of a ConcurrentBitset packed into 64-bit words.
+ *
+ * Search kernels test ids against the snapshot with plain loads instead of
+ * an atomic load per id, and skip whole words of ids when none of their bits
+ * is set. A snapshot never changes once built; ConcurrentBitset::frozen()
+ * hands out a new one after the bitset has been modified. */
+class FrozenBitset {
+ public:
+    using id_type_t = int64_t;
+
+    FrozenBitset(const uint8_t* data, size_t capacity);
+
+    inline bool
+    test(id_type_t id) const {
+        return (words_[id >> 6] >> (id & 63)) & 1;
+    }
+
+    /// true if any id in [begin, end) is set
+    bool
+    any(id_type_t begin, id_type_t end) const;
+
+    /// true if no id is set at all
+    bool
+    none() const {
+        return count_ == 0;
+    }
+
+    size_t
+    count() const {
+        return count_;
+    }
+
+    size_t
+    capacity() const {
+        return capacity_;
+    }
+
+    const uint64_t*
+    words() const {
+        return words_.data();
+    }
+
+ private:
+    size_t capacity_;
+    size_t count_ = 0;
+    std::vector<uint64_t> words_;
+};
+
+using FrozenBitsetPtr = std::shared_ptr<const FrozenBitset>;
+
 class ConcurrentBitset {
  public:
     using id_type_t = int64_t;
 
     explicit ConcurrentBitset(id_type_t size, uint8_t init_value = 0);
 
+    /// copy of size bits packed in bytes, for bitsets built outside instead of through mutable_data()
+    ConcurrentBitset(id_type_t size, const uint8_t* data);
+
     //    ConcurrentBitset(const ConcurrentBitset&) = delete;
     //    ConcurrentBitset&
     //    operator=(const ConcurrentBitset&) = delete;
@@ -72,11 +127,46 @@ class ConcurrentBitset {
     uint8_t*
     mutable_data();
 
+    /// read-only snapshot of the current bits, rebuilt on first call after a modification.
+    /// Once mutable_data() or bitset() has handed out write access, every call builds a new snapshot.
+    FrozenBitsetPtr
+    frozen();
+
+ private:
+    // called after each write
+    void
+    invalidate_frozen() {
+        frozen_valid_.store(false, std::memory_order_release);
+    }
+
+    void
+    open_for_write() {
+        open_for_write_.store(true, std::memory_order_release);
+        std::lock_guard<std::mutex> lock(frozen_mutex_);
+        frozen_ = nullptr;
+    }
+
  private:
     size_t capacity_;
     std::vector<std::atomic<uint8_t>> bitset_;
+
+    std::mutex frozen_mutex_;
+    std::atomic<bool> frozen_valid_{false};
+    std::atomic<bool> open_for_write_{false};
+    FrozenBitsetPtr frozen_;
 };
 
 using ConcurrentBitsetPtr = std::shared_ptr<ConcurrentBitset>;
 
+/// snapshot of a search blacklist, nullptr when no id is blacklisted so that
+/// search kernels can drop the per-id test altogether
+inline FrozenBitsetPtr
+frozen_blacklist(const ConcurrentBitsetPtr& bitset) {
+    if (bitset == nullptr) {
+        return nullptr;
+    }
+    auto frozen = bitset->frozen();
+    return frozen->none() ? nullptr : frozen;
+}
+
 }  // namespace faiss
@@ -0,0 +1,25 @@
+// -*- c++ -*-
+
+/* Popcount kernels for binary codes.
+ * The actual functions are implemented in binary_distances_simd_avx.cpp */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace faiss {
+
+/// number of differing bits, for HAMMING
+int
+bvec_hamming_avx(const uint8_t* a, const uint8_t* b, size_t n);
+
+/// bits set in a & b and in a | b, for JACCARD and TANIMOTO
+void
+bvec_jaccard_avx(const uint8_t* a, const uint8_t* b, size_t n, int* num, int* den);
+
+/// whether every bit of a is set in b, for SUBSTRUCTURE and SUPERSTRUCTURE
+bool
+bvec_contains_avx(const uint8_t* a, const uint8_t* b, size_t n);
+
+} // namespace faiss
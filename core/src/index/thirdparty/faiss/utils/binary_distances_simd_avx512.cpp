@@ -0,0 +1,91 @@
+// -*- c++ -*-
+
+#include <faiss/utils/binary_distances_avx512.h>
+#include <faiss/impl/FaissAssert.h>
+
+#include <immintrin.h>
+
+namespace faiss {
+
+#if (defined(__AVX512F__) && defined(__AVX512BW__))
+
+/* VPOPCNTDQ is newer than the rest of AVX-512 here, so only these kernels
+ * are built for it, and the hook picks them when the CPU reports it.
+ * The last partial 64 bytes are read with a byte mask. */
+#define BVEC_TARGET __attribute__((target("avx512vpopcntdq")))
+
+static inline __mmask64 tail_mask (size_t n) {
+    return n >= 64 ? ~(__mmask64)0 : (((__mmask64)1 << n) - 1);
+}
+
+BVEC_TARGET
+int
+bvec_hamming_avx512(const uint8_t* a, const uint8_t* b, size_t n) {
+    __m512i total = _mm512_setzero_si512();
+
+    for (size_t i = 0; i < n; i += 64) {
+        const __mmask64 mask = tail_mask(n - i);
+        __m512i x = _mm512_maskz_loadu_epi8(mask, a + i);
+        __m512i y = _mm512_maskz_loadu_epi8(mask, b + i);
+        total = _mm512_add_epi64(total, _mm512_popcnt_epi64(_mm512_xor_si512(x, y)));
+    }
+
+    return (int)_mm512_reduce_add_epi64(total);
+}
+
+BVEC_TARGET
+void
+bvec_jaccard_avx512(const uint8_t* a, const uint8_t* b, size_t n, int* num, int* den) {
+    __m512i total_and = _mm512_setzero_si512();
+    __m512i total_or = _mm512_setzero_si512();
+
+    for (size_t i = 0; i < n; i += 64) {
+        const __mmask64 mask = tail_mask(n - i);
+        __m512i x = _mm512_maskz_loadu_epi8(mask, a + i);
+        __m512i y = _mm512_maskz_loadu_epi8(mask, b + i);
+        total_and = _mm512_add_epi64(total_and, _mm512_popcnt_epi64(_mm512_and_si512(x, y)));
+        total_or = _mm512_add_epi64(total_or, _mm512_popcnt_epi64(_mm512_or_si512(x, y)));
+    }
+
+    *num = (int)_mm512_reduce_add_epi64(total_and);
+    *den = (int)_mm512_reduce_add_epi64(total_or);
+}
+
+bool
+bvec_contains_avx512(const uint8_t* a, const uint8_t* b, size_t n) {
+    for (size_t i = 0; i < n; i += 64) {
+        const __mmask64 mask = tail_mask(n - i);
+        __m512i x = _mm512_maskz_loadu_epi8(mask, a + i);
+        __m512i y = _mm512_maskz_loadu_epi8(mask, b + i);
+        // bits of a missing from b
+        if (_mm512_test_epi64_mask(_mm512_andnot_si512(y, x), _mm512_andnot_si512(y, x))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#undef BVEC_TARGET
+
+#else
+
+int
+bvec_hamming_avx512(const uint8_t* a, const uint8_t* b, size_t n) {
+    FAISS_ASSERT(false);
+    return 0;
+}
+
+void
+bvec_jaccard_avx512(const uint8_t* a, const uint8_t* b, size_t n, int* num, int* den) {
+    FAISS_ASSERT(false);
+}
+
+bool
+bvec_contains_avx512(const uint8_t* a, const uint8_t* b, size_t n) {
+    FAISS_ASSERT(false);
+    return false;
+}
+
+#endif
+
+} // namespace faiss
@@ -148,7 +148,8 @@ static void knn_inner_product_sse (const float * x,
                         const float * y,
                         size_t d, size_t nx, size_t ny,
                         float_minheap_array_t * res,
-                        ConcurrentBitsetPtr bitset = nullptr)
+                        const FrozenBitset * bitset = nullptr,
+                        const float * heap_thresholds = nullptr)
 {
     size_t k = res->k;
 
@@ -161,7 +162,8 @@ static void knn_inner_product_sse (const float * x,
 
     // init heap
     for (size_t i = 0; i < all_heap_size; i++) {
-        value[i] = -1.0 / 0.0;
+        value[i] = heap_thresholds ?
+                   heap_thresholds[(i % thread_heap_size) / k] : -1.0 / 0.0;
         labels[i] = -1;
     }
 
@@ -253,7 +255,8 @@ static void knn_L2sqr_sse (
                 const float * y,
                 size_t d, size_t nx, size_t ny,
                 float_maxheap_array_t * res,
-                ConcurrentBitsetPtr bitset = nullptr)
+                const FrozenBitset * bitset = nullptr,
+                const float * heap_thresholds = nullptr)
 {
     size_t k = res->k;
 
@@ -266,7 +269,8 @@ static void knn_L2sqr_sse (
 
     // init heap
     for (size_t i = 0; i < all_heap_size; i++) {
-        value[i] = 1.0 / 0.0;
+        value[i] = heap_thresholds ?
+                   heap_thresholds[(i % thread_heap_size) / k] : 1.0 / 0.0;
         labels[i] = -1;
     }
 
@@ -352,15 +356,32 @@ static void knn_L2sqr_sse (
     */
 }
 
+/** start every heap of res from the k-th distance of its query instead of
+ * the neutral value, only the results that beat it are kept */
+template <class C>
+static void init_heap_thresholds (HeapArray<C> * res,
+                                  const float * heap_thresholds)
+{
+    if (!heap_thresholds) return;
+    for (size_t i = 0; i < res->nh; i++) {
+        float * simi = res->get_val (i);
+        for (size_t j = 0; j < res->k; j++) {
+            simi[j] = heap_thresholds[i];
+        }
+    }
+}
+
 /** Find the nearest neighbors for nx queries in a set of ny vectors */
 static void knn_inner_product_blas (
         const float * x,
         const float * y,
         size_t d, size_t nx, size_t ny,
         float_minheap_array_t * res,
-        ConcurrentBitsetPtr bitset = nullptr)
+        const FrozenBitset * bitset = nullptr,
+        const float * heap_thresholds = nullptr)
 {
     res->heapify ();
+    init_heap_thresholds (res, heap_thresholds);
 
     // BLAS does not like empty matrices
     if (nx == 0 || ny == 0) return;
@@ -390,7 +411,9 @@ static void knn_inner_product_blas (
                         ip_block, &nyi);
             }
 
-            /* collect maxima */
+            /* collect maxima, skip the blacklist test for blocks without deleted ids */
+            const FrozenBitset * block_bitset =
+                (bitset && bitset->any(j0, j1)) ? bitset : nullptr;
 #pragma omp parallel for
             for(size_t i = i0; i < i1; i++){
                 float * __restrict simi = res->get_val(i);
@@ -398,7 +421,7 @@ static void knn_inner_product_blas (
                 const float *ip_line = ip_block + (i - i0) * (j1 - j0);
 
                 for(size_t j = j0; j < j1; j++){
-                    if(!bitset || !bitset->test(j)){
+                    if(!block_bitset || !block_bitset->test(j)){
                         float dis = *ip_line;
 
                         if(dis > simi[0]){
@@ -422,9 +445,11 @@ static void knn_L2sqr_blas (const float * x,
         size_t d, size_t nx, size_t ny,
         float_maxheap_array_t * res,
         const DistanceCorrection &corr,
-        ConcurrentBitsetPtr bitset = nullptr)
+        const FrozenBitset * bitset = nullptr,
+        const float * heap_thresholds = nullptr)
 {
     res->heapify ();
+    init_heap_thresholds (res, heap_thresholds);
 
     // BLAS does not like empty matrices
     if (nx == 0 || ny == 0) return;
@@ -460,7 +485,9 @@ static void knn_L2sqr_blas (const float * x,
                         ip_block, &nyi);
             }
 
-            /* collect minima */
+            /* collect minima, skip the blacklist test for blocks without deleted ids */
+            const FrozenBitset * block_bitset =
+                (bitset && bitset->any(j0, j1)) ? bitset : nullptr;
 #pragma omp parallel for
             for (size_t i = i0; i < i1; i++) {
                 float * __restrict simi = res->get_val(i);
@@ -468,7 +495,7 @@ static void knn_L2sqr_blas (const float * x,
                 const float *ip_line = ip_block + (i - i0) * (j1 - j0);
 
                 for (size_t j = j0; j < j1; j++) {
-                    if(!bitset || !bitset->test(j)){
+                    if(!block_bitset || !block_bitset->test(j)){
                         float ip = *ip_line;
                         float dis = x_norms[i] + y_norms[j] - 2 * ip;
 
@@ -498,7 +525,7 @@ static void knn_jaccard_blas (const float * x,
                               size_t d, size_t nx, size_t ny,
                               float_maxheap_array_t * res,
                               const DistanceCorrection &corr,
-                              ConcurrentBitsetPtr bitset = nullptr)
+                              const FrozenBitset * bitset = nullptr)
 {
     res->heapify ();
 
@@ -536,7 +563,9 @@ static void knn_jaccard_blas (const float * x,
                         ip_block, &nyi);
             }
 
-            /* collect minima */
+            /* collect minima, skip the blacklist test for blocks without deleted ids */
+            const FrozenBitset * block_bitset =
+                (bitset && bitset->any(j0, j1)) ? bitset : nullptr;
 #pragma omp parallel for
             for (size_t i = i0; i < i1; i++) {
                 float * __restrict simi = res->get_val(i);
@@ -544,7 +573,7 @@ static void knn_jaccard_blas (const float * x,
                 const float *ip_line = ip_block + (i - i0) * (j1 - j0);
 
                 for (size_t j = j0; j < j1; j++) {
-                    if(!bitset || !bitset->test(j)){
+                    if(!block_bitset || !block_bitset->test(j)){
                         float ip = *ip_line;
                         float dis = 1.0 - ip / (x_norms[i] + y_norms[j] - ip);
 
@@ -583,12 +612,15 @@ void knn_inner_product (const float * x,
         const float * y,
         size_t d, size_t nx, size_t ny,
         float_minheap_array_t * res,
-        ConcurrentBitsetPtr bitset)
+        ConcurrentBitsetPtr bitset,
+        const float * heap_thresholds)
 {
+    // one read-only snapshot for the whole search, the kernels test it with plain loads
+    auto frozen = frozen_blacklist(bitset);
     if (nx < distance_compute_blas_threshold) {
-        knn_inner_product_sse (x, y, d, nx, ny, res, bitset);
+        knn_inner_product_sse (x, y, d, nx, ny, res, frozen.get(), heap_thresholds);
     } else {
-        knn_inner_product_blas (x, y, d, nx, ny, res, bitset);
+        knn_inner_product_blas (x, y, d, nx, ny, res, frozen.get(), heap_thresholds);
     }
 }
 
@@ -604,13 +636,15 @@ void knn_L2sqr (const float * x,
                 const float * y,
                 size_t d, size_t nx, size_t ny,
                 float_maxheap_array_t * res,
-                ConcurrentBitsetPtr bitset)
+                ConcurrentBitsetPtr bitset,
+                const float * heap_thresholds)
 {
+    auto frozen = frozen_blacklist(bitset);
     if (nx < distance_compute_blas_threshold) {
-        knn_L2sqr_sse (x, y, d, nx, ny, res, bitset);
+        knn_L2sqr_sse (x, y, d, nx, ny, res, frozen.get(), heap_thresholds);
     } else {
         NopDistanceCorrection nop;
-        knn_L2sqr_blas (x, y, d, nx, ny, res, nop, bitset);
+        knn_L2sqr_blas (x, y, d, nx, ny, res, nop, frozen.get(), heap_thresholds);
     }
 }
 
@@ -620,12 +654,13 @@ void knn_jaccard (const float * x,
                   float_maxheap_array_t * res,
                   ConcurrentBitsetPtr bitset)
 {
+    auto frozen = frozen_blacklist(bitset);
     if (d % 4 == 0 && nx < distance_compute_blas_threshold) {
 //        knn_jaccard_sse (x, y, d, nx, ny, res);
         printf("jaccard sse not implemented!\n");
     } else {
         NopDistanceCorrection nop;
-        knn_jaccard_blas (x, y, d, nx, ny, res, nop, bitset);
+        knn_jaccard_blas (x, y, d, nx, ny, res, nop, frozen.get());
     }
 }
 
@@ -164,13 +164,17 @@ extern int distance_compute_blas_threshold;
  * @param x    query vectors, size nx * d
  * @param y    database vectors, size ny * d
  * @param res  result array, which also provides k. Sorted on output
+ * @param heap_thresholds  optional, size nx. Only the results better than
+ *                         the threshold of their query are returned, the
+ *                         missing ones have label -1
  */
 void knn_inner_product (
         const float * x,
         const float * y,
         size_t d, size_t nx, size_t ny,
         float_minheap_array_t * res,
-        ConcurrentBitsetPtr bitset = nullptr);
+        ConcurrentBitsetPtr bitset = nullptr,
+        const float * heap_thresholds = nullptr);
 
 /** Same as knn_inner_product, for the L2 distance */
 void knn_L2sqr (
@@ -178,7 +182,8 @@ void knn_L2sqr (
         const float * y,
         size_t d, size_t nx, size_t ny,
         float_maxheap_array_t * res,
-        ConcurrentBitsetPtr bitset = nullptr);
+        ConcurrentBitsetPtr bitset = nullptr,
+        const float * heap_thresholds = nullptr);
 
 void knn_jaccard (
         const float * x,
@@ -29,4 +29,13 @@ fvec_L1_avx(const float* x, const float* y, size_t d);
 float
 fvec_Linf_avx(const float* x, const float* y, size_t d);
 
+typedef float (*fvec_func_ptr)(const float*, const float*, size_t);
+
+/// L2 and IP unrolled for a fixed d (128, 256, 512 or 768), nullptr for any other d
+fvec_func_ptr
+fvec_L2sqr_fixed_avx(size_t d);
+
+fvec_func_ptr
+fvec_inner_product_fixed_avx(size_t d);
+
 } // namespace faiss
@@ -186,6 +186,69 @@ float fvec_Linf_avx (const float* x, const float* y, size_t d) {
     return  _mm_cvtss_f32 (msum2);
 }
 
+/* D is a multiple of 32, four accumulators hide the add latency */
+template <size_t D>
+static float fvec_L2sqr_fixed_avx_impl (const float* x, const float* y, size_t) {
+    __m256 msum0 = _mm256_setzero_ps(), msum1 = _mm256_setzero_ps();
+    __m256 msum2 = _mm256_setzero_ps(), msum3 = _mm256_setzero_ps();
+
+    for (size_t i = 0; i < D; i += 32) {
+        const __m256 a_m_b0 = _mm256_loadu_ps (x + i) - _mm256_loadu_ps (y + i);
+        const __m256 a_m_b1 = _mm256_loadu_ps (x + i + 8) - _mm256_loadu_ps (y + i + 8);
+        const __m256 a_m_b2 = _mm256_loadu_ps (x + i + 16) - _mm256_loadu_ps (y + i + 16);
+        const __m256 a_m_b3 = _mm256_loadu_ps (x + i + 24) - _mm256_loadu_ps (y + i + 24);
+        msum0 += a_m_b0 * a_m_b0;
+        msum1 += a_m_b1 * a_m_b1;
+        msum2 += a_m_b2 * a_m_b2;
+        msum3 += a_m_b3 * a_m_b3;
+    }
+
+    msum0 = (msum0 + msum1) + (msum2 + msum3);
+    __m128 msum = _mm256_extractf128_ps(msum0, 1) + _mm256_extractf128_ps(msum0, 0);
+    msum = _mm_hadd_ps (msum, msum);
+    msum = _mm_hadd_ps (msum, msum);
+    return  _mm_cvtss_f32 (msum);
+}
+
+template <size_t D>
+static float fvec_inner_product_fixed_avx_impl (const float* x, const float* y, size_t) {
+    __m256 msum0 = _mm256_setzero_ps(), msum1 = _mm256_setzero_ps();
+    __m256 msum2 = _mm256_setzero_ps(), msum3 = _mm256_setzero_ps();
+
+    for (size_t i = 0; i < D; i += 32) {
+        msum0 += _mm256_loadu_ps (x + i) * _mm256_loadu_ps (y + i);
+        msum1 += _mm256_loadu_ps (x + i + 8) * _mm256_loadu_ps (y + i + 8);
+        msum2 += _mm256_loadu_ps (x + i + 16) * _mm256_loadu_ps (y + i + 16);
+        msum3 += _mm256_loadu_ps (x + i + 24) * _mm256_loadu_ps (y + i + 24);
+    }
+
+    msum0 = (msum0 + msum1) + (msum2 + msum3);
+    __m128 msum = _mm256_extractf128_ps(msum0, 1) + _mm256_extractf128_ps(msum0, 0);
+    msum = _mm_hadd_ps (msum, msum);
+    msum = _mm_hadd_ps (msum, msum);
+    return  _mm_cvtss_f32 (msum);
+}
+
+fvec_func_ptr fvec_L2sqr_fixed_avx (size_t d) {
+    switch (d) {
+        case 128: return fvec_L2sqr_fixed_avx_impl<128>;
+        case 256: return fvec_L2sqr_fixed_avx_impl<256>;
+        case 512: return fvec_L2sqr_fixed_avx_impl<512>;
+        case 768: return fvec_L2sqr_fixed_avx_impl<768>;
+        default: return nullptr;
+    }
+}
+
+fvec_func_ptr fvec_inner_product_fixed_avx (size_t d) {
+    switch (d) {
+        case 128: return fvec_inner_product_fixed_avx_impl<128>;
+        case 256: return fvec_inner_product_fixed_avx_impl<256>;
+        case 512: return fvec_inner_product_fixed_avx_impl<512>;
+        case 768: return fvec_inner_product_fixed_avx_impl<768>;
+        default: return nullptr;
+    }
+}
+
 #else
 
 float fvec_inner_product_avx(const float* x, const float* y, size_t d) {
@@ -208,6 +271,14 @@ float fvec_Linf_avx (const float* x, const float* y, size_t d) {
     return 0.0;
 }
 
+fvec_func_ptr fvec_L2sqr_fixed_avx (size_t d) {
+    return nullptr;
+}
+
+fvec_func_ptr fvec_inner_product_fixed_avx (size_t d) {
+    return nullptr;
+}
+
 #endif
 
 } // namespace faiss
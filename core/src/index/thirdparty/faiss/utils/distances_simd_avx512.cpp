@@ -219,6 +219,65 @@ fvec_Linf_avx512(const float* x, const float* y, size_t d) {
     return  _mm_cvtss_f32 (msum2);
 }
 
+/* D is a multiple of 64, four accumulators hide the fma latency */
+template <size_t D>
+static float
+fvec_L2sqr_fixed_avx512_impl(const float* x, const float* y, size_t) {
+    __m512 msum0 = _mm512_setzero_ps(), msum1 = _mm512_setzero_ps();
+    __m512 msum2 = _mm512_setzero_ps(), msum3 = _mm512_setzero_ps();
+
+    for (size_t i = 0; i < D; i += 64) {
+        const __m512 a_m_b0 = _mm512_loadu_ps (x + i) - _mm512_loadu_ps (y + i);
+        const __m512 a_m_b1 = _mm512_loadu_ps (x + i + 16) - _mm512_loadu_ps (y + i + 16);
+        const __m512 a_m_b2 = _mm512_loadu_ps (x + i + 32) - _mm512_loadu_ps (y + i + 32);
+        const __m512 a_m_b3 = _mm512_loadu_ps (x + i + 48) - _mm512_loadu_ps (y + i + 48);
+        msum0 = _mm512_fmadd_ps (a_m_b0, a_m_b0, msum0);
+        msum1 = _mm512_fmadd_ps (a_m_b1, a_m_b1, msum1);
+        msum2 = _mm512_fmadd_ps (a_m_b2, a_m_b2, msum2);
+        msum3 = _mm512_fmadd_ps (a_m_b3, a_m_b3, msum3);
+    }
+
+    return _mm512_reduce_add_ps ((msum0 + msum1) + (msum2 + msum3));
+}
+
+template <size_t D>
+static float
+fvec_inner_product_fixed_avx512_impl(const float* x, const float* y, size_t) {
+    __m512 msum0 = _mm512_setzero_ps(), msum1 = _mm512_setzero_ps();
+    __m512 msum2 = _mm512_setzero_ps(), msum3 = _mm512_setzero_ps();
+
+    for (size_t i = 0; i < D; i += 64) {
+        msum0 = _mm512_fmadd_ps (_mm512_loadu_ps (x + i), _mm512_loadu_ps (y + i), msum0);
+        msum1 = _mm512_fmadd_ps (_mm512_loadu_ps (x + i + 16), _mm512_loadu_ps (y + i + 16), msum1);
+        msum2 = _mm512_fmadd_ps (_mm512_loadu_ps (x + i + 32), _mm512_loadu_ps (y + i + 32), msum2);
+        msum3 = _mm512_fmadd_ps (_mm512_loadu_ps (x + i + 48), _mm512_loadu_ps (y + i + 48), msum3);
+    }
+
+    return _mm512_reduce_add_ps ((msum0 + msum1) + (msum2 + msum3));
+}
+
+fvec_func_ptr
+fvec_L2sqr_fixed_avx512(size_t d) {
+    switch (d) {
+        case 128: return fvec_L2sqr_fixed_avx512_impl<128>;
+        case 256: return fvec_L2sqr_fixed_avx512_impl<256>;
+        case 512: return fvec_L2sqr_fixed_avx512_impl<512>;
+        case 768: return fvec_L2sqr_fixed_avx512_impl<768>;
+        default: return nullptr;
+    }
+}
+
+fvec_func_ptr
+fvec_inner_product_fixed_avx512(size_t d) {
+    switch (d) {
+        case 128: return fvec_inner_product_fixed_avx512_impl<128>;
+        case 256: return fvec_inner_product_fixed_avx512_impl<256>;
+        case 512: return fvec_inner_product_fixed_avx512_impl<512>;
+        case 768: return fvec_inner_product_fixed_avx512_impl<768>;
+        default: return nullptr;
+    }
+}
+
 #else
 
 float
@@ -245,6 +304,16 @@ fvec_Linf_avx512(const float* x, const float* y, size_t d) {
     return 0.0;
 }
 
+fvec_func_ptr
+fvec_L2sqr_fixed_avx512(size_t d) {
+    return nullptr;
+}
+
+fvec_func_ptr
+fvec_inner_product_fixed_avx512(size_t d) {
+    return nullptr;
+}
+
 #endif
 
 } // namespace faiss
@@ -0,0 +1,171 @@
+
+// -*- c++ -*-
+
+#include <faiss/utils/half_precision.h>
+
+#include <cstring>
+
+namespace faiss {
+
+uint16_t
+fp32_to_fp16(float f) {
+    uint32_t x;
+    memcpy(&x, &f, sizeof(x));
+
+    uint32_t sign = (x >> 16) & 0x8000;
+    uint32_t biased = (x >> 23) & 0xff;
+    uint32_t mant = x & 0x7fffff;
+
+    if (biased == 0xff) {
+        // inf stays inf, nan stays a quiet nan
+        return sign | 0x7c00 | (mant ? 0x200 : 0);
+    }
+
+    int32_t exp = (int32_t)biased - 127 + 15;
+    if (exp >= 0x1f) {
+        return sign | 0x7c00;
+    }
+
+    if (exp <= 0) {
+        // subnormal half, or zero if too small
+        if (exp < -10) {
+            return sign;
+        }
+        mant |= 0x800000;
+        uint32_t shift = 14 - exp;
+        uint32_t half = mant >> shift;
+        uint32_t rem = mant & ((1u << shift) - 1);
+        uint32_t mid = 1u << (shift - 1);
+        if (rem > mid || (rem == mid && (half & 1))) {
+            half++;
+        }
+        return sign | half;
+    }
+
+    // a carry out of the mantissa correctly bumps the exponent, up to inf
+    uint32_t half = ((uint32_t)exp << 10) | (mant >> 13);
+    uint32_t rem = mant & 0x1fff;
+    if (rem > 0x1000 || (rem == 0x1000 && (half & 1))) {
+        half++;
+    }
+    return sign | half;
+}
+
+float
+fp16_to_fp32(uint16_t h) {
+    uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+    int32_t exp = (h >> 10) & 0x1f;
+    uint32_t mant = h & 0x3ff;
+
+    uint32_t x;
+    if (exp == 0x1f) {
+        x = sign | 0x7f800000 | (mant << 13);
+    } else if (exp == 0) {
+        if (mant == 0) {
+            x = sign;
+        } else {
+            // normalize the subnormal half
+            exp = 1;
+            while (!(mant & 0x400)) {
+                mant <<= 1;
+                exp--;
+            }
+            mant &= 0x3ff;
+            x = sign | ((uint32_t)(exp + 127 - 15) << 23) | (mant << 13);
+        }
+    } else {
+        x = sign | ((uint32_t)(exp + 127 - 15) << 23) | (mant << 13);
+    }
+
+    float f;
+    memcpy(&f, &x, sizeof(f));
+    return f;
+}
+
+uint16_t
+fp32_to_bf16(float f) {
+    uint32_t x;
+    memcpy(&x, &f, sizeof(x));
+    if ((x & 0x7fffffff) > 0x7f800000) {
+        // keep nan a nan after truncation
+        return (x >> 16) | 0x40;
+    }
+    uint32_t rounding = 0x7fff + ((x >> 16) & 1);
+    return (x + rounding) >> 16;
+}
+
+float
+bf16_to_fp32(uint16_t h) {
+    uint32_t x = (uint32_t)h << 16;
+    float f;
+    memcpy(&f, &x, sizeof(f));
+    return f;
+}
+
+void
+fvec_to_fp16(const float* x, uint16_t* y, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        y[i] = fp32_to_fp16(x[i]);
+    }
+}
+
+void
+fp16_to_fvec(const uint16_t* x, float* y, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        y[i] = fp16_to_fp32(x[i]);
+    }
+}
+
+void
+fvec_to_bf16(const float* x, uint16_t* y, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        y[i] = fp32_to_bf16(x[i]);
+    }
+}
+
+void
+bf16_to_fvec(const uint16_t* x, float* y, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        y[i] = bf16_to_fp32(x[i]);
+    }
+}
+
+float
+fvec_L2sqr_fp16_ref(const float* x, const uint16_t* y, size_t d) {
+    float res = 0;
+    for (size_t i = 0; i < d; i++) {
+        float tmp = x[i] - fp16_to_fp32(y[i]);
+        res += tmp * tmp;
+    }
+    return res;
+}
+
+float
+fvec_inner_product_fp16_ref(const float* x, const uint16_t* y, size_t d) {
+    float res = 0;
+    for (size_t i = 0; i < d; i++) {
+        res += x[i] * fp16_to_fp32(y[i]);
+    }
+    return res;
+}
+
+float
+fvec_L2sqr_bf16_ref(const float* x, const uint16_t* y, size_t d) {
+    float res = 0;
+    for (size_t i = 0; i < d; i++) {
+        float tmp = x[i] - bf16_to_fp32(y[i]);
+        res += tmp * tmp;
+    }
+    return res;
+}
+
+float
+fvec_inner_product_bf16_ref(const float* x, const uint16_t* y, size_t d) {
+    float res = 0;
+    for (size_t i = 0; i < d; i++) {
+        res += x[i] * bf16_to_fp32(y[i]);
+    }
+    return res;
+}
+
+} // namespace faiss
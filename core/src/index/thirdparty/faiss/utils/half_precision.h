@@ -0,0 +1,59 @@
+
+// -*- c++ -*-
+
+/* Half precision (IEEE fp16 and bfloat16) storage of float vectors.
+ *
+ * Vectors are stored as uint16_t and compared against float queries, the
+ * conversion is done on the fly by the distance kernels. The SIMD kernels
+ * are implemented in half_precision_avx.cpp / half_precision_avx512.cpp and
+ * selected at runtime through FaissHook. */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace faiss {
+
+uint16_t
+fp32_to_fp16(float f);
+
+float
+fp16_to_fp32(uint16_t h);
+
+uint16_t
+fp32_to_bf16(float f);
+
+float
+bf16_to_fp32(uint16_t h);
+
+/// round-to-nearest-even conversions of n components
+void
+fvec_to_fp16(const float* x, uint16_t* y, size_t n);
+
+void
+fp16_to_fvec(const uint16_t* x, float* y, size_t n);
+
+void
+fvec_to_bf16(const float* x, uint16_t* y, size_t n);
+
+void
+bf16_to_fvec(const uint16_t* x, float* y, size_t n);
+
+/// squared L2 distance between a float vector and a fp16 vector
+float
+fvec_L2sqr_fp16_ref(const float* x, const uint16_t* y, size_t d);
+
+/// inner product between a float vector and a fp16 vector
+float
+fvec_inner_product_fp16_ref(const float* x, const uint16_t* y, size_t d);
+
+/// squared L2 distance between a float vector and a bf16 vector
+float
+fvec_L2sqr_bf16_ref(const float* x, const uint16_t* y, size_t d);
+
+/// inner product between a float vector and a bf16 vector
+float
+fvec_inner_product_bf16_ref(const float* x, const uint16_t* y, size_t d);
+
+} // namespace faiss
@@ -0,0 +1,126 @@
+
+// -*- c++ -*-
+
+#include <faiss/utils/half_precision_avx.h>
+#include <faiss/utils/half_precision.h>
+#include <faiss/impl/FaissAssert.h>
+
+#include <immintrin.h>
+
+namespace faiss {
+
+#if (defined(__AVX2__) && defined(__F16C__))
+
+namespace {
+
+inline __m256
+load_fp16(const uint16_t* y) {
+    return _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)y));
+}
+
+/// bf16 is the upper half of a float, widen and shift
+inline __m256
+load_bf16(const uint16_t* y) {
+    __m256i v = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)y));
+    return _mm256_castsi256_ps(_mm256_slli_epi32(v, 16));
+}
+
+inline float
+reduce_add(__m256 v) {
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    s = _mm_hadd_ps(s, s);
+    s = _mm_hadd_ps(s, s);
+    return _mm_cvtss_f32(s);
+}
+
+} // namespace
+
+float
+fvec_L2sqr_fp16_avx(const float* x, const uint16_t* y, size_t d) {
+    __m256 msum = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= d; i += 8) {
+        __m256 diff = _mm256_sub_ps(_mm256_loadu_ps(x + i), load_fp16(y + i));
+        msum = _mm256_add_ps(msum, _mm256_mul_ps(diff, diff));
+    }
+    float res = reduce_add(msum);
+    for (; i < d; i++) {
+        float tmp = x[i] - fp16_to_fp32(y[i]);
+        res += tmp * tmp;
+    }
+    return res;
+}
+
+float
+fvec_inner_product_fp16_avx(const float* x, const uint16_t* y, size_t d) {
+    __m256 msum = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= d; i += 8) {
+        msum = _mm256_add_ps(msum, _mm256_mul_ps(_mm256_loadu_ps(x + i), load_fp16(y + i)));
+    }
+    float res = reduce_add(msum);
+    for (; i < d; i++) {
+        res += x[i] * fp16_to_fp32(y[i]);
+    }
+    return res;
+}
+
+float
+fvec_L2sqr_bf16_avx(const float* x, const uint16_t* y, size_t d) {
+    __m256 msum = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= d; i += 8) {
+        __m256 diff = _mm256_sub_ps(_mm256_loadu_ps(x + i), load_bf16(y + i));
+        msum = _mm256_add_ps(msum, _mm256_mul_ps(diff, diff));
+    }
+    float res = reduce_add(msum);
+    for (; i < d; i++) {
+        float tmp = x[i] - bf16_to_fp32(y[i]);
+        res += tmp * tmp;
+    }
+    return res;
+}
+
+float
+fvec_inner_product_bf16_avx(const float* x, const uint16_t* y, size_t d) {
+    __m256 msum = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= d; i += 8) {
+        msum = _mm256_add_ps(msum, _mm256_mul_ps(_mm256_loadu_ps(x + i), load_bf16(y + i)));
+    }
+    float res = reduce_add(msum);
+    for (; i < d; i++) {
+        res += x[i] * bf16_to_fp32(y[i]);
+    }
+    return res;
+}
+
+#else
+
+float
+fvec_L2sqr_fp16_avx(const float* x, const uint16_t* y, size_t d) {
+    FAISS_ASSERT(false);
+    return 0.0;
+}
+
+float
+fvec_inner_product_fp16_avx(const float* x, const uint16_t* y, size_t d) {
+    FAISS_ASSERT(false);
+    return 0.0;
+}
+
+float
+fvec_L2sqr_bf16_avx(const float* x, const uint16_t* y, size_t d) {
+    FAISS_ASSERT(false);
+    return 0.0;
+}
+
+float
+fvec_inner_product_bf16_avx(const float* x, const uint16_t* y, size_t d) {
+    FAISS_ASSERT(false);
+    return 0.0;
+}
+
+#endif
+
+} // namespace faiss
@@ -0,0 +1,118 @@
+
+// -*- c++ -*-
+
+#include <faiss/utils/half_precision_avx512.h>
+#include <faiss/utils/half_precision.h>
+#include <faiss/impl/FaissAssert.h>
+
+#include <immintrin.h>
+
+namespace faiss {
+
+#if defined(__AVX512F__)
+
+namespace {
+
+inline __m512
+load_fp16(const uint16_t* y) {
+    return _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)y));
+}
+
+/// bf16 is the upper half of a float, widen and shift
+inline __m512
+load_bf16(const uint16_t* y) {
+    __m512i v = _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i*)y));
+    return _mm512_castsi512_ps(_mm512_slli_epi32(v, 16));
+}
+
+} // namespace
+
+float
+fvec_L2sqr_fp16_avx512(const float* x, const uint16_t* y, size_t d) {
+    __m512 msum = _mm512_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= d; i += 16) {
+        __m512 diff = _mm512_sub_ps(_mm512_loadu_ps(x + i), load_fp16(y + i));
+        msum = _mm512_fmadd_ps(diff, diff, msum);
+    }
+    float res = _mm512_reduce_add_ps(msum);
+    for (; i < d; i++) {
+        float tmp = x[i] - fp16_to_fp32(y[i]);
+        res += tmp * tmp;
+    }
+    return res;
+}
+
+float
+fvec_inner_product_fp16_avx512(const float* x, const uint16_t* y, size_t d) {
+    __m512 msum = _mm512_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= d; i += 16) {
+        msum = _mm512_fmadd_ps(_mm512_loadu_ps(x + i), load_fp16(y + i), msum);
+    }
+    float res = _mm512_reduce_add_ps(msum);
+    for (; i < d; i++) {
+        res += x[i] * fp16_to_fp32(y[i]);
+    }
+    return res;
+}
+
+float
+fvec_L2sqr_bf16_avx512(const float* x, const uint16_t* y, size_t d) {
+    __m512 msum = _mm512_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= d; i += 16) {
+        __m512 diff = _mm512_sub_ps(_mm512_loadu_ps(x + i), load_bf16(y + i));
+        msum = _mm512_fmadd_ps(diff, diff, msum);
+    }
+    float res = _mm512_reduce_add_ps(msum);
+    for (; i < d; i++) {
+        float tmp = x[i] - bf16_to_fp32(y[i]);
+        res += tmp * tmp;
+    }
+    return res;
+}
+
+float
+fvec_inner_product_bf16_avx512(const float* x, const uint16_t* y, size_t d) {
+    __m512 msum = _mm512_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= d; i += 16) {
+        msum = _mm512_fmadd_ps(_mm512_loadu_ps(x + i), load_bf16(y + i), msum);
+    }
+    float res = _mm512_reduce_add_ps(msum);
+    for (; i < d; i++) {
+        res += x[i] * bf16_to_fp32(y[i]);
+    }
+    return res;
+}
+
+#else
+
+float
+fvec_L2sqr_fp16_avx512(const float* x, const uint16_t* y, size_t d) {
+    FAISS_ASSERT(false);
+    return 0.0;
+}
+
+float
+fvec_inner_product_fp16_avx512(const float* x, const uint16_t* y, size_t d) {
+    FAISS_ASSERT(false);
+    return 0.0;
+}
+
+float
+fvec_L2sqr_bf16_avx512(const float* x, const uint16_t* y, size_t d) {
+    FAISS_ASSERT(false);
+    return 0.0;
+}
+
+float
+fvec_inner_product_bf16_avx512(const float* x, const uint16_t* y, size_t d) {
+    FAISS_ASSERT(false);
+    return 0.0;
+}
+
+#endif
+
+} // namespace faiss
@@ -0,0 +1,26 @@
+
+// -*- c++ -*-
+
+/* AVX512 kernels for half precision vectors.
+ * The actual functions are implemented in half_precision_avx512.cpp */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace faiss {
+
+float
+fvec_L2sqr_fp16_avx512(const float* x, const uint16_t* y, size_t d);
+
+float
+fvec_inner_product_fp16_avx512(const float* x, const uint16_t* y, size_t d);
+
+float
+fvec_L2sqr_bf16_avx512(const float* x, const uint16_t* y, size_t d);
+
+float
+fvec_inner_product_bf16_avx512(const float* x, const uint16_t* y, size_t d);
+
+} // namespace faiss
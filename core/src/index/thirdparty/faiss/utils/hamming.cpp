@@ -25,6 +25,7 @@
 */
 
 #include <faiss/utils/hamming.h>
+#include <faiss/utils/BinaryDistance.h>
 
 #include <vector>
 #include <memory>
@@ -43,6 +44,8 @@ static const size_t size_1M = 1 * 1024 * 1024;
 namespace faiss {
 
 size_t hamming_batch_size = 65536;
+/* queries sharing one pass over a batch of database codes */
+static const size_t hamming_query_block_size = 8;
 
 static const uint8_t hamdis_tab_ham_bytes[256] = {
     0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
@@ -338,22 +341,28 @@ void hammings_knn_hc (
     } else {
         if (init_heap) ha->heapify ();
         const size_t block_size = hamming_batch_size;
+        const size_t nqb = (ha->nh + hamming_query_block_size - 1) / hamming_query_block_size;
         for (size_t j0 = 0; j0 < n2; j0 += block_size) {
         const size_t j1 = std::min(j0 + block_size, n2);
 #pragma omp parallel for
-            for (size_t i = 0; i < ha->nh; i++) {
-                HammingComputer hc (bs1 + i * bytes_per_code, bytes_per_code);
+            for (size_t qb = 0; qb < nqb; qb++) {
+                const size_t i0 = qb * hamming_query_block_size;
+                const size_t i1 = std::min(i0 + hamming_query_block_size, ha->nh);
+
+                HammingComputer hc[hamming_query_block_size];
+                for (size_t i = i0; i < i1; i++) {
+                    hc[i - i0].set (bs1 + i * bytes_per_code, bytes_per_code);
+                }
 
                 const uint8_t * bs2_ = bs2 + j0 * bytes_per_code;
-                hamdis_t dis;
-                hamdis_t * __restrict bh_val_ = ha->val + i * k;
-                int64_t * __restrict bh_ids_ = ha->ids + i * k;
-                size_t j;
-                for (j = j0; j < j1; j++, bs2_+= bytes_per_code) {
+                for (size_t j = j0; j < j1; j++, bs2_+= bytes_per_code) {
                     if(!bitset || !bitset->test(j)){
-                        dis = hc.hamming (bs2_);
-                        if (dis < bh_val_[0]) {
-                            faiss::maxheap_swap_top<hamdis_t> (k, bh_val_, bh_ids_, dis, j);
+                        for (size_t i = i0; i < i1; i++) {
+                            hamdis_t dis = hc[i - i0].hamming (bs2_);
+                            hamdis_t * __restrict bh_val_ = ha->val + i * k;
+                            if (dis < bh_val_[0]) {
+                                faiss::maxheap_swap_top<hamdis_t> (k, bh_val_, ha->ids + i * k, dis, j);
+                            }
                         }
                     }
                 }
@@ -687,7 +696,10 @@ void hammings_knn_hc (
             (32, ha, a, b, nb, order, true, bitset);
         break;
     default:
-        if(ncodes % 8 == 0) {
+        if (ncodes >= 64) {
+            hammings_knn_hc<faiss::HammingComputerHook>
+                (ncodes, ha, a, b, nb, order, true, bitset);
+        } else if(ncodes % 8 == 0) {
             hammings_knn_hc<faiss::HammingComputerM8>
                 (ncodes, ha, a, b, nb, order, true, bitset);
         } else {
@@ -733,7 +745,11 @@ void hammings_knn_mc(
         );
         break;
     default:
-        if(ncodes % 8 == 0) {
+        if (ncodes >= 64) {
+            hammings_knn_mc<faiss::HammingComputerHook>(
+              ncodes, a, b, na, nb, k, distances, labels, bitset
+            );
+        } else if(ncodes % 8 == 0) {
             hammings_knn_mc<faiss::HammingComputerM8>(
               ncodes, a, b, na, nb, k, distances, labels, bitset
             );
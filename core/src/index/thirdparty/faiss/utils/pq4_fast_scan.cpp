@@ -0,0 +1,108 @@
+
+// -*- c++ -*-
+
+#include <faiss/utils/pq4_fast_scan.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace faiss {
+
+size_t
+pq4_packed_size(size_t n, size_t M) {
+    size_t nblocks = (n + PQ4_BLOCK_SIZE - 1) / PQ4_BLOCK_SIZE;
+    return nblocks * M * PQ4_BLOCK_SIZE / 2;
+}
+
+namespace {
+
+/// sub-quantizer m of a code written by PQEncoderGeneric with nbits = 4
+inline uint8_t
+get_code(const uint8_t* code, size_t m) {
+    return (code[m >> 1] >> ((m & 1) * 4)) & 15;
+}
+
+inline void
+set_code(uint8_t* code, size_t m, uint8_t c) {
+    code[m >> 1] |= c << ((m & 1) * 4);
+}
+
+} // namespace
+
+void
+pq4_pack_codes(const uint8_t* codes, size_t n, size_t M, uint8_t* blocks) {
+    size_t code_size = (M + 1) / 2;
+    memset(blocks, 0, pq4_packed_size(n, M));
+
+    for (size_t i = 0; i < n; i++) {
+        const uint8_t* code = codes + i * code_size;
+        uint8_t* block = blocks + (i / PQ4_BLOCK_SIZE) * M * 16;
+        size_t j = i % PQ4_BLOCK_SIZE;
+        int shift = j < 16 ? 0 : 4;
+        for (size_t m = 0; m < M; m++) {
+            block[m * 16 + (j & 15)] |= get_code(code, m) << shift;
+        }
+    }
+}
+
+void
+pq4_unpack_codes(const uint8_t* blocks, size_t n, size_t M, uint8_t* codes) {
+    size_t code_size = (M + 1) / 2;
+    memset(codes, 0, n * code_size);
+
+    for (size_t i = 0; i < n; i++) {
+        uint8_t* code = codes + i * code_size;
+        const uint8_t* block = blocks + (i / PQ4_BLOCK_SIZE) * M * 16;
+        size_t j = i % PQ4_BLOCK_SIZE;
+        int shift = j < 16 ? 0 : 4;
+        for (size_t m = 0; m < M; m++) {
+            set_code(code, m, (block[m * 16 + (j & 15)] >> shift) & 15);
+        }
+    }
+}
+
+void
+pq4_quantize_LUT(size_t M, const float* LUT, uint8_t* qLUT, float& scale, float& bias) {
+    // shift every table to start at 0, then use a common scale so that the
+    // widest table spans [0, 255]
+    bias = 0;
+    float max_span = 0;
+    std::vector<float> mins(M);
+    for (size_t m = 0; m < M; m++) {
+        const float* tab = LUT + m * 16;
+        float vmin = *std::min_element(tab, tab + 16);
+        float vmax = *std::max_element(tab, tab + 16);
+        mins[m] = vmin;
+        bias += vmin;
+        max_span = std::max(max_span, vmax - vmin);
+    }
+
+    scale = max_span > 0 ? 255.0f / max_span : 1.0f;
+    for (size_t m = 0; m < M; m++) {
+        for (size_t k = 0; k < 16; k++) {
+            float v = std::floor((LUT[m * 16 + k] - mins[m]) * scale + 0.5f);
+            qLUT[m * 16 + k] = (uint8_t)std::min(v, 255.0f);
+        }
+    }
+}
+
+void
+pq4_accumulate_ref(size_t nblocks, size_t M, const uint8_t* blocks, const uint8_t* LUT, uint16_t* dis) {
+    for (size_t b = 0; b < nblocks; b++) {
+        memset(dis, 0, sizeof(uint16_t) * PQ4_BLOCK_SIZE);
+        for (size_t m = 0; m < M; m++) {
+            const uint8_t* tab = LUT + m * 16;
+            for (size_t j = 0; j < 16; j++) {
+                uint8_t c = blocks[j];
+                dis[j] += tab[c & 15];
+                dis[j + 16] += tab[c >> 4];
+            }
+            blocks += 16;
+        }
+        dis += PQ4_BLOCK_SIZE;
+    }
+}
+
+} // namespace faiss
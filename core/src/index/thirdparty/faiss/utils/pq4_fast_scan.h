@@ -0,0 +1,47 @@
+
+// -*- c++ -*-
+
+/* Fast scan of 4-bit PQ codes.
+ *
+ * Codes are stored in blocks of 32 vectors. Inside a block, sub-quantizer m
+ * owns 16 consecutive bytes: byte i holds the code of vector i in the low
+ * nibble and the code of vector i + 16 in the high nibble. With 16 centroids
+ * per sub-quantizer a whole look-up table fits in one 128-bit register, so a
+ * block is scanned with one shuffle per sub-quantizer instead of one gather
+ * per code. Tables are quantized to uint8 and sums accumulated on uint16. */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace faiss {
+
+/// number of vectors interleaved in one block
+constexpr size_t PQ4_BLOCK_SIZE = 32;
+
+/// number of bytes of the blocked layout for n codes of M sub-quantizers
+size_t
+pq4_packed_size(size_t n, size_t M);
+
+/// pack n codes produced by a ProductQuantizer with nbits = 4 into blocks,
+/// the tail of the last block is zero-filled
+void
+pq4_pack_codes(const uint8_t* codes, size_t n, size_t M, uint8_t* blocks);
+
+/// inverse of pq4_pack_codes
+void
+pq4_unpack_codes(const uint8_t* blocks, size_t n, size_t M, uint8_t* codes);
+
+/** quantize M x 16 float tables to uint8
+ *
+ * the approximate distance of a code is then bias + sum(qLUT) / scale
+ */
+void
+pq4_quantize_LUT(size_t M, const float* LUT, uint8_t* qLUT, float& scale, float& bias);
+
+/// accumulate quantized tables over nblocks blocks, dis receives nblocks * 32 sums
+void
+pq4_accumulate_ref(size_t nblocks, size_t M, const uint8_t* blocks, const uint8_t* LUT, uint16_t* dis);
+
+} // namespace faiss
@@ -0,0 +1,75 @@
+
+// -*- c++ -*-
+
+#include <faiss/utils/pq4_fast_scan_avx.h>
+#include <faiss/utils/pq4_fast_scan.h>
+
+#include <immintrin.h>
+
+namespace faiss {
+
+namespace {
+
+/* acc_even / acc_odd hold, per 128-bit lane, the uint16 sums of the even /
+ * odd bytes of the shuffled tables. Lane 0 and lane 1 carry different
+ * sub-quantizers of the same 16 vectors, fold them and restore the order. */
+inline void
+store_sums(__m256i acc_even, __m256i acc_odd, uint16_t* dis) {
+    __m128i even = _mm_add_epi16(_mm256_castsi256_si128(acc_even), _mm256_extracti128_si256(acc_even, 1));
+    __m128i odd = _mm_add_epi16(_mm256_castsi256_si128(acc_odd), _mm256_extracti128_si256(acc_odd, 1));
+    _mm_storeu_si128((__m128i*)dis, _mm_unpacklo_epi16(even, odd));
+    _mm_storeu_si128((__m128i*)(dis + 8), _mm_unpackhi_epi16(even, odd));
+}
+
+} // namespace
+
+void
+pq4_accumulate_avx(size_t nblocks, size_t M, const uint8_t* blocks, const uint8_t* LUT, uint16_t* dis) {
+    const __m256i mask4 = _mm256_set1_epi8(0x0f);
+    const __m256i mask8 = _mm256_set1_epi16(0x00ff);
+    const __m256i zero = _mm256_setzero_si256();
+
+    for (size_t b = 0; b < nblocks; b++) {
+        // vectors 0..15 come from the low nibbles, vectors 16..31 from the high ones
+        __m256i lo_even = zero;
+        __m256i lo_odd = zero;
+        __m256i hi_even = zero;
+        __m256i hi_odd = zero;
+
+        size_t m = 0;
+        // two sub-quantizers per iteration, one in each lane
+        for (; m + 2 <= M; m += 2) {
+            __m256i codes = _mm256_loadu_si256((const __m256i*)(blocks + m * 16));
+            __m256i lut = _mm256_loadu_si256((const __m256i*)(LUT + m * 16));
+
+            __m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(codes, mask4));
+            __m256i hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(codes, 4), mask4));
+
+            lo_even = _mm256_add_epi16(lo_even, _mm256_and_si256(lo, mask8));
+            lo_odd = _mm256_add_epi16(lo_odd, _mm256_srli_epi16(lo, 8));
+            hi_even = _mm256_add_epi16(hi_even, _mm256_and_si256(hi, mask8));
+            hi_odd = _mm256_add_epi16(hi_odd, _mm256_srli_epi16(hi, 8));
+        }
+        if (m < M) {
+            // odd M, the last sub-quantizer only fills lane 0
+            __m256i codes = _mm256_inserti128_si256(zero, _mm_loadu_si128((const __m128i*)(blocks + m * 16)), 0);
+            __m256i lut = _mm256_inserti128_si256(zero, _mm_loadu_si128((const __m128i*)(LUT + m * 16)), 0);
+
+            __m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(codes, mask4));
+            __m256i hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(codes, 4), mask4));
+
+            lo_even = _mm256_add_epi16(lo_even, _mm256_and_si256(lo, mask8));
+            lo_odd = _mm256_add_epi16(lo_odd, _mm256_srli_epi16(lo, 8));
+            hi_even = _mm256_add_epi16(hi_even, _mm256_and_si256(hi, mask8));
+            hi_odd = _mm256_add_epi16(hi_odd, _mm256_srli_epi16(hi, 8));
+        }
+
+        store_sums(lo_even, lo_odd, dis);
+        store_sums(hi_even, hi_odd, dis + 16);
+
+        blocks += M * 16;
+        dis += PQ4_BLOCK_SIZE;
+    }
+}
+
+} // namespace faiss
@@ -0,0 +1,18 @@
+
+// -*- c++ -*-
+
+/* AVX2 kernel for the 4-bit PQ fast scan.
+ * The actual functions are implemented in pq4_fast_scan_avx.cpp */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace faiss {
+
+/// same as pq4_accumulate_ref, table look-ups done with _mm256_shuffle_epi8
+void
+pq4_accumulate_avx(size_t nblocks, size_t M, const uint8_t* blocks, const uint8_t* LUT, uint16_t* dis);
+
+} // namespace faiss
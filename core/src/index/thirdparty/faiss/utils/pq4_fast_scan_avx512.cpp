@@ -0,0 +1,80 @@
+// -*- c++ -*-
+
+#include <faiss/utils/pq4_fast_scan_avx512.h>
+#include <faiss/utils/pq4_fast_scan.h>
+#include <faiss/impl/FaissAssert.h>
+
+#include <immintrin.h>
+
+namespace faiss {
+
+#if defined(__AVX512BW__)
+
+namespace {
+
+/// add the four 128-bit lanes, each of them carries other sub-quantizers of the same vectors
+inline __m128i
+fold_lanes(__m512i v) {
+    __m256i s = _mm256_add_epi16(_mm512_castsi512_si256(v), _mm512_extracti64x4_epi64(v, 1));
+    return _mm_add_epi16(_mm256_castsi256_si128(s), _mm256_extracti128_si256(s, 1));
+}
+
+/* acc_even / acc_odd hold the uint16 sums of the even / odd bytes of the
+ * shuffled tables, interleave them back to the order of the vectors */
+inline void
+store_sums(__m512i acc_even, __m512i acc_odd, uint16_t* dis) {
+    __m128i even = fold_lanes(acc_even);
+    __m128i odd = fold_lanes(acc_odd);
+    _mm_storeu_si128((__m128i*)dis, _mm_unpacklo_epi16(even, odd));
+    _mm_storeu_si128((__m128i*)(dis + 8), _mm_unpackhi_epi16(even, odd));
+}
+
+} // namespace
+
+void
+pq4_accumulate_avx512(size_t nblocks, size_t M, const uint8_t* blocks, const uint8_t* LUT, uint16_t* dis) {
+    const __m512i mask4 = _mm512_set1_epi8(0x0f);
+    const __m512i mask8 = _mm512_set1_epi16(0x00ff);
+
+    for (size_t b = 0; b < nblocks; b++) {
+        // vectors 0..15 come from the low nibbles, vectors 16..31 from the high ones
+        __m512i lo_even = _mm512_setzero_si512();
+        __m512i lo_odd = _mm512_setzero_si512();
+        __m512i hi_even = _mm512_setzero_si512();
+        __m512i hi_odd = _mm512_setzero_si512();
+
+        // four sub-quantizers per iteration, one in each lane. The lanes past M
+        // are loaded as zeros, a zero table adds nothing to the sums
+        for (size_t m = 0; m < M; m += 4) {
+            size_t bytes = (M - m < 4 ? M - m : 4) * 16;
+            __mmask64 mask = bytes == 64 ? ~(__mmask64)0 : (((__mmask64)1 << bytes) - 1);
+            __m512i codes = _mm512_maskz_loadu_epi8(mask, blocks + m * 16);
+            __m512i lut = _mm512_maskz_loadu_epi8(mask, LUT + m * 16);
+
+            __m512i lo = _mm512_shuffle_epi8(lut, _mm512_and_si512(codes, mask4));
+            __m512i hi = _mm512_shuffle_epi8(lut, _mm512_and_si512(_mm512_srli_epi16(codes, 4), mask4));
+
+            lo_even = _mm512_add_epi16(lo_even, _mm512_and_si512(lo, mask8));
+            lo_odd = _mm512_add_epi16(lo_odd, _mm512_srli_epi16(lo, 8));
+            hi_even = _mm512_add_epi16(hi_even, _mm512_and_si512(hi, mask8));
+            hi_odd = _mm512_add_epi16(hi_odd, _mm512_srli_epi16(hi, 8));
+        }
+
+        store_sums(lo_even, lo_odd, dis);
+        store_sums(hi_even, hi_odd, dis + 16);
+
+        blocks += M * 16;
+        dis += PQ4_BLOCK_SIZE;
+    }
+}
+
+#else
+
+void
+pq4_accumulate_avx512(size_t nblocks, size_t M, const uint8_t* blocks, const uint8_t* LUT, uint16_t* dis) {
+    FAISS_ASSERT(false);
+}
+
+#endif
+
+} // namespace faiss
@@ -64,6 +64,12 @@ namespace hnswlib_nm {
     template<typename MTYPE>
     using DISTFUNC = MTYPE(*)(const void *, const void *, const void *);
 
+    // parameter of the float spaces, dim comes first as the index reads it back as a size_t
+    struct FloatDistParam {
+        size_t dim;
+        float (*kernel)(const float *, const float *, size_t);
+    };
+
 
     template<typename MTYPE>
     class SpaceInterface {
@@ -14,7 +14,8 @@ InnerProduct(const void *pVect1, const void *pVect2, const void *qty_ptr) {
     }
     return (1.0f - res);
 #else
-    return (1.0f - faiss::fvec_inner_product((const float*)pVect1, (const float*)pVect2, *((size_t*)qty_ptr)));
+    auto param = (const FloatDistParam *) qty_ptr;
+    return (1.0f - param->kernel((const float*)pVect1, (const float*)pVect2, param->dim));
 #endif
 }
 
@@ -220,7 +221,7 @@ InnerProductSIMD16Ext(const void *pVect1v, const void *pVect2v, const void *qty_
 class InnerProductSpace : public SpaceInterface<float> {
     DISTFUNC<float> fstdistfunc_;
     size_t data_size_;
-    size_t dim_;
+    FloatDistParam param_;
  public:
     InnerProductSpace(size_t dim) {
         fstdistfunc_ = InnerProduct;
@@ -232,7 +233,8 @@ class InnerProductSpace : public SpaceInterface<float> {
             fstdistfunc_ = InnerProductSIMD16Ext;
 #endif
 #endif
-        dim_ = dim;
+        param_.dim = dim;
+        param_.kernel = faiss::fvec_inner_product_for_dim(dim);
         data_size_ = dim * sizeof(float);
     }
 
@@ -245,7 +247,7 @@ class InnerProductSpace : public SpaceInterface<float> {
     }
 
     void *get_dist_func_param() {
-        return &dim_;
+        return &param_;
     }
 
     ~InnerProductSpace() {}
@@ -16,7 +16,8 @@ L2Sqr(const void *pVect1, const void *pVect2, const void *qty_ptr) {
     }
     return (res);
 #else
-    return faiss::fvec_L2sqr((const float*)pVect1, (const float*)pVect2, *((size_t*)qty_ptr));
+    auto param = (const FloatDistParam *) qty_ptr;
+    return param->kernel((const float*)pVect1, (const float*)pVect2, param->dim);
 #endif
 }
 
@@ -151,7 +152,7 @@ L2SqrSIMD4Ext(const void *pVect1v, const void *pVect2v, const void *qty_ptr) {
 class L2Space : public SpaceInterface<float> {
     DISTFUNC<float> fstdistfunc_;
     size_t data_size_;
-    size_t dim_;
+    FloatDistParam param_;
  public:
     L2Space(size_t dim) {
         fstdistfunc_ = L2Sqr;
@@ -166,7 +167,8 @@ class L2Space : public SpaceInterface<float> {
         }*/
 #endif
 #endif
-        dim_ = dim;
+        param_.dim = dim;
+        param_.kernel = faiss::fvec_L2sqr_for_dim(dim);
         data_size_ = dim * sizeof(float);
     }
 
@@ -179,7 +181,7 @@ class L2Space : public SpaceInterface<float> {
     }
 
     void *get_dist_func_param() {
-        return &dim_;
+        return &param_;
     }
 
     ~L2Space() {}
@@ -0,0 +1,192 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include <gtest/gtest.h>
+#include <hdf5.h>
+#include <sys/time.h>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "knowhere/index/vector_index/IndexDiskANN.h"
+#include "knowhere/index/vector_index/adapter/VectorAdapter.h"
+#include "knowhere/index/vector_index/helpers/IndexParameter.h"
+
+/*****************************************************
+ * Recall and latency of DISKANN served from its sector file.
+ * To run this test, please download the HDF5 from
+ *  https://support.hdfgroup.org/ftp/HDF5/releases/
+ * and install it to /usr/local/hdf5 .
+ *****************************************************/
+
+const char HDF5_POSTFIX[] = ".hdf5";
+const char HDF5_DATASET_TRAIN[] = "train";
+const char HDF5_DATASET_TEST[] = "test";
+const char HDF5_DATASET_NEIGHBORS[] = "neighbors";
+
+double
+elapsed() {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+void*
+hdf5_read(const std::string& file_name, const std::string& dataset_name, H5T_class_t dataset_class, size_t& d_out,
+          size_t& n_out) {
+    hid_t file = H5Fopen(file_name.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    hid_t dataset = H5Dopen2(file, dataset_name.c_str(), H5P_DEFAULT);
+    hid_t datatype = H5Dget_type(dataset);
+    H5T_class_t t_class = H5Tget_class(datatype);
+    assert(t_class == dataset_class || !"Illegal dataset class type");
+
+    hsize_t dims_out[2];
+    hid_t dataspace = H5Dget_space(dataset);
+    H5Sget_simple_extent_dims(dataspace, dims_out, nullptr);
+    n_out = dims_out[0];
+    d_out = dims_out[1];
+
+    void* data_out = nullptr;
+    switch (t_class) {
+        case H5T_INTEGER:
+            data_out = new int[dims_out[0] * dims_out[1]];
+            H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data_out);
+            break;
+        case H5T_FLOAT:
+            data_out = new float[dims_out[0] * dims_out[1]];
+            H5Dread(dataset, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data_out);
+            break;
+        default:
+            printf("Illegal dataset class type\n");
+            break;
+    }
+
+    H5Tclose(datatype);
+    H5Dclose(dataset);
+    H5Sclose(dataspace);
+    H5Fclose(file);
+
+    return data_out;
+}
+
+// build the index once, keep the sectors in a file and serve the queries from it
+milvus::knowhere::IndexDiskANNPtr
+load_index(const std::string& ann_test_name, const milvus::knowhere::Config& build_conf) {
+    double t0 = elapsed();
+    const std::string ann_file_name = ann_test_name + HDF5_POSTFIX;
+    const std::string sector_file_name = ann_test_name + "_DISKANN.sectors";
+
+    size_t nb, dim;
+    auto xb = (float*)hdf5_read(ann_file_name, HDF5_DATASET_TRAIN, H5T_FLOAT, dim, nb);
+    auto conf = build_conf;
+    conf[milvus::knowhere::meta::DIM] = dim;
+    conf[milvus::knowhere::meta::ROWS] = nb;
+
+    printf("[%.3f s] Building DISKANN on %ld vectors\n", elapsed() - t0, nb);
+    std::vector<int64_t> ids(nb);
+    std::iota(ids.begin(), ids.end(), 0);
+    auto index = std::make_shared<milvus::knowhere::IndexDiskANN>();
+    index->BuildAll(milvus::knowhere::GenDatasetWithIds(nb, dim, xb, ids.data()), conf);
+    delete[] xb;
+    printf("[%.3f s] Build done\n", elapsed() - t0);
+
+    auto binary_set = index->Serialize();
+    auto sectors = binary_set.Erase(SECTOR_DATA);
+    std::ofstream out(sector_file_name, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(sectors->data.get()), sectors->size);
+    out.close();
+
+    std::shared_ptr<uint8_t[]> path(new uint8_t[sector_file_name.size()]);
+    memcpy(path.get(), sector_file_name.data(), sector_file_name.size());
+    binary_set.Append(SECTOR_FILE, path, sector_file_name.size());
+
+    auto disk_index = std::make_shared<milvus::knowhere::IndexDiskANN>();
+    disk_index->Load(binary_set);
+    printf("[%.3f s] Sectors on disk: %ld MB, index in memory: %ld MB\n", elapsed() - t0, sectors->size >> 20,
+           disk_index->IndexSize() >> 20);
+    return disk_index;
+}
+
+void
+test_ann_hdf5(const std::string& ann_test_name, const milvus::knowhere::Config& build_conf,
+              const std::vector<int64_t>& search_lengths, const std::vector<int64_t>& beam_widths, int64_t topk) {
+    const std::string ann_file_name = ann_test_name + HDF5_POSTFIX;
+    auto index = load_index(ann_test_name, build_conf);
+
+    size_t nq, dim, gt_k, nq2;
+    auto xq = (float*)hdf5_read(ann_file_name, HDF5_DATASET_TEST, H5T_FLOAT, dim, nq);
+    auto gt = (int*)hdf5_read(ann_file_name, HDF5_DATASET_NEIGHBORS, H5T_INTEGER, gt_k, nq2);
+    assert(nq2 == nq || !"incorrect nb of ground truth index");
+    auto query_dataset = milvus::knowhere::GenDataset(nq, dim, xq);
+
+    printf("\n%s | DISKANN | topk = %ld\n", ann_test_name.c_str(), topk);
+    printf("=====================================================================\n");
+    printf("  L   |   W  |  recall  |  QPS  | latency (ms) | sector reads / query\n");
+    for (auto search_length : search_lengths) {
+        for (auto beam_width : beam_widths) {
+            milvus::knowhere::Config conf{
+                {milvus::knowhere::meta::TOPK, topk},
+                {milvus::knowhere::IndexParams::search_length, search_length},
+                {milvus::knowhere::IndexParams::beam_width, beam_width},
+            };
+
+            // queries one by one for the latency, then as one batch for the throughput
+            int64_t reads_before = index->SectorReads();
+            double t_start = elapsed();
+            for (size_t i = 0; i < nq; i++) {
+                index->Query(milvus::knowhere::GenDataset(1, dim, xq + i * dim), conf);
+            }
+            double latency = (elapsed() - t_start) * 1000 / nq;
+            double reads = double(index->SectorReads() - reads_before) / nq;
+
+            t_start = elapsed();
+            auto result = index->Query(query_dataset, conf);
+            double qps = nq / (elapsed() - t_start);
+
+            auto ids = result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+            size_t hit = 0;
+            for (size_t i = 0; i < nq; i++) {
+                std::set<int64_t> ground(gt + i * gt_k, gt + i * gt_k + topk);
+                for (int64_t j = 0; j < topk; j++) {
+                    hit += ground.count(ids[i * topk + j]);
+                }
+            }
+            printf(" %4ld | %4ld | %8.4f | %5.0f | %12.3f | %8.1f\n", search_length, beam_width,
+                   hit / double(nq * topk), qps, latency, reads);
+        }
+    }
+    printf("=====================================================================\n");
+
+    delete[] xq;
+    delete[] gt;
+}
+
+TEST(DISKANNTEST, BENCHMARK) {
+    milvus::knowhere::Config build_conf{
+        {milvus::knowhere::IndexParams::out_degree, 64},
+        {milvus::knowhere::IndexParams::search_length, 100},
+        {milvus::knowhere::IndexParams::candidate, 500},
+        {milvus::knowhere::IndexParams::m, 32},
+        {milvus::knowhere::IndexParams::alpha, 1.2},
+        {milvus::knowhere::IndexParams::cache_nodes, 10000},
+        {milvus::knowhere::Metric::TYPE, milvus::knowhere::Metric::L2},
+    };
+    std::vector<int64_t> search_lengths = {20, 50, 100, 200};
+    std::vector<int64_t> beam_widths = {1, 4, 8};
+
+    test_ann_hdf5("sift-128-euclidean", build_conf, search_lengths, beam_widths, 10);
+}
@@ -571,3 +571,72 @@ TEST(FAISSTEST, BENCHMARK) {
 
     test_ann_hdf5("sift-128-euclidean", "IVF128", "Flat", MODE_CPU, SIFT_INSERT_LOOPS, param_nprobes, SEARCH_LOOPS);
 }
+
+/************************************************************************************
+ * Blacklist test cost: atomic ConcurrentBitset::test against the read-only
+ * FrozenBitset snapshot the search kernels use.
+ *************************************************************************************/
+
+TEST(FAISSTEST, FROZEN_BITSET) {
+    const int64_t size = 100000000;
+    const int32_t TEST_LOOPS = 5;
+
+    std::vector<int32_t> percentages = {0, 5, 50, 100};
+    for (auto percentage : percentages) {
+        faiss::ConcurrentBitsetPtr bitset = CreateBitset(size, percentage);
+
+        double t0 = elapsed();
+        int64_t atomic_hits = 0;
+        for (int32_t loop = 0; loop < TEST_LOOPS; loop++) {
+            for (int64_t i = 0; i < size; i++) {
+                atomic_hits += bitset->test(i);
+            }
+        }
+        double t1 = elapsed();
+
+        faiss::FrozenBitsetPtr frozen = bitset->frozen();
+        double t2 = elapsed();
+        int64_t frozen_hits = 0;
+        for (int32_t loop = 0; loop < TEST_LOOPS; loop++) {
+            for (int64_t i = 0; i < size; i++) {
+                frozen_hits += frozen->test(i);
+            }
+        }
+        double t3 = elapsed();
+
+        ASSERT_EQ(atomic_hits, frozen_hits);
+        ASSERT_EQ(frozen->count() * TEST_LOOPS, frozen_hits);
+        ASSERT_EQ(frozen->none(), percentage == 0);
+
+        printf("bitset = %3d%%, atomic test = %.4fs, frozen test = %.4fs, snapshot = %.4fs\n", percentage,
+               (t1 - t0) / TEST_LOOPS, (t3 - t2) / TEST_LOOPS, t2 - t1);
+    }
+
+    // the snapshot is rebuilt once the bitset changes, earlier snapshots stay untouched
+    faiss::ConcurrentBitsetPtr bitset = CreateBitset(1000, 0);
+    auto before = bitset->frozen();
+    ASSERT_EQ(before, bitset->frozen());
+    bitset->set(999);
+    auto after = bitset->frozen();
+    ASSERT_NE(before, after);
+    ASSERT_FALSE(before->test(999));
+    ASSERT_TRUE(after->test(999));
+    ASSERT_TRUE(after->any(960, 1000));
+    ASSERT_FALSE(after->any(0, 999));
+
+    // bulk writes invalidate the snapshot once they are done
+    faiss::ConcurrentBitsetPtr merged = CreateBitset(1000, 0);
+    ASSERT_FALSE(merged->frozen()->test(999));
+    *merged |= *bitset;
+    ASSERT_TRUE(merged->frozen()->test(999));
+    *merged ^= *bitset;
+    ASSERT_FALSE(merged->frozen()->test(999));
+
+    // once write access is handed out, no snapshot is kept
+    bitset->mutable_data()[0] = 1;
+    auto raw = bitset->frozen();
+    ASSERT_TRUE(raw->test(0));
+    ASSERT_NE(raw, bitset->frozen());
+    bitset->mutable_data()[0] = 0;
+    ASSERT_FALSE(bitset->frozen()->test(0));
+}
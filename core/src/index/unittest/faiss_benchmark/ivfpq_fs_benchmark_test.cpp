@@ -0,0 +1,187 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include <gtest/gtest.h>
+#include <hdf5.h>
+#include <sys/time.h>
+#include <cassert>
+#include <cstdio>
+#include <memory>
+#include <numeric>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "knowhere/index/vector_index/IndexIVFPQ.h"
+#include "knowhere/index/vector_index/IndexIVFPQFastScan.h"
+#include "knowhere/index/vector_index/adapter/VectorAdapter.h"
+#include "knowhere/index/vector_index/helpers/IndexParameter.h"
+
+/*****************************************************
+ * Throughput and recall of IVF_PQ_FS against IVF_PQ with the same code size.
+ * To run this test, please download the HDF5 from
+ *  https://support.hdfgroup.org/ftp/HDF5/releases/
+ * and install it to /usr/local/hdf5 .
+ *****************************************************/
+
+const char HDF5_POSTFIX[] = ".hdf5";
+const char HDF5_DATASET_TRAIN[] = "train";
+const char HDF5_DATASET_TEST[] = "test";
+const char HDF5_DATASET_NEIGHBORS[] = "neighbors";
+
+double
+elapsed() {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+void*
+hdf5_read(const std::string& file_name, const std::string& dataset_name, H5T_class_t dataset_class, size_t& d_out,
+          size_t& n_out) {
+    hid_t file = H5Fopen(file_name.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    hid_t dataset = H5Dopen2(file, dataset_name.c_str(), H5P_DEFAULT);
+    hid_t datatype = H5Dget_type(dataset);
+    H5T_class_t t_class = H5Tget_class(datatype);
+    assert(t_class == dataset_class || !"Illegal dataset class type");
+
+    hsize_t dims_out[2];
+    hid_t dataspace = H5Dget_space(dataset);
+    H5Sget_simple_extent_dims(dataspace, dims_out, nullptr);
+    n_out = dims_out[0];
+    d_out = dims_out[1];
+
+    void* data_out = nullptr;
+    switch (t_class) {
+        case H5T_INTEGER:
+            data_out = new int[dims_out[0] * dims_out[1]];
+            H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data_out);
+            break;
+        case H5T_FLOAT:
+            data_out = new float[dims_out[0] * dims_out[1]];
+            H5Dread(dataset, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data_out);
+            break;
+        default:
+            printf("Illegal dataset class type\n");
+            break;
+    }
+
+    H5Tclose(datatype);
+    H5Dclose(dataset);
+    H5Sclose(dataspace);
+    H5Fclose(file);
+
+    return data_out;
+}
+
+struct BenchIndex {
+    std::string name;
+    milvus::knowhere::VecIndexPtr index;
+    int64_t refine_factor;
+};
+
+void
+test_ann_hdf5(const std::string& ann_test_name, int64_t nlist, int64_t code_size, const std::vector<int64_t>& nprobes,
+              int64_t topk) {
+    double t0 = elapsed();
+    const std::string ann_file_name = ann_test_name + HDF5_POSTFIX;
+
+    size_t nb, dim;
+    auto xb = (float*)hdf5_read(ann_file_name, HDF5_DATASET_TRAIN, H5T_FLOAT, dim, nb);
+    std::vector<int64_t> ids(nb);
+    std::iota(ids.begin(), ids.end(), 0);
+    auto base_dataset = milvus::knowhere::GenDatasetWithIds(nb, dim, xb, ids.data());
+
+    // 8-bit IVF_PQ and 4-bit IVF_PQ_FS, both with code_size bytes per vector
+    milvus::knowhere::Config pq_conf{
+        {milvus::knowhere::meta::DIM, dim},
+        {milvus::knowhere::IndexParams::nlist, nlist},
+        {milvus::knowhere::IndexParams::m, code_size},
+        {milvus::knowhere::IndexParams::nbits, 8},
+        {milvus::knowhere::Metric::TYPE, milvus::knowhere::Metric::L2},
+    };
+    auto fs_conf = pq_conf;
+    fs_conf[milvus::knowhere::IndexParams::m] = code_size * 2;
+
+    printf("[%.3f s] Building IVF_PQ and IVF_PQ_FS on %ld vectors\n", elapsed() - t0, nb);
+    auto pq_index = std::make_shared<milvus::knowhere::IVFPQ>();
+    pq_index->BuildAll(base_dataset, pq_conf);
+    auto fs_index = std::make_shared<milvus::knowhere::IVFPQFastScan>();
+    fs_index->BuildAll(base_dataset, fs_conf);
+
+    // the same codes re-ranked with the raw vectors attached
+    auto binary_set = fs_index->Serialize();
+    auto raw = std::make_shared<milvus::knowhere::Binary>();
+    raw->data = std::shared_ptr<uint8_t[]>((uint8_t*)xb, [](uint8_t*) {});
+    raw->size = nb * dim * sizeof(float);
+    binary_set.Append(RAW_DATA, raw);
+    auto rerank_index = std::make_shared<milvus::knowhere::IVFPQFastScan>();
+    rerank_index->Load(binary_set);
+    printf("[%.3f s] Build done\n", elapsed() - t0);
+
+    size_t nq, gt_k, nq2;
+    auto xq = (float*)hdf5_read(ann_file_name, HDF5_DATASET_TEST, H5T_FLOAT, dim, nq);
+    auto gt = (int*)hdf5_read(ann_file_name, HDF5_DATASET_NEIGHBORS, H5T_INTEGER, gt_k, nq2);
+    assert(nq2 == nq || !"incorrect nb of ground truth index");
+    auto query_dataset = milvus::knowhere::GenDataset(nq, dim, xq);
+
+    std::vector<BenchIndex> indexes = {
+        {"IVF_PQ", pq_index, 1},
+        {"IVF_PQ_FS", fs_index, 1},
+        {"IVF_PQ_FS refine 4", rerank_index, 4},
+    };
+
+    printf("\n%s | nlist = %ld | %ld bytes per code | topk = %ld\n", ann_test_name.c_str(), nlist, code_size, topk);
+    printf("=====================================================================\n");
+    printf(" nprobe | index              |  recall  |   QPS   | latency (ms)\n");
+    for (auto nprobe : nprobes) {
+        for (auto& bench : indexes) {
+            milvus::knowhere::Config conf{
+                {milvus::knowhere::meta::TOPK, topk},
+                {milvus::knowhere::IndexParams::nprobe, nprobe},
+                {milvus::knowhere::IndexParams::refine_factor, bench.refine_factor},
+            };
+
+            // queries one by one for the latency, then as one batch for the throughput
+            double t_start = elapsed();
+            for (size_t i = 0; i < nq; i++) {
+                bench.index->Query(milvus::knowhere::GenDataset(1, dim, xq + i * dim), conf);
+            }
+            double latency = (elapsed() - t_start) * 1000 / nq;
+
+            t_start = elapsed();
+            auto result = bench.index->Query(query_dataset, conf);
+            double qps = nq / (elapsed() - t_start);
+
+            auto res_ids = result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+            size_t hit = 0;
+            for (size_t i = 0; i < nq; i++) {
+                std::set<int64_t> ground(gt + i * gt_k, gt + i * gt_k + topk);
+                for (int64_t j = 0; j < topk; j++) {
+                    hit += ground.count(res_ids[i * topk + j]);
+                }
+            }
+            printf(" %6ld | %-18s | %8.4f | %7.0f | %12.3f\n", nprobe, bench.name.c_str(), hit / double(nq * topk),
+                   qps, latency);
+        }
+    }
+    printf("=====================================================================\n");
+
+    delete[] xb;
+    delete[] xq;
+    delete[] gt;
+}
+
+TEST(IVFPQFSTEST, BENCHMARK) {
+    std::vector<int64_t> nprobes = {8, 16, 32, 64, 128};
+
+    test_ann_hdf5("sift-128-euclidean", 4096, 16, nprobes, 10);
+}
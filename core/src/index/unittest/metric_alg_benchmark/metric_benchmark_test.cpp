@@ -9,10 +9,14 @@
 // is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
+#include <faiss/FaissHook.h>
+#include <faiss/utils/BinaryDistance.h>
 #include <gtest/gtest.h>
 #include <immintrin.h>
 #include <cassert>
 #include <chrono>
+#include <cmath>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -57,6 +61,14 @@ CheckResult(const float* result1, const float* result2, const size_t size) {
     }
 }
 
+// unrolled kernels sum in another order, so only a relative error is expected
+void
+CheckResultNear(const float* result1, const float* result2, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_NEAR(result1[i], result2[i], 1e-5 * std::fabs(result1[i]) + 1e-5);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /* from faiss/utils/distances_simd.cpp */
 namespace FAISS {
@@ -413,3 +425,194 @@ TEST(METRICTEST, BENCHMARK) {
     TestMetricAlg(func_map, "ANNOY::IP", LOOP, distance_annoy.data(), NB, xb.data(), NQ, xq.data(), DIM);
     CheckResult(distance_faiss.data(), distance_annoy.data(), NB * NQ);
 }
+
+TEST(METRICTEST, DISPATCH) {
+    std::string cpu_flag;
+    faiss::hook_init(cpu_flag);
+    std::cout << "kernels for " << cpu_flag << std::endl;
+
+    for (int64_t dim : {100, 128, 256, 512, 768}) {
+        std::unordered_map<std::string, metric_func_ptr> func_map;
+        func_map["HOOK::L2"] = faiss::fvec_L2sqr;
+        func_map["HOOK::IP"] = faiss::fvec_inner_product;
+        func_map["DIM::L2"] = faiss::fvec_L2sqr_for_dim(dim);
+        func_map["DIM::IP"] = faiss::fvec_inner_product_for_dim(dim);
+
+        std::vector<float> xb(NB * dim);
+        std::vector<float> xq(NQ * dim);
+        GenerateData(dim, NB, xb.data());
+        GenerateData(dim, NQ, xq.data());
+
+        std::vector<float> distance_hook(NB * NQ);
+        std::vector<float> distance_dim(NB * NQ);
+
+        std::cout << "========== dim " << dim << std::endl;
+        TestMetricAlg(func_map, "HOOK::L2", LOOP, distance_hook.data(), NB, xb.data(), NQ, xq.data(), dim);
+        TestMetricAlg(func_map, "DIM::L2", LOOP, distance_dim.data(), NB, xb.data(), NQ, xq.data(), dim);
+        CheckResultNear(distance_hook.data(), distance_dim.data(), NB * NQ);
+
+        TestMetricAlg(func_map, "HOOK::IP", LOOP, distance_hook.data(), NB, xb.data(), NQ, xq.data(), dim);
+        TestMetricAlg(func_map, "DIM::IP", LOOP, distance_dim.data(), NB, xb.data(), NQ, xq.data(), dim);
+        CheckResultNear(distance_hook.data(), distance_dim.data(), NB * NQ);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* popcount kernels for binary metrics, scalar reference against the hooked ones */
+namespace BINARY {
+int64_t
+TimeSince(std::chrono::system_clock::time_point t0) {
+    auto t1 = std::chrono::system_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+}
+
+void
+GenerateCodes(const int64_t code_size, const int64_t n, uint8_t* x) {
+    for (int64_t i = 0; i < n * code_size; ++i) {
+        x[i] = lrand48() & 0xff;
+    }
+}
+
+// every other database code is a superset of one query, so that the
+// substructure kernels do not always stop at the first word
+void
+GenerateSupersets(const int64_t code_size, const int64_t nb, const int64_t nq, const uint8_t* xq, uint8_t* xb) {
+    for (int64_t i = 0; i < nb; i += 2) {
+        const uint8_t* q = xq + (i / 2 % nq) * code_size;
+        for (int64_t j = 0; j < code_size; ++j) {
+            xb[i * code_size + j] |= q[j];
+        }
+    }
+}
+
+struct Kernels {
+    faiss::bvec_hamming_func_ptr hamming;
+    faiss::bvec_jaccard_func_ptr jaccard;
+    faiss::bvec_contains_func_ptr contains;
+};
+
+void
+TestKernels(const std::string& name, const Kernels& kernels, const int64_t code_size, const int64_t nb,
+            const uint8_t* xb, const int64_t nq, const uint8_t* xq, std::vector<int>& result) {
+    int64_t diff[4] = {0, 0, 0, 0};
+    result.assign(nb * nq * 4, 0);
+    for (int64_t l = 0; l < LOOP; l++) {
+        auto t0 = std::chrono::system_clock::now();
+        for (int64_t i = 0; i < nb; i++) {
+            for (int64_t j = 0; j < nq; j++) {
+                result[(i * nq + j) * 4] = kernels.hamming(xb + i * code_size, xq + j * code_size, code_size);
+            }
+        }
+        diff[0] += TimeSince(t0);
+
+        t0 = std::chrono::system_clock::now();
+        for (int64_t i = 0; i < nb; i++) {
+            for (int64_t j = 0; j < nq; j++) {
+                int num, den;
+                kernels.jaccard(xb + i * code_size, xq + j * code_size, code_size, &num, &den);
+                result[(i * nq + j) * 4 + 1] = num * 65536 + den;
+            }
+        }
+        diff[1] += TimeSince(t0);
+
+        t0 = std::chrono::system_clock::now();
+        for (int64_t i = 0; i < nb; i++) {
+            for (int64_t j = 0; j < nq; j++) {
+                result[(i * nq + j) * 4 + 2] = kernels.contains(xq + j * code_size, xb + i * code_size, code_size);
+            }
+        }
+        diff[2] += TimeSince(t0);
+
+        t0 = std::chrono::system_clock::now();
+        for (int64_t i = 0; i < nb; i++) {
+            for (int64_t j = 0; j < nq; j++) {
+                result[(i * nq + j) * 4 + 3] = kernels.contains(xb + i * code_size, xq + j * code_size, code_size);
+            }
+        }
+        diff[3] += TimeSince(t0);
+    }
+    const char* metrics[4] = {"HAMMING", "JACCARD/TANIMOTO", "SUBSTRUCTURE", "SUPERSTRUCTURE"};
+    for (int m = 0; m < 4; m++) {
+        std::cout << name << "::" << metrics[m] << " takes average " << diff[m] / LOOP << "us" << std::endl;
+    }
+}
+}  // namespace BINARY
+
+TEST(METRICTEST, BINARY_DISPATCH) {
+    std::string cpu_flag;
+    faiss::hook_init(cpu_flag);
+    std::cout << "kernels for " << cpu_flag << (faiss::support_avx512_vpopcntdq() ? " with VPOPCNTDQ" : "")
+              << std::endl;
+
+    BINARY::Kernels ref = {faiss::bvec_hamming_ref, faiss::bvec_jaccard_ref, faiss::bvec_contains_ref};
+    BINARY::Kernels hook = {faiss::bvec_hamming, faiss::bvec_jaccard, faiss::bvec_contains};
+
+    for (int64_t code_size : {64, 100, 256, 512}) {
+        std::vector<uint8_t> xb(NB * code_size);
+        std::vector<uint8_t> xq(NQ * code_size);
+        BINARY::GenerateCodes(code_size, NB, xb.data());
+        BINARY::GenerateCodes(code_size, NQ, xq.data());
+        BINARY::GenerateSupersets(code_size, NB, NQ, xq.data(), xb.data());
+
+        std::vector<int> result_ref, result_hook;
+        std::cout << "========== " << code_size * 8 << " bits" << std::endl;
+        BINARY::TestKernels("REF", ref, code_size, NB, xb.data(), NQ, xq.data(), result_ref);
+        BINARY::TestKernels("HOOK", hook, code_size, NB, xb.data(), NQ, xq.data(), result_hook);
+        ASSERT_EQ(result_ref, result_hook);
+    }
+}
+
+TEST(METRICTEST, BINARY_SEARCH) {
+    std::string cpu_flag;
+    faiss::hook_init(cpu_flag);
+
+    // enough queries to take the blocked batch path of the knn searches
+    const int64_t code_size = 256, nb = 100000, nq = 512, k = 10;
+    std::vector<uint8_t> xb(nb * code_size);
+    std::vector<uint8_t> xq(nq * code_size);
+    BINARY::GenerateCodes(code_size, nb, xb.data());
+    BINARY::GenerateCodes(code_size, nq, xq.data());
+    BINARY::GenerateSupersets(code_size, nb, nq, xq.data(), xb.data());
+
+    for (bool use_ref : {true, false}) {
+        if (use_ref) {
+            faiss::bvec_hamming = faiss::bvec_hamming_ref;
+            faiss::bvec_jaccard = faiss::bvec_jaccard_ref;
+            faiss::bvec_contains = faiss::bvec_contains_ref;
+        } else {
+            faiss::hook_init(cpu_flag);
+        }
+        const std::string name = use_ref ? "REF" : "HOOK";
+
+        std::vector<int32_t> ham_dis(nq * k);
+        std::vector<int64_t> ham_ids(nq * k);
+        faiss::int_maxheap_array_t ham_res = {size_t(nq), size_t(k), ham_ids.data(), ham_dis.data()};
+        auto t0 = std::chrono::system_clock::now();
+        faiss::hammings_knn_hc(&ham_res, xq.data(), xb.data(), nb, code_size, 1);
+        std::cout << name << "::HAMMING search takes " << BINARY::TimeSince(t0) / 1000 << "ms" << std::endl;
+
+        std::vector<float> jac_dis(nq * k);
+        std::vector<int64_t> jac_ids(nq * k);
+        faiss::float_maxheap_array_t jac_res = {size_t(nq), size_t(k), jac_ids.data(), jac_dis.data()};
+        t0 = std::chrono::system_clock::now();
+        faiss::binary_distence_knn_hc(faiss::METRIC_Jaccard, &jac_res, xq.data(), xb.data(), nb, code_size, 1);
+        std::cout << name << "::JACCARD search takes " << BINARY::TimeSince(t0) / 1000 << "ms" << std::endl;
+
+        std::vector<float> sub_dis(nq * k);
+        std::vector<int64_t> sub_ids(nq * k);
+        t0 = std::chrono::system_clock::now();
+        faiss::binary_distence_knn_mc(faiss::METRIC_Superstructure, xq.data(), xb.data(), nq, nb, k, code_size,
+                                      sub_dis.data(), sub_ids.data(), nullptr);
+        std::cout << name << "::SUPERSTRUCTURE search takes " << BINARY::TimeSince(t0) / 1000 << "ms" << std::endl;
+
+        static std::vector<int64_t> ref_ids;
+        std::vector<int64_t> ids = ham_ids;
+        ids.insert(ids.end(), jac_ids.begin(), jac_ids.end());
+        ids.insert(ids.end(), sub_ids.begin(), sub_ids.end());
+        if (use_ref) {
+            ref_ids = ids;
+        } else {
+            ASSERT_EQ(ref_ids, ids);
+        }
+    }
+}
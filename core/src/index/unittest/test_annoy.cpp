@@ -11,11 +11,17 @@
 
 #include <gtest/gtest.h>
 #include <src/index/knowhere/knowhere/index/vector_index/helpers/IndexParameter.h>
+#include <omp.h>
+#include <cstring>
 #include <iostream>
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include "knowhere/common/Exception.h"
+#include "knowhere/common/Timer.h"
 #include "knowhere/index/vector_index/IndexAnnoy.h"
+#include "knowhere/index/vector_index/adapter/VectorAdapter.h"
 
 #include "unittest/utils.h"
 
@@ -205,6 +211,53 @@ TEST_P(AnnoyTest, annoy_serialize) {
     }
 }
 
+TEST_P(AnnoyTest, annoy_benchmark) {
+    conf[milvus::knowhere::IndexParams::n_trees] = 16;
+    int max_threads = omp_get_max_threads();
+
+    // trees take their random seeds in order, so the forest does not depend on the number of threads
+    milvus::knowhere::TimeRecorder tc("Annoy");
+    omp_set_num_threads(1);
+    auto single = std::make_shared<milvus::knowhere::IndexAnnoy>();
+    single->BuildAll(base_dataset, conf);
+    tc.RecordSection("build with 1 thread");
+    omp_set_num_threads(max_threads);
+    index_->BuildAll(base_dataset, conf);
+    tc.RecordSection("build with " + std::to_string(max_threads) + " threads");
+
+    auto single_bin = single->Serialize().GetByName("annoy_index_data");
+    auto bin = index_->Serialize().GetByName("annoy_index_data");
+    ASSERT_EQ(single_bin->size, bin->size);
+    ASSERT_EQ(memcmp(single_bin->data.get(), bin->data.get(), bin->size), 0);
+
+    // a batch shares the search buffers of each thread, one query at a time does not
+    const int64_t batch = 1000;
+    std::vector<float> xq_batch(batch * dim);
+    for (int64_t i = 0; i < batch; ++i) {
+        memcpy(xq_batch.data() + i * dim, xb.data() + (i * 7 % nb) * dim, dim * sizeof(float));
+    }
+    auto batch_dataset = milvus::knowhere::GenDataset(batch, dim, xq_batch.data());
+
+    tc.RecordSection("prepare");
+    auto result = index_->Query(batch_dataset, conf);
+    double batch_time = tc.RecordSection("batch of " + std::to_string(batch) + " queries");
+
+    auto ids = result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    auto dist = result->Get<float*>(milvus::knowhere::meta::DISTANCE);
+    for (int64_t i = 0; i < batch; ++i) {
+        auto one = index_->Query(milvus::knowhere::GenDataset(1, dim, xq_batch.data() + i * dim), conf);
+        auto one_ids = one->Get<int64_t*>(milvus::knowhere::meta::IDS);
+        auto one_dist = one->Get<float*>(milvus::knowhere::meta::DISTANCE);
+        for (int64_t j = 0; j < k; ++j) {
+            ASSERT_EQ(one_ids[j], ids[i * k + j]);
+            ASSERT_EQ(one_dist[j], dist[i * k + j]);
+        }
+    }
+    double single_time = tc.RecordSection("one query at a time");
+    std::cout << "Annoy QPS, batch: " << batch * 1e6 / batch_time << ", one at a time: " << batch * 1e6 / single_time
+              << std::endl;
+}
+
 /*
  * faiss style test
  * keep it
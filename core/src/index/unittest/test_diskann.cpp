@@ -0,0 +1,249 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "knowhere/common/Exception.h"
+#include "knowhere/index/vector_index/ConfAdapter.h"
+#include "knowhere/index/vector_index/IndexDiskANN.h"
+#include "knowhere/index/vector_index/adapter/VectorAdapter.h"
+#include "knowhere/index/vector_index/helpers/IndexParameter.h"
+#include "unittest/utils.h"
+
+using ::testing::TestWithParam;
+using ::testing::Values;
+
+class DiskANNTest : public DataGen, public TestWithParam<std::string> {
+ protected:
+    void
+    SetUp() override {
+        Generate(64, 10000, 10);  // dim = 64, nb = 10000, nq = 10
+        sector_file_ = ::testing::TempDir() + "test_diskann.sectors";
+        index_ = std::make_shared<milvus::knowhere::IndexDiskANN>();
+        conf_ = milvus::knowhere::Config{
+            {milvus::knowhere::meta::DIM, 64},
+            {milvus::knowhere::meta::ROWS, 10000},
+            {milvus::knowhere::meta::TOPK, 10},
+            {milvus::knowhere::IndexParams::out_degree, 32},
+            {milvus::knowhere::IndexParams::search_length, 100},
+            {milvus::knowhere::IndexParams::candidate, 200},
+            {milvus::knowhere::IndexParams::m, 16},
+            {milvus::knowhere::IndexParams::alpha, 1.2},
+            {milvus::knowhere::IndexParams::cache_nodes, 100},
+            {milvus::knowhere::IndexParams::beam_width, 4},
+            {milvus::knowhere::Metric::TYPE, milvus::knowhere::Metric::L2},
+        };
+    }
+
+    void
+    TearDown() override {
+        std::remove(sector_file_.c_str());
+    }
+
+    // keep the sectors in a file of their own, as the codec does
+    void
+    MoveSectorsToFile(milvus::knowhere::BinarySet& bs) {
+        auto sectors = bs.Erase(SECTOR_DATA);
+        ASSERT_NE(sectors, nullptr);
+        std::ofstream out(sector_file_, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(sectors->data.get()), sectors->size);
+        out.close();
+
+        std::shared_ptr<uint8_t[]> path(new uint8_t[sector_file_.size()]);
+        memcpy(path.get(), sector_file_.data(), sector_file_.size());
+        bs.Append(SECTOR_FILE, path, sector_file_.size());
+    }
+
+ protected:
+    milvus::knowhere::Config conf_;
+    milvus::knowhere::IndexDiskANNPtr index_ = nullptr;
+    std::string sector_file_;
+};
+
+// fails every read after the first fail_after ones
+class FailingSectorReader : public milvus::knowhere::SectorReader {
+ public:
+    FailingSectorReader(const std::string& path, int64_t fail_after) : file_(path), fail_after_(fail_after) {
+    }
+
+    int64_t
+    Size() const override {
+        return file_.Size();
+    }
+
+    void
+    Read(void* data, size_t length, int64_t offset) const override {
+        if (reads_++ >= fail_after_) {
+            throw milvus::knowhere::KnowhereException("sector read failed");
+        }
+        file_.Read(data, length, offset);
+    }
+
+ private:
+    milvus::knowhere::SectorFile file_;
+    int64_t fail_after_;
+    mutable std::atomic<int64_t> reads_{0};
+};
+
+INSTANTIATE_TEST_CASE_P(DiskANNParameters, DiskANNTest, Values("DISKANN"));
+
+TEST_P(DiskANNTest, diskann_basic) {
+    assert(!xb.empty());
+
+    // null index
+    {
+        ASSERT_ANY_THROW(index_->Serialize());
+        ASSERT_ANY_THROW(index_->Query(query_dataset, conf_));
+        ASSERT_ANY_THROW(index_->Add(base_dataset, conf_));
+        ASSERT_ANY_THROW(index_->AddWithoutIds(base_dataset, conf_));
+        ASSERT_ANY_THROW(index_->Count());
+        ASSERT_ANY_THROW(index_->Dim());
+    }
+
+    auto adapter = std::make_shared<milvus::knowhere::DiskANNConfAdapter>();
+    ASSERT_TRUE(adapter->CheckTrain(conf_, index_->index_mode()));
+    ASSERT_TRUE(adapter->CheckSearch(conf_, index_->index_type(), index_->index_mode()));
+
+    index_->BuildAll(base_dataset, conf_);
+    EXPECT_EQ(index_->Count(), nb);
+    EXPECT_EQ(index_->Dim(), dim);
+
+    auto result = index_->Query(query_dataset, conf_);
+    AssertAnns(result, nq, k);
+
+    milvus::knowhere::BinarySet bs = index_->Serialize();
+    auto loaded = std::make_shared<milvus::knowhere::IndexDiskANN>();
+    loaded->Load(bs);
+    EXPECT_EQ(loaded->Count(), nb);
+    auto loaded_result = loaded->Query(query_dataset, conf_);
+    AssertAnns(loaded_result, nq, k);
+}
+
+TEST_P(DiskANNTest, diskann_sector_file) {
+    index_->BuildAll(base_dataset, conf_);
+    auto memory_result = index_->Query(query_dataset, conf_);
+
+    milvus::knowhere::BinarySet bs = index_->Serialize();
+    int64_t sectors_size = bs.GetByName(SECTOR_DATA)->size;
+    EXPECT_EQ(sectors_size % 4096, 0);
+    MoveSectorsToFile(bs);
+
+    auto disk_index = std::make_shared<milvus::knowhere::IndexDiskANN>();
+    disk_index->Load(bs);
+    EXPECT_LT(disk_index->IndexSize(), sectors_size);
+
+    auto disk_result = disk_index->Query(query_dataset, conf_);
+    AssertAnns(disk_result, nq, k);
+    // every expanded node is read at most once, a search expands about search_length of them
+    int64_t search_length = conf_[milvus::knowhere::IndexParams::search_length];
+    EXPECT_GT(disk_index->SectorReads(), 0);
+    EXPECT_LE(disk_index->SectorReads(), nq * search_length * 2);
+
+    auto memory_ids = memory_result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    auto disk_ids = disk_result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    for (int64_t i = 0; i < nq * k; i++) {
+        EXPECT_EQ(memory_ids[i], disk_ids[i]);
+    }
+
+    // a disk index serializes the sectors read back from the file
+    auto bs2 = disk_index->Serialize();
+    EXPECT_EQ(bs2.GetByName(SECTOR_DATA)->size, sectors_size);
+}
+
+TEST_P(DiskANNTest, diskann_sector_reader) {
+    index_->BuildAll(base_dataset, conf_);
+    auto memory_result = index_->Query(query_dataset, conf_);
+
+    milvus::knowhere::BinarySet bs = index_->Serialize();
+    MoveSectorsToFile(bs);
+    bs.Erase(SECTOR_FILE);
+
+    // without sectors the index loads, but can not search until a reader is set
+    auto disk_index = std::make_shared<milvus::knowhere::IndexDiskANN>();
+    disk_index->Load(bs);
+    ASSERT_ANY_THROW(disk_index->Query(query_dataset, conf_));
+
+    // a reader that fails while searching fails the query instead of the process
+    disk_index->SetSectorReader(std::make_shared<FailingSectorReader>(sector_file_, 200));
+    ASSERT_ANY_THROW(disk_index->Query(query_dataset, conf_));
+
+    disk_index->SetSectorReader(std::make_shared<milvus::knowhere::SectorFile>(sector_file_));
+    auto disk_result = disk_index->Query(query_dataset, conf_);
+    auto memory_ids = memory_result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    auto disk_ids = disk_result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    for (int64_t i = 0; i < nq * k; i++) {
+        EXPECT_EQ(memory_ids[i], disk_ids[i]);
+    }
+
+    // sectors of another index are refused
+    std::string short_file = sector_file_ + ".short";
+    std::ofstream(short_file, std::ios::binary).write("x", 1);
+    ASSERT_ANY_THROW(disk_index->SetSectorReader(std::make_shared<milvus::knowhere::SectorFile>(short_file)));
+    std::remove(short_file.c_str());
+}
+
+TEST_P(DiskANNTest, diskann_delete) {
+    index_->BuildAll(base_dataset, conf_);
+
+    faiss::ConcurrentBitsetPtr bitset = std::make_shared<faiss::ConcurrentBitset>(nb);
+    for (auto i = 0; i < nq; ++i) {
+        bitset->set(i);
+    }
+
+    auto result1 = index_->Query(query_dataset, conf_);
+    AssertAnns(result1, nq, k);
+
+    index_->SetBlacklist(bitset);
+    auto result2 = index_->Query(query_dataset, conf_);
+    AssertAnns(result2, nq, k, CheckMode::CHECK_NOT_EQUAL);
+}
+
+TEST_P(DiskANNTest, diskann_recall) {
+    index_->BuildAll(base_dataset, conf_);
+
+    // exact neighbors of every query
+    std::vector<int64_t> gt(nq * k);
+    for (int64_t i = 0; i < nq; i++) {
+        std::vector<std::pair<float, int64_t>> dists(nb);
+        for (int64_t j = 0; j < nb; j++) {
+            float d = 0;
+            for (int64_t t = 0; t < dim; t++) {
+                float diff = xq[i * dim + t] - xb[j * dim + t];
+                d += diff * diff;
+            }
+            dists[j] = {d, j};
+        }
+        std::partial_sort(dists.begin(), dists.begin() + k, dists.end());
+        for (int64_t j = 0; j < k; j++) {
+            gt[i * k + j] = dists[j].second;
+        }
+    }
+
+    auto result = index_->Query(query_dataset, conf_);
+    auto ids = result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    int64_t hit = 0;
+    for (int64_t i = 0; i < nq; i++) {
+        for (int64_t j = 0; j < k; j++) {
+            hit += std::count(gt.begin() + i * k, gt.begin() + (i + 1) * k, ids[i * k + j]);
+        }
+    }
+    float recall = hit / static_cast<float>(nq * k);
+    EXPECT_GT(recall, 0.9f);
+}
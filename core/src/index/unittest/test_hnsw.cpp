@@ -15,6 +15,7 @@
 #include <iostream>
 #include <random>
 #include "knowhere/common/Exception.h"
+#include "knowhere/index/vector_index/adapter/VectorAdapter.h"
 #include "unittest/utils.h"
 
 using ::testing::Combine;
@@ -136,6 +137,34 @@ TEST_P(HNSWTest, HNSW_delete) {
     */
 }
 
+TEST_P(HNSWTest, HNSW_incremental) {
+    assert(!xb.empty());
+
+    // start with a small capacity, the graph must grow while vectors arrive
+    auto train_conf = conf;
+    train_conf[milvus::knowhere::meta::ROWS] = 100;
+    index_->Train(milvus::knowhere::GenDataset(100, dim, nullptr), train_conf);
+
+    int64_t step = nb / 4;
+    for (int64_t count = step; count <= nb; count += step) {
+        index_->AddWithoutIds(milvus::knowhere::GenDataset(count, dim, xb.data()), conf);
+        EXPECT_EQ(index_->Count(), count);
+    }
+    EXPECT_EQ(index_->Dim(), dim);
+
+    milvus::knowhere::BinarySet bs = index_->Serialize();
+    milvus::knowhere::BinaryPtr bptr = std::make_shared<milvus::knowhere::Binary>();
+    bptr->data = std::shared_ptr<uint8_t[]>((uint8_t*)xb.data(), [&](uint8_t*) {});
+    bptr->size = dim * nb * sizeof(float);
+    bs.Append(RAW_DATA, bptr);
+
+    index_->Load(bs);
+    EXPECT_EQ(index_->Count(), nb);
+
+    auto result = index_->Query(query_dataset, conf);
+    AssertAnns(result, nq, k);
+}
+
 /*
 TEST_P(HNSWTest, HNSW_serialize) {
     auto serialize = [](const std::string& filename, milvus::knowhere::BinaryPtr& bin, uint8_t* ret) {
@@ -13,12 +13,17 @@
 
 #include <fiu-control.h>
 #include <fiu-local.h>
+#include <faiss/utils/half_precision.h>
+#include <chrono>
 #include <iostream>
+#include <set>
 #include <thread>
 
 #include "knowhere/common/Exception.h"
 #include "knowhere/index/IndexType.h"
 #include "knowhere/index/vector_index/IndexIDMAP.h"
+#include "knowhere/index/vector_index/IndexIDMAPHalf.h"
+#include "knowhere/index/vector_index/adapter/VectorAdapter.h"
 #ifdef MILVUS_GPU_VERSION
 #include <faiss/gpu/GpuCloner.h>
 #include "knowhere/index/vector_index/gpu/IndexGPUIDMAP.h"
@@ -244,3 +249,180 @@ TEST_P(IDMAPTest, idmap_copy) {
     }
 }
 #endif
+
+namespace {
+
+std::vector<uint16_t>
+ToHalf(const std::vector<float>& data, milvus::knowhere::HalfType half_type) {
+    std::vector<uint16_t> half(data.size());
+    if (half_type == milvus::knowhere::HalfType::FP16) {
+        faiss::fvec_to_fp16(data.data(), half.data(), data.size());
+    } else {
+        faiss::fvec_to_bf16(data.data(), half.data(), data.size());
+    }
+    return half;
+}
+
+double
+Recall(const milvus::knowhere::DatasetPtr& result, const milvus::knowhere::DatasetPtr& ground_truth, int64_t nq,
+       int64_t k) {
+    auto res_ids = result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    auto gt_ids = ground_truth->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    int64_t hit = 0;
+    for (int64_t i = 0; i < nq; i++) {
+        std::set<int64_t> gt(gt_ids + i * k, gt_ids + (i + 1) * k);
+        for (int64_t j = 0; j < k; j++) {
+            hit += gt.count(res_ids[i * k + j]);
+        }
+    }
+    return (double)hit / (nq * k);
+}
+
+}  // namespace
+
+TEST_P(IDMAPTest, idmap_half) {
+    if (index_mode_ == milvus::knowhere::IndexMode::MODE_GPU) {
+        return;
+    }
+
+    for (auto metric : {milvus::knowhere::Metric::L2, milvus::knowhere::Metric::IP}) {
+        milvus::knowhere::Config conf{{milvus::knowhere::meta::DIM, dim},
+                                      {milvus::knowhere::meta::TOPK, k},
+                                      {milvus::knowhere::Metric::TYPE, metric}};
+        index_->Train(base_dataset, conf);
+        index_->Add(base_dataset, conf);
+        auto ground_truth = index_->Query(query_dataset, conf);
+
+        for (auto half_type : {milvus::knowhere::HalfType::FP16, milvus::knowhere::HalfType::BF16}) {
+            auto half_data = ToHalf(xb, half_type);
+            auto half_dataset = milvus::knowhere::GenDatasetWithIds(nb, dim, half_data.data(), ids.data());
+
+            auto half_index = std::make_shared<milvus::knowhere::IDMAPHalf>(half_type);
+            ASSERT_ANY_THROW(half_index->Query(query_dataset, conf));
+            half_index->Train(half_dataset, conf);
+            half_index->Add(half_dataset, conf);
+            EXPECT_EQ(half_index->Count(), nb);
+            EXPECT_EQ(half_index->Dim(), dim);
+            ASSERT_ANY_THROW(half_index->Serialize());
+
+            auto result = half_index->Query(query_dataset, conf);
+            if (metric == milvus::knowhere::Metric::L2) {
+                AssertAnns(result, nq, k);
+            }
+            EXPECT_GE(Recall(result, ground_truth, nq, k), 0.9);
+
+            // decoded vectors are close to the float ones, the index keeps no float copy
+            ASSERT_ANY_THROW(half_index->GetRawVectors());
+            std::vector<float> raw(nb * dim);
+            half_index->DecodeRawVectors(raw.data());
+            for (int64_t i = 0; i < nb * dim; i++) {
+                EXPECT_NEAR(raw[i], xb[i], std::abs(xb[i]) * 1e-2 + 1e-3);
+            }
+
+            faiss::ConcurrentBitsetPtr concurrent_bitset_ptr = std::make_shared<faiss::ConcurrentBitset>(nb);
+            for (int64_t i = 0; i < nq; ++i) {
+                concurrent_bitset_ptr->set(i);
+            }
+            half_index->SetBlacklist(concurrent_bitset_ptr);
+            auto result_bs = half_index->Query(query_dataset, conf);
+            AssertAnns(result_bs, nq, k, CheckMode::CHECK_NOT_EQUAL);
+        }
+    }
+}
+
+TEST_P(IDMAPTest, idmap_topk_bounds) {
+    if (index_mode_ == milvus::knowhere::IndexMode::MODE_GPU) {
+        return;
+    }
+
+    for (auto metric : {milvus::knowhere::Metric::L2, milvus::knowhere::Metric::IP}) {
+        milvus::knowhere::Config conf{{milvus::knowhere::meta::DIM, dim},
+                                      {milvus::knowhere::meta::TOPK, k},
+                                      {milvus::knowhere::Metric::TYPE, metric}};
+        auto index = std::make_shared<milvus::knowhere::IDMAP>();
+        index->Train(base_dataset, conf);
+        index->Add(base_dataset, conf);
+        auto result = index->Query(query_dataset, conf);
+        auto ids = result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+        auto dist = result->Get<float*>(milvus::knowhere::meta::DISTANCE);
+
+        // bound every query by the distance in the middle of its unbounded result
+        int64_t bound_pos = k / 2;
+        std::vector<float> bounds(nq);
+        for (int64_t i = 0; i < nq; i++) {
+            bounds[i] = dist[i * k + bound_pos];
+        }
+        conf[milvus::knowhere::meta::TOPK_BOUNDS] = bounds;
+        auto bounded = index->Query(query_dataset, conf);
+        auto bounded_ids = bounded->Get<int64_t*>(milvus::knowhere::meta::IDS);
+        auto bounded_dist = bounded->Get<float*>(milvus::knowhere::meta::DISTANCE);
+
+        bool is_ip = (metric == milvus::knowhere::Metric::IP);
+        for (int64_t i = 0; i < nq; i++) {
+            for (int64_t j = 0; j < k; j++) {
+                int64_t pos = i * k + j;
+                bool better = is_ip ? dist[pos] > bounds[i] : dist[pos] < bounds[i];
+                if (better) {
+                    EXPECT_EQ(bounded_ids[pos], ids[pos]);
+                    EXPECT_EQ(bounded_dist[pos], dist[pos]);
+                } else {
+                    EXPECT_EQ(bounded_ids[pos], -1);
+                }
+            }
+        }
+
+        conf[milvus::knowhere::meta::TOPK_BOUNDS] = std::vector<float>(nq + 1, 0.0f);
+        ASSERT_ANY_THROW(index->Query(query_dataset, conf));
+    }
+}
+
+// recall and throughput of half precision brute force search against float32, 768-dim embeddings
+TEST_P(IDMAPTest, idmap_half_benchmark) {
+    if (index_mode_ == milvus::knowhere::IndexMode::MODE_GPU) {
+        return;
+    }
+
+    const int64_t bench_dim = 768;
+    const int64_t bench_nb = 20000;
+    const int64_t bench_nq = 100;
+    const int64_t bench_k = 10;
+    std::vector<float> bench_xb, bench_xq;
+    std::vector<int64_t> bench_ids, bench_xids;
+    GenAll(bench_dim, bench_nb, bench_xb, bench_ids, bench_xids, bench_nq, bench_xq);
+    auto base = milvus::knowhere::GenDatasetWithIds(bench_nb, bench_dim, bench_xb.data(), bench_ids.data());
+    auto query = milvus::knowhere::GenDataset(bench_nq, bench_dim, bench_xq.data());
+
+    milvus::knowhere::Config conf{{milvus::knowhere::meta::DIM, bench_dim},
+                                  {milvus::knowhere::meta::TOPK, bench_k},
+                                  {milvus::knowhere::Metric::TYPE, milvus::knowhere::Metric::L2}};
+
+    auto timed_query = [&](const milvus::knowhere::IDMAPPtr& index, double& qps) {
+        auto start = std::chrono::steady_clock::now();
+        auto result = index->Query(query, conf);
+        auto end = std::chrono::steady_clock::now();
+        qps = bench_nq / std::chrono::duration<double>(end - start).count();
+        return result;
+    };
+
+    index_->Train(base, conf);
+    index_->Add(base, conf);
+    double float_qps;
+    auto ground_truth = timed_query(index_, float_qps);
+    std::cout << "FLOAT32: " << bench_nb * bench_dim * sizeof(float) << " bytes, qps " << float_qps << std::endl;
+
+    for (auto half_type : {milvus::knowhere::HalfType::FP16, milvus::knowhere::HalfType::BF16}) {
+        auto half_data = ToHalf(bench_xb, half_type);
+        auto half_base = milvus::knowhere::GenDatasetWithIds(bench_nb, bench_dim, half_data.data(), bench_ids.data());
+        auto half_index = std::make_shared<milvus::knowhere::IDMAPHalf>(half_type);
+        half_index->Train(half_base, conf);
+        half_index->Add(half_base, conf);
+
+        double half_qps;
+        auto result = timed_query(half_index, half_qps);
+        double recall = Recall(result, ground_truth, bench_nq, bench_k);
+        std::cout << (half_type == milvus::knowhere::HalfType::FP16 ? "FP16" : "BF16") << ": "
+                  << half_index->IndexSize() << " bytes, qps " << half_qps << ", recall@" << bench_k << " " << recall
+                  << std::endl;
+        EXPECT_GE(recall, 0.9);
+    }
+}
@@ -20,11 +20,17 @@
 #include <faiss/gpu/GpuIndexIVFFlat.h>
 #endif
 
+#include <faiss/FaissHook.h>
+#include <faiss/utils/pq4_fast_scan.h>
+#include <faiss/utils/pq4_fast_scan_avx.h>
+#include <faiss/utils/pq4_fast_scan_avx512.h>
+
 #include "knowhere/common/Exception.h"
 #include "knowhere/common/Timer.h"
 #include "knowhere/index/IndexType.h"
 #include "knowhere/index/vector_index/IndexIVF.h"
 #include "knowhere/index/vector_index/IndexIVFPQ.h"
+#include "knowhere/index/vector_index/IndexIVFPQFastScan.h"
 #include "knowhere/index/vector_index/IndexIVFSQ.h"
 #include "knowhere/index/vector_index/adapter/VectorAdapter.h"
 
@@ -86,6 +92,7 @@ INSTANTIATE_TEST_CASE_P(
         std::make_tuple(milvus::knowhere::IndexEnum::INDEX_FAISS_IVFSQ8H, milvus::knowhere::IndexMode::MODE_GPU),
 #endif
         std::make_tuple(milvus::knowhere::IndexEnum::INDEX_FAISS_IVFPQ, milvus::knowhere::IndexMode::MODE_CPU),
+        std::make_tuple(milvus::knowhere::IndexEnum::INDEX_FAISS_IVFPQFS, milvus::knowhere::IndexMode::MODE_CPU),
         std::make_tuple(milvus::knowhere::IndexEnum::INDEX_FAISS_IVFSQ8, milvus::knowhere::IndexMode::MODE_CPU)));
 
 TEST_P(IVFTest, ivf_basic_cpu) {
@@ -215,6 +222,79 @@ TEST_P(IVFTest, ivf_serialize) {
     }
 }
 
+TEST_P(IVFTest, ivfpq_fast_scan_rerank) {
+    if (index_type_ != milvus::knowhere::IndexEnum::INDEX_FAISS_IVFPQFS) {
+        return;
+    }
+
+    index_->Train(base_dataset, conf_);
+    index_->AddWithoutIds(base_dataset, conf_);
+    auto result = index_->Query(query_dataset, conf_);
+    AssertAnns(result, nq, k);
+
+    // attach raw vectors, distances of the re-ranked results are exact
+    auto binaryset = index_->Serialize();
+    auto raw = std::make_shared<milvus::knowhere::Binary>();
+    raw->data = std::shared_ptr<uint8_t[]>((uint8_t*)xb.data(), [&](uint8_t*) {});
+    raw->size = nb * dim * sizeof(float);
+    binaryset.Append(RAW_DATA, raw);
+    index_->Load(binaryset);
+    EXPECT_EQ(index_->Count(), nb);
+
+    auto rerank_conf = conf_;
+    rerank_conf[milvus::knowhere::IndexParams::refine_factor] = 4;
+    auto rerank_result = index_->Query(query_dataset, rerank_conf);
+    AssertAnns(rerank_result, nq, k);
+    auto ids = rerank_result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    auto dis = rerank_result->Get<float*>(milvus::knowhere::meta::DISTANCE);
+    for (int64_t i = 0; i < nq; ++i) {
+        EXPECT_FLOAT_EQ(dis[i * k], 0.0f);
+        for (int64_t j = 1; j < k; ++j) {
+            EXPECT_LE(dis[i * k + j - 1], dis[i * k + j]);
+            if (ids[i * k + j] >= 0) {
+                auto id = ids[i * k + j];
+                float expect = 0;
+                for (int64_t d = 0; d < dim; ++d) {
+                    float diff = xq[i * dim + d] - xb[id * dim + d];
+                    expect += diff * diff;
+                }
+                EXPECT_NEAR(dis[i * k + j], expect, 1e-3 * std::max(1.0f, expect));
+            }
+        }
+    }
+}
+
+// every kernel the hook may pick gives the sums of the reference one, whatever the number of sub-quantizers
+TEST(IVFPQFastScanTest, accumulate_kernels) {
+    std::vector<faiss::pq4_accumulate_func_ptr> kernels;
+    if (faiss::support_avx2()) {
+        kernels.push_back(faiss::pq4_accumulate_avx);
+    }
+    if (faiss::support_avx512()) {
+        kernels.push_back(faiss::pq4_accumulate_avx512);
+    }
+
+    const size_t nblocks = 3;
+    for (size_t M = 1; M <= 9; M++) {
+        std::vector<uint8_t> blocks(nblocks * M * 16);
+        std::vector<uint8_t> lut(M * 16);
+        for (auto& v : blocks) {
+            v = lrand48() % 256;
+        }
+        for (auto& v : lut) {
+            v = lrand48() % 256;
+        }
+
+        std::vector<uint16_t> expect(nblocks * faiss::PQ4_BLOCK_SIZE);
+        faiss::pq4_accumulate_ref(nblocks, M, blocks.data(), lut.data(), expect.data());
+        for (auto kernel : kernels) {
+            std::vector<uint16_t> sums(nblocks * faiss::PQ4_BLOCK_SIZE);
+            kernel(nblocks, M, blocks.data(), lut.data(), sums.data());
+            EXPECT_EQ(sums, expect) << "M = " << M;
+        }
+    }
+}
+
 // TODO(linxj): deprecated
 #ifdef MILVUS_GPU_VERSION
 TEST_P(IVFTest, clone_test) {
@@ -13,8 +13,14 @@
 
 #include <fiu-control.h>
 #include <fiu-local.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
+#include <limits>
 #include <thread>
+#include <vector>
 
 #ifdef MILVUS_GPU_VERSION
 #include <faiss/gpu/GpuIndexIVFFlat.h>
@@ -129,3 +135,250 @@ TEST_P(IVFNMCPUTest, ivf_basic_cpu) {
     milvus::knowhere::FaissGpuResourceMgr::GetInstance().Dump();
 #endif
 }
+
+TEST_P(IVFNMCPUTest, ivf_disk_mode) {
+    if (index_mode_ != milvus::knowhere::IndexMode::MODE_CPU) {
+        return;
+    }
+
+    index_->Train(base_dataset, conf_);
+    index_->AddWithoutIds(base_dataset, conf_);
+    milvus::knowhere::BinarySet bs = index_->Serialize(conf_);
+    auto memory_size = bs.GetByName("IVF")->size;
+
+    auto raw_data = base_dataset->Get<const void*>(milvus::knowhere::meta::TENSOR);
+    milvus::knowhere::BinaryPtr bptr = std::make_shared<milvus::knowhere::Binary>();
+    bptr->data = std::shared_ptr<uint8_t[]>((uint8_t*)raw_data, [&](uint8_t*) {});
+    bptr->size = dim * nb * sizeof(float);
+    bs.Append(RAW_DATA, bptr);
+    auto memory_index = IndexFactoryNM(index_type_, index_mode_);
+    memory_index->Load(bs);
+
+    // the lists are written once when the index is built, it serializes only its quantizer afterwards
+    std::string lists_path = ::testing::TempDir() + "ivf_disk_mode.ivfdata";
+    index_->MoveListsToDisk(lists_path, 0, (const uint8_t*)raw_data);
+    milvus::knowhere::BinarySet disk_bs = index_->Serialize(conf_);
+    EXPECT_LT(disk_bs.GetByName("IVF")->size, memory_size);
+
+    // a cache of a couple of lists forces most probes to read the file
+    int64_t list_bytes = nb / conf_[milvus::knowhere::IndexParams::nlist].get<int64_t>() *
+                         (dim * sizeof(float) + sizeof(int64_t));
+    auto disk_index = IndexFactoryNM(index_type_, index_mode_);
+    disk_index->Load(disk_bs);
+    disk_index->OpenListsOnDisk(lists_path, 2 * list_bytes);
+    auto disk_lists = disk_index->GetDiskLists();
+    ASSERT_NE(disk_lists, nullptr);
+    EXPECT_EQ(disk_lists->FileSize(), nb * (dim * sizeof(float) + sizeof(int64_t)));
+
+    auto memory_result = memory_index->Query(query_dataset, conf_);
+    auto disk_result = disk_index->Query(query_dataset, conf_);
+    auto memory_ids = memory_result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    auto disk_ids = disk_result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    auto memory_dis = memory_result->Get<float*>(milvus::knowhere::meta::DISTANCE);
+    auto disk_dis = disk_result->Get<float*>(milvus::knowhere::meta::DISTANCE);
+    for (int64_t i = 0; i < nq * k; i++) {
+        EXPECT_EQ(memory_ids[i], disk_ids[i]);
+        EXPECT_FLOAT_EQ(memory_dis[i], disk_dis[i]);
+    }
+    EXPECT_GT(disk_lists->CacheMisses(), 0);
+
+    // with room for every list, a repeated query never reads the file and every access of it is a hit
+    auto cached_index = IndexFactoryNM(index_type_, index_mode_);
+    cached_index->Load(disk_bs);
+    cached_index->OpenListsOnDisk(lists_path, disk_lists->FileSize());
+    auto cached_lists = cached_index->GetDiskLists();
+    cached_index->Query(query_dataset, conf_);
+    auto misses = cached_lists->CacheMisses();
+    auto hits = cached_lists->CacheHits();
+    EXPECT_GT(misses, 0);
+    auto result = cached_index->Query(query_dataset, conf_);
+    AssertAnns(result, nq, k);
+    EXPECT_EQ(cached_lists->CacheMisses(), misses);
+    EXPECT_EQ(cached_lists->CacheHits() - hits, hits + misses);
+
+    faiss::ConcurrentBitsetPtr concurrent_bitset_ptr = std::make_shared<faiss::ConcurrentBitset>(nb);
+    for (int64_t i = 0; i < nq; ++i) {
+        concurrent_bitset_ptr->set(i);
+    }
+    disk_index->SetBlacklist(concurrent_bitset_ptr);
+    auto result_bs = disk_index->Query(query_dataset, conf_);
+    AssertAnns(result_bs, nq, k, CheckMode::CHECK_NOT_EQUAL);
+
+    // a lists file that does not belong to the index is refused
+    auto other_index = IndexFactoryNM(index_type_, index_mode_);
+    other_index->Load(disk_bs);
+    ASSERT_ANY_THROW(other_index->OpenListsOnDisk(lists_path + ".missing", 0));
+
+    std::remove(lists_path.c_str());
+}
+
+TEST_P(IVFNMCPUTest, ivf_disk_mode_benchmark) {
+    if (index_mode_ != milvus::knowhere::IndexMode::MODE_CPU) {
+        return;
+    }
+
+    const int bench_dim = 128, bench_nb = 100000, bench_nq = 1000, bench_nlist = 512;
+    Generate(bench_dim, bench_nb, bench_nq);
+
+    auto conf = conf_;
+    conf[milvus::knowhere::meta::DIM] = bench_dim;
+    conf[milvus::knowhere::IndexParams::nlist] = bench_nlist;
+    index_->Train(base_dataset, conf);
+    index_->AddWithoutIds(base_dataset, conf);
+    milvus::knowhere::BinarySet bs = index_->Serialize(conf);
+
+    auto raw_data = base_dataset->Get<const void*>(milvus::knowhere::meta::TENSOR);
+    milvus::knowhere::BinaryPtr bptr = std::make_shared<milvus::knowhere::Binary>();
+    bptr->data = std::shared_ptr<uint8_t[]>((uint8_t*)raw_data, [&](uint8_t*) {});
+    bptr->size = bench_dim * bench_nb * sizeof(float);
+    bs.Append(RAW_DATA, bptr);
+    auto memory_index = IndexFactoryNM(index_type_, index_mode_);
+    memory_index->Load(bs);
+
+    std::string lists_path = ::testing::TempDir() + "ivf_disk_mode_benchmark.ivfdata";
+    index_->MoveListsToDisk(lists_path, 0, (const uint8_t*)raw_data);
+    milvus::knowhere::BinarySet disk_bs = index_->Serialize(conf);
+    int64_t file_size = bench_nb * (bench_dim * sizeof(float) + sizeof(int64_t));
+
+    // without a cache every probe reads its list from the file (usually out of the page cache of the OS),
+    // a tenth of the lists or all of them fit in the cache of the other two
+    auto disk_index = [&](int64_t cache_size) {
+        auto index = IndexFactoryNM(index_type_, index_mode_);
+        index->Load(disk_bs);
+        index->OpenListsOnDisk(lists_path, cache_size);
+        return index;
+    };
+    std::vector<std::pair<std::string, milvus::knowhere::IVFNMPtr>> indexes = {
+        {"memory", memory_index},
+        {"disk 0%", disk_index(0)},
+        {"disk 10%", disk_index(file_size / 10)},
+        {"disk 100%", disk_index(file_size)}};
+
+    std::vector<milvus::knowhere::DatasetPtr> queries;
+    for (int i = 0; i < bench_nq; ++i) {
+        queries.push_back(milvus::knowhere::GenDataset(1, bench_dim, xq.data() + i * bench_dim));
+    }
+    auto elapsed = [](const std::chrono::steady_clock::time_point& start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    printf("\nIVF_NM | nb = %d, dim = %d, nlist = %d, nq = %d, topk = %d, one query per call\n", bench_nb, bench_dim,
+           bench_nlist, bench_nq, k);
+    printf("==============================================================\n");
+    printf("    mode    | nprobe |   QPS   | latency (ms) | cache hit rate\n");
+    for (int64_t nprobe : {8, 32, 128}) {
+        conf[milvus::knowhere::IndexParams::nprobe] = nprobe;
+        std::vector<int64_t> memory_ids;
+        for (auto& mode : indexes) {
+            auto lists = mode.second->GetDiskLists();
+            int64_t hits = lists ? lists->CacheHits() : 0;
+            int64_t misses = lists ? lists->CacheMisses() : 0;
+
+            // best of three rounds, the first one also fills the caches
+            double best = std::numeric_limits<double>::max();
+            std::vector<int64_t> ids(bench_nq * k);
+            for (int round = 0; round < 3; ++round) {
+                auto start = std::chrono::steady_clock::now();
+                for (int i = 0; i < bench_nq; ++i) {
+                    auto result = mode.second->Query(queries[i], conf);
+                    auto result_ids = result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+                    std::copy(result_ids, result_ids + k, ids.begin() + i * k);
+                }
+                best = std::min(best, elapsed(start));
+            }
+
+            // disk mode has to find the very same neighbors as the index in memory
+            if (memory_ids.empty()) {
+                memory_ids = ids;
+            } else {
+                ASSERT_EQ(ids, memory_ids);
+            }
+
+            if (lists) {
+                hits = lists->CacheHits() - hits;
+                misses = lists->CacheMisses() - misses;
+                printf(" %10s | %6ld | %7.0f | %12.4f | %13.2f%%\n", mode.first.c_str(), nprobe, bench_nq / best,
+                       best * 1000 / bench_nq, hits * 100.0 / std::max<int64_t>(hits + misses, 1));
+            } else {
+                printf(" %10s | %6ld | %7.0f | %12.4f |\n", mode.first.c_str(), nprobe, bench_nq / best,
+                       best * 1000 / bench_nq);
+            }
+        }
+    }
+    printf("==============================================================\n");
+
+    std::remove(lists_path.c_str());
+}
+
+TEST_P(IVFNMCPUTest, ivf_list_order) {
+    if (index_mode_ != milvus::knowhere::IndexMode::MODE_CPU) {
+        return;
+    }
+
+    index_->Train(base_dataset, conf_);
+    index_->AddWithoutIds(base_dataset, conf_);
+
+    std::vector<int64_t> order;
+    index_->GetListOrder(order);
+    ASSERT_EQ(order.size(), nb);
+    std::vector<int64_t> new_offset(nb, -1);
+    for (int64_t i = 0; i < nb; ++i) {
+        ASSERT_GE(order[i], 0);
+        ASSERT_LT(order[i], nb);
+        ASSERT_EQ(new_offset[order[i]], -1);
+        new_offset[order[i]] = i;
+    }
+
+    auto attach_raw_data = [&](milvus::knowhere::BinarySet& bs, const float* data) {
+        milvus::knowhere::BinaryPtr bptr = std::make_shared<milvus::knowhere::Binary>();
+        bptr->data = std::shared_ptr<uint8_t[]>((uint8_t*)data, [&](uint8_t*) {});
+        bptr->size = dim * nb * sizeof(float);
+        bs.Append(RAW_DATA, bptr);
+    };
+
+    milvus::knowhere::BinarySet bs = index_->Serialize(conf_);
+    attach_raw_data(bs, xb.data());
+    auto plain_index = IndexFactoryNM(index_type_, index_mode_);
+    plain_index->Load(bs);
+
+    // the raw data moves as the offsets in the lists are renumbered
+    index_->RenumberInListOrder();
+    std::vector<float> arranged(xb.size());
+    for (int64_t i = 0; i < nb; ++i) {
+        memcpy(arranged.data() + i * dim, xb.data() + order[i] * dim, dim * sizeof(float));
+    }
+    milvus::knowhere::BinarySet arranged_bs = index_->Serialize(conf_);
+    attach_raw_data(arranged_bs, arranged.data());
+    auto arranged_index = IndexFactoryNM(index_type_, index_mode_);
+    arranged_index->Load(arranged_bs);
+
+    std::vector<int64_t> arranged_order;
+    arranged_index->GetListOrder(arranged_order);
+    for (int64_t i = 0; i < nb; ++i) {
+        ASSERT_EQ(arranged_order[i], i);
+    }
+
+    auto AssertSameAnns = [&](const milvus::knowhere::DatasetPtr& plain, const milvus::knowhere::DatasetPtr& moved) {
+        auto plain_ids = plain->Get<int64_t*>(milvus::knowhere::meta::IDS);
+        auto moved_ids = moved->Get<int64_t*>(milvus::knowhere::meta::IDS);
+        auto plain_dis = plain->Get<float*>(milvus::knowhere::meta::DISTANCE);
+        auto moved_dis = moved->Get<float*>(milvus::knowhere::meta::DISTANCE);
+        for (int64_t i = 0; i < nq * k; ++i) {
+            EXPECT_EQ(plain_ids[i], moved_ids[i] == -1 ? -1 : order[moved_ids[i]]);
+            EXPECT_FLOAT_EQ(plain_dis[i], moved_dis[i]);
+        }
+    };
+
+    AssertSameAnns(plain_index->Query(query_dataset, conf_), arranged_index->Query(query_dataset, conf_));
+
+    // deleted offsets move with the vectors
+    faiss::ConcurrentBitsetPtr plain_bitset = std::make_shared<faiss::ConcurrentBitset>(nb);
+    faiss::ConcurrentBitsetPtr arranged_bitset = std::make_shared<faiss::ConcurrentBitset>(nb);
+    for (int64_t i = 0; i < nq; ++i) {
+        plain_bitset->set(i);
+        arranged_bitset->set(new_offset[i]);
+    }
+    plain_index->SetBlacklist(plain_bitset);
+    arranged_index->SetBlacklist(arranged_bitset);
+    AssertSameAnns(plain_index->Query(query_dataset, conf_), arranged_index->Query(query_dataset, conf_));
+}
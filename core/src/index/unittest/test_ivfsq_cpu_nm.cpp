@@ -13,8 +13,10 @@
 
 #include <fiu-control.h>
 #include <fiu-local.h>
+#include <cstring>
 #include <iostream>
 #include <thread>
+#include <vector>
 
 #ifdef MILVUS_GPU_VERSION
 #include <faiss/gpu/GpuIndexIVFFlat.h>
@@ -131,3 +133,46 @@ TEST_P(IVFSQNMCPUTest, ivf_basic_cpu) {
     milvus::knowhere::FaissGpuResourceMgr::GetInstance().Dump();
 #endif
 }
+
+TEST_P(IVFSQNMCPUTest, ivf_list_order) {
+    if (index_mode_ != milvus::knowhere::IndexMode::MODE_CPU) {
+        return;
+    }
+
+    index_->Train(base_dataset, conf_);
+    index_->AddWithoutIds(base_dataset, conf_);
+
+    std::vector<int64_t> order;
+    index_->GetListOrder(order);
+    ASSERT_EQ(order.size(), nb);
+
+    milvus::knowhere::BinarySet bs = index_->Serialize();
+    auto plain_index = std::make_shared<milvus::knowhere::IVFSQNR_NM>();
+    plain_index->Load(bs);
+
+    // once renumbered, the codes are serialized as they are arranged in the lists
+    index_->RenumberInListOrder();
+    milvus::knowhere::BinarySet arranged_bs = index_->Serialize();
+    auto code_size = dynamic_cast<faiss::IndexIVFScalarQuantizer*>(index_->index_.get())->code_size;
+    auto plain_codes = bs.GetByName(SQ8_DATA);
+    auto arranged_codes = arranged_bs.GetByName(SQ8_DATA);
+    ASSERT_EQ(plain_codes->size, arranged_codes->size);
+    for (int64_t i = 0; i < nb; ++i) {
+        ASSERT_EQ(memcmp(arranged_codes->data.get() + i * code_size, plain_codes->data.get() + order[i] * code_size,
+                         code_size),
+                  0);
+    }
+    auto arranged_index = std::make_shared<milvus::knowhere::IVFSQNR_NM>();
+    arranged_index->Load(arranged_bs);
+
+    auto plain_result = plain_index->Query(query_dataset, conf_);
+    auto arranged_result = arranged_index->Query(query_dataset, conf_);
+    auto plain_ids = plain_result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    auto arranged_ids = arranged_result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    auto plain_dis = plain_result->Get<float*>(milvus::knowhere::meta::DISTANCE);
+    auto arranged_dis = arranged_result->Get<float*>(milvus::knowhere::meta::DISTANCE);
+    for (int64_t i = 0; i < nq * k; ++i) {
+        EXPECT_EQ(plain_ids[i], arranged_ids[i] == -1 ? -1 : order[arranged_ids[i]]);
+        EXPECT_FLOAT_EQ(plain_dis[i], arranged_dis[i]);
+    }
+}
@@ -12,9 +12,16 @@
 #include <fiu-control.h>
 #include <fiu-local.h>
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <limits>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "knowhere/common/Exception.h"
+#include "knowhere/index/vector_index/IndexIDMAP.h"
+#include "knowhere/index/vector_index/adapter/VectorAdapter.h"
 #include "knowhere/index/vector_index/helpers/IndexParameter.h"
 #include "knowhere/index/vector_offset_index/IndexNSG_NM.h"
 #ifdef MILVUS_GPU_VERSION
@@ -24,6 +31,7 @@
 #endif
 
 #include "knowhere/common/Timer.h"
+#include "knowhere/index/vector_index/impl/nsg/NNDescent.h"
 #include "knowhere/index/vector_index/impl/nsg/NSGIO.h"
 
 #include "unittest/utils.h"
@@ -200,3 +208,158 @@ TEST_F(NSGInterfaceTest, delete_test) {
         ASSERT_NE(I_before[i * k], I_after[i * k]);
     }
 }
+
+TEST_F(NSGInterfaceTest, colocate_test) {
+    assert(!xb.empty());
+
+    auto raw_data = base_dataset->Get<const void*>(milvus::knowhere::meta::TENSOR);
+    auto load = [&](std::shared_ptr<milvus::knowhere::NSG_NM>& index) {
+        milvus::knowhere::BinarySet bs = index->Serialize();
+        milvus::knowhere::BinaryPtr bptr = std::make_shared<milvus::knowhere::Binary>();
+        bptr->data = std::shared_ptr<uint8_t[]>((uint8_t*)raw_data, [&](uint8_t*) {});
+        bptr->size = dim * nb * sizeof(float);
+        bs.Append(RAW_DATA, bptr);
+        index->Load(bs);
+    };
+
+    train_conf[milvus::knowhere::meta::DEVICEID] = -1;
+    index_->BuildAll(base_dataset, train_conf);
+    load(index_);
+
+    auto colocated = std::make_shared<milvus::knowhere::NSG_NM>();
+    train_conf[milvus::knowhere::IndexParams::colocate_vectors] = true;
+    colocated->BuildAll(base_dataset, train_conf);
+
+    // the co-located layout searches without the raw data
+    auto result = colocated->Query(query_dataset, search_conf);
+    AssertAnns(result, nq, k);
+
+    load(colocated);
+    ASSERT_EQ(colocated->Count(), nb);
+
+    milvus::knowhere::TimeRecorder tc("NSG layout");
+    for (int i = 0; i < 10; ++i) {
+        index_->Query(query_dataset, search_conf);
+    }
+    tc.RecordSection("adjacency");
+    for (int i = 0; i < 10; ++i) {
+        result = colocated->Query(query_dataset, search_conf);
+    }
+    tc.RecordSection("co-located");
+    AssertAnns(result, nq, k);
+}
+
+TEST_F(NSGInterfaceTest, layout_benchmark) {
+    const int bench_dim = 128, bench_nb = 100000, bench_nq = 1000;
+    Generate(bench_dim, bench_nb, bench_nq);
+
+    train_conf[milvus::knowhere::meta::DIM] = bench_dim;
+    train_conf[milvus::knowhere::meta::DEVICEID] = -1;
+    train_conf[milvus::knowhere::meta::TOPK] = k;
+
+    // exact neighbors to measure recall against
+    auto idmap = std::make_shared<milvus::knowhere::IDMAP>();
+    idmap->Train(base_dataset, train_conf);
+    idmap->AddWithoutIds(base_dataset, train_conf);
+    auto gt = idmap->Query(query_dataset, train_conf)->Get<int64_t*>(milvus::knowhere::meta::IDS);
+
+    auto raw_data = base_dataset->Get<const void*>(milvus::knowhere::meta::TENSOR);
+    auto elapsed = [](const std::chrono::steady_clock::time_point& start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    printf("\nNSG | nb = %d, dim = %d, nq = %d, topk = %d, one query per call\n", bench_nb, bench_dim, bench_nq, k);
+    printf("==============================================================\n");
+    printf("   layout   |   L   |  recall  |   QPS   | latency (ms)\n");
+    for (auto& layout : {"adjacency", "csr", "co-located"}) {
+        auto conf = train_conf;
+        conf[milvus::knowhere::IndexParams::compact_graph] = std::string(layout) == "csr";
+        conf[milvus::knowhere::IndexParams::colocate_vectors] = std::string(layout) == "co-located";
+        auto index = std::make_shared<milvus::knowhere::NSG_NM>();
+        index->BuildAll(base_dataset, conf);
+
+        milvus::knowhere::BinarySet bs = index->Serialize();
+        milvus::knowhere::BinaryPtr bptr = std::make_shared<milvus::knowhere::Binary>();
+        bptr->data = std::shared_ptr<uint8_t[]>((uint8_t*)raw_data, [&](uint8_t*) {});
+        bptr->size = bench_dim * bench_nb * sizeof(float);
+        bs.Append(RAW_DATA, bptr);
+        index->Load(bs);
+
+        for (int64_t search_length : {40, 100, 200}) {
+            conf[milvus::knowhere::IndexParams::search_length] = search_length;
+            std::vector<milvus::knowhere::DatasetPtr> queries;
+            for (int i = 0; i < bench_nq; ++i) {
+                queries.push_back(milvus::knowhere::GenDataset(1, bench_dim, xq.data() + i * bench_dim));
+            }
+
+            // best of three rounds, the first one also warms up the caches
+            double best = std::numeric_limits<double>::max();
+            int64_t hit = 0;
+            for (int round = 0; round < 3; ++round) {
+                hit = 0;
+                auto start = std::chrono::steady_clock::now();
+                for (int i = 0; i < bench_nq; ++i) {
+                    auto ids = index->Query(queries[i], conf)->Get<int64_t*>(milvus::knowhere::meta::IDS);
+                    for (int j = 0; j < k; ++j) {
+                        hit += std::count(gt + i * k, gt + (i + 1) * k, ids[j]);
+                    }
+                }
+                best = std::min(best, elapsed(start));
+            }
+            float recall = static_cast<float>(hit) / (bench_nq * k);
+            printf(" %10s | %5ld | %8.4f | %7.0f | %8.4f\n", layout, search_length, recall, bench_nq / best,
+                   best * 1000 / bench_nq);
+            ASSERT_GT(recall, 0.5);
+        }
+    }
+    printf("==============================================================\n");
+}
+
+TEST_F(NSGInterfaceTest, nn_descent_test) {
+    assert(!xb.empty());
+
+    const size_t knn = 20, nsample = 100;
+    milvus::knowhere::impl::DistanceL2 distance(dim);
+    milvus::knowhere::impl::NNDescentParams params;
+    params.k = knn;
+    milvus::knowhere::impl::Graph knng;
+    milvus::knowhere::TimeRecorder tc("NN-descent");
+    milvus::knowhere::impl::NNDescent(xb.data(), nb, dim, &distance).Build(params, knng);
+    tc.RecordSection("knng");
+    ASSERT_EQ(knng.size(), nb);
+
+    // recall against the exact neighbors of a few nodes
+    size_t hit = 0;
+    for (size_t n = 0; n < nsample; ++n) {
+        std::vector<std::pair<float, int64_t>> exact;
+        for (int64_t i = 0; i < nb; ++i) {
+            if (i != static_cast<int64_t>(n)) {
+                exact.emplace_back(distance.Compare(xb.data() + n * dim, xb.data() + i * dim, dim), i);
+            }
+        }
+        std::partial_sort(exact.begin(), exact.begin() + knn, exact.end());
+        ASSERT_EQ(knng[n].size(), knn);
+        for (size_t i = 0; i < knn; ++i) {
+            hit += std::count(knng[n].begin(), knng[n].end(), exact[i].second);
+        }
+    }
+    float recall = static_cast<float>(hit) / (nsample * knn);
+    std::cout << "NN-descent recall@" << knn << ": " << recall << std::endl;
+    ASSERT_GT(recall, 0.8);
+
+    train_conf[milvus::knowhere::meta::DEVICEID] = -1;
+    train_conf[milvus::knowhere::IndexParams::nn_descent] = true;
+    index_->BuildAll(base_dataset, train_conf);
+    tc.RecordSection("build");
+
+    auto raw_data = base_dataset->Get<const void*>(milvus::knowhere::meta::TENSOR);
+    milvus::knowhere::BinarySet bs = index_->Serialize();
+    milvus::knowhere::BinaryPtr bptr = std::make_shared<milvus::knowhere::Binary>();
+    bptr->data = std::shared_ptr<uint8_t[]>((uint8_t*)raw_data, [&](uint8_t*) {});
+    bptr->size = dim * nb * sizeof(float);
+    bs.Append(RAW_DATA, bptr);
+    index_->Load(bs);
+
+    auto result = index_->Query(query_dataset, search_conf);
+    AssertAnns(result, nq, k);
+}
@@ -0,0 +1,131 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "knowhere/index/structured_index/StructuredIndexBitmap.h"
+#include "knowhere/index/structured_index/StructuredIndexSort.h"
+
+namespace {
+
+std::vector<int>
+GenCategoryData(int range, int n) {
+    std::default_random_engine re(42);
+    std::uniform_int_distribution<int> unif(0, range - 1);
+    std::vector<int> data(n);
+    for (auto& v : data) {
+        v = unif(re);
+    }
+    return data;
+}
+
+}  // namespace
+
+TEST(STRUCTUREDINDEXBITMAP_TEST, test_cardinality) {
+    auto data = GenCategoryData(20, 10000);
+    ASSERT_TRUE(milvus::knowhere::StructuredIndexBitmap<int>::IsLowCardinality(data.size(), data.data()));
+    ASSERT_FALSE(milvus::knowhere::StructuredIndexBitmap<int>::IsLowCardinality(data.size(), data.data(), 10));
+
+    milvus::knowhere::StructuredIndexBitmap<int> index(data.size(), data.data());
+    ASSERT_EQ(index.Cardinality(), 20);
+}
+
+TEST(STRUCTUREDINDEXBITMAP_TEST, test_in_not_in) {
+    int n = 1001;
+    auto data = GenCategoryData(20, n);
+    milvus::knowhere::StructuredIndexBitmap<int> index(n, data.data());
+
+    std::vector<int> terms = {1, 3, 5, 7, 11, 13, 17, 19, 100};
+    auto in_res = index.In(terms.size(), terms.data());
+    auto not_in_res = index.NotIn(terms.size(), terms.data());
+    for (auto i = 0; i < n; ++i) {
+        bool hit = std::find(terms.begin(), terms.end(), data[i]) != terms.end();
+        ASSERT_EQ(hit, in_res->test(i));
+        ASSERT_EQ(!hit, not_in_res->test(i));
+    }
+
+    // the padding bits past the last row stay clear
+    auto last_byte = not_in_res->data()[not_in_res->size() - 1];
+    ASSERT_EQ(last_byte >> (n & 7), 0);
+}
+
+TEST(STRUCTUREDINDEXBITMAP_TEST, test_range) {
+    int n = 1000;
+    auto data = GenCategoryData(20, n);
+    milvus::knowhere::StructuredIndexBitmap<int> index(n, data.data());
+
+    int val = 8;
+    auto lt_res = index.Range(val, milvus::knowhere::OperatorType::LT);
+    auto le_res = index.Range(val, milvus::knowhere::OperatorType::LE);
+    auto gt_res = index.Range(val, milvus::knowhere::OperatorType::GT);
+    auto ge_res = index.Range(val, milvus::knowhere::OperatorType::GE);
+    auto between_res = index.Range(4, true, 15, false);
+    auto inverted_res = index.Range(15, false, 4, true);
+    auto point_res = index.Range(val, true, val, true);
+    auto half_open_point_res = index.Range(val, true, val, false);
+    for (auto i = 0; i < n; ++i) {
+        ASSERT_EQ(data[i] < val, lt_res->test(i));
+        ASSERT_EQ(data[i] <= val, le_res->test(i));
+        ASSERT_EQ(data[i] > val, gt_res->test(i));
+        ASSERT_EQ(data[i] >= val, ge_res->test(i));
+        ASSERT_EQ(data[i] >= 4 && data[i] < 15, between_res->test(i));
+        ASSERT_FALSE(inverted_res->test(i));
+        ASSERT_EQ(data[i] == val, point_res->test(i));
+        ASSERT_FALSE(half_open_point_res->test(i));
+    }
+}
+
+TEST(STRUCTUREDINDEXBITMAP_TEST, test_serialize_and_load) {
+    int n = 1000;
+    auto data = GenCategoryData(20, n);
+    milvus::knowhere::StructuredIndexBitmap<int> index(n, data.data());
+    auto binaryset = index.Serialize();
+
+    milvus::knowhere::StructuredIndexBitmap<int> loaded;
+    loaded.Load(binaryset);
+    ASSERT_EQ(loaded.Cardinality(), index.Cardinality());
+    ASSERT_EQ(loaded.Size(), index.Size());
+
+    std::vector<int> terms = {2, 4, 6};
+    auto res = loaded.In(terms.size(), terms.data());
+    for (auto i = 0; i < n; ++i) {
+        ASSERT_EQ(data[i] == 2 || data[i] == 4 || data[i] == 6, res->test(i));
+    }
+}
+
+// IN over half of the categories, bitmap against sorted index
+TEST(STRUCTUREDINDEXBITMAP_TEST, test_in_benchmark) {
+    int n = 1000000;
+    auto data = GenCategoryData(20, n);
+    milvus::knowhere::StructuredIndexBitmap<int> bitmap_index(n, data.data());
+    milvus::knowhere::StructuredIndexSort<int> sort_index(n, data.data());
+
+    std::vector<int> terms = {0, 2, 4, 6, 8, 10, 12, 14, 16, 18};
+    auto start = std::chrono::steady_clock::now();
+    auto bitmap_res = bitmap_index.In(terms.size(), terms.data());
+    auto bitmap_cost = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    auto sort_res = sort_index.In(terms.size(), terms.data());
+    auto sort_cost = std::chrono::steady_clock::now() - start;
+
+    std::cout << "IN 10 of 20 values over " << n << " rows: sort "
+              << std::chrono::duration_cast<std::chrono::microseconds>(sort_cost).count() << "us, bitmap "
+              << std::chrono::duration_cast<std::chrono::microseconds>(bitmap_cost).count() << "us" << std::endl;
+    for (auto i = 0; i < n; ++i) {
+        ASSERT_EQ(sort_res->test(i), bitmap_res->test(i));
+    }
+}
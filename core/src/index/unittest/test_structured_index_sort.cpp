@@ -268,3 +268,22 @@ TEST(STRUCTUREDINDEXSORT_TEST, test_double_border_range) {
     }
     free(p);
 }
+
+TEST(STRUCTUREDINDEXSORT_TEST, test_empty_range) {
+    int range = 100, n = 1000, *p = nullptr;
+    gen_rand_data(range, n, p);
+    milvus::knowhere::StructuredIndexSort<int> structuredIndexSort((size_t)n, p);  // Build default
+
+    int val = p[0];
+    auto inverted = structuredIndexSort.Range(60, true, 40, true);
+    auto point = structuredIndexSort.Range(val, true, val, true);
+    auto lower_open_point = structuredIndexSort.Range(val, false, val, true);
+    auto upper_open_point = structuredIndexSort.Range(val, true, val, false);
+    for (auto i = 0; i < n; ++i) {
+        ASSERT_FALSE(inverted->test(i));
+        ASSERT_EQ(*(p + i) == val, point->test(i));
+        ASSERT_FALSE(lower_open_point->test(i));
+        ASSERT_FALSE(upper_open_point->test(i));
+    }
+    free(p);
+}
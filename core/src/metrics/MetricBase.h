@@ -83,6 +83,18 @@ class MetricsBase {
     CacheAccessTotalIncrement(double value = 1) {
     }
 
+    virtual void
+    ResultCacheHitTotalIncrement(double value = 1) {
+    }
+
+    virtual void
+    ResultCacheMissTotalIncrement(double value = 1) {
+    }
+
+    virtual void
+    ResultCacheUsageGaugeSet(double value) {
+    }
+
     virtual void
     MemTableMergeDurationSecondsHistogramObserve(double value) {
     }
@@ -183,6 +195,14 @@ class MetricsBase {
     KeepingAliveCounterIncrement(double value = 1) {
     }
 
+    virtual void
+    WalRecoveryDurationSecondsGaugeSet(double value) {
+    }
+
+    virtual void
+    WalRecoveryRowsPerSecondGaugeSet(double value) {
+    }
+
     virtual void
     OctetsSet() {
     }
@@ -146,6 +146,27 @@ class PrometheusMetrics : public MetricsBase {
         }
     }
 
+    void
+    ResultCacheHitTotalIncrement(double value = 1) override {
+        if (startup_) {
+            result_cache_hit_total_.Increment(value);
+        }
+    }
+
+    void
+    ResultCacheMissTotalIncrement(double value = 1) override {
+        if (startup_) {
+            result_cache_miss_total_.Increment(value);
+        }
+    }
+
+    void
+    ResultCacheUsageGaugeSet(double value) override {
+        if (startup_) {
+            result_cache_usage_gauge_.Set(value);
+        }
+    }
+
     void
     MemTableMergeDurationSecondsHistogramObserve(double value) override {
         if (startup_) {
@@ -281,6 +302,20 @@ class PrometheusMetrics : public MetricsBase {
         }
     }
 
+    void
+    WalRecoveryDurationSecondsGaugeSet(double value) override {
+        if (startup_) {
+            wal_recovery_duration_gauge_.Set(value);
+        }
+    }
+
+    void
+    WalRecoveryRowsPerSecondGaugeSet(double value) override {
+        if (startup_) {
+            wal_recovery_throughput_gauge_.Set(value);
+        }
+    }
+
     void
     OctetsSet() override;
 
@@ -548,6 +583,20 @@ class PrometheusMetrics : public MetricsBase {
         prometheus::BuildGauge().Name("cache_usage_bytes").Help("current cache usage by bytes").Register(*registry_);
     prometheus::Gauge& cpu_cache_usage_gauge_ = cpu_cache_usage_.Add({});
 
+    // record search result cache hits, misses and usage
+    prometheus::Family<prometheus::Counter>& result_cache_access_ = prometheus::BuildCounter()
+                                                                        .Name("result_cache_access_total")
+                                                                        .Help("the count of looking up search results")
+                                                                        .Register(*registry_);
+    prometheus::Counter& result_cache_hit_total_ = result_cache_access_.Add({{"outcome", "hit"}});
+    prometheus::Counter& result_cache_miss_total_ = result_cache_access_.Add({{"outcome", "miss"}});
+
+    prometheus::Family<prometheus::Gauge>& result_cache_usage_ = prometheus::BuildGauge()
+                                                                     .Name("result_cache_usage_bytes")
+                                                                     .Help("current search result cache usage by bytes")
+                                                                     .Register(*registry_);
+    prometheus::Gauge& result_cache_usage_gauge_ = result_cache_usage_.Add({});
+
     // record GPU cache usage and %
     prometheus::Family<prometheus::Gauge>& gpu_cache_usage_ = prometheus::BuildGauge()
                                                                   .Name("gpu_cache_usage_bytes")
@@ -644,6 +693,18 @@ class PrometheusMetrics : public MetricsBase {
                                                                   .Register(*registry_);
     prometheus::Counter& keeping_alive_counter_ = keeping_alive_.Add({});
 
+    prometheus::Family<prometheus::Gauge>& wal_recovery_duration_ = prometheus::BuildGauge()
+                                                                        .Name("wal_recovery_duration_seconds")
+                                                                        .Help("time spent replaying wal at startup")
+                                                                        .Register(*registry_);
+    prometheus::Gauge& wal_recovery_duration_gauge_ = wal_recovery_duration_.Add({});
+
+    prometheus::Family<prometheus::Gauge>& wal_recovery_throughput_ = prometheus::BuildGauge()
+                                                                          .Name("wal_recovery_rows_per_second")
+                                                                          .Help("rows replayed per second from wal")
+                                                                          .Register(*registry_);
+    prometheus::Gauge& wal_recovery_throughput_gauge_ = wal_recovery_throughput_.Add({});
+
     prometheus::Family<prometheus::Gauge>& octets_ =
         prometheus::BuildGauge().Name("octets_bytes_per_second").Help("octets bytes per second").Register(*registry_);
     prometheus::Gauge& inoctets_gauge_ = octets_.Add({{"type", "inoctets"}});
@@ -10,6 +10,9 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include "scheduler/TaskCreator.h"
+
+#include <algorithm>
+
 #include "SchedInst.h"
 #include "tasklabel/BroadcastLabel.h"
 #include "tasklabel/SpecResLabel.h"
@@ -38,9 +41,19 @@ TaskCreator::Create(const JobPtr& job) {
 
 std::vector<TaskPtr>
 TaskCreator::Create(const SearchJobPtr& job) {
-    std::vector<TaskPtr> tasks;
+    // the largest segments first, their results are the most likely to be kept and give the others
+    // a tight topk bound to start from
+    std::vector<SegmentSchemaPtr> files;
     for (auto& index_file : job->index_files()) {
-        auto task = std::make_shared<XSearchTask>(job->GetContext(), index_file.second, nullptr);
+        files.emplace_back(index_file.second);
+    }
+    std::stable_sort(files.begin(), files.end(), [](const SegmentSchemaPtr& lhs, const SegmentSchemaPtr& rhs) {
+        return lhs->row_count_ > rhs->row_count_;
+    });
+
+    std::vector<TaskPtr> tasks;
+    for (auto& file : files) {
+        auto task = std::make_shared<XSearchTask>(job->GetContext(), file, nullptr);
         task->job_ = job;
         tasks.emplace_back(task);
     }
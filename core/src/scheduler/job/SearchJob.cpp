@@ -82,6 +82,44 @@ SearchJob::GetStatus() {
     return status_;
 }
 
+void
+SearchJob::UpdateTopkBounds(uint64_t nq, uint64_t topk, bool ascending) {
+    if (merged_ && merged_ascending_ != ascending) {
+        merged_both_orders_ = true;
+    }
+    merged_ = true;
+    merged_ascending_ = ascending;
+    if (merged_both_orders_) {
+        topk_bounds_.clear();
+        return;
+    }
+
+    if (topk == 0 || result_ids_.size() != nq * topk || result_distances_.size() != nq * topk) {
+        return;
+    }
+
+    std::vector<float> bounds(nq);
+    for (uint64_t i = 0; i < nq; ++i) {
+        uint64_t last = i * topk + topk - 1;
+        if (result_ids_[last] == -1) {
+            return;
+        }
+        bounds[i] = result_distances_[last];
+    }
+    topk_bounds_.swap(bounds);
+}
+
+bool
+SearchJob::GetTopkBounds(std::vector<float>& bounds, bool ascending) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (merged_both_orders_ || merged_ascending_ != ascending) {
+        bounds.clear();
+        return false;
+    }
+    bounds = topk_bounds_;
+    return !bounds.empty();
+}
+
 json
 SearchJob::Dump() const {
     json ret{
@@ -24,6 +24,7 @@
 
 #include "Job.h"
 #include "db/Types.h"
+#include "db/engine/QueryEvaluator.h"
 #include "db/meta/MetaTypes.h"
 
 #include "query/GeneralQuery.h"
@@ -131,6 +132,23 @@ class SearchJob : public Job {
         return attr_type_;
     }
 
+    // predicates compiled once for all the segments of the job
+    void
+    SetQueryEvaluator(const engine::QueryEvaluatorPtr& evaluator, const std::string& vector_placeholder) {
+        query_evaluator_ = evaluator;
+        vector_placeholder_ = vector_placeholder;
+    }
+
+    engine::QueryEvaluatorPtr
+    query_evaluator() const {
+        return query_evaluator_;
+    }
+
+    const std::string&
+    vector_placeholder() const {
+        return vector_placeholder_;
+    }
+
     uint64_t&
     vector_count() {
         return vector_count_;
@@ -141,6 +159,17 @@ class SearchJob : public Job {
         return time_stat_;
     }
 
+    // publish the k-th distance of every query once all of them hold topk results, the caller holds mutex().
+    // ascending is the order the results were merged in, once results were merged in both orders the k-th
+    // distance means nothing and no bound is published for the rest of the job
+    void
+    UpdateTopkBounds(uint64_t nq, uint64_t topk, bool ascending);
+
+    // snapshot of the k-th distance of every query, false until all the queries hold topk results merged in the
+    // given order
+    bool
+    GetTopkBounds(std::vector<float>& bounds, bool ascending);
+
  private:
     const std::shared_ptr<server::Context> context_;
 
@@ -158,12 +187,18 @@ class SearchJob : public Job {
     query::GeneralQueryPtr general_query_;
     query::QueryPtr query_ptr_;
     std::unordered_map<std::string, engine::meta::hybrid::DataType> attr_type_;
+    engine::QueryEvaluatorPtr query_evaluator_;
+    std::string vector_placeholder_;
     uint64_t vector_count_;
 
     std::mutex mutex_;
     std::condition_variable cv_;
 
     SearchTimeStat time_stat_;
+    std::vector<float> topk_bounds_;
+    bool merged_ = false;
+    bool merged_ascending_ = true;
+    bool merged_both_orders_ = false;
 };
 
 using SearchJobPtr = std::shared_ptr<SearchJob>;
@@ -11,6 +11,7 @@
 
 #include "scheduler/task/SearchTask.h"
 
+#include <boost/filesystem.hpp>
 #include <fiu-local.h>
 
 #include <algorithm>
@@ -19,9 +20,11 @@
 #include <thread>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "db/Utils.h"
 #include "db/engine/EngineFactory.h"
+#include "db/engine/QueryEvaluator.h"
 #include "metrics/Metrics.h"
 #include "scheduler/SchedInst.h"
 #include "scheduler/job/SearchJob.h"
@@ -102,13 +105,6 @@ CollectFileMetrics(int file_type, size_t file_size) {
 XSearchTask::XSearchTask(const std::shared_ptr<server::Context>& context, SegmentSchemaPtr file, TaskLabelPtr label)
     : Task(TaskType::SearchTask, std::move(label)), context_(context), file_(file) {
     if (file_) {
-        // distance -- value 0 means two vectors equal, ascending reduce, L2/HAMMING/JACCARD/TONIMOTO ...
-        // similarity -- infinity value means two vectors equal, descending reduce, IP
-        if (file_->metric_type_ == static_cast<int>(MetricType::IP) &&
-            file_->engine_type_ != static_cast<int>(EngineType::FAISS_PQ)) {
-            ascending_reduce = false;
-        }
-
         EngineType engine_type;
         if (file->file_type_ == SegmentSchema::FILE_TYPE::RAW ||
             file->file_type_ == SegmentSchema::FILE_TYPE::TO_INDEX ||
@@ -119,6 +115,24 @@ XSearchTask::XSearchTask(const std::shared_ptr<server::Context>& context, Segmen
             engine_type = (EngineType)file->engine_type_;
         }
 
+        // a raw file flushed with its hnsw graph is searched through the graph until it is merged or indexed
+        std::string location = file_->location_;
+        if (file->file_type_ == SegmentSchema::FILE_TYPE::RAW &&
+            file->engine_type_ == static_cast<int>(EngineType::HNSW)) {
+            auto graph_location = engine::utils::GetIncrementalIndexPath(file_->location_);
+            if (boost::filesystem::exists(graph_location)) {
+                engine_type = EngineType::HNSW;
+                location = graph_location;
+            }
+        }
+
+        // distance -- value 0 means two vectors equal, ascending reduce, L2/HAMMING/JACCARD/TONIMOTO ...
+        // similarity -- infinity value means two vectors equal, descending reduce, IP
+        // the order is the one of the engine searching the file, raw files of an IVF_PQ collection are brute forced
+        if (file_->metric_type_ == static_cast<int>(MetricType::IP) && engine_type != EngineType::FAISS_PQ) {
+            ascending_reduce = false;
+        }
+
         milvus::json json_params;
         if (!file_->index_params_.empty()) {
             json_params = milvus::json::parse(file_->index_params_);
@@ -138,7 +152,7 @@ XSearchTask::XSearchTask(const std::shared_ptr<server::Context>& context, Segmen
         //                                         (MetricType)file_->metric_type_, types, json_params);
         //            }
         //        }
-        index_engine_ = EngineFactory::Build(file_->dimension_, file_->location_, engine_type,
+        index_engine_ = EngineFactory::Build(file_->dimension_, location, engine_type,
                                              (MetricType)file_->metric_type_, json_params);
     }
 }
@@ -156,7 +170,17 @@ XSearchTask::Load(LoadType type, uint8_t device_id) {
         fiu_do_on("XSearchTask.Load.throw_std_exception", throw std::exception());
         if (type == LoadType::DISK2CPU) {
             stat = index_engine_->Load();
-            stat = index_engine_->LoadAttr();
+            if (stat.ok()) {
+                // only the attribute fields filtered by the query are loaded
+                std::vector<std::string> field_names;
+                if (auto job = job_.lock()) {
+                    auto search_job = std::static_pointer_cast<scheduler::SearchJob>(job);
+                    engine::CollectQueryFields(search_job->general_query(), field_names);
+                }
+                if (!field_names.empty()) {
+                    stat = index_engine_->LoadAttr(field_names);
+                }
+            }
             type_str = "DISK2CPU";
         } else if (type == LoadType::CPU2GPU) {
             bool hybrid = false;
@@ -249,6 +273,7 @@ XSearchTask::Execute() {
                 hybrid = true;
             }
             Status s;
+            bool ascending = ascending_reduce;
             if (general_query != nullptr) {
                 std::unordered_map<std::string, DataType> types;
                 auto attr_type = search_job->attr_type();
@@ -268,6 +293,11 @@ XSearchTask::Execute() {
                 s = index_engine_->Search(output_ids, output_distance, search_job, hybrid);
             }
 
+            // refined results carry exact inner products, whatever the index reports
+            if (index_engine_->SearchRefined() && file_->metric_type_ == static_cast<int>(MetricType::IP)) {
+                ascending = false;
+            }
+
             fiu_do_on("XSearchTask.Execute.search_fail", s = Status(SERVER_UNEXPECTED_ERROR, ""));
             if (!s.ok()) {
                 search_job->GetStatus() = s;
@@ -284,8 +314,9 @@ XSearchTask::Execute() {
                                               file_->location_.c_str());
             } else {
                 std::unique_lock<std::mutex> lock(search_job->mutex());
-                XSearchTask::MergeTopkToResultSet(output_ids, output_distance, spec_k, nq, topk, ascending_reduce,
+                XSearchTask::MergeTopkToResultSet(output_ids, output_distance, spec_k, nq, topk, ascending,
                                                   search_job->GetResultIds(), search_job->GetResultDistances());
+                search_job->UpdateTopkBounds(nq, topk, ascending);
             }
 
             span = rc.RecordSection("reduce topk done");
@@ -333,8 +364,9 @@ XSearchTask::MergeTopkToResultSet(const scheduler::ResultIds& src_ids, const sch
             buf_idx = buf_k_multi_i + buf_k_j;
 
             if ((tar_ids[tar_idx] == -1) ||  // initialized value
-                (ascending && src_distances[src_idx] < tar_distances[tar_idx]) ||
-                (!ascending && src_distances[src_idx] > tar_distances[tar_idx])) {
+                (src_ids[src_idx] != -1 &&   // slots of a bounded search left empty
+                 ((ascending && src_distances[src_idx] < tar_distances[tar_idx]) ||
+                  (!ascending && src_distances[src_idx] > tar_distances[tar_idx])))) {
                 buf_ids[buf_idx] = src_ids[src_idx];
                 buf_distances[buf_idx] = src_distances[src_idx];
                 src_k_j++;
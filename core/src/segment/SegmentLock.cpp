@@ -0,0 +1,48 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "segment/SegmentLock.h"
+
+#include <unordered_map>
+
+namespace milvus {
+namespace segment {
+
+std::shared_ptr<std::mutex>
+GetSegmentLock(const std::string& segment_dir) {
+    static std::mutex registry_mutex;
+    static std::unordered_map<std::string, std::weak_ptr<std::mutex>> registry;
+
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    auto iter = registry.find(segment_dir);
+    if (iter != registry.end()) {
+        if (auto segment_lock = iter->second.lock()) {
+            return segment_lock;
+        }
+    }
+
+    // a lock lives as long as someone holds it, drop the entries of segments nobody uses any more
+    for (auto it = registry.begin(); it != registry.end();) {
+        it = it->second.expired() ? registry.erase(it) : std::next(it);
+    }
+    auto segment_lock = std::make_shared<std::mutex>();
+    registry[segment_dir] = segment_lock;
+    return segment_lock;
+}
+
+}  // namespace segment
+}  // namespace milvus
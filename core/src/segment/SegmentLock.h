@@ -0,0 +1,34 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace milvus {
+namespace segment {
+
+// The uids, raw vectors and deleted docs of a segment are addressed by the same offsets. The lock of a segment
+// directory is held while those files are rewritten in another order, and by readers that look an offset up in
+// one file and use it in another.
+std::shared_ptr<std::mutex>
+GetSegmentLock(const std::string& segment_dir);
+
+}  // namespace segment
+}  // namespace milvus
@@ -89,6 +89,20 @@ SegmentReader::LoadAttrs(const std::string& field_name, off_t offset, size_t num
     return Status::OK();
 }
 
+Status
+SegmentReader::LoadAttrsIndex(const std::string& field_name, segment::AttrIndexPtr& attr_index_ptr) {
+    try {
+        auto& default_codec = codec::DefaultCodec::instance();
+        fs_ptr_->operation_ptr_->CreateDirectory();
+        default_codec.GetAttrsIndexFormat()->read(fs_ptr_, field_name, attr_index_ptr);
+    } catch (std::exception& e) {
+        std::string err_msg = "Failed to load attribute index: " + std::string(e.what());
+        LOG_ENGINE_ERROR_ << err_msg;
+        return Status(DB_ERROR, err_msg);
+    }
+    return Status::OK();
+}
+
 Status
 SegmentReader::LoadUids(std::vector<doc_id_t>& uids) {
     try {
@@ -152,6 +166,20 @@ SegmentReader::LoadDeletedDocs(segment::DeletedDocsPtr& deleted_docs_ptr) {
     return Status::OK();
 }
 
+Status
+SegmentReader::LoadZoneMaps(segment::ZoneMapsPtr& zone_maps_ptr) {
+    try {
+        auto& default_codec = codec::DefaultCodec::instance();
+        fs_ptr_->operation_ptr_->CreateDirectory();
+        default_codec.GetZoneMapsFormat()->read(fs_ptr_, zone_maps_ptr);
+    } catch (std::exception& e) {
+        std::string err_msg = "Failed to load zone maps: " + std::string(e.what());
+        LOG_ENGINE_ERROR_ << err_msg;
+        return Status(DB_ERROR, err_msg);
+    }
+    return Status::OK();
+}
+
 Status
 SegmentReader::ReadDeletedDocsSize(size_t& size) {
     try {
@@ -46,6 +46,9 @@ class SegmentReader {
     Status
     LoadAttrs(const std::string& field_name, off_t offset, size_t num_bytes, std::vector<uint8_t>& raw_attrs);
 
+    Status
+    LoadAttrsIndex(const std::string& field_name, segment::AttrIndexPtr& attr_index_ptr);
+
     Status
     LoadUids(std::vector<doc_id_t>& uids);
 
@@ -59,6 +62,9 @@ class SegmentReader {
     Status
     LoadDeletedDocs(segment::DeletedDocsPtr& deleted_docs_ptr);
 
+    Status
+    LoadZoneMaps(segment::ZoneMapsPtr& zone_maps_ptr);
+
     Status
     GetSegment(SegmentPtr& segment_ptr);
 
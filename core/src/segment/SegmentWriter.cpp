@@ -18,9 +18,12 @@
 #include "segment/SegmentWriter.h"
 
 #include <algorithm>
+#include <future>
 #include <memory>
 #include <utility>
+#include <vector>
 
+#include "SegmentLock.h"
 #include "SegmentReader.h"
 #include "Vectors.h"
 #include "codecs/default/DefaultCodec.h"
@@ -29,11 +32,25 @@
 #include "storage/disk/DiskIOWriter.h"
 #include "storage/disk/DiskOperation.h"
 #include "utils/Log.h"
+#include "utils/ThreadPool.h"
 #include "utils/TimeRecorder.h"
 
 namespace milvus {
 namespace segment {
 
+namespace {
+
+constexpr size_t SEGMENT_WRITE_THREAD_NUM = 4;
+
+// shared by all segment writers, bounds the number of files written at the same time
+ThreadPool&
+SegmentWritePool() {
+    static ThreadPool pool(SEGMENT_WRITE_THREAD_NUM);
+    return pool;
+}
+
+}  // namespace
+
 SegmentWriter::SegmentWriter(const std::string& directory) {
     storage::IOReaderPtr reader_ptr = std::make_shared<storage::DiskIOReader>();
     storage::IOWriterPtr writer_ptr = std::make_shared<storage::DiskIOWriter>();
@@ -104,56 +121,69 @@ SegmentWriter::SetAttrsIndex(const std::unordered_map<std::string, knowhere::Ind
     return Status::OK();
 }
 
+Status
+SegmentWriter::SetAttrsType(const std::unordered_map<std::string, engine::meta::hybrid::DataType>& attr_type) {
+    attr_type_ = attr_type;
+    return Status::OK();
+}
+
 Status
 SegmentWriter::SetVectorIndex(const milvus::knowhere::VecIndexPtr& index) {
     segment_ptr_->vector_index_ptr_->SetVectorIndex(index);
     return Status::OK();
 }
 
+storage::FSHandlerPtr
+SegmentWriter::NewFSHandler() {
+    storage::IOReaderPtr reader_ptr = std::make_shared<storage::DiskIOReader>();
+    storage::IOWriterPtr writer_ptr = std::make_shared<storage::DiskIOWriter>();
+    return std::make_shared<storage::FSHandler>(reader_ptr, writer_ptr, fs_ptr_->operation_ptr_);
+}
+
 Status
 SegmentWriter::Serialize() {
     TimeRecorder recorder("SegmentWriter::Serialize");
 
-    auto status = WriteBloomFilter();
-    if (!status.ok()) {
-        LOG_ENGINE_ERROR_ << status.message();
-        return status;
-    }
-
-    recorder.RecordSection("Writing bloom filter done");
+    try {
+        fs_ptr_->operation_ptr_->CreateDirectory();
+    } catch (std::exception& e) {
+        std::string err_msg = "Failed to create segment directory: " + std::string(e.what());
+        LOG_ENGINE_ERROR_ << err_msg;
 
-    status = WriteVectors();
-    if (!status.ok()) {
-        LOG_ENGINE_ERROR_ << "Write vectors fail: " << status.message();
-        return status;
+        engine::utils::SendExitSignal();
+        return Status(SERVER_WRITE_ERROR, err_msg);
     }
 
-    status = WriteAttrs();
-    if (!status.ok()) {
-        return status;
-    }
+    // every part of a segment goes to its own files, write them concurrently
+    std::vector<std::future<Status>> results;
+    auto& pool = SegmentWritePool();
+    results.emplace_back(pool.enqueue([this]() { return WriteBloomFilter(NewFSHandler()); }));
+    results.emplace_back(pool.enqueue([this]() { return WriteVectors(NewFSHandler()); }));
+    results.emplace_back(pool.enqueue([this]() { return WriteAttrs(NewFSHandler()); }));
+    results.emplace_back(pool.enqueue([this]() { return WriteZoneMaps(NewFSHandler()); }));
+    results.emplace_back(pool.enqueue([this]() { return WriteAttrsIndex(NewFSHandler()); }));
+    // Write an empty deleted doc
+    results.emplace_back(pool.enqueue([this]() { return WriteDeletedDocs(NewFSHandler()); }));
 
-    status = WriteAttrsIndex();
-    if (!status.ok()) {
-        return status;
+    Status status;
+    for (auto& result : results) {
+        auto write_status = result.get();
+        if (!write_status.ok() && status.ok()) {
+            status = write_status;
+        }
     }
 
-    recorder.RecordSection("Writing vectors and uids done");
-
-    // Write an empty deleted doc
-    status = WriteDeletedDocs();
-
-    recorder.RecordSection("Writing deleted docs done");
+    recorder.RecordSection("Writing bloom filter, vectors, uids, attrs and deleted docs done");
 
     return status;
 }
 
 Status
-SegmentWriter::WriteVectors() {
+SegmentWriter::WriteVectors(const storage::FSHandlerPtr& fs_ptr) {
     try {
         auto& default_codec = codec::DefaultCodec::instance();
-        fs_ptr_->operation_ptr_->CreateDirectory();
-        default_codec.GetVectorsFormat()->write(fs_ptr_, segment_ptr_->vectors_ptr_);
+        fs_ptr->operation_ptr_->CreateDirectory();
+        default_codec.GetVectorsFormat()->write(fs_ptr, segment_ptr_->vectors_ptr_);
     } catch (std::exception& e) {
         std::string err_msg = "Failed to write vectors: " + std::string(e.what());
         LOG_ENGINE_ERROR_ << err_msg;
@@ -165,11 +195,11 @@ SegmentWriter::WriteVectors() {
 }
 
 Status
-SegmentWriter::WriteAttrs() {
+SegmentWriter::WriteAttrs(const storage::FSHandlerPtr& fs_ptr) {
     try {
         auto& default_codec = codec::DefaultCodec::instance();
-        fs_ptr_->operation_ptr_->CreateDirectory();
-        default_codec.GetAttrsFormat()->write(fs_ptr_, segment_ptr_->attrs_ptr_);
+        fs_ptr->operation_ptr_->CreateDirectory();
+        default_codec.GetAttrsFormat()->write(fs_ptr, segment_ptr_->attrs_ptr_);
     } catch (std::exception& e) {
         std::string err_msg = "Failed to write vectors: " + std::string(e.what());
         LOG_ENGINE_ERROR_ << err_msg;
@@ -180,6 +210,34 @@ SegmentWriter::WriteAttrs() {
     return Status::OK();
 }
 
+Status
+SegmentWriter::WriteZoneMaps(const storage::FSHandlerPtr& fs_ptr) {
+    for (auto& pair : segment_ptr_->attrs_ptr_->attrs) {
+        auto type_iter = attr_type_.find(pair.first);
+        if (type_iter == attr_type_.end()) {
+            continue;
+        }
+        if (segment_ptr_->zone_maps_ptr_ == nullptr) {
+            segment_ptr_->zone_maps_ptr_ = std::make_shared<ZoneMaps>();
+        }
+        segment_ptr_->zone_maps_ptr_->Build(pair.first, type_iter->second, pair.second->GetData());
+    }
+    if (segment_ptr_->zone_maps_ptr_ == nullptr) {
+        return Status::OK();
+    }
+
+    try {
+        auto& default_codec = codec::DefaultCodec::instance();
+        fs_ptr->operation_ptr_->CreateDirectory();
+        default_codec.GetZoneMapsFormat()->write(fs_ptr, segment_ptr_->zone_maps_ptr_);
+    } catch (std::exception& e) {
+        std::string err_msg = "Failed to write zone maps: " + std::string(e.what());
+        LOG_ENGINE_ERROR_ << err_msg;
+        return Status(SERVER_WRITE_ERROR, err_msg);
+    }
+    return Status::OK();
+}
+
 Status
 SegmentWriter::WriteVectorIndex(const std::string& location) {
     if (location.empty()) {
@@ -202,10 +260,15 @@ SegmentWriter::WriteVectorIndex(const std::string& location) {
 
 Status
 SegmentWriter::WriteAttrsIndex() {
+    return WriteAttrsIndex(fs_ptr_);
+}
+
+Status
+SegmentWriter::WriteAttrsIndex(const storage::FSHandlerPtr& fs_ptr) {
     try {
         auto& default_codec = codec::DefaultCodec::instance();
-        fs_ptr_->operation_ptr_->CreateDirectory();
-        default_codec.GetAttrsIndexFormat()->write(fs_ptr_, segment_ptr_->attrs_index_ptr_);
+        fs_ptr->operation_ptr_->CreateDirectory();
+        default_codec.GetAttrsIndexFormat()->write(fs_ptr, segment_ptr_->attrs_index_ptr_);
     } catch (std::exception& e) {
         std::string err_msg = "Failed to write vector index: " + std::string(e.what());
         LOG_ENGINE_ERROR_ << err_msg;
@@ -217,15 +280,15 @@ SegmentWriter::WriteAttrsIndex() {
 }
 
 Status
-SegmentWriter::WriteBloomFilter() {
+SegmentWriter::WriteBloomFilter(const storage::FSHandlerPtr& fs_ptr) {
     try {
         auto& default_codec = codec::DefaultCodec::instance();
 
-        fs_ptr_->operation_ptr_->CreateDirectory();
+        fs_ptr->operation_ptr_->CreateDirectory();
 
         TimeRecorder recorder("SegmentWriter::WriteBloomFilter");
 
-        default_codec.GetIdBloomFilterFormat()->create(fs_ptr_, segment_ptr_->id_bloom_filter_ptr_);
+        default_codec.GetIdBloomFilterFormat()->create(fs_ptr, segment_ptr_->id_bloom_filter_ptr_);
 
         recorder.RecordSection("Initializing bloom filter");
 
@@ -236,7 +299,7 @@ SegmentWriter::WriteBloomFilter() {
 
         recorder.RecordSection("Adding " + std::to_string(uids.size()) + " ids to bloom filter");
 
-        default_codec.GetIdBloomFilterFormat()->write(fs_ptr_, segment_ptr_->id_bloom_filter_ptr_);
+        default_codec.GetIdBloomFilterFormat()->write(fs_ptr, segment_ptr_->id_bloom_filter_ptr_);
 
         recorder.RecordSection("Writing bloom filter");
     } catch (std::exception& e) {
@@ -250,12 +313,12 @@ SegmentWriter::WriteBloomFilter() {
 }
 
 Status
-SegmentWriter::WriteDeletedDocs() {
+SegmentWriter::WriteDeletedDocs(const storage::FSHandlerPtr& fs_ptr) {
     try {
         auto& default_codec = codec::DefaultCodec::instance();
-        fs_ptr_->operation_ptr_->CreateDirectory();
+        fs_ptr->operation_ptr_->CreateDirectory();
         DeletedDocsPtr deleted_docs_ptr = std::make_shared<DeletedDocs>();
-        default_codec.GetDeletedDocsFormat()->write(fs_ptr_, deleted_docs_ptr);
+        default_codec.GetDeletedDocsFormat()->write(fs_ptr, deleted_docs_ptr);
     } catch (std::exception& e) {
         std::string err_msg = "Failed to write deleted docs: " + std::string(e.what());
         LOG_ENGINE_ERROR_ << err_msg;
@@ -282,6 +345,39 @@ SegmentWriter::WriteDeletedDocs(const DeletedDocsPtr& deleted_docs) {
     return Status::OK();
 }
 
+Status
+SegmentWriter::RewriteVectors(const VectorsPtr& vectors) {
+    try {
+        auto& default_codec = codec::DefaultCodec::instance();
+        fs_ptr_->operation_ptr_->CreateDirectory();
+        default_codec.GetVectorsFormat()->rewrite(fs_ptr_, vectors);
+    } catch (std::exception& e) {
+        std::string err_msg = "Failed to rewrite vectors: " + std::string(e.what());
+        LOG_ENGINE_ERROR_ << err_msg;
+
+        engine::utils::SendExitSignal();
+        return Status(SERVER_WRITE_ERROR, err_msg);
+    }
+    segment_ptr_->vectors_ptr_ = vectors;
+    return Status::OK();
+}
+
+Status
+SegmentWriter::RewriteDeletedDocs(const DeletedDocsPtr& deleted_docs) {
+    try {
+        auto& default_codec = codec::DefaultCodec::instance();
+        fs_ptr_->operation_ptr_->CreateDirectory();
+        default_codec.GetDeletedDocsFormat()->rewrite(fs_ptr_, deleted_docs);
+    } catch (std::exception& e) {
+        std::string err_msg = "Failed to rewrite deleted docs: " + std::string(e.what());
+        LOG_ENGINE_ERROR_ << err_msg;
+
+        engine::utils::SendExitSignal();
+        return Status(SERVER_WRITE_ERROR, err_msg);
+    }
+    return Status::OK();
+}
+
 Status
 SegmentWriter::WriteBloomFilter(const IdBloomFilterPtr& id_bloom_filter_ptr) {
     try {
@@ -324,6 +420,9 @@ SegmentWriter::Merge(const std::string& dir_to_merge, const std::string& name) {
     bool in_cache;
     auto status = segment_reader_to_merge.LoadCache(in_cache);
     if (!in_cache) {
+        // deleted docs are offsets into the vectors, both must be read in the same order
+        auto segment_lock = GetSegmentLock(dir_to_merge);
+        std::lock_guard<std::mutex> lock(*segment_lock);
         status = segment_reader_to_merge.Load();
         if (!status.ok()) {
             std::string msg = "Failed to load segment from " + dir_to_merge;
@@ -346,6 +445,7 @@ SegmentWriter::Merge(const std::string& dir_to_merge, const std::string& name) {
 
     recorder.RecordSection("erase");
 
+    segment_ptr_->vectors_ptr_->SetDataType(segment_to_merge->vectors_ptr_->GetDataType());
     AddVectors(name, segment_to_merge->vectors_ptr_->GetData(), segment_to_merge->vectors_ptr_->GetUids());
 
     auto rows = segment_to_merge->vectors_ptr_->GetCount();
@@ -367,6 +467,20 @@ SegmentWriter::Merge(const std::string& dir_to_merge, const std::string& name) {
     }
     AddAttrs(name, attr_nbytes, attr_data, segment_to_merge->vectors_ptr_->GetUids());
 
+    // zone maps of the merged segments still bound the data, deleted entities only narrow it
+    if (!segment_to_merge->attrs_ptr_->attrs.empty() && zone_maps_valid_) {
+        ZoneMapsPtr zone_maps_to_merge;
+        segment_reader_to_merge.LoadZoneMaps(zone_maps_to_merge);
+        if (zone_maps_to_merge == nullptr) {
+            zone_maps_valid_ = false;
+            segment_ptr_->zone_maps_ptr_ = nullptr;
+        } else if (segment_ptr_->zone_maps_ptr_ == nullptr) {
+            segment_ptr_->zone_maps_ptr_ = zone_maps_to_merge;
+        } else {
+            segment_ptr_->zone_maps_ptr_->Merge(*zone_maps_to_merge);
+        }
+    }
+
     LOG_ENGINE_DEBUG_ << "Merging completed from " << dir_to_merge << " to " << fs_ptr_->operation_ptr_->GetDirectory();
 
     return Status::OK();
@@ -52,12 +52,24 @@ class SegmentWriter {
                   const std::unordered_map<std::string, int64_t>& attr_nbytes,
                   const std::unordered_map<std::string, engine::meta::hybrid::DataType>& attr_type);
 
+    // attributes with a known type get a zone map when written
+    Status
+    SetAttrsType(const std::unordered_map<std::string, engine::meta::hybrid::DataType>& attr_type);
+
     Status
     WriteBloomFilter(const IdBloomFilterPtr& bloom_filter_ptr);
 
     Status
     WriteDeletedDocs(const DeletedDocsPtr& deleted_docs);
 
+    // replace the raw vectors and uids of the segment, the old files stay readable until the new ones are complete
+    Status
+    RewriteVectors(const VectorsPtr& vectors);
+
+    // overwrite the deleted docs of the segment, WriteDeletedDocs appends to them
+    Status
+    RewriteDeletedDocs(const DeletedDocsPtr& deleted_docs);
+
     Status
     Serialize();
 
@@ -86,21 +98,33 @@ class SegmentWriter {
     SetSegmentName(const std::string& name);
 
  private:
+    // a handler with its own reader and writer, so that segment files can be written concurrently
+    storage::FSHandlerPtr
+    NewFSHandler();
+
+    Status
+    WriteVectors(const storage::FSHandlerPtr& fs_ptr);
+
+    Status
+    WriteAttrs(const storage::FSHandlerPtr& fs_ptr);
+
     Status
-    WriteVectors();
+    WriteZoneMaps(const storage::FSHandlerPtr& fs_ptr);
 
     Status
-    WriteAttrs();
+    WriteAttrsIndex(const storage::FSHandlerPtr& fs_ptr);
 
     Status
-    WriteBloomFilter();
+    WriteBloomFilter(const storage::FSHandlerPtr& fs_ptr);
 
     Status
-    WriteDeletedDocs();
+    WriteDeletedDocs(const storage::FSHandlerPtr& fs_ptr);
 
  private:
     storage::FSHandlerPtr fs_ptr_;
     SegmentPtr segment_ptr_;
+    std::unordered_map<std::string, engine::meta::hybrid::DataType> attr_type_;
+    bool zone_maps_valid_ = true;  // false once a segment without zone maps is merged in
 };
 
 using SegmentWriterPtr = std::shared_ptr<SegmentWriter>;
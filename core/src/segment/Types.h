@@ -25,6 +25,7 @@
 #include "segment/IdBloomFilter.h"
 #include "segment/VectorIndex.h"
 #include "segment/Vectors.h"
+#include "segment/ZoneMaps.h"
 
 namespace milvus {
 namespace segment {
@@ -38,6 +39,7 @@ struct Segment {
     AttrsIndexPtr attrs_index_ptr_ = std::make_shared<AttrsIndex>();
     DeletedDocsPtr deleted_docs_ptr_ = nullptr;
     IdBloomFilterPtr id_bloom_filter_ptr_ = nullptr;
+    ZoneMapsPtr zone_maps_ptr_ = nullptr;
 };
 
 using SegmentPtr = std::shared_ptr<Segment>;
@@ -18,6 +18,7 @@
 #include "segment/Vectors.h"
 
 #include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <utility>
 #include <vector>
@@ -47,6 +48,12 @@ Vectors::AddUids(const std::vector<doc_id_t>& uids) {
     uids_.insert(uids_.end(), std::make_move_iterator(uids.begin()), std::make_move_iterator(uids.end()));
 }
 
+void
+Vectors::Reserve(uint64_t count, uint64_t code_length) {
+    data_.reserve(count * code_length);
+    uids_.reserve(count);
+}
+
 void
 Vectors::Erase(int32_t offset) {
     auto code_length = GetCodeLength();
@@ -116,6 +123,19 @@ Vectors::Erase(std::vector<int32_t>& offsets) {
     recorder.RecordSection(msg);
 }
 
+void
+Vectors::Rearrange(const std::vector<int64_t>& order) {
+    auto code_length = GetCodeLength();
+    std::vector<uint8_t> new_data(data_.size());
+    std::vector<doc_id_t> new_uids(uids_.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        memcpy(new_data.data() + i * code_length, data_.data() + order[i] * code_length, code_length);
+        new_uids[i] = uids_[order[i]];
+    }
+    data_.swap(new_data);
+    uids_.swap(new_uids);
+}
+
 std::vector<uint8_t>&
 Vectors::GetMutableData() {
     return data_;
@@ -166,6 +186,16 @@ Vectors::GetName() const {
     return name_;
 }
 
+void
+Vectors::SetDataType(VectorsDataType data_type) {
+    data_type_ = data_type;
+}
+
+VectorsDataType
+Vectors::GetDataType() const {
+    return data_type_;
+}
+
 void
 Vectors::Clear() {
     data_.clear();
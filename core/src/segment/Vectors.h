@@ -26,6 +26,13 @@ namespace segment {
 
 using doc_id_t = int64_t;
 
+// element type of the raw vectors, half precision types are stored as uint16_t components
+enum class VectorsDataType {
+    FLOAT = 0,
+    FP16 = 1,
+    BF16 = 2,
+};
+
 class Vectors {
  public:
     Vectors() = default;
@@ -39,9 +46,19 @@ class Vectors {
     void
     AddUids(const std::vector<doc_id_t>& uids);
 
+    // Reserve room for count vectors of code_length bytes, so that appends never move the data
+    void
+    Reserve(uint64_t count, uint64_t code_length);
+
     void
     SetName(const std::string& name);
 
+    void
+    SetDataType(VectorsDataType data_type);
+
+    VectorsDataType
+    GetDataType() const;
+
     std::vector<uint8_t>&
     GetMutableData();
 
@@ -69,6 +86,10 @@ class Vectors {
     void
     Erase(std::vector<int32_t>& offsets);
 
+    // Move the vector and uid at offset order[i] to offset i, order is a permutation of the offsets
+    void
+    Rearrange(const std::vector<int64_t>& order);
+
     size_t
     VectorsSize();
 
@@ -91,6 +112,7 @@ class Vectors {
     std::vector<uint8_t> data_;
     std::vector<doc_id_t> uids_;
     std::string name_;
+    VectorsDataType data_type_ = VectorsDataType::FLOAT;
 };
 
 using VectorsPtr = std::shared_ptr<Vectors>;
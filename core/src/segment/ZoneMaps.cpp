@@ -0,0 +1,282 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "segment/ZoneMaps.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+namespace milvus {
+namespace segment {
+
+namespace {
+
+template <typename T, typename B>
+void
+MinMax(const std::vector<uint8_t>& data, int64_t& count, B& min_value, B& max_value) {
+    count = data.size() / sizeof(T);
+    if (count == 0) {
+        return;
+    }
+    auto values = reinterpret_cast<const T*>(data.data());
+    auto range = std::minmax_element(values, values + count);
+    min_value = *range.first;
+    max_value = *range.second;
+}
+
+template <typename T>
+std::vector<T>
+TermValues(const std::vector<uint8_t>& field_value) {
+    std::vector<T> values(field_value.size() / sizeof(T));
+    memcpy(values.data(), field_value.data(), values.size() * sizeof(T));
+    return values;
+}
+
+template <typename B>
+bool
+MatchCompare(const B& min_value, const B& max_value, query::CompareOperator op, const B& value) {
+    switch (op) {
+        case query::CompareOperator::LT:
+            return min_value < value;
+        case query::CompareOperator::LTE:
+            return min_value <= value;
+        case query::CompareOperator::EQ:
+            return min_value <= value && value <= max_value;
+        case query::CompareOperator::GT:
+            return max_value > value;
+        case query::CompareOperator::GTE:
+            return max_value >= value;
+        case query::CompareOperator::NE:
+            return !(min_value == value && max_value == value);
+        default:
+            return true;
+    }
+}
+
+}  // namespace
+
+void
+ZoneMaps::Build(const std::string& field_name, engine::meta::hybrid::DataType data_type,
+                const std::vector<uint8_t>& data) {
+    ZoneMap zone_map;
+    zone_map.data_type_ = (int32_t)data_type;
+    switch (data_type) {
+        case engine::meta::hybrid::DataType::INT8:
+            MinMax<int8_t>(data, zone_map.row_count_, zone_map.min_int_, zone_map.max_int_);
+            break;
+        case engine::meta::hybrid::DataType::INT16:
+            MinMax<int16_t>(data, zone_map.row_count_, zone_map.min_int_, zone_map.max_int_);
+            break;
+        case engine::meta::hybrid::DataType::INT32:
+            MinMax<int32_t>(data, zone_map.row_count_, zone_map.min_int_, zone_map.max_int_);
+            break;
+        case engine::meta::hybrid::DataType::INT64:
+            MinMax<int64_t>(data, zone_map.row_count_, zone_map.min_int_, zone_map.max_int_);
+            break;
+        case engine::meta::hybrid::DataType::FLOAT:
+            MinMax<float>(data, zone_map.row_count_, zone_map.min_double_, zone_map.max_double_);
+            break;
+        case engine::meta::hybrid::DataType::DOUBLE:
+            MinMax<double>(data, zone_map.row_count_, zone_map.min_double_, zone_map.max_double_);
+            break;
+        default:
+            return;
+    }
+    zone_maps_[field_name] = zone_map;
+}
+
+void
+ZoneMaps::Set(const std::string& field_name, const ZoneMap& zone_map) {
+    zone_maps_[field_name] = zone_map;
+}
+
+void
+ZoneMaps::Merge(const ZoneMaps& other) {
+    for (auto iter = zone_maps_.begin(); iter != zone_maps_.end();) {
+        // a field known by one side only has no bound for the other part
+        auto other_iter = other.zone_maps_.find(iter->first);
+        if (other_iter == other.zone_maps_.end()) {
+            iter = zone_maps_.erase(iter);
+            continue;
+        }
+
+        auto& zone_map = iter->second;
+        auto& other_map = other_iter->second;
+        ++iter;
+        if (other_map.row_count_ == 0) {
+            continue;
+        }
+        if (zone_map.row_count_ == 0) {
+            zone_map = other_map;
+            continue;
+        }
+        zone_map.row_count_ += other_map.row_count_;
+        zone_map.null_count_ += other_map.null_count_;
+        zone_map.min_int_ = std::min(zone_map.min_int_, other_map.min_int_);
+        zone_map.max_int_ = std::max(zone_map.max_int_, other_map.max_int_);
+        zone_map.min_double_ = std::min(zone_map.min_double_, other_map.min_double_);
+        zone_map.max_double_ = std::max(zone_map.max_double_, other_map.max_double_);
+    }
+}
+
+const std::unordered_map<std::string, ZoneMap>&
+ZoneMaps::GetZoneMaps() const {
+    return zone_maps_;
+}
+
+bool
+ZoneMaps::MayMatch(const query::GeneralQueryPtr& general_query) const {
+    return Match(general_query) != MatchResult::NEVER;
+}
+
+int64_t
+ZoneMaps::Size() {
+    return zone_maps_.size() * (sizeof(ZoneMap) + sizeof(std::string));
+}
+
+// mirrors ExecutionEngineImpl::ExecBinaryQuery, a NO_FILTER side takes the result of the other side
+ZoneMaps::MatchResult
+ZoneMaps::Match(const query::GeneralQueryPtr& general_query) const {
+    if (general_query == nullptr) {
+        return MatchResult::NO_FILTER;
+    }
+
+    if (general_query->leaf != nullptr) {
+        auto& leaf = general_query->leaf;
+        auto result = MatchResult::NO_FILTER;
+        if (leaf->term_query != nullptr) {
+            result = MatchTerm(leaf->term_query) ? MatchResult::MAYBE : MatchResult::NEVER;
+        }
+        if (leaf->range_query != nullptr) {
+            result = MatchRange(leaf->range_query) ? MatchResult::MAYBE : MatchResult::NEVER;
+        }
+        if (!leaf->vector_placeholder.empty()) {
+            result = MatchResult::NO_FILTER;
+        }
+        return result;
+    }
+
+    if (general_query->bin == nullptr) {
+        return MatchResult::NO_FILTER;
+    }
+    auto left = Match(general_query->bin->left_query);
+    auto right = Match(general_query->bin->right_query);
+    if (left == MatchResult::NO_FILTER || right == MatchResult::NO_FILTER) {
+        return left == MatchResult::NO_FILTER ? right : left;
+    }
+
+    switch (general_query->bin->relation) {
+        case query::QueryRelation::AND:
+        case query::QueryRelation::R1:
+            return (left == MatchResult::MAYBE && right == MatchResult::MAYBE) ? MatchResult::MAYBE
+                                                                              : MatchResult::NEVER;
+        case query::QueryRelation::OR:
+        case query::QueryRelation::R2:
+        case query::QueryRelation::R3:
+            return (left == MatchResult::MAYBE || right == MatchResult::MAYBE) ? MatchResult::MAYBE
+                                                                              : MatchResult::NEVER;
+        case query::QueryRelation::R4:
+            // left and not right, the zone map of right tells nothing
+            return left;
+        default:
+            return MatchResult::MAYBE;
+    }
+}
+
+bool
+ZoneMaps::MatchTerm(const query::TermQueryPtr& term_query) const {
+    auto iter = zone_maps_.find(term_query->field_name);
+    if (iter == zone_maps_.end()) {
+        return true;
+    }
+    auto& zone_map = iter->second;
+    if (zone_map.row_count_ == 0) {
+        return false;
+    }
+
+    auto in_int = [&](int64_t value) { return zone_map.min_int_ <= value && value <= zone_map.max_int_; };
+    auto in_double = [&](double value) { return zone_map.min_double_ <= value && value <= zone_map.max_double_; };
+    auto& field_value = term_query->field_value;
+    switch ((engine::meta::hybrid::DataType)zone_map.data_type_) {
+        case engine::meta::hybrid::DataType::INT8: {
+            auto values = TermValues<int8_t>(field_value);
+            return std::any_of(values.begin(), values.end(), in_int);
+        }
+        case engine::meta::hybrid::DataType::INT16: {
+            auto values = TermValues<int16_t>(field_value);
+            return std::any_of(values.begin(), values.end(), in_int);
+        }
+        case engine::meta::hybrid::DataType::INT32: {
+            auto values = TermValues<int32_t>(field_value);
+            return std::any_of(values.begin(), values.end(), in_int);
+        }
+        case engine::meta::hybrid::DataType::INT64: {
+            auto values = TermValues<int64_t>(field_value);
+            return std::any_of(values.begin(), values.end(), in_int);
+        }
+        case engine::meta::hybrid::DataType::FLOAT: {
+            auto values = TermValues<float>(field_value);
+            return std::any_of(values.begin(), values.end(), in_double);
+        }
+        case engine::meta::hybrid::DataType::DOUBLE: {
+            auto values = TermValues<double>(field_value);
+            return std::any_of(values.begin(), values.end(), in_double);
+        }
+        default:
+            return true;
+    }
+}
+
+bool
+ZoneMaps::MatchRange(const query::RangeQueryPtr& range_query) const {
+    auto iter = zone_maps_.find(range_query->field_name);
+    if (iter == zone_maps_.end()) {
+        return true;
+    }
+    auto& zone_map = iter->second;
+    if (zone_map.row_count_ == 0) {
+        return false;
+    }
+
+    auto data_type = (engine::meta::hybrid::DataType)zone_map.data_type_;
+    for (auto& expr : range_query->compare_expr) {
+        bool match = true;
+        if (data_type == engine::meta::hybrid::DataType::FLOAT) {
+            std::istringstream iss(expr.operand);
+            float value;
+            iss >> value;
+            match = MatchCompare<double>(zone_map.min_double_, zone_map.max_double_, expr.compare_operator, value);
+        } else if (data_type == engine::meta::hybrid::DataType::DOUBLE) {
+            std::istringstream iss(expr.operand);
+            double value;
+            iss >> value;
+            match = MatchCompare<double>(zone_map.min_double_, zone_map.max_double_, expr.compare_operator, value);
+        } else {
+            int64_t value = std::strtoll(expr.operand.c_str(), nullptr, 10);
+            match = MatchCompare<int64_t>(zone_map.min_int_, zone_map.max_int_, expr.compare_operator, value);
+        }
+        if (!match) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace segment
+}  // namespace milvus
@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "cache/DataObj.h"
+#include "db/meta/MetaTypes.h"
+#include "query/GeneralQuery.h"
+
+namespace milvus {
+namespace segment {
+
+// min/max statistics of one attribute field in a segment
+struct ZoneMap {
+    int32_t data_type_ = 0;
+    int64_t row_count_ = 0;
+    int64_t null_count_ = 0;  // attributes are not nullable yet, always 0
+    int64_t min_int_ = 0;     // INT8 ~ INT64
+    int64_t max_int_ = 0;
+    double min_double_ = 0;  // FLOAT and DOUBLE
+    double max_double_ = 0;
+};
+
+class ZoneMaps : public cache::DataObj {
+ public:
+    ZoneMaps() = default;
+
+    // compute the zone map of a field from its raw data
+    void
+    Build(const std::string& field_name, engine::meta::hybrid::DataType data_type, const std::vector<uint8_t>& data);
+
+    void
+    Set(const std::string& field_name, const ZoneMap& zone_map);
+
+    // widen the zone maps to cover another segment, used when segments are merged
+    void
+    Merge(const ZoneMaps& other);
+
+    const std::unordered_map<std::string, ZoneMap>&
+    GetZoneMaps() const;
+
+    // false only if no entity of the segment can pass the attribute predicates of the query,
+    // fields without zone map never prune
+    bool
+    MayMatch(const query::GeneralQueryPtr& general_query) const;
+
+    int64_t
+    Size() override;
+
+ private:
+    enum class MatchResult {
+        NO_FILTER,
+        MAYBE,
+        NEVER,
+    };
+
+    MatchResult
+    Match(const query::GeneralQueryPtr& general_query) const;
+
+    bool
+    MatchTerm(const query::TermQueryPtr& term_query) const;
+
+    bool
+    MatchRange(const query::RangeQueryPtr& range_query) const;
+
+ private:
+    std::unordered_map<std::string, ZoneMap> zone_maps_;
+};
+
+using ZoneMapsPtr = std::shared_ptr<ZoneMaps>;
+
+}  // namespace segment
+}  // namespace milvus
@@ -115,6 +115,13 @@ DBWrapper::StartService() {
             kill(0, SIGUSR1);
         }
 
+        s = config.GetWalConfigCompressionEnable(opt.wal_compression_enable_);
+        if (!s.ok()) {
+            std::cerr << "ERROR! Failed to get compression_enable configuration." << std::endl;
+            std::cerr << s.ToString() << std::endl;
+            kill(0, SIGUSR1);
+        }
+
         int64_t wal_buffer_size = 0;
         s = config.GetWalConfigBufferSize(wal_buffer_size);
         if (!s.ok()) {
@@ -161,6 +168,12 @@ DBWrapper::StartService() {
     }
     faiss::distance_compute_blas_threshold = use_blas_threshold;
 
+    s = config.GetEngineConfigIncrementalHnsw(opt.incremental_hnsw_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
     // set archive config
     engine::ArchiveConf::CriteriaT criterial;
     int64_t disk, days;
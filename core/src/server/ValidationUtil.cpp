@@ -182,7 +182,27 @@ ValidateIndexParams(const milvus::json& index_params, const engine::meta::Collec
         }
         case (int32_t)engine::EngineType::FAISS_IVFFLAT:
         case (int32_t)engine::EngineType::FAISS_IVFSQ8:
-        case (int32_t)engine::EngineType::FAISS_IVFSQ8NR:
+        case (int32_t)engine::EngineType::FAISS_IVFSQ8NR: {
+            auto status = CheckParameterRange(index_params, knowhere::IndexParams::nlist, 1, 999999);
+            if (!status.ok()) {
+                return status;
+            }
+
+            if (index_params.contains(knowhere::IndexParams::disk_mode) &&
+                !index_params[knowhere::IndexParams::disk_mode].is_boolean()) {
+                std::string msg = "Invalid " + std::string(knowhere::IndexParams::disk_mode) + ", must be a boolean";
+                LOG_SERVER_ERROR_ << msg;
+                return Status(SERVER_INVALID_ARGUMENT, msg);
+            }
+
+            if (index_params.contains(knowhere::IndexParams::disk_cache_size)) {
+                status = CheckParameterRange(index_params, knowhere::IndexParams::disk_cache_size, 1, 1048576);
+                if (!status.ok()) {
+                    return status;
+                }
+            }
+            break;
+        }
         case (int32_t)engine::EngineType::FAISS_IVFSQ8H:
         case (int32_t)engine::EngineType::FAISS_BIN_IVFFLAT: {
             auto status = CheckParameterRange(index_params, knowhere::IndexParams::nlist, 1, 999999);
@@ -191,7 +211,8 @@ ValidateIndexParams(const milvus::json& index_params, const engine::meta::Collec
             }
             break;
         }
-        case (int32_t)engine::EngineType::FAISS_PQ: {
+        case (int32_t)engine::EngineType::FAISS_PQ:
+        case (int32_t)engine::EngineType::FAISS_IVFPQFS: {
             auto status = CheckParameterRange(index_params, knowhere::IndexParams::nlist, 1, 999999);
             if (!status.ok()) {
                 return status;
@@ -202,9 +223,20 @@ ValidateIndexParams(const milvus::json& index_params, const engine::meta::Collec
                 return status;
             }
 
+            if (index_params.contains(knowhere::IndexParams::rerank) &&
+                !index_params[knowhere::IndexParams::rerank].is_boolean()) {
+                std::string msg = "Invalid " + std::string(knowhere::IndexParams::rerank) + ", must be a boolean";
+                LOG_SERVER_ERROR_ << msg;
+                return Status(SERVER_INVALID_ARGUMENT, msg);
+            }
+
             // special check for 'm' parameter
             std::vector<int64_t> resset;
-            milvus::knowhere::IVFPQConfAdapter::GetValidMList(collection_schema.dimension_, resset);
+            if (index_type == (int32_t)engine::EngineType::FAISS_IVFPQFS) {
+                milvus::knowhere::IVFPQFastScanConfAdapter::GetValidMList(collection_schema.dimension_, resset);
+            } else {
+                milvus::knowhere::IVFPQConfAdapter::GetValidMList(collection_schema.dimension_, resset);
+            }
             int64_t m_value = index_params[knowhere::IndexParams::m];
             if (resset.empty()) {
                 std::string msg = "Invalid collection dimension, unable to get reasonable values for 'm'";
@@ -246,6 +278,67 @@ ValidateIndexParams(const milvus::json& index_params, const engine::meta::Collec
             if (!status.ok()) {
                 return status;
             }
+
+            if (index_params.contains(knowhere::IndexParams::compact_graph) &&
+                !index_params[knowhere::IndexParams::compact_graph].is_boolean()) {
+                std::string msg =
+                    "Invalid " + std::string(knowhere::IndexParams::compact_graph) + ", must be a boolean";
+                LOG_SERVER_ERROR_ << msg;
+                return Status(SERVER_INVALID_ARGUMENT, msg);
+            }
+            if (index_params.contains(knowhere::IndexParams::colocate_vectors) &&
+                !index_params[knowhere::IndexParams::colocate_vectors].is_boolean()) {
+                std::string msg =
+                    "Invalid " + std::string(knowhere::IndexParams::colocate_vectors) + ", must be a boolean";
+                LOG_SERVER_ERROR_ << msg;
+                return Status(SERVER_INVALID_ARGUMENT, msg);
+            }
+            if (index_params.contains(knowhere::IndexParams::nn_descent) &&
+                !index_params[knowhere::IndexParams::nn_descent].is_boolean()) {
+                std::string msg = "Invalid " + std::string(knowhere::IndexParams::nn_descent) + ", must be a boolean";
+                LOG_SERVER_ERROR_ << msg;
+                return Status(SERVER_INVALID_ARGUMENT, msg);
+            }
+            break;
+        }
+        case (int32_t)engine::EngineType::DISKANN: {
+            auto status = CheckParameterRange(index_params, knowhere::IndexParams::out_degree, 4, 128);
+            if (!status.ok()) {
+                return status;
+            }
+            status = CheckParameterRange(index_params, knowhere::IndexParams::search_length, 10, 500);
+            if (!status.ok()) {
+                return status;
+            }
+            status = CheckParameterRange(index_params, knowhere::IndexParams::candidate, 50, 1000);
+            if (!status.ok()) {
+                return status;
+            }
+            status = CheckParameterExistence(index_params, knowhere::IndexParams::m);
+            if (!status.ok()) {
+                return status;
+            }
+            int64_t m_value = index_params[knowhere::IndexParams::m];
+            if (m_value <= 0 || collection_schema.dimension_ % m_value != 0) {
+                std::string msg = "Invalid " + std::string(knowhere::IndexParams::m) + ", must be a divisor of " +
+                                  std::to_string(collection_schema.dimension_);
+                LOG_SERVER_ERROR_ << msg;
+                return Status(SERVER_INVALID_ARGUMENT, msg);
+            }
+            if (index_params.contains(knowhere::IndexParams::alpha)) {
+                auto& alpha = index_params[knowhere::IndexParams::alpha];
+                if (!alpha.is_number() || alpha.get<double>() < 1.0 || alpha.get<double>() > 2.0) {
+                    std::string msg = "Invalid " + std::string(knowhere::IndexParams::alpha) + ". Valid range is [1, 2]";
+                    LOG_SERVER_ERROR_ << msg;
+                    return Status(SERVER_INVALID_ARGUMENT, msg);
+                }
+            }
+            if (index_params.contains(knowhere::IndexParams::cache_nodes)) {
+                status = CheckParameterRange(index_params, knowhere::IndexParams::cache_nodes, 0, 1000000);
+                if (!status.ok()) {
+                    return status;
+                }
+            }
             break;
         }
         case (int32_t)engine::EngineType::HNSW_SQ8NR:
@@ -274,6 +367,14 @@ ValidateIndexParams(const milvus::json& index_params, const engine::meta::Collec
 Status
 ValidateSearchParams(const milvus::json& search_params, const engine::meta::CollectionSchema& collection_schema,
                      int64_t topk) {
+    // optional for every index type, only quantized indexes make use of it
+    if (search_params.contains(knowhere::IndexParams::refine_factor)) {
+        auto status = CheckParameterRange(search_params, knowhere::IndexParams::refine_factor, 1, 64);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
     switch (collection_schema.engine_type_) {
         case (int32_t)engine::EngineType::FAISS_IDMAP:
         case (int32_t)engine::EngineType::FAISS_BIN_IDMAP: {
@@ -284,7 +385,8 @@ ValidateSearchParams(const milvus::json& search_params, const engine::meta::Coll
         case (int32_t)engine::EngineType::FAISS_IVFSQ8NR:
         case (int32_t)engine::EngineType::FAISS_IVFSQ8H:
         case (int32_t)engine::EngineType::FAISS_BIN_IVFFLAT:
-        case (int32_t)engine::EngineType::FAISS_PQ: {
+        case (int32_t)engine::EngineType::FAISS_PQ:
+        case (int32_t)engine::EngineType::FAISS_IVFPQFS: {
             auto status = CheckParameterRange(search_params, knowhere::IndexParams::nprobe, 1, 999999);
             if (!status.ok()) {
                 return status;
@@ -298,6 +400,19 @@ ValidateSearchParams(const milvus::json& search_params, const engine::meta::Coll
             }
             break;
         }
+        case (int32_t)engine::EngineType::DISKANN: {
+            auto status = CheckParameterRange(search_params, knowhere::IndexParams::search_length, topk, 4096);
+            if (!status.ok()) {
+                return status;
+            }
+            if (search_params.contains(knowhere::IndexParams::beam_width)) {
+                status = CheckParameterRange(search_params, knowhere::IndexParams::beam_width, 1, 64);
+                if (!status.ok()) {
+                    return status;
+                }
+            }
+            break;
+        }
         case (int32_t)engine::EngineType::HNSW_SQ8NR:
         case (int32_t)engine::EngineType::HNSW: {
             auto status = CheckParameterRange(search_params, knowhere::IndexParams::ef, topk, 4096);
@@ -384,6 +499,42 @@ ValidateCollectionIndexFileSize(int64_t index_file_size) {
     return Status::OK();
 }
 
+Status
+ValidateCollectionParams(const milvus::json& collection_params, int64_t metric_type, int64_t& flag) {
+    flag = 0;
+    if (!collection_params.contains(COLLECTION_VECTOR_TYPE)) {
+        return Status::OK();
+    }
+
+    auto& vector_type = collection_params[COLLECTION_VECTOR_TYPE];
+    if (!vector_type.is_string()) {
+        std::string msg = "Invalid collection params: " + std::string(COLLECTION_VECTOR_TYPE) + " must be a string";
+        LOG_SERVER_ERROR_ << msg;
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+
+    auto type_str = vector_type.get<std::string>();
+    if (type_str == "FLOAT") {
+        return Status::OK();
+    } else if (type_str == "FP16") {
+        flag = engine::meta::FLAG_MASK_FP16_VECTOR;
+    } else if (type_str == "BF16") {
+        flag = engine::meta::FLAG_MASK_BF16_VECTOR;
+    } else {
+        std::string msg = "Invalid vector type: " + type_str + ". Valid values are FLOAT, FP16 and BF16.";
+        LOG_SERVER_ERROR_ << msg;
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+
+    if (engine::utils::IsBinaryMetricType(metric_type)) {
+        std::string msg = "Vector type " + type_str + " is not supported by binary metric types";
+        LOG_SERVER_ERROR_ << msg;
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+
+    return Status::OK();
+}
+
 Status
 ValidateCollectionIndexMetricType(int32_t metric_type) {
     if (metric_type <= 0 || metric_type > static_cast<int32_t>(engine::MetricType::MAX_VALUE)) {
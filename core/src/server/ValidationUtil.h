@@ -24,12 +24,17 @@ namespace server {
 
 constexpr int64_t QUERY_MAX_TOPK = 2048;
 
+constexpr const char* COLLECTION_VECTOR_TYPE = "vector_type";
+
 extern Status
 ValidateCollectionName(const std::string& collection_name);
 
 extern Status
 ValidateTableDimension(int64_t dimension, int64_t metric_type);
 
+extern Status
+ValidateCollectionParams(const milvus::json& collection_params, int64_t metric_type, int64_t& flag);
+
 extern Status
 ValidateCollectionIndexType(int32_t index_type);
 
@@ -53,9 +53,10 @@ namespace server {
 
 Status
 RequestHandler::CreateCollection(const std::shared_ptr<Context>& context, const std::string& collection_name,
-                                 int64_t dimension, int64_t index_file_size, int64_t metric_type) {
+                                 int64_t dimension, int64_t index_file_size, int64_t metric_type,
+                                 const milvus::json& json_params) {
     BaseRequestPtr request_ptr =
-        CreateCollectionRequest::Create(context, collection_name, dimension, index_file_size, metric_type);
+        CreateCollectionRequest::Create(context, collection_name, dimension, index_file_size, metric_type, json_params);
     RequestScheduler::ExecRequest(request_ptr);
 
     return request_ptr->status();
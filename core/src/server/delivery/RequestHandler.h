@@ -31,7 +31,7 @@ class RequestHandler {
 
     Status
     CreateCollection(const std::shared_ptr<Context>& context, const std::string& collection_name, int64_t dimension,
-                     int64_t index_file_size, int64_t metric_type);
+                     int64_t index_file_size, int64_t metric_type, const milvus::json& json_params = milvus::json());
 
     Status
     HasCollection(const std::shared_ptr<Context>& context, const std::string& collection_name, bool& has_collection);
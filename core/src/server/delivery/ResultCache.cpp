@@ -0,0 +1,282 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "server/delivery/ResultCache.h"
+#include "config/Config.h"
+#include "metrics/Metrics.h"
+#include "server/DBWrapper.h"
+#include "utils/Log.h"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <utility>
+
+namespace milvus {
+namespace server {
+
+namespace {
+
+// every field is written with its length, so different requests never produce the same signature
+void
+Append(std::string& sig, const void* data, size_t size) {
+    sig.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    sig.append(reinterpret_cast<const char*>(data), size);
+}
+
+void
+Append(std::string& sig, const std::string& str) {
+    Append(sig, str.data(), str.size());
+}
+
+template <typename T>
+void
+AppendValue(std::string& sig, const T& value) {
+    Append(sig, &value, sizeof(value));
+}
+
+template <typename T>
+void
+AppendArray(std::string& sig, const std::vector<T>& array) {
+    Append(sig, array.data(), array.size() * sizeof(T));
+}
+
+void
+AppendTags(std::string& sig, std::vector<std::string> tags) {
+    std::sort(tags.begin(), tags.end());
+    AppendValue(sig, tags.size());
+    for (auto& tag : tags) {
+        Append(sig, tag);
+    }
+}
+
+void
+AppendQuery(std::string& sig, const query::GeneralQueryPtr& query) {
+    if (query == nullptr) {
+        AppendValue(sig, 'n');
+        return;
+    }
+    if (query->leaf != nullptr) {
+        auto& leaf = query->leaf;
+        AppendValue(sig, 'l');
+        if (leaf->term_query != nullptr) {
+            AppendValue(sig, 't');
+            Append(sig, leaf->term_query->field_name);
+            AppendArray(sig, leaf->term_query->field_value);
+            AppendValue(sig, leaf->term_query->boost);
+        }
+        if (leaf->range_query != nullptr) {
+            AppendValue(sig, 'r');
+            Append(sig, leaf->range_query->field_name);
+            AppendValue(sig, leaf->range_query->compare_expr.size());
+            for (auto& expr : leaf->range_query->compare_expr) {
+                AppendValue(sig, expr.compare_operator);
+                Append(sig, expr.operand);
+            }
+            AppendValue(sig, leaf->range_query->boost);
+        }
+        Append(sig, leaf->vector_placeholder);
+        AppendValue(sig, leaf->query_boost);
+    }
+    if (query->bin != nullptr) {
+        AppendValue(sig, 'b');
+        AppendValue(sig, query->bin->relation);
+        AppendValue(sig, query->bin->query_boost);
+        AppendQuery(sig, query->bin->left_query);
+        AppendQuery(sig, query->bin->right_query);
+    }
+}
+
+int64_t
+ConfiguredCapacity() {
+    int64_t capacity = 0;
+    Config::GetInstance().GetCacheConfigResultCacheSize(capacity);
+    LOG_SERVER_INFO_ << "result cache.size: " << capacity;
+    return capacity;
+}
+
+}  // namespace
+
+ResultCache::Entry::Entry(const std::string& signature, const engine::QueryResult& result)
+    : signature_(signature), result_(result) {
+    size_ = signature_.size() + result_.result_ids_.size() * sizeof(engine::IDNumber) +
+            result_.result_distances_.size() * sizeof(float);
+    for (auto& vectors : result_.vectors_) {
+        size_ += vectors.float_data_.size() * sizeof(float) + vectors.binary_data_.size() +
+                 vectors.id_array_.size() * sizeof(engine::IDNumber);
+    }
+    for (auto& attrs : result_.attrs_) {
+        for (auto& pair : attrs.attr_data_) {
+            size_ += pair.first.size() + pair.second.size();
+        }
+        size_ += attrs.id_array_.size() * sizeof(engine::IDNumber);
+    }
+}
+
+ResultCache::ResultCache() : ResultCache(ConfiguredCapacity()) {
+}
+
+ResultCache::ResultCache(int64_t capacity) {
+    cache_ = std::make_shared<cache::Cache<EntryPtr>>(std::max<int64_t>(capacity, 0), 1UL << 32, "[CACHE RESULT]");
+    enabled_ = capacity > 0;
+}
+
+void
+ResultCache::SetCapacity(int64_t capacity) {
+    if (capacity > 0) {
+        cache_->set_capacity(capacity);
+        enabled_ = true;
+    } else {
+        enabled_ = false;
+        cache_->clear();
+    }
+    server::Metrics::GetInstance().ResultCacheUsageGaugeSet(cache_->usage());
+}
+
+std::string
+ResultCache::SearchSignature(const std::string& collection_id, const std::vector<std::string>& partition_tags,
+                             const std::vector<std::string>& file_ids, int64_t topk, const milvus::json& extra_params,
+                             const engine::VectorsData& vectors) {
+    uint64_t version = 0;
+    if (!Enabled() || !DBWrapper::DB()->GetCollectionVersion(collection_id, version).ok()) {
+        return "";
+    }
+
+    std::string sig = "search";
+    Append(sig, collection_id);
+    AppendValue(sig, version);
+    AppendTags(sig, partition_tags);
+    AppendTags(sig, file_ids);
+    AppendValue(sig, topk);
+    Append(sig, extra_params.dump());
+    AppendValue(sig, vectors.vector_count_);
+    AppendArray(sig, vectors.float_data_);
+    AppendArray(sig, vectors.binary_data_);
+    return sig;
+}
+
+std::string
+ResultCache::HybridSearchSignature(const std::string& collection_id, const std::vector<std::string>& partition_tags,
+                                   const query::GeneralQueryPtr& general_query, const query::QueryPtr& query,
+                                   const milvus::json& json_params, const std::vector<std::string>& field_names) {
+    uint64_t version = 0;
+    if (!Enabled() || !DBWrapper::DB()->GetCollectionVersion(collection_id, version).ok()) {
+        return "";
+    }
+
+    std::string sig = "hybrid";
+    Append(sig, collection_id);
+    AppendValue(sig, version);
+    AppendTags(sig, partition_tags);
+    Append(sig, json_params.dump());
+    AppendValue(sig, field_names.size());
+    for (auto& name : field_names) {
+        Append(sig, name);
+    }
+    AppendQuery(sig, general_query);
+    if (query != nullptr) {
+        auto root = std::make_shared<query::GeneralQuery>();
+        root->bin = query->root;
+        AppendQuery(sig, root);
+
+        // placeholders are unordered, sort them to get the same signature for the same query
+        std::map<std::string, query::VectorQueryPtr> vectors(query->vectors.begin(), query->vectors.end());
+        AppendValue(sig, vectors.size());
+        for (auto& pair : vectors) {
+            Append(sig, pair.first);
+            auto& vector_query = pair.second;
+            if (vector_query == nullptr) {
+                AppendValue(sig, 'n');
+                continue;
+            }
+            Append(sig, vector_query->field_name);
+            Append(sig, vector_query->extra_params.dump());
+            AppendValue(sig, vector_query->topk);
+            AppendValue(sig, vector_query->boost);
+            AppendArray(sig, vector_query->query_vector.float_data);
+            AppendArray(sig, vector_query->query_vector.binary_data);
+        }
+    }
+    return sig;
+}
+
+bool
+ResultCache::Get(const std::string& signature, TopKQueryResult& result) {
+    auto entry = Lookup(signature);
+    if (entry == nullptr) {
+        return false;
+    }
+    result.row_num_ = entry->result_.row_num_;
+    result.id_list_ = entry->result_.result_ids_;
+    result.distance_list_ = entry->result_.result_distances_;
+    return true;
+}
+
+bool
+ResultCache::Get(const std::string& signature, engine::QueryResult& result) {
+    auto entry = Lookup(signature);
+    if (entry == nullptr) {
+        return false;
+    }
+    result = entry->result_;
+    return true;
+}
+
+void
+ResultCache::Insert(const std::string& signature, const TopKQueryResult& result) {
+    engine::QueryResult query_result;
+    query_result.row_num_ = result.row_num_;
+    query_result.result_ids_ = result.id_list_;
+    query_result.result_distances_ = result.distance_list_;
+    Store(signature, query_result);
+}
+
+void
+ResultCache::Insert(const std::string& signature, const engine::QueryResult& result) {
+    Store(signature, result);
+}
+
+std::string
+ResultCache::Digest(const std::string& signature) const {
+    return std::to_string(std::hash<std::string>()(signature)) + "_" + std::to_string(signature.size());
+}
+
+ResultCache::EntryPtr
+ResultCache::Lookup(const std::string& signature) {
+    if (!Enabled() || signature.empty()) {
+        return nullptr;
+    }
+
+    auto entry = cache_->get(Digest(signature));
+    if (entry == nullptr || entry->signature_ != signature) {
+        server::Metrics::GetInstance().ResultCacheMissTotalIncrement();
+        return nullptr;
+    }
+    server::Metrics::GetInstance().ResultCacheHitTotalIncrement();
+    return entry;
+}
+
+void
+ResultCache::Store(const std::string& signature, const engine::QueryResult& result) {
+    if (!Enabled() || signature.empty() || result.result_ids_.empty()) {
+        return;
+    }
+
+    auto entry = std::make_shared<Entry>(signature, result);
+    if (entry->Size() > cache_->capacity()) {
+        return;
+    }
+    cache_->insert(Digest(signature), entry);
+    server::Metrics::GetInstance().ResultCacheUsageGaugeSet(cache_->usage());
+}
+
+}  // namespace server
+}  // namespace milvus
@@ -0,0 +1,113 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include "cache/Cache.h"
+#include "cache/DataObj.h"
+#include "db/Types.h"
+#include "query/GeneralQuery.h"
+#include "server/delivery/request/BaseRequest.h"
+#include "utils/Json.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace milvus {
+namespace server {
+
+/*
+ * Results of recent searches, looked up by a signature of the request. A signature contains the version of the
+ * collection, so a flush, merge, index build or delete makes the older results unreachable and the LRU drops them.
+ * An empty signature means the request can not be cached.
+ */
+class ResultCache {
+ public:
+    static ResultCache&
+    GetInstance() {
+        static ResultCache cache;
+        return cache;
+    }
+
+    virtual ~ResultCache() = default;
+
+    bool
+    Enabled() const {
+        return enabled_;
+    }
+
+    /// resize the cache, a capacity of 0 disables it and drops every result
+    void
+    SetCapacity(int64_t capacity);
+
+    std::string
+    SearchSignature(const std::string& collection_id, const std::vector<std::string>& partition_tags,
+                    const std::vector<std::string>& file_ids, int64_t topk, const milvus::json& extra_params,
+                    const engine::VectorsData& vectors);
+
+    std::string
+    HybridSearchSignature(const std::string& collection_id, const std::vector<std::string>& partition_tags,
+                          const query::GeneralQueryPtr& general_query, const query::QueryPtr& query,
+                          const milvus::json& json_params, const std::vector<std::string>& field_names);
+
+    bool
+    Get(const std::string& signature, TopKQueryResult& result);
+
+    bool
+    Get(const std::string& signature, engine::QueryResult& result);
+
+    void
+    Insert(const std::string& signature, const TopKQueryResult& result);
+
+    void
+    Insert(const std::string& signature, const engine::QueryResult& result);
+
+ private:
+    class Entry : public cache::DataObj {
+     public:
+        Entry(const std::string& signature, const engine::QueryResult& result);
+
+        int64_t
+        Size() override {
+            return size_;
+        }
+
+        std::string signature_;
+        engine::QueryResult result_;
+        int64_t size_;
+    };
+    using EntryPtr = std::shared_ptr<Entry>;
+
+    ResultCache();
+
+ protected:
+    explicit ResultCache(int64_t capacity);
+
+    /// key of the entry for a signature, the entry keeps the full signature to tell colliding keys apart
+    virtual std::string
+    Digest(const std::string& signature) const;
+
+ private:
+    EntryPtr
+    Lookup(const std::string& signature);
+
+    void
+    Store(const std::string& signature, const engine::QueryResult& result);
+
+ private:
+    std::shared_ptr<cache::Cache<EntryPtr>> cache_;
+    std::atomic_bool enabled_{false};
+};
+
+}  // namespace server
+}  // namespace milvus
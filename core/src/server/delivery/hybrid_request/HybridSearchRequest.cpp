@@ -12,6 +12,7 @@
 #include "server/delivery/hybrid_request/HybridSearchRequest.h"
 #include "db/Utils.h"
 #include "server/DBWrapper.h"
+#include "server/delivery/ResultCache.h"
 #include "server/ValidationUtil.h"
 #include "utils/CommonUtil.h"
 #include "utils/Log.h"
@@ -105,6 +106,16 @@ HybridSearchRequest::OnExecute() {
             }
         }
 
+        auto& result_cache = ResultCache::GetInstance();
+        std::string signature;
+        if (result_cache.Enabled()) {
+            signature = result_cache.HybridSearchSignature(collection_name_, partition_list_, general_query_,
+                                                           query_ptr_, json_params, field_names_);
+            if (result_cache.Get(signature, result_)) {
+                return Status::OK();
+            }
+        }
+
         status = DBWrapper::DB()->HybridQuery(context_, collection_name_, partition_list_, general_query_, query_ptr_,
                                               field_names_, attr_type, result_);
 
@@ -120,6 +131,7 @@ HybridSearchRequest::OnExecute() {
         if (result_.result_ids_.empty()) {
             return Status::OK();  // empty table
         }
+        result_cache.Insert(signature, result_);
 
         auto post_query_ctx = context_->Child("Constructing result");
 
@@ -26,20 +26,22 @@ namespace server {
 
 CreateCollectionRequest::CreateCollectionRequest(const std::shared_ptr<milvus::server::Context>& context,
                                                  const std::string& collection_name, int64_t dimension,
-                                                 int64_t index_file_size, int64_t metric_type)
+                                                 int64_t index_file_size, int64_t metric_type,
+                                                 const milvus::json& json_params)
     : BaseRequest(context, BaseRequest::kCreateCollection),
       collection_name_(collection_name),
       dimension_(dimension),
       index_file_size_(index_file_size),
-      metric_type_(metric_type) {
+      metric_type_(metric_type),
+      json_params_(json_params) {
 }
 
 BaseRequestPtr
 CreateCollectionRequest::Create(const std::shared_ptr<milvus::server::Context>& context,
                                 const std::string& collection_name, int64_t dimension, int64_t index_file_size,
-                                int64_t metric_type) {
+                                int64_t metric_type, const milvus::json& json_params) {
     return std::shared_ptr<BaseRequest>(
-        new CreateCollectionRequest(context, collection_name, dimension, index_file_size, metric_type));
+        new CreateCollectionRequest(context, collection_name, dimension, index_file_size, metric_type, json_params));
 }
 
 Status
@@ -72,6 +74,12 @@ CreateCollectionRequest::OnExecute() {
             return status;
         }
 
+        int64_t flag = 0;
+        status = ValidateCollectionParams(json_params_, metric_type_, flag);
+        if (!status.ok()) {
+            return status;
+        }
+
         rc.RecordSection("check validation");
 
         // step 2: construct collection schema
@@ -80,6 +88,7 @@ CreateCollectionRequest::OnExecute() {
         collection_info.dimension_ = static_cast<uint16_t>(dimension_);
         collection_info.index_file_size_ = index_file_size_;
         collection_info.metric_type_ = metric_type_;
+        collection_info.flag_ = flag;
 
         // some metric type only support binary vector, adapt the index type
         if (engine::utils::IsBinaryMetricType(metric_type_)) {
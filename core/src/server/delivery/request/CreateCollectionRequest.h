@@ -15,6 +15,7 @@
 #include <string>
 
 #include "server/delivery/request/BaseRequest.h"
+#include "utils/Json.h"
 
 namespace milvus {
 namespace server {
@@ -23,11 +24,13 @@ class CreateCollectionRequest : public BaseRequest {
  public:
     static BaseRequestPtr
     Create(const std::shared_ptr<milvus::server::Context>& context, const std::string& collection_name,
-           int64_t dimension, int64_t index_file_size, int64_t metric_type);
+           int64_t dimension, int64_t index_file_size, int64_t metric_type,
+           const milvus::json& json_params = milvus::json());
 
  protected:
     CreateCollectionRequest(const std::shared_ptr<milvus::server::Context>& context, const std::string& collection_name,
-                            int64_t dimension, int64_t index_file_size, int64_t metric_type);
+                            int64_t dimension, int64_t index_file_size, int64_t metric_type,
+                            const milvus::json& json_params);
 
     Status
     OnExecute() override;
@@ -37,6 +40,7 @@ class CreateCollectionRequest : public BaseRequest {
     int64_t dimension_;
     int64_t index_file_size_;
     int64_t metric_type_;
+    milvus::json json_params_;
 };
 
 }  // namespace server
@@ -14,12 +14,15 @@
 #include "server/DBWrapper.h"
 #include "server/ValidationUtil.h"
 #include "server/context/Context.h"
+#include "server/delivery/ResultCache.h"
 #include "utils/CommonUtil.h"
 #include "utils/Log.h"
 #include "utils/TimeRecorder.h"
 
 #include <memory>
 #include <set>
+#include <string>
+#include <vector>
 
 namespace milvus {
 namespace server {
@@ -264,7 +267,9 @@ SearchCombineRequest::OnExecute() {
             }
         }
 
-        // step 2: check input
+        // step 2: check input, requests answered from the result cache return here
+        auto& result_cache = ResultCache::GetInstance();
+        std::vector<std::string> signatures;
         size_t run_request = 0;
         std::vector<SearchRequestPtr>::iterator iter = request_list_.begin();
         for (; iter != request_list_.end();) {
@@ -301,6 +306,20 @@ SearchCombineRequest::OnExecute() {
                 continue;
             }
 
+            if (result_cache.Enabled()) {
+                std::string signature =
+                    result_cache.SearchSignature(collection_name_, request->PartitionList(), request->FileIDList(),
+                                                 request->TopK(), request->ExtraParams(), request->VectorsData());
+                if (result_cache.Get(signature, request->QueryResult())) {
+                    FreeRequest(request, Status::OK());
+                    iter = request_list_.erase(iter);
+                    continue;
+                }
+                signatures.emplace_back(signature);
+            } else {
+                signatures.emplace_back();
+            }
+
             // reset topk
             search_topk_ = request->TopK() > search_topk_ ? request->TopK() : search_topk_;
 
@@ -398,7 +417,8 @@ SearchCombineRequest::OnExecute() {
         // engine ensure each target vector has same count of id/distance pairs
         size_t pair_each_vector = result_ids.size() / vectors_data_.vector_count_;
         offset = 0;
-        for (auto& request : request_list_) {
+        for (size_t r = 0; r < request_list_.size(); ++r) {
+            auto& request = request_list_[r];
             uint64_t count = request->VectorsData().vector_count_;
             int64_t topk = request->TopK();
             uint64_t pair_cnt = (pair_each_vector > topk) ? topk : pair_each_vector;
@@ -415,6 +435,7 @@ SearchCombineRequest::OnExecute() {
             }
 
             offset += count * pair_cnt;
+            result_cache.Insert(signatures[r], result);
 
             // let request return
             FreeRequest(request, Status::OK());
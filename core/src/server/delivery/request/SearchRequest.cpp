@@ -17,6 +17,7 @@
 
 #include "db/Utils.h"
 #include "server/DBWrapper.h"
+#include "server/delivery/ResultCache.h"
 #include "server/ValidationUtil.h"
 #include "utils/CommonUtil.h"
 #include "utils/Log.h"
@@ -135,6 +136,17 @@ SearchRequest::OnExecute() {
 
         rc.RecordSection("check validation");
 
+        auto& result_cache = ResultCache::GetInstance();
+        std::string signature;
+        if (result_cache.Enabled()) {
+            signature = result_cache.SearchSignature(collection_name_, partition_list_, file_id_list_, topk_,
+                                                     extra_params_, vectors_data_);
+            if (result_cache.Get(signature, result_)) {
+                rc.RecordSection("get result from cache");
+                return Status::OK();
+            }
+        }
+
         // step 7: search vectors
 #ifdef ENABLE_CPU_PROFILING
         std::string fname = "/tmp/search_" + CommonUtil::GetCurrentTimeStr() + ".profiling";
@@ -172,6 +184,7 @@ SearchRequest::OnExecute() {
         result_.row_num_ = vectors_data_.vector_count_;
         result_.id_list_.swap(result_ids);
         result_.distance_list_.swap(result_distances);
+        result_cache.Insert(signature, result_);
         rc.RecordSection("construct result");
     } catch (std::exception& ex) {
         LOG_SERVER_ERROR_ << LogOut("[%s][%ld] Encounter exception: %s", "search", 0, ex.what());
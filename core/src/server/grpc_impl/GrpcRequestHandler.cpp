@@ -135,6 +135,53 @@ CopyRowRecords(const google::protobuf::RepeatedPtrField<::milvus::grpc::RowRecor
     vectors.id_array_.swap(id_array);
 }
 
+Status
+CopyPackedRecords(const ::milvus::grpc::InsertPackedParam& param, engine::VectorsData& vectors) {
+    // the payload is one row-major buffer, its type is told by its size
+    const std::string& data = param.vector_data();
+    int64_t row_count = param.row_count();
+    int64_t dimension = param.dimension();
+    if (row_count <= 0 || dimension <= 0) {
+        return Status(SERVER_INVALID_ROWRECORD_ARRAY, "Row count and dimension of packed vectors must be positive");
+    }
+
+    // sizes are divided rather than multiplied, a row count or dimension from the client can not overflow them
+    auto match_rows = [&](uint64_t row_size) {
+        return row_size > 0 && data.size() % row_size == 0 && data.size() / row_size == static_cast<uint64_t>(row_count);
+    };
+    bool is_float = static_cast<uint64_t>(dimension) <= data.size() / sizeof(float) &&
+                    match_rows(static_cast<uint64_t>(dimension) * sizeof(float));
+    bool is_binary = !is_float && dimension % 8 == 0 && match_rows(static_cast<uint64_t>(dimension) / 8);
+    if (!is_float && !is_binary) {
+        return Status(SERVER_INVALID_ROWRECORD_ARRAY, "Packed vector data doesn't match row count and dimension");
+    }
+
+    try {
+        if (is_float) {
+            vectors.float_data_.resize(data.size() / sizeof(float));
+            memcpy(vectors.float_data_.data(), data.data(), data.size());
+        } else {
+            vectors.binary_data_.resize(data.size());
+            memcpy(vectors.binary_data_.data(), data.data(), data.size());
+        }
+    } catch (std::exception& ex) {
+        return Status(SERVER_UNEXPECTED_ERROR, "Failed to copy packed vectors: " + std::string(ex.what()));
+    }
+
+    const auto& grpc_id_array = param.row_id_array();
+    vectors.id_array_.assign(grpc_id_array.begin(), grpc_id_array.end());
+    vectors.vector_count_ = row_count;
+    return Status::OK();
+}
+
+void
+AppendVectorIds(const engine::VectorsData& vectors, ::milvus::grpc::VectorIds* response) {
+    auto grpc_ids = response->mutable_vector_id_array();
+    int offset = grpc_ids->size();
+    grpc_ids->Resize(offset + static_cast<int>(vectors.id_array_.size()), 0);
+    memcpy(grpc_ids->mutable_data() + offset, vectors.id_array_.data(), vectors.id_array_.size() * sizeof(int64_t));
+}
+
 void
 DeSerialization(const ::milvus::grpc::GeneralQuery& general_query, query::BooleanQueryPtr& boolean_clause,
                 query::QueryPtr& query_ptr) {
@@ -551,9 +598,17 @@ GrpcRequestHandler::CreateCollection(::grpc::ServerContext* context, const ::mil
     CHECK_NULLPTR_RETURN(request);
     LOG_SERVER_INFO_ << LogOut("Request [%s] %s begin.", GetContext(context)->RequestID().c_str(), __func__);
 
+    milvus::json json_params;
+    for (int i = 0; i < request->extra_params_size(); i++) {
+        const ::milvus::grpc::KeyValuePair& extra = request->extra_params(i);
+        if (extra.key() == EXTRA_PARAM_KEY) {
+            json_params = json::parse(extra.value());
+        }
+    }
+
     Status status =
         request_handler_.CreateCollection(GetContext(context), request->collection_name(), request->dimension(),
-                                          request->index_file_size(), request->metric_type());
+                                          request->index_file_size(), request->metric_type(), json_params);
 
     LOG_SERVER_INFO_ << LogOut("Request [%s] %s end.", GetContext(context)->RequestID().c_str(), __func__);
     SET_RESPONSE(response, status, context);
@@ -637,6 +692,60 @@ GrpcRequestHandler::Insert(::grpc::ServerContext* context, const ::milvus::grpc:
     return ::grpc::Status::OK;
 }
 
+::grpc::Status
+GrpcRequestHandler::InsertPacked(::grpc::ServerContext* context, const ::milvus::grpc::InsertPackedParam* request,
+                                 ::milvus::grpc::VectorIds* response) {
+    CHECK_NULLPTR_RETURN(request);
+    LOG_SERVER_INFO_ << LogOut("Request [%s] %s begin.", GetContext(context)->RequestID().c_str(), __func__);
+
+    // step 1: copy vector data
+    engine::VectorsData vectors;
+    Status status = CopyPackedRecords(*request, vectors);
+
+    // step 2: insert vectors
+    if (status.ok()) {
+        status = request_handler_.Insert(GetContext(context), request->collection_name(), vectors,
+                                         request->partition_tag());
+    }
+
+    // step 3: return id array
+    AppendVectorIds(vectors, response);
+
+    LOG_SERVER_INFO_ << LogOut("Request [%s] %s end.", GetContext(context)->RequestID().c_str(), __func__);
+    SET_RESPONSE(response->mutable_status(), status, context);
+    return ::grpc::Status::OK;
+}
+
+::grpc::Status
+GrpcRequestHandler::InsertStream(::grpc::ServerContext* context,
+                                 ::grpc::ServerReader<::milvus::grpc::InsertPackedParam>* reader,
+                                 ::milvus::grpc::VectorIds* response) {
+    if (nullptr == reader) {
+        return ::grpc::Status::OK;
+    }
+    LOG_SERVER_INFO_ << LogOut("Request [%s] %s begin.", GetContext(context)->RequestID().c_str(), __func__);
+
+    // the message is reused so its vector buffer is only allocated once for the whole stream
+    Status status;
+    ::milvus::grpc::InsertPackedParam request;
+    while (reader->Read(&request)) {
+        engine::VectorsData vectors;
+        status = CopyPackedRecords(request, vectors);
+        if (status.ok()) {
+            status = request_handler_.Insert(GetContext(context), request.collection_name(), vectors,
+                                             request.partition_tag());
+        }
+        if (!status.ok()) {
+            break;
+        }
+        AppendVectorIds(vectors, response);
+    }
+
+    LOG_SERVER_INFO_ << LogOut("Request [%s] %s end.", GetContext(context)->RequestID().c_str(), __func__);
+    SET_RESPONSE(response->mutable_status(), status, context);
+    return ::grpc::Status::OK;
+}
+
 ::grpc::Status
 GrpcRequestHandler::GetVectorsByID(::grpc::ServerContext* context, const ::milvus::grpc::VectorsIdentity* request,
                                    ::milvus::grpc::VectorsData* response) {
@@ -219,6 +219,24 @@ class GrpcRequestHandler final : public ::milvus::grpc::MilvusService::Service,
     Insert(::grpc::ServerContext* context, const ::milvus::grpc::InsertParam* request,
            ::milvus::grpc::VectorIds* response) override;
     // *
+    // @brief This method is used to add vectors packed into one buffer to collection.
+    //
+    // @param InsertPackedParam, insert parameters.
+    //
+    // @return VectorIds
+    ::grpc::Status
+    InsertPacked(::grpc::ServerContext* context, const ::milvus::grpc::InsertPackedParam* request,
+                 ::milvus::grpc::VectorIds* response) override;
+    // *
+    // @brief This method is used to bulk load vectors, each message of the stream is inserted in turn.
+    //
+    // @param InsertPackedParam, stream of insert parameters.
+    //
+    // @return VectorIds, ids of all the inserted vectors.
+    ::grpc::Status
+    InsertStream(::grpc::ServerContext* context, ::grpc::ServerReader<::milvus::grpc::InsertPackedParam>* reader,
+                 ::milvus::grpc::VectorIds* response) override;
+    // *
     // @brief This method is used to get vectors data by id array.
     //
     // @param VectorsIdentity, target vector id array.
@@ -21,8 +21,10 @@ const char* NAME_ENGINE_TYPE_IVFSQ8 = "IVFSQ8";
 const char* NAME_ENGINE_TYPE_IVFSQ8H = "IVFSQ8H";
 const char* NAME_ENGINE_TYPE_RNSG = "RNSG";
 const char* NAME_ENGINE_TYPE_IVFPQ = "IVFPQ";
+const char* NAME_ENGINE_TYPE_IVFPQFS = "IVFPQFS";
 const char* NAME_ENGINE_TYPE_HNSW = "HNSW";
 const char* NAME_ENGINE_TYPE_ANNOY = "ANNOY";
+const char* NAME_ENGINE_TYPE_DISKANN = "DISKANN";
 const char* NAME_ENGINE_TYPE_IVFSQ8NR = "IVFSQ8NR";
 const char* NAME_ENGINE_TYPE_HNSWSQ8NR = "HNSWSQ8NR";
 
@@ -54,8 +56,10 @@ const std::unordered_map<engine::EngineType, std::string> IndexMap = {
     {engine::EngineType::FAISS_IVFSQ8H, NAME_ENGINE_TYPE_IVFSQ8H},
     {engine::EngineType::NSG_MIX, NAME_ENGINE_TYPE_RNSG},
     {engine::EngineType::FAISS_PQ, NAME_ENGINE_TYPE_IVFPQ},
+    {engine::EngineType::FAISS_IVFPQFS, NAME_ENGINE_TYPE_IVFPQFS},
     {engine::EngineType::HNSW, NAME_ENGINE_TYPE_HNSW},
     {engine::EngineType::ANNOY, NAME_ENGINE_TYPE_ANNOY},
+    {engine::EngineType::DISKANN, NAME_ENGINE_TYPE_DISKANN},
     {engine::EngineType::FAISS_IVFSQ8NR, NAME_ENGINE_TYPE_IVFSQ8NR},
     {engine::EngineType::HNSW_SQ8NR, NAME_ENGINE_TYPE_HNSWSQ8NR}};
 
@@ -66,8 +70,10 @@ const std::unordered_map<std::string, engine::EngineType> IndexNameMap = {
     {NAME_ENGINE_TYPE_IVFSQ8H, engine::EngineType::FAISS_IVFSQ8H},
     {NAME_ENGINE_TYPE_RNSG, engine::EngineType::NSG_MIX},
     {NAME_ENGINE_TYPE_IVFPQ, engine::EngineType::FAISS_PQ},
+    {NAME_ENGINE_TYPE_IVFPQFS, engine::EngineType::FAISS_IVFPQFS},
     {NAME_ENGINE_TYPE_HNSW, engine::EngineType::HNSW},
     {NAME_ENGINE_TYPE_ANNOY, engine::EngineType::ANNOY},
+    {NAME_ENGINE_TYPE_DISKANN, engine::EngineType::DISKANN},
     {NAME_ENGINE_TYPE_IVFSQ8NR, engine::EngineType::FAISS_IVFSQ8NR},
     {NAME_ENGINE_TYPE_HNSWSQ8NR, engine::EngineType::HNSW_SQ8NR}};
 
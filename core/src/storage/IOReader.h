@@ -28,11 +28,19 @@ class IOReader {
     virtual void
     seekg(int64_t pos) = 0;
 
+    // read at pos without moving the read position, several threads may call it on one opened reader
+    virtual bool
+    read_at(void* ptr, int64_t size, int64_t pos) = 0;
+
     virtual int64_t
     length() = 0;
 
     virtual void
     close() = 0;
+
+    // a new reader on the same storage, for a file that stays open while this one reads others
+    virtual std::shared_ptr<IOReader>
+    clone() const = 0;
 };
 
 using IOReaderPtr = std::shared_ptr<IOReader>;
@@ -11,14 +11,28 @@
 
 #include "storage/disk/DiskIOReader.h"
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+
 namespace milvus {
 namespace storage {
 
+DiskIOReader::~DiskIOReader() {
+    close();
+}
+
 bool
 DiskIOReader::open(const std::string& name) {
+    close();
     name_ = name;
     fs_ = std::fstream(name_, std::ios::in | std::ios::binary);
-    return fs_.good();
+    if (!fs_.good()) {
+        return false;
+    }
+    fd_ = ::open(name_.c_str(), O_RDONLY);
+    return fd_ >= 0;
 }
 
 void
@@ -31,6 +45,24 @@ DiskIOReader::seekg(int64_t pos) {
     fs_.seekg(pos);
 }
 
+bool
+DiskIOReader::read_at(void* ptr, int64_t size, int64_t pos) {
+    auto data = reinterpret_cast<char*>(ptr);
+    while (size > 0) {
+        ssize_t read = ::pread(fd_, data, size, pos);
+        if (read < 0 && errno == EINTR) {
+            continue;
+        }
+        if (read <= 0) {
+            return false;
+        }
+        data += read;
+        pos += read;
+        size -= read;
+    }
+    return true;
+}
+
 int64_t
 DiskIOReader::length() {
     fs_.seekg(0, fs_.end);
@@ -41,7 +73,18 @@ DiskIOReader::length() {
 
 void
 DiskIOReader::close() {
-    fs_.close();
+    if (fs_.is_open()) {
+        fs_.close();
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+std::shared_ptr<IOReader>
+DiskIOReader::clone() const {
+    return std::make_shared<DiskIOReader>();
 }
 
 }  // namespace storage
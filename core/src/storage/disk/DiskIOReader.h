@@ -22,7 +22,7 @@ namespace storage {
 class DiskIOReader : public IOReader {
  public:
     DiskIOReader() = default;
-    ~DiskIOReader() = default;
+    ~DiskIOReader();
 
     // No copy and move
     DiskIOReader(const DiskIOReader&) = delete;
@@ -42,15 +42,22 @@ class DiskIOReader : public IOReader {
     void
     seekg(int64_t pos) override;
 
+    bool
+    read_at(void* ptr, int64_t size, int64_t pos) override;
+
     int64_t
     length() override;
 
     void
     close() override;
 
+    std::shared_ptr<IOReader>
+    clone() const override;
+
  public:
     std::string name_;
     std::fstream fs_;
+    int fd_ = -1;  // for read_at, a stream has a single position
 };
 
 using DiskIOReaderPtr = std::shared_ptr<DiskIOReader>;
@@ -18,7 +18,14 @@ bool
 DiskIOWriter::open(const std::string& name) {
     name_ = name;
     len_ = 0;
-    fs_ = std::fstream(name_, std::ios::out | std::ios::binary);
+    if (fs_.is_open()) {
+        fs_.close();
+    }
+    fs_.clear();
+    // the buffer has to be set before the file is opened
+    buffer_.resize(DISK_WRITE_BUFFER_SIZE);
+    fs_.rdbuf()->pubsetbuf(buffer_.data(), buffer_.size());
+    fs_.open(name_, std::ios::out | std::ios::binary);
     return fs_.good();
 }
 
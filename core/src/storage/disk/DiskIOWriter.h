@@ -14,11 +14,16 @@
 #include <fstream>
 #include <memory>
 #include <string>
+#include <vector>
+
 #include "storage/IOWriter.h"
 
 namespace milvus {
 namespace storage {
 
+// small writes such as headers and sizes are combined in the stream buffer, large ones go to the file directly
+constexpr int64_t DISK_WRITE_BUFFER_SIZE = 1024 * 1024;
+
 class DiskIOWriter : public IOWriter {
  public:
     DiskIOWriter() = default;
@@ -48,6 +53,7 @@ class DiskIOWriter : public IOWriter {
  public:
     std::string name_;
     int64_t len_;
+    std::vector<char> buffer_;
     std::fstream fs_;
 };
 
@@ -32,6 +32,15 @@ S3IOReader::seekg(int64_t pos) {
     pos_ = pos;
 }
 
+bool
+S3IOReader::read_at(void* ptr, int64_t size, int64_t pos) {
+    if (pos < 0 || size < 0 || pos > static_cast<int64_t>(buffer_.length()) - size) {
+        return false;
+    }
+    memcpy(ptr, buffer_.data() + pos, size);
+    return true;
+}
+
 int64_t
 S3IOReader::length() {
     return buffer_.length();
@@ -41,5 +50,10 @@ void
 S3IOReader::close() {
 }
 
+std::shared_ptr<IOReader>
+S3IOReader::clone() const {
+    return std::make_shared<S3IOReader>();
+}
+
 }  // namespace storage
 }  // namespace milvus
@@ -41,12 +41,18 @@ class S3IOReader : public IOReader {
     void
     seekg(int64_t pos) override;
 
+    bool
+    read_at(void* ptr, int64_t size, int64_t pos) override;
+
     int64_t
     length() override;
 
     void
     close() override;
 
+    std::shared_ptr<IOReader>
+    clone() const override;
+
  public:
     std::string name_;
     std::string buffer_;
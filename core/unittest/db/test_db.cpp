@@ -13,7 +13,9 @@
 #include <fiu-local.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <boost/filesystem.hpp>
+#include <functional>
 #include <random>
 #include <thread>
 
@@ -1334,6 +1336,161 @@ TEST_F(DBTest2, INSERT_DUPLICATE_ID) {
     ASSERT_TRUE(stat.ok());
 }
 
+TEST_F(DBTest, INCREMENTAL_HNSW_TEST) {
+    auto options = GetOptions();
+    options.incremental_hnsw_ = true;
+    BuildDB(options);
+
+    milvus::engine::meta::CollectionSchema collection_info = BuildCollectionSchema();
+    auto stat = db_->CreateCollection(collection_info);
+    ASSERT_TRUE(stat.ok());
+
+    // the index is declared before inserting, the insert buffer links its vectors into a graph
+    milvus::engine::CollectionIndex index;
+    index.engine_type_ = (int)milvus::engine::EngineType::HNSW;
+    index.extra_params_ = {{"M", 16}, {"efConstruction", 100}};
+    stat = db_->CreateIndex(dummy_context_, COLLECTION_NAME, index);
+    ASSERT_TRUE(stat.ok());
+
+    uint64_t nb = 2000;
+    milvus::engine::VectorsData xb;
+    BuildVectors(nb, 0, xb);
+    stat = db_->InsertVectors(COLLECTION_NAME, "", xb);
+    ASSERT_TRUE(stat.ok());
+    stat = db_->Flush();
+    ASSERT_TRUE(stat.ok());
+
+    // the flushed segment is far below index_file_size and stays raw, its graph is written next to it
+    std::vector<std::string> graph_files;
+    boost::filesystem::recursive_directory_iterator iter(options.meta_.path_), end;
+    for (; iter != end; ++iter) {
+        if (iter->path().extension() == ".hnsw") {
+            graph_files.push_back(iter->path().string());
+        }
+    }
+    ASSERT_EQ(graph_files.size(), 1);
+
+    int64_t nq = 10, topk = 10;
+    milvus::engine::VectorsData xq;
+    xq.vector_count_ = nq;
+    xq.float_data_.assign(xb.float_data_.begin(), xb.float_data_.begin() + nq * COLLECTION_DIM);
+
+    std::vector<std::string> tags;
+    milvus::json json_params = {{"ef", 64}};
+    milvus::engine::ResultIds result_ids;
+    milvus::engine::ResultDistances result_distances;
+    stat = db_->Query(dummy_context_, COLLECTION_NAME, tags, topk, json_params, xq, result_ids, result_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(result_ids.size(), nq * topk);
+    for (int64_t i = 0; i < nq; ++i) {
+        ASSERT_EQ(result_ids[i * topk], xb.id_array_[i]);
+    }
+
+    // the raw segment was loaded through its graph rather than as raw data
+    ASSERT_TRUE(milvus::cache::CpuCacheMgr::GetInstance()->ItemExists(graph_files[0]));
+}
+
+TEST_F(DBTest, REFINE_SEARCH_TEST) {
+    milvus::engine::meta::CollectionSchema collection_info = BuildCollectionSchema();
+    collection_info.metric_type_ = (int32_t)milvus::engine::MetricType::IP;
+    auto stat = db_->CreateCollection(collection_info);
+    ASSERT_TRUE(stat.ok());
+
+    uint64_t nb = 5000;
+    milvus::engine::VectorsData xb;
+    BuildVectors(nb, 0, xb);
+    stat = db_->InsertVectors(COLLECTION_NAME, "", xb);
+    ASSERT_TRUE(stat.ok());
+    stat = db_->Flush();
+    ASSERT_TRUE(stat.ok());
+
+    int64_t nq = 10, topk = 10;
+    milvus::engine::VectorsData xq;
+    xq.vector_count_ = nq;
+    xq.float_data_.assign(xb.float_data_.begin(), xb.float_data_.begin() + nq * COLLECTION_DIM);
+
+    auto inner_product = [&](int64_t query, int64_t id) {
+        float dis = 0;
+        for (int64_t d = 0; d < COLLECTION_DIM; ++d) {
+            dis += xq.float_data_[query * COLLECTION_DIM + d] * xb.float_data_[id * COLLECTION_DIM + d];
+        }
+        return dis;
+    };
+
+    // exact topk by brute force
+    std::vector<std::vector<int64_t>> ground_truth(nq);
+    for (int64_t i = 0; i < nq; ++i) {
+        std::vector<std::pair<float, int64_t>> all;
+        for (uint64_t id = 0; id < nb; ++id) {
+            all.emplace_back(inner_product(i, id), xb.id_array_[id]);
+        }
+        std::partial_sort(all.begin(), all.begin() + topk, all.end(), std::greater<std::pair<float, int64_t>>());
+        for (int64_t j = 0; j < topk; ++j) {
+            ground_truth[i].push_back(all[j].second);
+        }
+    }
+
+    auto recall = [&](const milvus::engine::ResultIds& result_ids) {
+        int64_t hits = 0;
+        for (int64_t i = 0; i < nq; ++i) {
+            for (int64_t j = 0; j < topk; ++j) {
+                auto& truth = ground_truth[i];
+                hits += std::count(truth.begin(), truth.end(), result_ids[i * topk + j]);
+            }
+        }
+        return (double)hits / (nq * topk);
+    };
+
+    std::vector<std::pair<milvus::engine::EngineType, milvus::json>> indexes = {
+        {milvus::engine::EngineType::FAISS_IVFSQ8, {{"nlist", 16}}},
+        {milvus::engine::EngineType::FAISS_PQ, {{"nlist", 16}, {"m", 16}, {"nbits", 8}}},
+    };
+    for (auto& pair : indexes) {
+        milvus::engine::CollectionIndex index;
+        index.engine_type_ = (int)pair.first;
+        index.metric_type_ = (int)milvus::engine::MetricType::IP;
+        index.extra_params_ = pair.second;
+        stat = db_->CreateIndex(dummy_context_, COLLECTION_NAME, index);
+        ASSERT_TRUE(stat.ok());
+
+        std::vector<std::string> tags;
+        milvus::engine::ResultIds plain_ids, refined_ids;
+        milvus::engine::ResultDistances plain_distances, refined_distances;
+        stat = db_->Query(dummy_context_, COLLECTION_NAME, tags, topk, {{"nprobe", 16}}, xq, plain_ids,
+                          plain_distances);
+        ASSERT_TRUE(stat.ok());
+        stat = db_->Query(dummy_context_, COLLECTION_NAME, tags, topk, {{"nprobe", 16}, {"refine_factor", 8}}, xq,
+                          refined_ids, refined_distances);
+        ASSERT_TRUE(stat.ok());
+        ASSERT_EQ(refined_ids.size(), nq * topk);
+
+        // refined results are exact inner products, ordered from the most similar
+        bool distances_changed = false;
+        for (int64_t i = 0; i < nq; ++i) {
+            for (int64_t j = 0; j < topk; ++j) {
+                auto k = i * topk + j;
+                ASSERT_GE(refined_ids[k], 0);
+                auto exact = inner_product(i, refined_ids[k]);
+                ASSERT_NEAR(refined_distances[k], exact, std::abs(exact) * 1e-4);
+                if (j > 0) {
+                    ASSERT_GE(refined_distances[k - 1], refined_distances[k]);
+                }
+                if (plain_ids[k] >= 0 && std::abs(plain_distances[k] - inner_product(i, plain_ids[k])) > 1e-3) {
+                    distances_changed = true;
+                }
+            }
+        }
+        ASSERT_TRUE(distances_changed);
+
+        auto refined_recall = recall(refined_ids);
+        ASSERT_GE(refined_recall, recall(plain_ids));
+        ASSERT_GE(refined_recall, 0.9);
+
+        stat = db_->DropIndex(COLLECTION_NAME);
+        ASSERT_TRUE(stat.ok());
+    }
+}
+
 /*
 TEST_F(DBTest2, SEARCH_WITH_DIFFERENT_INDEX) {
     milvus::engine::meta::CollectionSchema collection_info = BuildCollectionSchema();
@@ -9,6 +9,7 @@
 // is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
+#include <algorithm>
 #include <boost/filesystem.hpp>
 #include <chrono>
 #include <cmath>
@@ -525,6 +526,108 @@ TEST_F(DeleteTest, delete_multiple_times_with_index) {
     }
 }
 
+TEST_F(DeleteTest, delete_with_list_ordered_index) {
+    milvus::engine::meta::CollectionSchema collection_info = BuildCollectionSchema();
+    auto stat = db_->CreateCollection(collection_info);
+    ASSERT_TRUE(stat.ok());
+
+    int64_t nb = 5000;
+    milvus::engine::VectorsData xb;
+    BuildVectors(nb, xb);
+    for (int64_t i = 0; i < nb; i++) {
+        xb.id_array_.push_back(i);
+    }
+
+    stat = db_->InsertVectors(collection_info.collection_id_, "", xb);
+    ASSERT_TRUE(stat.ok());
+    stat = db_->Flush();
+    ASSERT_TRUE(stat.ok());
+
+    // deleted before the build, their offsets move with the segment
+    std::vector<int64_t> deleted_ids{3, 1000, 4999};
+    stat = db_->DeleteVectors(collection_info.collection_id_, deleted_ids);
+    ASSERT_TRUE(stat.ok());
+    stat = db_->Flush();
+    ASSERT_TRUE(stat.ok());
+
+    milvus::engine::CollectionIndex index;
+    index.engine_type_ = (int)milvus::engine::EngineType::FAISS_IVFFLAT;
+    index.extra_params_ = {{"nlist", 16}};
+    stat = db_->CreateIndex(dummy_context_, collection_info.collection_id_, index);
+    ASSERT_TRUE(stat.ok());
+
+    // deleted after the build, found by the rearranged uids
+    std::vector<int64_t> deleted_after{7, 2500};
+    stat = db_->DeleteVectors(collection_info.collection_id_, deleted_after);
+    ASSERT_TRUE(stat.ok());
+    stat = db_->Flush();
+    ASSERT_TRUE(stat.ok());
+    deleted_ids.insert(deleted_ids.end(), deleted_after.begin(), deleted_after.end());
+
+    uint64_t row_count;
+    stat = db_->GetCollectionRowCount(collection_info.collection_id_, row_count);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(row_count, nb - deleted_ids.size());
+
+    std::vector<int64_t> ids_to_check{0, 3, 7, 42, 1000, 2500, 3001, 4999};
+    std::vector<milvus::engine::VectorsData> vectors;
+    stat = db_->GetVectorsByID(collection_info, ids_to_check, vectors);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(vectors.size(), ids_to_check.size());
+
+    std::vector<std::string> tags;
+    int topk = 10, nprobe = 16;
+    for (size_t i = 0; i < ids_to_check.size(); ++i) {
+        auto id = ids_to_check[i];
+        bool deleted = std::find(deleted_ids.begin(), deleted_ids.end(), id) != deleted_ids.end();
+        milvus::engine::VectorsData search;
+        search.vector_count_ = 1;
+        search.float_data_.assign(xb.float_data_.begin() + id * COLLECTION_DIM,
+                                  xb.float_data_.begin() + (id + 1) * COLLECTION_DIM);
+
+        if (deleted) {
+            ASSERT_EQ(vectors[i].vector_count_, 0);
+        } else {
+            ASSERT_EQ(vectors[i].vector_count_, 1);
+            ASSERT_EQ(vectors[i].float_data_, search.float_data_);
+        }
+
+        milvus::engine::ResultIds result_ids;
+        milvus::engine::ResultDistances result_distances;
+        stat = db_->Query(dummy_context_, collection_info.collection_id_, tags, topk, {{"nprobe", nprobe}}, search,
+                          result_ids, result_distances);
+        ASSERT_TRUE(stat.ok());
+        if (deleted) {
+            ASSERT_NE(result_ids[0], id);
+        } else {
+            ASSERT_EQ(result_ids[0], id);
+            ASSERT_LT(result_distances[0], 1e-4);
+        }
+    }
+
+    // the rearranged files were renamed into place, nothing is left under a temp name
+    boost::filesystem::recursive_directory_iterator iter(GetOptions().meta_.path_), end;
+    for (; iter != end; ++iter) {
+        ASSERT_NE(iter->path().extension(), ".tmp");
+        ASSERT_NE(iter->path().filename(), "temp_del");
+    }
+
+    // uids and deleted docs of the segment still agree
+    std::string collection_stats;
+    stat = db_->GetCollectionInfo(collection_info.collection_id_, collection_stats);
+    ASSERT_TRUE(stat.ok());
+    auto json = milvus::json::parse(collection_stats);
+    std::string segment_id = json["partitions"].at(0)["segments"].at(0)["name"];
+
+    milvus::engine::IDNumbers segment_ids;
+    stat = db_->GetVectorIDs(collection_info.collection_id_, segment_id, segment_ids);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(segment_ids.size(), nb - deleted_ids.size());
+    for (auto id : deleted_ids) {
+        ASSERT_EQ(std::find(segment_ids.begin(), segment_ids.end(), id), segment_ids.end());
+    }
+}
+
 TEST_F(DeleteTest, delete_single_vector) {
     milvus::engine::meta::CollectionSchema collection_info = BuildCollectionSchema();
     auto stat = db_->CreateCollection(collection_info);
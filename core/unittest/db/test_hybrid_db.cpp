@@ -14,6 +14,7 @@
 #include <gtest/gtest.h>
 
 #include <boost/filesystem.hpp>
+#include <cmath>
 #include <random>
 #include <thread>
 
@@ -24,7 +25,13 @@
 #include "db/DBFactory.h"
 #include "db/DBImpl.h"
 #include "db/IDGenerator.h"
+#include "db/engine/QueryEvaluator.h"
 #include "db/meta/MetaConsts.h"
+#include "knowhere/index/structured_index/StructuredIndexBitmap.h"
+#include "knowhere/index/structured_index/StructuredIndexSort.h"
+#include "segment/SegmentReader.h"
+#include "segment/SegmentWriter.h"
+#include "segment/ZoneMaps.h"
 #include "db/utils.h"
 #include "utils/CommonUtil.h"
 
@@ -182,6 +189,51 @@ ConstructGeneralQuery(milvus::query::GeneralQueryPtr& general_query, milvus::que
     query_ptr->vectors.insert(std::make_pair(vector_placeholder, vector_query));
 }
 
+milvus::query::GeneralQueryPtr
+BuildRangeQuery(const std::string& field_name, milvus::query::CompareOperator op, const std::string& operand) {
+    auto general_query = std::make_shared<milvus::query::GeneralQuery>();
+    general_query->leaf = std::make_shared<milvus::query::LeafQuery>();
+    general_query->leaf->range_query = std::make_shared<milvus::query::RangeQuery>();
+    general_query->leaf->range_query->field_name = field_name;
+    milvus::query::CompareExpr expr;
+    expr.compare_operator = op;
+    expr.operand = operand;
+    general_query->leaf->range_query->compare_expr.push_back(expr);
+    return general_query;
+}
+
+milvus::query::GeneralQueryPtr
+BuildTermQuery(const std::string& field_name, const std::vector<int64_t>& values) {
+    auto general_query = std::make_shared<milvus::query::GeneralQuery>();
+    general_query->leaf = std::make_shared<milvus::query::LeafQuery>();
+    general_query->leaf->term_query = std::make_shared<milvus::query::TermQuery>();
+    general_query->leaf->term_query->field_name = field_name;
+    general_query->leaf->term_query->field_value.resize(values.size() * sizeof(int64_t));
+    memcpy(general_query->leaf->term_query->field_value.data(), values.data(), values.size() * sizeof(int64_t));
+    return general_query;
+}
+
+milvus::query::GeneralQueryPtr
+BuildBinaryQuery(milvus::query::QueryRelation relation, const milvus::query::GeneralQueryPtr& left,
+                 const milvus::query::GeneralQueryPtr& right) {
+    auto general_query = std::make_shared<milvus::query::GeneralQuery>();
+    general_query->bin->relation = relation;
+    general_query->bin->left_query = left;
+    general_query->bin->right_query = right;
+    return general_query;
+}
+
+int64_t
+CountBits(const faiss::ConcurrentBitsetPtr& bitset, int64_t entity_count) {
+    int64_t count = 0;
+    for (int64_t i = 0; i < entity_count; ++i) {
+        if (bitset->test(i)) {
+            ++count;
+        }
+    }
+    return count;
+}
+
 }  // namespace
 
 TEST_F(DBTest, HYBRID_DB_TEST) {
@@ -357,3 +409,334 @@ TEST_F(DBTest2, GET_ENTITY_BY_ID_TEST) {
         ASSERT_TRUE(vector.binary_data_.empty());
     }
 }
+
+TEST_F(DBTest2, GET_HALF_ENTITY_BY_ID_TEST) {
+    // entities of a half precision collection are converted on insert and decoded on read
+    int64_t flags[] = {milvus::engine::meta::FLAG_MASK_FP16_VECTOR, milvus::engine::meta::FLAG_MASK_BF16_VECTOR};
+    for (auto flag : flags) {
+        milvus::engine::meta::CollectionSchema collection_schema;
+        milvus::engine::meta::hybrid::FieldsSchema fields_schema;
+        std::unordered_map<std::string, milvus::engine::meta::hybrid::DataType> attr_type;
+        BuildCollectionSchema(collection_schema, fields_schema, attr_type);
+        std::string collection_name = std::string(COLLECTION_NAME) + "_" + std::to_string(flag);
+        collection_schema.collection_id_ = collection_name;
+        for (auto& field : fields_schema.fields_schema_) {
+            field.collection_id_ = collection_name;
+        }
+        collection_schema.flag_ |= flag;
+
+        auto stat = db_->CreateHybridCollection(collection_schema, fields_schema);
+        ASSERT_TRUE(stat.ok());
+
+        uint64_t vector_count = 1000;
+        milvus::engine::Entity entity;
+        BuildEntity(vector_count, 0, entity);
+
+        std::vector<std::string> field_names = {"field_0", "field_1", "field_2"};
+        stat = db_->InsertEntities(collection_name, "", field_names, entity, attr_type);
+        ASSERT_TRUE(stat.ok());
+        stat = db_->Flush();
+        ASSERT_TRUE(stat.ok());
+
+        std::vector<milvus::engine::AttrsData> attrs;
+        std::vector<milvus::engine::VectorsData> vectors;
+        stat = db_->GetEntitiesByID(collection_name, entity.id_array_, vectors, attrs);
+        ASSERT_TRUE(stat.ok());
+        ASSERT_EQ(vectors.size(), entity.id_array_.size());
+
+        auto& inserted = entity.vector_data_.at("field_3").float_data_;
+        for (uint64_t i = 0; i < vector_count; i++) {
+            ASSERT_EQ(vectors[i].float_data_.size(), COLLECTION_DIM);
+            for (int64_t j = 0; j < COLLECTION_DIM; j++) {
+                auto expected = inserted[i * COLLECTION_DIM + j];
+                ASSERT_NEAR(vectors[i].float_data_[j], expected, std::abs(expected) * 1e-2 + 1e-3);
+            }
+        }
+    }
+}
+
+TEST_F(DBTest, ZONE_MAP_TEST) {
+    uint64_t n = 1000;
+    std::vector<int64_t> int_values(n);
+    std::vector<float> float_values(n);
+    for (uint64_t i = 0; i < n; ++i) {
+        int_values[i] = 1000 + i;
+        float_values[i] = i * 0.5f;
+    }
+    std::unordered_map<std::string, std::vector<uint8_t>> attr_data;
+    std::unordered_map<std::string, uint64_t> attr_nbytes;
+    attr_data["field_1"].resize(n * sizeof(int64_t));
+    memcpy(attr_data["field_1"].data(), int_values.data(), n * sizeof(int64_t));
+    attr_nbytes["field_1"] = n * sizeof(int64_t);
+    attr_data["field_2"].resize(n * sizeof(float));
+    memcpy(attr_data["field_2"].data(), float_values.data(), n * sizeof(float));
+    attr_nbytes["field_2"] = n * sizeof(float);
+
+    std::unordered_map<std::string, milvus::engine::meta::hybrid::DataType> attr_type = {
+        {"field_1", milvus::engine::meta::hybrid::DataType::INT64},
+        {"field_2", milvus::engine::meta::hybrid::DataType::FLOAT},
+    };
+
+    // zone maps are written along with the attributes
+    std::string segment_dir = GetOptions().meta_.path_ + "/zone_map_segment";
+    auto segment_writer = std::make_shared<milvus::segment::SegmentWriter>(segment_dir);
+    segment_writer->AddVectors("zone_map", std::vector<uint8_t>(n * sizeof(float), 0), int_values);
+    segment_writer->AddAttrs("zone_map", attr_nbytes, attr_data, int_values);
+    segment_writer->SetAttrsType(attr_type);
+    ASSERT_TRUE(segment_writer->Serialize().ok());
+
+    milvus::segment::SegmentReader segment_reader(segment_dir);
+    milvus::segment::ZoneMapsPtr zone_maps;
+    ASSERT_TRUE(segment_reader.LoadZoneMaps(zone_maps).ok());
+    ASSERT_NE(zone_maps, nullptr);
+    auto& int_map = zone_maps->GetZoneMaps().at("field_1");
+    ASSERT_EQ(int_map.row_count_, (int64_t)n);
+    ASSERT_EQ(int_map.min_int_, 1000);
+    ASSERT_EQ(int_map.max_int_, 1999);
+    auto& float_map = zone_maps->GetZoneMaps().at("field_2");
+    ASSERT_DOUBLE_EQ(float_map.min_double_, 0);
+    ASSERT_DOUBLE_EQ(float_map.max_double_, 499.5);
+
+    using milvus::query::CompareOperator;
+    using milvus::query::QueryRelation;
+    ASSERT_FALSE(zone_maps->MayMatch(BuildRangeQuery("field_1", CompareOperator::GT, "1999")));
+    ASSERT_TRUE(zone_maps->MayMatch(BuildRangeQuery("field_1", CompareOperator::GTE, "1999")));
+    ASSERT_FALSE(zone_maps->MayMatch(BuildRangeQuery("field_1", CompareOperator::LT, "1000")));
+    ASSERT_FALSE(zone_maps->MayMatch(BuildRangeQuery("field_1", CompareOperator::EQ, "5000")));
+    ASSERT_FALSE(zone_maps->MayMatch(BuildRangeQuery("field_2", CompareOperator::GT, "500.0")));
+    ASSERT_TRUE(zone_maps->MayMatch(BuildRangeQuery("field_2", CompareOperator::LTE, "0")));
+    ASSERT_TRUE(zone_maps->MayMatch(BuildRangeQuery("field_0", CompareOperator::GT, "100000")));
+
+    ASSERT_FALSE(zone_maps->MayMatch(BuildTermQuery("field_1", {1, 2, 3})));
+    ASSERT_TRUE(zone_maps->MayMatch(BuildTermQuery("field_1", {1, 1500})));
+
+    auto never = BuildRangeQuery("field_1", CompareOperator::GT, "5000");
+    auto maybe = BuildRangeQuery("field_1", CompareOperator::LT, "1500");
+    auto vector_leaf = std::make_shared<milvus::query::GeneralQuery>();
+    vector_leaf->leaf = std::make_shared<milvus::query::LeafQuery>();
+    vector_leaf->leaf->vector_placeholder = "placeholder_1";
+    ASSERT_TRUE(zone_maps->MayMatch(vector_leaf));
+    ASSERT_FALSE(zone_maps->MayMatch(BuildBinaryQuery(QueryRelation::AND, never, vector_leaf)));
+    ASSERT_FALSE(zone_maps->MayMatch(BuildBinaryQuery(QueryRelation::AND, never, maybe)));
+    ASSERT_TRUE(zone_maps->MayMatch(BuildBinaryQuery(QueryRelation::OR, never, maybe)));
+
+    // merged zone maps cover both segments
+    milvus::segment::ZoneMaps other;
+    std::vector<uint8_t> other_data(sizeof(int64_t));
+    int64_t other_value = 5001;
+    memcpy(other_data.data(), &other_value, sizeof(int64_t));
+    other.Build("field_1", milvus::engine::meta::hybrid::DataType::INT64, other_data);
+    zone_maps->Merge(other);
+    ASSERT_TRUE(zone_maps->MayMatch(never));
+    ASSERT_EQ(zone_maps->GetZoneMaps().count("field_2"), 0);
+    ASSERT_TRUE(zone_maps->MayMatch(BuildRangeQuery("field_2", CompareOperator::GT, "500.0")));
+}
+
+TEST_F(DBTest, QUERY_EVALUATOR_TEST) {
+    const int64_t n = 100;
+    std::vector<int64_t> int_values(n);
+    std::vector<float> float_values(n);
+    std::vector<int32_t> low_cardinality_values(n);
+    for (int64_t i = 0; i < n; ++i) {
+        int_values[i] = i;
+        float_values[i] = i * 0.5f;
+        low_cardinality_values[i] = i % 4;
+    }
+    milvus::engine::AttrIndexMap attr_indexes;
+    attr_indexes["field_1"] = std::make_shared<milvus::knowhere::StructuredIndexSort<int64_t>>(n, int_values.data());
+    attr_indexes["field_2"] = std::make_shared<milvus::knowhere::StructuredIndexSort<float>>(n, float_values.data());
+    attr_indexes["field_3"] =
+        std::make_shared<milvus::knowhere::StructuredIndexBitmap<int32_t>>(n, low_cardinality_values.data());
+
+    std::unordered_map<std::string, milvus::engine::meta::hybrid::DataType> attr_type = {
+        {"field_1", milvus::engine::meta::hybrid::DataType::INT64},
+        {"field_2", milvus::engine::meta::hybrid::DataType::FLOAT},
+        {"field_3", milvus::engine::meta::hybrid::DataType::INT32},
+    };
+
+    auto evaluate = [&](const milvus::query::GeneralQueryPtr& general_query) -> int64_t {
+        milvus::engine::QueryEvaluatorPtr evaluator;
+        std::string vector_placeholder;
+        auto status = milvus::engine::CompileQuery(general_query, attr_type, evaluator, vector_placeholder);
+        EXPECT_TRUE(status.ok());
+        if (evaluator == nullptr) {
+            return -1;
+        }
+        faiss::ConcurrentBitsetPtr bitset;
+        EXPECT_TRUE(evaluator->Evaluate(attr_indexes, n, bitset).ok());
+        return CountBits(bitset, n);
+    };
+
+    using milvus::query::CompareOperator;
+    using milvus::query::QueryRelation;
+    ASSERT_EQ(evaluate(BuildRangeQuery("field_1", CompareOperator::GT, "89")), 10);
+    ASSERT_EQ(evaluate(BuildRangeQuery("field_1", CompareOperator::NE, "89")), 99);
+    ASSERT_EQ(evaluate(BuildRangeQuery("field_1", CompareOperator::GT, "4294967296")), 0);
+    ASSERT_EQ(evaluate(BuildRangeQuery("field_2", CompareOperator::LTE, "4.5")), 10);
+    ASSERT_EQ(evaluate(BuildRangeQuery("field_3", CompareOperator::EQ, "2")), 25);
+    ASSERT_EQ(evaluate(BuildTermQuery("field_1", {1, 5, 500})), 2);
+
+    // all the compare expressions of a range leaf apply
+    auto closed_range = BuildRangeQuery("field_1", CompareOperator::GTE, "10");
+    milvus::query::CompareExpr upper;
+    upper.compare_operator = CompareOperator::LT;
+    upper.operand = "20";
+    closed_range->leaf->range_query->compare_expr.push_back(upper);
+    ASSERT_EQ(evaluate(closed_range), 10);
+
+    // float term values are copied with the float size
+    std::vector<float> float_terms = {0.5f, 1.0f, 1000.0f};
+    auto float_term = std::make_shared<milvus::query::GeneralQuery>();
+    float_term->leaf = std::make_shared<milvus::query::LeafQuery>();
+    float_term->leaf->term_query = std::make_shared<milvus::query::TermQuery>();
+    float_term->leaf->term_query->field_name = "field_2";
+    float_term->leaf->term_query->field_value.resize(float_terms.size() * sizeof(float));
+    memcpy(float_term->leaf->term_query->field_value.data(), float_terms.data(), float_terms.size() * sizeof(float));
+    ASSERT_EQ(evaluate(float_term), 2);
+
+    auto low = BuildRangeQuery("field_1", CompareOperator::LT, "50");
+    auto even = BuildRangeQuery("field_3", CompareOperator::EQ, "0");
+    ASSERT_EQ(evaluate(BuildBinaryQuery(QueryRelation::AND, low, even)), 13);
+    ASSERT_EQ(evaluate(BuildBinaryQuery(QueryRelation::OR, low, even)), 62);
+    ASSERT_EQ(evaluate(BuildBinaryQuery(QueryRelation::R4, low, even)), 37);
+
+    // vector leaves do not filter
+    auto vector_leaf = std::make_shared<milvus::query::GeneralQuery>();
+    vector_leaf->leaf = std::make_shared<milvus::query::LeafQuery>();
+    vector_leaf->leaf->vector_placeholder = "placeholder_1";
+    ASSERT_EQ(evaluate(vector_leaf), -1);
+    ASSERT_EQ(evaluate(BuildBinaryQuery(QueryRelation::AND, low, vector_leaf)), 50);
+
+    milvus::engine::QueryEvaluatorPtr evaluator;
+    std::string vector_placeholder;
+    auto status = milvus::engine::CompileQuery(BuildBinaryQuery(QueryRelation::AND, low, vector_leaf), attr_type,
+                                               evaluator, vector_placeholder);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(vector_placeholder, "placeholder_1");
+
+    status = milvus::engine::CompileQuery(BuildRangeQuery("field_0", CompareOperator::GT, "1"), attr_type, evaluator,
+                                          vector_placeholder);
+    ASSERT_FALSE(status.ok());
+    status = milvus::engine::CompileQuery(BuildRangeQuery("field_1", CompareOperator::GT, "abc"), attr_type, evaluator,
+                                          vector_placeholder);
+    ASSERT_FALSE(status.ok());
+
+    // the attribute indexes of a segment must match the compiled types
+    status = milvus::engine::CompileQuery(BuildRangeQuery("field_1", CompareOperator::GT, "1"), attr_type, evaluator,
+                                          vector_placeholder);
+    ASSERT_TRUE(status.ok());
+    milvus::engine::AttrIndexMap wrong_indexes;
+    wrong_indexes["field_1"] = attr_indexes["field_3"];
+    faiss::ConcurrentBitsetPtr bitset;
+    ASSERT_FALSE(evaluator->Evaluate(wrong_indexes, n, bitset).ok());
+}
+
+TEST_F(DBTest, QUERY_EVALUATOR_RANGE_TEST) {
+    const int64_t n = 100;
+    std::vector<int64_t> int_values(n);
+    std::vector<int8_t> int8_values(n);
+    std::vector<int32_t> low_cardinality_values(n);
+    for (int64_t i = 0; i < n; ++i) {
+        int_values[i] = i;
+        int8_values[i] = static_cast<int8_t>(i + 28);  // 28 ... 127
+        low_cardinality_values[i] = i % 4;
+    }
+    milvus::engine::AttrIndexMap attr_indexes;
+    attr_indexes["field_1"] = std::make_shared<milvus::knowhere::StructuredIndexSort<int64_t>>(n, int_values.data());
+    attr_indexes["field_2"] = std::make_shared<milvus::knowhere::StructuredIndexSort<int8_t>>(n, int8_values.data());
+    attr_indexes["field_3"] =
+        std::make_shared<milvus::knowhere::StructuredIndexBitmap<int32_t>>(n, low_cardinality_values.data());
+
+    std::unordered_map<std::string, milvus::engine::meta::hybrid::DataType> attr_type = {
+        {"field_1", milvus::engine::meta::hybrid::DataType::INT64},
+        {"field_2", milvus::engine::meta::hybrid::DataType::INT8},
+        {"field_3", milvus::engine::meta::hybrid::DataType::INT32},
+    };
+
+    auto evaluate = [&](const milvus::query::GeneralQueryPtr& general_query) -> int64_t {
+        milvus::engine::QueryEvaluatorPtr evaluator;
+        std::string vector_placeholder;
+        EXPECT_TRUE(milvus::engine::CompileQuery(general_query, attr_type, evaluator, vector_placeholder).ok());
+        faiss::ConcurrentBitsetPtr bitset;
+        EXPECT_TRUE(evaluator->Evaluate(attr_indexes, n, bitset).ok());
+        return CountBits(bitset, n);
+    };
+
+    using milvus::query::CompareOperator;
+    auto range = [](const std::string& field_name, CompareOperator lower_op, const std::string& lower,
+                    CompareOperator upper_op, const std::string& upper) {
+        auto general_query = BuildRangeQuery(field_name, lower_op, lower);
+        milvus::query::CompareExpr expr;
+        expr.compare_operator = upper_op;
+        expr.operand = upper;
+        general_query->leaf->range_query->compare_expr.push_back(expr);
+        return general_query;
+    };
+
+    // inverted and half open point ranges are empty, they are not swapped
+    ASSERT_EQ(evaluate(range("field_1", CompareOperator::GT, "60", CompareOperator::LT, "40")), 0);
+    ASSERT_EQ(evaluate(range("field_1", CompareOperator::GTE, "20", CompareOperator::LT, "20")), 0);
+    ASSERT_EQ(evaluate(range("field_1", CompareOperator::GT, "20", CompareOperator::LTE, "20")), 0);
+    ASSERT_EQ(evaluate(range("field_1", CompareOperator::GTE, "20", CompareOperator::LTE, "20")), 1);
+    ASSERT_EQ(evaluate(range("field_3", CompareOperator::GT, "2", CompareOperator::LT, "1")), 0);
+    ASSERT_EQ(evaluate(range("field_3", CompareOperator::GTE, "2", CompareOperator::LTE, "2")), 25);
+
+    // operands outside of INT8 are clamped without changing the meaning of the compare
+    ASSERT_EQ(evaluate(BuildRangeQuery("field_2", CompareOperator::LT, "300")), 100);
+    ASSERT_EQ(evaluate(BuildRangeQuery("field_2", CompareOperator::LTE, "300")), 100);
+    ASSERT_EQ(evaluate(BuildRangeQuery("field_2", CompareOperator::GT, "300")), 0);
+    ASSERT_EQ(evaluate(BuildRangeQuery("field_2", CompareOperator::GTE, "300")), 0);
+    ASSERT_EQ(evaluate(BuildRangeQuery("field_2", CompareOperator::GT, "-300")), 100);
+    ASSERT_EQ(evaluate(BuildRangeQuery("field_2", CompareOperator::LTE, "-300")), 0);
+    ASSERT_EQ(evaluate(BuildRangeQuery("field_2", CompareOperator::EQ, "300")), 0);
+    ASSERT_EQ(evaluate(BuildRangeQuery("field_2", CompareOperator::NE, "300")), 100);
+    ASSERT_EQ(evaluate(range("field_2", CompareOperator::GTE, "100", CompareOperator::LT, "1000")), 28);
+    ASSERT_EQ(evaluate(BuildRangeQuery("field_1", CompareOperator::LT, "99999999999999999999")), 100);
+}
+
+TEST_F(DBTest, ATTR_INDEX_LOAD_TEST) {
+    const int64_t n = 100;
+    std::vector<int64_t> int_values(n);
+    std::vector<float> float_values(n);
+    for (int64_t i = 0; i < n; ++i) {
+        int_values[i] = i;
+        float_values[i] = i * 0.5f;
+    }
+    std::unordered_map<std::string, milvus::knowhere::IndexPtr> attr_indexes;
+    attr_indexes["field_1"] = std::make_shared<milvus::knowhere::StructuredIndexSort<int64_t>>(n, int_values.data());
+    attr_indexes["field_2"] = std::make_shared<milvus::knowhere::StructuredIndexSort<float>>(n, float_values.data());
+    std::unordered_map<std::string, int64_t> attr_nbytes = {{"field_1", n * sizeof(int64_t)},
+                                                            {"field_2", n * sizeof(float)}};
+    std::unordered_map<std::string, milvus::engine::meta::hybrid::DataType> attr_type = {
+        {"field_1", milvus::engine::meta::hybrid::DataType::INT64},
+        {"field_2", milvus::engine::meta::hybrid::DataType::FLOAT},
+    };
+
+    std::string segment_dir = GetOptions().meta_.path_ + "/attr_index_segment";
+    milvus::segment::SegmentWriter segment_writer(segment_dir);
+    ASSERT_TRUE(segment_writer.SetAttrsIndex(attr_indexes, attr_nbytes, attr_type).ok());
+    ASSERT_TRUE(segment_writer.WriteAttrsIndex().ok());
+
+    // a single field is read without touching the others
+    milvus::segment::SegmentReader segment_reader(segment_dir);
+    milvus::segment::AttrIndexPtr attr_index;
+    ASSERT_TRUE(segment_reader.LoadAttrsIndex("field_2", attr_index).ok());
+    ASSERT_NE(attr_index, nullptr);
+    ASSERT_EQ(attr_index->GetDataType(), milvus::engine::meta::hybrid::DataType::FLOAT);
+    auto float_index = std::dynamic_pointer_cast<milvus::knowhere::StructuredIndex<float>>(attr_index->GetAttrIndex());
+    ASSERT_NE(float_index, nullptr);
+    float value = 2.5f;
+    ASSERT_EQ(CountBits(float_index->In(1, &value), n), 1);
+
+    ASSERT_TRUE(segment_reader.LoadAttrsIndex("field_3", attr_index).ok());
+    ASSERT_EQ(attr_index, nullptr);
+
+    std::vector<std::string> field_names;
+    using milvus::query::CompareOperator;
+    using milvus::query::QueryRelation;
+    auto query = BuildBinaryQuery(QueryRelation::OR, BuildRangeQuery("field_1", CompareOperator::LT, "10"),
+                                  BuildBinaryQuery(QueryRelation::AND, BuildTermQuery("field_3", {1}),
+                                                   BuildRangeQuery("field_1", CompareOperator::GT, "90")));
+    milvus::engine::CollectQueryFields(query, field_names);
+    ASSERT_EQ(field_names, std::vector<std::string>({"field_1", "field_3"}));
+}
@@ -109,6 +109,52 @@ TEST_F(MemManagerTest, VECTOR_SOURCE_TEST) {
     ASSERT_EQ(vectors.id_array_.size(), 100);
 }
 
+TEST_F(MemManagerTest, VECTOR_SOURCE_BORROW_TEST) {
+    milvus::engine::meta::CollectionSchema collection_schema = BuildCollectionSchema();
+    auto status = impl_->CreateCollection(collection_schema);
+    ASSERT_TRUE(status.ok());
+
+    milvus::engine::meta::SegmentSchema table_file_schema;
+    table_file_schema.collection_id_ = GetCollectionName();
+    status = impl_->CreateCollectionFile(table_file_schema);
+    ASSERT_TRUE(status.ok());
+
+    int64_t n = 100;
+    milvus::engine::VectorsData vectors;
+    BuildVectors(n, vectors);
+    milvus::engine::IDNumbers ids(n);
+    for (int64_t i = 0; i < n; i++) {
+        ids[i] = i + 1000;
+    }
+
+    std::string directory;
+    milvus::engine::utils::GetParentPath(table_file_schema.location_, directory);
+    auto segment_writer_ptr = std::make_shared<milvus::segment::SegmentWriter>(directory);
+    milvus::segment::SegmentPtr segment_ptr;
+    segment_writer_ptr->GetSegment(segment_ptr);
+    segment_ptr->vectors_ptr_->Reserve(n, COLLECTION_DIM * sizeof(float));
+    auto raw_ptr = segment_ptr->vectors_ptr_->GetData().data();
+
+    // the source reads the caller's buffers in place
+    milvus::engine::VectorSource source(n, ids.data(), vectors.float_data_.data());
+    size_t num_vectors_added;
+    status = source.Add(segment_writer_ptr, table_file_schema, 50, num_vectors_added);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(num_vectors_added, 50);
+    status = source.Add(segment_writer_ptr, table_file_schema, 60, num_vectors_added);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(num_vectors_added, 50);
+    ASSERT_TRUE(source.AllAdded());
+    ASSERT_EQ(source.GetVectorIds(), ids);
+
+    // appends within the reserved room never move the raw buffer
+    auto& raw = segment_ptr->vectors_ptr_->GetData();
+    ASSERT_EQ(raw.data(), raw_ptr);
+    ASSERT_EQ(raw.size(), n * COLLECTION_DIM * sizeof(float));
+    ASSERT_EQ(memcmp(raw.data(), vectors.float_data_.data(), raw.size()), 0);
+    ASSERT_EQ(segment_ptr->vectors_ptr_->GetUids(), ids);
+}
+
 TEST_F(MemManagerTest, MEM_TABLE_FILE_TEST) {
     auto options = GetOptions();
     fiu_init(0);
@@ -11,6 +11,7 @@
 
 #include "db/Constants.h"
 #include "db/Utils.h"
+#include "db/meta/CachedMetaImpl.h"
 #include "db/meta/MetaConsts.h"
 #include "db/meta/SqliteMetaImpl.h"
 #include "db/utils.h"
@@ -21,6 +22,8 @@
 #include <stdlib.h>
 #include <time.h>
 #include <boost/filesystem/operations.hpp>
+#include <chrono>
+#include <iostream>
 
 TEST_F(MetaTest, COLLECTION_TEST) {
     auto collection_id = "meta_test_table";
@@ -772,6 +775,184 @@ TEST_F(MetaTest, INDEX_TEST) {
     ASSERT_TRUE(status.ok());
 }
 
+TEST_F(MetaTest, CACHED_META_TEST) {
+    auto collection_id = "cached_meta_test";
+    auto cached_meta = std::make_shared<milvus::engine::meta::CachedMetaImpl>(impl_);
+
+    milvus::engine::meta::CollectionSchema collection;
+    collection.collection_id_ = collection_id;
+    auto status = cached_meta->CreateCollection(collection);
+    ASSERT_TRUE(status.ok());
+
+    const int64_t raw_files_cnt = 10;
+    milvus::engine::meta::SegmentSchema table_file;
+    table_file.collection_id_ = collection_id;
+    for (auto i = 0; i < raw_files_cnt; ++i) {
+        status = cached_meta->CreateCollectionFile(table_file);
+        table_file.file_type_ = milvus::engine::meta::SegmentSchema::RAW;
+        table_file.row_count_ = 1;
+        status = cached_meta->UpdateCollectionFile(table_file);
+    }
+
+    milvus::engine::meta::FilesHolder files_holder;
+    status = cached_meta->FilesToSearch(collection_id, files_holder);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(files_holder.HoldFiles().size(), raw_files_cnt);
+
+    // served from cache, the backend is not asked again
+    auto version = cached_meta->CacheVersion();
+    files_holder.ReleaseFiles();
+    status = cached_meta->FilesToSearch(collection_id, files_holder);
+    ASSERT_EQ(files_holder.HoldFiles().size(), raw_files_cnt);
+    ASSERT_EQ(version, cached_meta->CacheVersion());
+
+    // mutation through the cached meta is visible at once
+    table_file.file_type_ = milvus::engine::meta::SegmentSchema::TO_DELETE;
+    status = cached_meta->UpdateCollectionFile(table_file);
+    ASSERT_TRUE(status.ok());
+    ASSERT_GT(cached_meta->CacheVersion(), version);
+    files_holder.ReleaseFiles();
+    status = cached_meta->FilesToSearch(collection_id, files_holder);
+    ASSERT_EQ(files_holder.HoldFiles().size(), raw_files_cnt - 1);
+
+    std::set<std::string> partition_ids;
+    files_holder.ReleaseFiles();
+    status = cached_meta->FilesToSearchEx(collection_id, partition_ids, files_holder);
+    ASSERT_EQ(files_holder.HoldFiles().size(), raw_files_cnt - 1);
+
+    std::vector<milvus::engine::meta::CollectionSchema> partitions;
+    status = cached_meta->ShowPartitions(collection_id, partitions);
+    ASSERT_TRUE(status.ok());
+    ASSERT_TRUE(partitions.empty());
+
+    status = cached_meta->CreatePartition(collection_id, "cached_meta_partition", "0", 0);
+    ASSERT_TRUE(status.ok());
+    status = cached_meta->ShowPartitions(collection_id, partitions);
+    ASSERT_EQ(partitions.size(), 1);
+
+    partition_ids.insert(partitions[0].collection_id_);
+    table_file.collection_id_ = partitions[0].collection_id_;
+    status = cached_meta->CreateCollectionFile(table_file);
+    table_file.file_type_ = milvus::engine::meta::SegmentSchema::INDEX;
+    status = cached_meta->UpdateCollectionFile(table_file);
+    files_holder.ReleaseFiles();
+    status = cached_meta->FilesToSearchEx(collection_id, partition_ids, files_holder);
+    ASSERT_EQ(files_holder.HoldFiles().size(), raw_files_cnt);
+
+    // a flush lsn does not change the searchable files
+    auto collection_version = cached_meta->CollectionVersion(collection_id);
+    status = cached_meta->UpdateCollectionFlushLSN(collection_id, 100);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(collection_version, cached_meta->CollectionVersion(collection_id));
+
+    // a change written behind the cache stays hidden while the collection is not touched through it
+    files_holder.ReleaseFiles();
+    status = cached_meta->FilesToSearch(collection_id, files_holder);
+    ASSERT_EQ(files_holder.HoldFiles().size(), raw_files_cnt - 1);
+    auto hidden_file = files_holder.HoldFiles()[0];
+    hidden_file.file_type_ = milvus::engine::meta::SegmentSchema::TO_DELETE;
+    status = impl_->UpdateCollectionFile(hidden_file);
+    ASSERT_TRUE(status.ok());
+
+    // changes of another collection leave the cached lists and the version of this one alone
+    auto other_id = "cached_meta_test_other";
+    milvus::engine::meta::CollectionSchema other;
+    other.collection_id_ = other_id;
+    status = cached_meta->CreateCollection(other);
+    ASSERT_TRUE(status.ok());
+    milvus::engine::meta::SegmentSchema other_file;
+    other_file.collection_id_ = other_id;
+    status = cached_meta->CreateCollectionFile(other_file);
+    other_file.file_type_ = milvus::engine::meta::SegmentSchema::RAW;
+    other_file.row_count_ = 1;
+    status = cached_meta->UpdateCollectionFile(other_file);
+    ASSERT_TRUE(status.ok());
+    ASSERT_GT(cached_meta->CollectionVersion(other_id), collection_version);
+    ASSERT_EQ(collection_version, cached_meta->CollectionVersion(collection_id));
+    files_holder.ReleaseFiles();
+    status = cached_meta->FilesToSearch(collection_id, files_holder);
+    ASSERT_EQ(files_holder.HoldFiles().size(), raw_files_cnt - 1);
+    files_holder.ReleaseFiles();
+    status = cached_meta->FilesToSearchEx(collection_id, partition_ids, files_holder);
+    ASSERT_EQ(files_holder.HoldFiles().size(), raw_files_cnt);
+    files_holder.ReleaseFiles();
+    status = cached_meta->FilesToSearch(other_id, files_holder);
+    ASSERT_EQ(files_holder.HoldFiles().size(), 1);
+
+    // a change of one of its partitions drops the lists of the collection
+    table_file.file_type_ = milvus::engine::meta::SegmentSchema::TO_DELETE;
+    status = cached_meta->UpdateCollectionFile(table_file);
+    ASSERT_TRUE(status.ok());
+    ASSERT_GT(cached_meta->CollectionVersion(collection_id), collection_version);
+    files_holder.ReleaseFiles();
+    status = cached_meta->FilesToSearch(collection_id, files_holder);
+    ASSERT_EQ(files_holder.HoldFiles().size(), raw_files_cnt - 2);
+    files_holder.ReleaseFiles();
+    status = cached_meta->FilesToSearchEx(collection_id, partition_ids, files_holder);
+    ASSERT_EQ(files_holder.HoldFiles().size(), raw_files_cnt - 2);
+    files_holder.ReleaseFiles();
+
+    status = cached_meta->DropCollections({other_id});
+    ASSERT_TRUE(status.ok());
+    status = cached_meta->DropCollections({collection_id});
+    ASSERT_TRUE(status.ok());
+    status = cached_meta->ShowPartitions(collection_id, partitions);
+    ASSERT_TRUE(partitions.empty());
+}
+
+TEST_F(MetaTest, CACHED_META_BENCHMARK) {
+    auto collection_id = "cached_meta_benchmark";
+    auto cached_meta = std::make_shared<milvus::engine::meta::CachedMetaImpl>(impl_);
+
+    milvus::engine::meta::CollectionSchema collection;
+    collection.collection_id_ = collection_id;
+    auto status = cached_meta->CreateCollection(collection);
+    ASSERT_TRUE(status.ok());
+
+    const int64_t files_cnt = 100;
+    milvus::engine::meta::SegmentSchema table_file;
+    table_file.collection_id_ = collection_id;
+    for (auto i = 0; i < files_cnt; ++i) {
+        status = cached_meta->CreateCollectionFile(table_file);
+        table_file.file_type_ = (i % 2) ? milvus::engine::meta::SegmentSchema::RAW
+                                        : milvus::engine::meta::SegmentSchema::INDEX;
+        table_file.row_count_ = 1;
+        status = cached_meta->UpdateCollectionFile(table_file);
+    }
+
+    const int64_t loops = 1000;
+    std::set<std::string> partition_ids;
+    milvus::engine::meta::FilesHolder files_holder;
+    auto bench = [&](milvus::engine::meta::Meta& meta, bool with_partitions) {
+        auto start = std::chrono::steady_clock::now();
+        for (auto i = 0; i < loops; ++i) {
+            if (with_partitions) {
+                status = meta.FilesToSearchEx(collection_id, partition_ids, files_holder);
+            } else {
+                status = meta.FilesToSearch(collection_id, files_holder);
+            }
+            EXPECT_TRUE(status.ok());
+            EXPECT_EQ(files_holder.HoldFiles().size(), files_cnt);
+            files_holder.ReleaseFiles();
+        }
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    };
+
+    auto sqlite_us = bench(*impl_, false);
+    auto cached_us = bench(*cached_meta, false);
+    std::cout << "FilesToSearch x" << loops << ": sqlite " << sqlite_us << "us, cached " << cached_us << "us"
+              << std::endl;
+
+    sqlite_us = bench(*impl_, true);
+    cached_us = bench(*cached_meta, true);
+    std::cout << "FilesToSearchEx x" << loops << ": sqlite " << sqlite_us << "us, cached " << cached_us << "us"
+              << std::endl;
+
+    status = cached_meta->DropCollections({collection_id});
+    ASSERT_TRUE(status.ok());
+}
+
 TEST_F(MetaTest, LSN_TEST) {
     auto collection_id = "lsn_test";
     uint64_t lsn = 42949672960;
@@ -19,7 +19,10 @@
 #include "server/Server.h"
 #include "server/delivery/RequestHandler.h"
 #include "server/delivery/RequestScheduler.h"
+#include "server/delivery/ResultCache.h"
 #include "server/delivery/request/BaseRequest.h"
+#include "server/delivery/request/SearchCombineRequest.h"
+#include "server/delivery/request/SearchRequest.h"
 #include "server/grpc_impl/GrpcRequestHandler.h"
 #include "src/version.h"
 
@@ -348,6 +351,60 @@ TEST_F(RpcHandlerTest, INSERT_TEST) {
     ASSERT_EQ(vector_ids.status().error_code(), ::milvus::grpc::ILLEGAL_ROWRECORD);
 }
 
+TEST_F(RpcHandlerTest, INSERT_PACKED_TEST) {
+    ::grpc::ServerContext context;
+    handler->SetContext(&context, dummy_context);
+    handler->RegisterRequestHandler(milvus::server::RequestHandler());
+    ::milvus::grpc::InsertPackedParam request;
+    request.set_collection_name(COLLECTION_NAME);
+    request.set_dimension(COLLECTION_DIM);
+    request.set_row_count(VECTOR_COUNT);
+
+    std::vector<std::vector<float>> record_array;
+    BuildVectors(0, VECTOR_COUNT, record_array);
+    std::string* data = request.mutable_vector_data();
+    for (auto& record : record_array) {
+        data->append(reinterpret_cast<const char*>(record.data()), record.size() * sizeof(float));
+    }
+
+    ::milvus::grpc::VectorIds vector_ids;
+    handler->InsertPacked(&context, &request, &vector_ids);
+    ASSERT_EQ(vector_ids.status().error_code(), ::milvus::grpc::SUCCESS);
+    ASSERT_EQ(vector_ids.vector_id_array_size(), VECTOR_COUNT);
+
+    // the buffer must hold exactly row_count vectors
+    request.mutable_vector_data()->resize(data->size() - sizeof(float));
+    vector_ids.Clear();
+    handler->InsertPacked(&context, &request, &vector_ids);
+    ASSERT_EQ(vector_ids.status().error_code(), ::milvus::grpc::ILLEGAL_ROWRECORD);
+    ASSERT_EQ(vector_ids.vector_id_array_size(), 0);
+
+    request.set_row_count(0);
+    vector_ids.Clear();
+    handler->InsertPacked(&context, &request, &vector_ids);
+    ASSERT_EQ(vector_ids.status().error_code(), ::milvus::grpc::ILLEGAL_ROWRECORD);
+
+    request.set_row_count(VECTOR_COUNT);
+    request.set_dimension(-COLLECTION_DIM);
+    vector_ids.Clear();
+    handler->InsertPacked(&context, &request, &vector_ids);
+    ASSERT_EQ(vector_ids.status().error_code(), ::milvus::grpc::ILLEGAL_ROWRECORD);
+
+    // row_count * dimension * sizeof(float) wraps around to the buffer size, it must not pass for a match
+    request.mutable_vector_data()->assign(64, '\0');
+    request.set_dimension((int64_t(1) << 62) + 4);
+    request.set_row_count(4);
+    vector_ids.Clear();
+    handler->InsertPacked(&context, &request, &vector_ids);
+    ASSERT_EQ(vector_ids.status().error_code(), ::milvus::grpc::ILLEGAL_ROWRECORD);
+
+    request.set_dimension(4);
+    request.set_row_count((int64_t(1) << 62) + 4);
+    vector_ids.Clear();
+    handler->InsertPacked(&context, &request, &vector_ids);
+    ASSERT_EQ(vector_ids.status().error_code(), ::milvus::grpc::ILLEGAL_ROWRECORD);
+}
+
 TEST_F(RpcHandlerTest, SEARCH_TEST) {
     ::grpc::ServerContext context;
     handler->SetContext(&context, dummy_context);
@@ -615,6 +672,238 @@ TEST_F(RpcHandlerTest, COMBINE_SEARCH_BINARY_TEST) {
     }
 }
 
+namespace {
+
+// maps every signature to the same entry, as if their digests collided
+class CollidingResultCache : public milvus::server::ResultCache {
+ public:
+    explicit CollidingResultCache(int64_t capacity) : ResultCache(capacity) {
+    }
+
+ protected:
+    std::string
+    Digest(const std::string& signature) const override {
+        return "digest";
+    }
+};
+
+milvus::engine::VectorsData
+BuildQueryVectors(int64_t from, int64_t to) {
+    std::vector<std::vector<float>> record_array;
+    BuildVectors(from, to, record_array);
+    milvus::engine::VectorsData vectors;
+    vectors.vector_count_ = record_array.size();
+    for (auto& record : record_array) {
+        vectors.float_data_.insert(vectors.float_data_.end(), record.begin(), record.end());
+    }
+    return vectors;
+}
+
+// a result no search returns, so a search that returns it was answered from the cache
+milvus::server::TopKQueryResult
+PlantedResult(int64_t nq, int64_t topk) {
+    milvus::server::TopKQueryResult result;
+    result.row_num_ = nq;
+    result.id_list_.assign(nq * topk, -1);
+    result.distance_list_.assign(nq * topk, -1.0f);
+    return result;
+}
+
+milvus::server::TopKQueryResult
+SearchCollection(const std::shared_ptr<milvus::server::Context>& context, const std::string& collection_name,
+                 milvus::engine::VectorsData vectors, int64_t topk, const milvus::json& extra_params,
+                 const std::vector<std::string>& partition_list = {}) {
+    milvus::server::TopKQueryResult result;
+    auto request = milvus::server::SearchRequest::Create(context, collection_name, vectors, topk, extra_params,
+                                                         partition_list, {}, result);
+    auto status = request->Execute();
+    EXPECT_TRUE(status.ok()) << status.message();
+    return result;
+}
+
+}  // namespace
+
+TEST_F(RpcHandlerTest, RESULT_CACHE_TEST) {
+    auto& result_cache = milvus::server::ResultCache::GetInstance();
+    result_cache.SetCapacity(64 * 1024 * 1024);
+    ASSERT_TRUE(result_cache.Enabled());
+
+    auto db = milvus::server::DBWrapper::DB();
+    const std::string tag = "cache_tag";
+    ASSERT_TRUE(db->CreatePartition(COLLECTION_NAME, "", tag).ok());
+
+    auto vectors = BuildQueryVectors(0, VECTOR_COUNT);
+    ASSERT_TRUE(db->InsertVectors(COLLECTION_NAME, "", vectors).ok());
+    ASSERT_TRUE(db->Flush(COLLECTION_NAME).ok());
+    auto ids = vectors.id_array_;
+    ASSERT_EQ(ids.size(), VECTOR_COUNT);
+
+    const int64_t nq = 2, topk = 10;
+    milvus::json extra_params = {{"nprobe", 16}};
+    auto query = BuildQueryVectors(0, nq);
+    auto planted = PlantedResult(nq, topk);
+
+    // the first search misses and caches its result
+    auto signature = result_cache.SearchSignature(COLLECTION_NAME, {}, {}, topk, extra_params, query);
+    ASSERT_FALSE(signature.empty());
+    milvus::server::TopKQueryResult cached;
+    ASSERT_FALSE(result_cache.Get(signature, cached));
+    auto result = SearchCollection(dummy_context, COLLECTION_NAME, query, topk, extra_params);
+    ASSERT_EQ(result.row_num_, nq);
+    ASSERT_EQ(result.id_list_.size(), nq * topk);
+    ASSERT_TRUE(result_cache.Get(signature, cached));
+    ASSERT_EQ(cached.id_list_, result.id_list_);
+    ASSERT_EQ(cached.distance_list_, result.distance_list_);
+
+    // the same request is answered from the cache
+    result_cache.Insert(signature, planted);
+    ASSERT_EQ(result_cache.SearchSignature(COLLECTION_NAME, {}, {}, topk, extra_params, query), signature);
+    result = SearchCollection(dummy_context, COLLECTION_NAME, query, topk, extra_params);
+    ASSERT_EQ(result.id_list_, planted.id_list_);
+
+    // a different topk, params, partitions or vectors misses
+    std::vector<std::string> others = {
+        result_cache.SearchSignature(COLLECTION_NAME, {}, {}, topk - 1, extra_params, query),
+        result_cache.SearchSignature(COLLECTION_NAME, {}, {}, topk, {{"nprobe", 8}}, query),
+        result_cache.SearchSignature(COLLECTION_NAME, {tag}, {}, topk, extra_params, query),
+        result_cache.SearchSignature(COLLECTION_NAME, {}, {}, topk, extra_params, BuildQueryVectors(1, nq + 1)),
+    };
+    for (auto& other : others) {
+        ASSERT_FALSE(other.empty());
+        ASSERT_NE(other, signature);
+        ASSERT_FALSE(result_cache.Get(other, cached));
+    }
+    result = SearchCollection(dummy_context, COLLECTION_NAME, query, topk - 1, extra_params);
+    ASSERT_EQ(result.id_list_.size(), nq * (topk - 1));
+    ASSERT_NE(result.id_list_[0], -1);
+    result = SearchCollection(dummy_context, COLLECTION_NAME, BuildQueryVectors(1, nq + 1), topk, extra_params);
+    ASSERT_NE(result.id_list_, planted.id_list_);
+
+    // every change of the collection makes the next search miss
+    uint64_t version = 0;
+    ASSERT_TRUE(db->GetCollectionVersion(COLLECTION_NAME, version).ok());
+    auto expect_miss = [&](const std::string& change) {
+        uint64_t new_version = 0;
+        ASSERT_TRUE(db->GetCollectionVersion(COLLECTION_NAME, new_version).ok());
+        ASSERT_NE(new_version, version) << change;
+        version = new_version;
+
+        auto new_signature = result_cache.SearchSignature(COLLECTION_NAME, {}, {}, topk, extra_params, query);
+        ASSERT_NE(new_signature, signature) << change;
+        ASSERT_FALSE(result_cache.Get(new_signature, cached)) << change;
+        auto new_result = SearchCollection(dummy_context, COLLECTION_NAME, query, topk, extra_params);
+        ASSERT_NE(new_result.id_list_, planted.id_list_) << change;
+
+        signature = new_signature;
+        result_cache.Insert(signature, planted);
+    };
+
+    auto more = BuildQueryVectors(VECTOR_COUNT, VECTOR_COUNT * 2);
+    ASSERT_TRUE(db->InsertVectors(COLLECTION_NAME, "", more).ok());
+    ASSERT_TRUE(db->Flush(COLLECTION_NAME).ok());
+    expect_miss("flush");
+
+    ASSERT_TRUE(db->DeleteVectors(COLLECTION_NAME, {ids[0], ids[1]}).ok());
+    ASSERT_TRUE(db->Flush(COLLECTION_NAME).ok());
+    expect_miss("delete");
+
+    milvus::engine::CollectionIndex index;
+    index.engine_type_ = (int)milvus::engine::EngineType::FAISS_IVFFLAT;
+    index.extra_params_ = {{"nlist", 16}};
+    ASSERT_TRUE(db->CreateIndex(dummy_context, COLLECTION_NAME, index).ok());
+    expect_miss("index build");
+
+    ASSERT_TRUE(db->DropPartitionByTag(COLLECTION_NAME, tag).ok());
+    expect_miss("partition drop");
+
+    result_cache.SetCapacity(0);
+    ASSERT_FALSE(result_cache.Enabled());
+    ASSERT_FALSE(result_cache.Get(signature, cached));
+}
+
+TEST_F(RpcHandlerTest, RESULT_CACHE_COLLISION_TEST) {
+    CollidingResultCache result_cache(64 * 1024 * 1024);
+    ASSERT_TRUE(result_cache.Enabled());
+
+    milvus::json extra_params = {{"nprobe", 16}};
+    auto signature = result_cache.SearchSignature(COLLECTION_NAME, {}, {}, 10, extra_params, BuildQueryVectors(0, 1));
+    auto other = result_cache.SearchSignature(COLLECTION_NAME, {}, {}, 10, extra_params, BuildQueryVectors(1, 2));
+    ASSERT_FALSE(signature.empty());
+    ASSERT_NE(other, signature);
+    ASSERT_EQ(other.size(), signature.size());
+
+    // both signatures share an entry, only the one it was stored for gets it back
+    auto planted = PlantedResult(1, 10);
+    result_cache.Insert(signature, planted);
+    milvus::server::TopKQueryResult cached;
+    ASSERT_FALSE(result_cache.Get(other, cached));
+    ASSERT_TRUE(result_cache.Get(signature, cached));
+    ASSERT_EQ(cached.id_list_, planted.id_list_);
+
+    result_cache.Insert(other, planted);
+    ASSERT_FALSE(result_cache.Get(signature, cached));
+}
+
+TEST_F(RpcHandlerTest, RESULT_CACHE_COMBINE_TEST) {
+    auto& result_cache = milvus::server::ResultCache::GetInstance();
+    result_cache.SetCapacity(64 * 1024 * 1024);
+
+    auto db = milvus::server::DBWrapper::DB();
+    auto vectors = BuildQueryVectors(0, VECTOR_COUNT);
+    for (int64_t i = 0; i < VECTOR_COUNT; i++) {
+        vectors.id_array_.push_back(i + 1);
+    }
+    ASSERT_TRUE(db->InsertVectors(COLLECTION_NAME, "", vectors).ok());
+    ASSERT_TRUE(db->Flush(COLLECTION_NAME).ok());
+
+    // the second request is cached, the others are searched together
+    const int64_t request_count = 3, nq = 2, topk = 5;
+    milvus::json extra_params = {{"nprobe", 16}};
+    auto planted = PlantedResult(nq, topk);
+    std::vector<milvus::server::TopKQueryResult> results(request_count);
+    std::vector<std::string> signatures;
+    auto combine_request = std::make_shared<milvus::server::SearchCombineRequest>();
+    std::vector<milvus::server::SearchRequestPtr> requests;
+    for (int64_t i = 0; i < request_count; i++) {
+        auto query = BuildQueryVectors(i * nq, (i + 1) * nq);
+        signatures.push_back(result_cache.SearchSignature(COLLECTION_NAME, {}, {}, topk, extra_params, query));
+        auto request = std::static_pointer_cast<milvus::server::SearchRequest>(milvus::server::SearchRequest::Create(
+            dummy_context, COLLECTION_NAME, query, topk, extra_params, {}, {}, results[i]));
+        if (i > 0) {
+            ASSERT_TRUE(combine_request->CanCombine(request));
+        }
+        ASSERT_TRUE(combine_request->Combine(request).ok());
+        requests.push_back(request);
+    }
+    result_cache.Insert(signatures[1], planted);
+
+    ASSERT_TRUE(combine_request->Execute().ok());
+    for (int64_t i = 0; i < request_count; i++) {
+        ASSERT_TRUE(requests[i]->WaitToFinish().ok());
+        auto& result = results[i];
+        ASSERT_EQ(result.row_num_, nq);
+        ASSERT_EQ(result.id_list_.size(), nq * topk);
+        ASSERT_EQ(result.distance_list_.size(), nq * topk);
+
+        milvus::server::TopKQueryResult cached;
+        ASSERT_TRUE(result_cache.Get(signatures[i], cached));
+        ASSERT_EQ(cached.id_list_, result.id_list_);
+        ASSERT_EQ(cached.distance_list_, result.distance_list_);
+        if (i == 1) {
+            ASSERT_EQ(result.id_list_, planted.id_list_);
+            continue;
+        }
+
+        // every query vector finds itself first
+        for (int64_t q = 0; q < nq; q++) {
+            ASSERT_EQ(result.id_list_[q * topk], i * nq + q + 1);
+            ASSERT_LT(result.distance_list_[q * topk], 0.00001);
+        }
+    }
+
+    result_cache.SetCapacity(0);
+}
+
 TEST_F(RpcHandlerTest, TABLES_TEST) {
     ::grpc::ServerContext context;
     handler->SetContext(&context, dummy_context);
@@ -13,6 +13,9 @@
 #include <cmath>
 #include <vector>
 
+#include "knowhere/index/vector_index/IndexIDMAP.h"
+#include "knowhere/index/vector_index/adapter/VectorAdapter.h"
+#include "knowhere/index/vector_index/helpers/IndexParameter.h"
 #include "scheduler/job/SearchJob.h"
 #include "scheduler/task/SearchTask.h"
 #include "utils/TimeRecorder.h"
@@ -162,6 +165,102 @@ TEST(DBSearchTest, MERGE_RESULT_SET_TEST) {
     MergeTopkToResultSetTest(TOP_K / 2, TOP_K / 3, NQ, TOP_K, false);
 }
 
+namespace {
+
+void
+QuerySegment(const milvus::knowhere::IDMAPPtr& index, const milvus::knowhere::DatasetPtr& query,
+             const milvus::knowhere::Config& conf, size_t nq, size_t topk, ms::ResultIds& ids,
+             ms::ResultDistances& distances) {
+    auto result = index->Query(query, conf);
+    auto res_ids = result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    auto res_dist = result->Get<float*>(milvus::knowhere::meta::DISTANCE);
+    ids.assign(res_ids, res_ids + nq * topk);
+    distances.assign(res_dist, res_dist + nq * topk);
+    free(res_ids);
+    free(res_dist);
+}
+
+}  // namespace
+
+TEST(DBSearchTest, TOPK_BOUNDS_TEST) {
+    const int64_t dim = 16, segment_rows = 2000, segment_count = 4;
+    const size_t nq = 8, topk = 10;
+
+    std::vector<float> queries(nq * dim);
+    for (auto& v : queries) {
+        v = drand48();
+    }
+    auto query = milvus::knowhere::GenDataset(nq, dim, queries.data());
+
+    for (auto metric : {milvus::knowhere::Metric::L2, milvus::knowhere::Metric::IP}) {
+        bool ascending = (metric == milvus::knowhere::Metric::L2);
+        milvus::knowhere::Config conf{{milvus::knowhere::meta::DIM, dim},
+                                      {milvus::knowhere::meta::TOPK, topk},
+                                      {milvus::knowhere::Metric::TYPE, metric}};
+
+        std::vector<milvus::knowhere::IDMAPPtr> segments;
+        for (int64_t s = 0; s < segment_count; ++s) {
+            std::vector<float> data(segment_rows * dim);
+            std::vector<int64_t> ids(segment_rows);
+            for (int64_t i = 0; i < segment_rows; ++i) {
+                ids[i] = s * segment_rows + i;
+                for (int64_t d = 0; d < dim; ++d) {
+                    data[i * dim + d] = drand48();
+                }
+            }
+            auto index = std::make_shared<milvus::knowhere::IDMAP>();
+            auto dataset = milvus::knowhere::GenDatasetWithIds(segment_rows, dim, data.data(), ids.data());
+            index->Train(dataset, conf);
+            index->Add(dataset, conf);
+            segments.push_back(index);
+        }
+
+        // every segment scanned from empty heaps
+        ms::ResultIds unbounded_ids;
+        ms::ResultDistances unbounded_distances;
+        for (auto& segment : segments) {
+            ms::ResultIds ids;
+            ms::ResultDistances distances;
+            QuerySegment(segment, query, conf, nq, topk, ids, distances);
+            ms::XSearchTask::MergeTopkToResultSet(ids, distances, topk, nq, topk, ascending, unbounded_ids,
+                                                  unbounded_distances);
+        }
+
+        // later segments start from the k-th distance merged so far, the merged result must not change
+        milvus::engine::VectorsData vectors;
+        ms::SearchJob job(nullptr, topk, milvus::json(), vectors);
+        int64_t bounded_count = 0;
+        for (auto& segment : segments) {
+            auto segment_conf = conf;
+            std::vector<float> bounds;
+            if (job.GetTopkBounds(bounds, ascending)) {
+                ASSERT_EQ(bounds.size(), nq);
+                segment_conf[milvus::knowhere::meta::TOPK_BOUNDS] = bounds;
+                ++bounded_count;
+            }
+            ASSERT_FALSE(job.GetTopkBounds(bounds, !ascending));
+
+            ms::ResultIds ids;
+            ms::ResultDistances distances;
+            QuerySegment(segment, query, segment_conf, nq, topk, ids, distances);
+            ms::XSearchTask::MergeTopkToResultSet(ids, distances, topk, nq, topk, ascending, job.GetResultIds(),
+                                                  job.GetResultDistances());
+            job.UpdateTopkBounds(nq, topk, ascending);
+        }
+        ASSERT_EQ(bounded_count, segment_count - 1);
+        ASSERT_EQ(job.GetResultIds(), unbounded_ids);
+        ASSERT_EQ(job.GetResultDistances(), unbounded_distances);
+
+        // a result merged in the other order, as IVF_PQ with IP does, disables the bounds of the job
+        job.UpdateTopkBounds(nq, topk, !ascending);
+        std::vector<float> bounds;
+        ASSERT_FALSE(job.GetTopkBounds(bounds, ascending));
+        ASSERT_FALSE(job.GetTopkBounds(bounds, !ascending));
+        job.UpdateTopkBounds(nq, topk, ascending);
+        ASSERT_FALSE(job.GetTopkBounds(bounds, ascending));
+    }
+}
+
 //void MergeTopkArrayTest(size_t topk_1, size_t topk_2, size_t nq, size_t topk, bool ascending) {
 //    std::vector<int64_t> ids1, ids2;
 //    std::vector<float> dist1, dist2;
@@ -15,6 +15,7 @@
 #include <stdlib.h>
 #include <time.h>
 
+#include <chrono>
 #include <fstream>
 #include <random>
 #include <sstream>
@@ -414,6 +415,108 @@ TEST(WalTest, BUFFER_TEST) {
     }
 }
 
+TEST(WalTest, BUFFER_COMPRESSION_TEST) {
+    MakeEmptyTestPath();
+
+    // embeddings quantized to few distinct values and sequential ids, the way real batches compress
+    const uint32_t dim = 128;
+    const uint32_t nb = 200;
+    const int record_num = 8;
+    std::vector<milvus::engine::IDNumber> ids(nb);
+    std::vector<float> vectors(nb * dim);
+    std::default_random_engine e;
+    std::uniform_int_distribution<int> u(0, 15);
+    for (uint32_t i = 0; i < nb; ++i) {
+        ids[i] = i;
+    }
+    for (auto& v : vectors) {
+        v = u(e) / 16.0f;
+    }
+
+    auto make_record = [&](milvus::engine::wal::MXLogRecord& record) {
+        record.type = milvus::engine::wal::MXLogType::InsertVector;
+        record.collection_id = "compressed_collection";
+        record.partition_tag = "parti1";
+        record.length = nb;
+        record.ids = ids.data();
+        record.data_size = vectors.size() * sizeof(float);
+        record.data = vectors.data();
+    };
+
+    // same records with and without compression, file 1 is compressed
+    uint64_t last_lsn[2] = {0, 0};
+    for (int compressed = 0; compressed < 2; ++compressed) {
+        milvus::engine::wal::MXLogBuffer buffer(WAL_GTEST_PATH, 32, compressed == 1);
+        buffer.Reset((uint64_t)compressed << 32);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < record_num; ++i) {
+            milvus::engine::wal::MXLogRecord record;
+            make_record(record);
+            ASSERT_EQ(buffer.Append(record), milvus::WAL_SUCCESS);
+            last_lsn[compressed] = record.lsn;
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        milvus::engine::wal::MXLogFileHandler file_handler(WAL_GTEST_PATH);
+        file_handler.SetFileName(std::to_string(compressed) + ".wal");
+        std::cout << (compressed ? "lz4" : "raw") << " wal: " << record_num * nb << " rows in "
+                  << std::chrono::duration<double, std::milli>(end - start).count() << " ms, logical size "
+                  << (uint32_t)last_lsn[compressed] << ", file size " << file_handler.GetFileSize() << std::endl;
+    }
+    ASSERT_EQ((uint32_t)last_lsn[0], (uint32_t)last_lsn[1]);
+
+    milvus::engine::wal::MXLogFileHandler file_handler(WAL_GTEST_PATH);
+    file_handler.SetFileName("1.wal");
+    uint32_t compressed_size = file_handler.GetFileSize();
+    ASSERT_LT(compressed_size, (uint32_t)last_lsn[1] / 2);
+
+    // recover from the compressed file and keep appending to it
+    {
+        milvus::engine::wal::MXLogBuffer buffer(WAL_GTEST_PATH, 32);
+        ASSERT_TRUE(buffer.Init((uint64_t)1 << 32, last_lsn[1]));
+        ASSERT_TRUE(buffer.writer_compressed_);
+
+        milvus::engine::wal::MXLogRecord record;
+        make_record(record);
+        record.type = milvus::engine::wal::MXLogType::Delete;
+        record.data_size = 0;
+        record.data = nullptr;
+        ASSERT_EQ(buffer.Append(record), milvus::WAL_SUCCESS);
+        last_lsn[1] = record.lsn;
+    }
+    {
+        milvus::engine::wal::MXLogBuffer buffer(WAL_GTEST_PATH, 32);
+        ASSERT_TRUE(buffer.Init((uint64_t)1 << 32, last_lsn[1]));
+
+        milvus::engine::wal::MXLogRecord read_rst;
+        for (int i = 0; i < record_num; ++i) {
+            ASSERT_EQ(buffer.Next(last_lsn[1], read_rst), milvus::WAL_SUCCESS);
+            ASSERT_EQ(read_rst.type, milvus::engine::wal::MXLogType::InsertVector);
+            ASSERT_EQ(read_rst.collection_id, "compressed_collection");
+            ASSERT_EQ(read_rst.length, nb);
+            ASSERT_EQ(memcmp(read_rst.ids, ids.data(), nb * sizeof(milvus::engine::IDNumber)), 0);
+            ASSERT_EQ(read_rst.data_size, vectors.size() * sizeof(float));
+            ASSERT_EQ(memcmp(read_rst.data, vectors.data(), read_rst.data_size), 0);
+        }
+        ASSERT_EQ(buffer.Next(last_lsn[1], read_rst), milvus::WAL_SUCCESS);
+        ASSERT_EQ(read_rst.type, milvus::engine::wal::MXLogType::Delete);
+        ASSERT_EQ(read_rst.lsn, last_lsn[1]);
+    }
+
+    // a corrupted frame fails the crc check
+    FILE* fi = fopen(WAL_GTEST_PATH "1.wal", "r+");
+    fseek(fi, compressed_size / 2, SEEK_SET);
+    int c = fgetc(fi);
+    fseek(fi, compressed_size / 2, SEEK_SET);
+    fputc(c ^ 0xff, fi);
+    fclose(fi);
+    {
+        milvus::engine::wal::MXLogBuffer buffer(WAL_GTEST_PATH, 32);
+        ASSERT_FALSE(buffer.Init((uint64_t)1 << 32, last_lsn[1]));
+    }
+}
+
 TEST(WalTest, HYBRID_BUFFFER_TEST) {
     MakeEmptyTestPath();
 
@@ -797,6 +900,75 @@ TEST(WalTest, MANAGER_RECOVERY_TEST) {
     ASSERT_EQ(manager->p_buffer_->mxlog_buffer_writer_.buf_offset, 0);
 }
 
+TEST(WalTest, MANAGER_CHECKPOINT_TEST) {
+    MakeEmptyTestPath();
+
+    // round trip and damaged file
+    milvus::engine::wal::MXLogCheckpoint checkpoint, read_back;
+    checkpoint["collection"][""] = 10;
+    checkpoint["collection"]["tag"] = 12;
+    auto meta_handler = std::make_shared<milvus::engine::wal::MXLogMetaHandler>(WAL_GTEST_PATH);
+    ASSERT_FALSE(meta_handler->GetMXLogCheckpoint(read_back));
+    ASSERT_TRUE(meta_handler->SetMXLogCheckpoint(checkpoint));
+    ASSERT_TRUE(meta_handler->GetMXLogCheckpoint(read_back));
+    ASSERT_EQ(read_back, checkpoint);
+
+    std::string checkpoint_path = WAL_GTEST_PATH;
+    checkpoint_path += milvus::engine::wal::WAL_CHECKPOINT_FILE_NAME;
+    ASSERT_EQ(truncate(checkpoint_path.c_str(), 20), 0);
+    ASSERT_FALSE(meta_handler->GetMXLogCheckpoint(read_back));
+    ASSERT_TRUE(read_back.empty());
+    meta_handler = nullptr;
+
+    MakeEmptyTestPath();
+    milvus::engine::DBMetaOptions opt = {WAL_GTEST_PATH};
+    milvus::engine::meta::MetaPtr meta = std::make_shared<milvus::engine::meta::TestWalMeta>(opt);
+
+    milvus::engine::wal::MXLogConfiguration wal_config;
+    wal_config.mxlog_path = WAL_GTEST_PATH;
+    wal_config.buffer_size = 64;
+    wal_config.recovery_error_ignore = false;
+
+    auto manager = std::make_shared<milvus::engine::wal::WalManager>(wal_config);
+    ASSERT_EQ(manager->Init(meta), milvus::WAL_SUCCESS);
+
+    // meta never sees a flush of this collection, only the checkpoint does
+    milvus::engine::meta::CollectionSchema schema;
+    schema.collection_id_ = "collection";
+    schema.flush_lsn_ = 0;
+    meta->CreateCollection(schema);
+    manager->CreateCollection(schema.collection_id_);
+
+    std::vector<int64_t> ids(1024, 0);
+    std::vector<float> data_float(1024 * 512, 0);
+    ASSERT_TRUE(manager->Insert(schema.collection_id_, "", ids, data_float));
+    uint64_t flush_lsn = manager->Flush();
+    ASSERT_NE(flush_lsn, 0);
+
+    milvus::engine::wal::MXLogRecord record;
+    while (1) {
+        ASSERT_EQ(manager->GetNextRecord(record), milvus::WAL_SUCCESS);
+        if (record.type == milvus::engine::wal::MXLogType::Flush) {
+            break;
+        }
+    }
+    manager->CollectionFlushed("", flush_lsn);
+
+    // without checkpoint the records are replayed again
+    manager = std::make_shared<milvus::engine::wal::WalManager>(wal_config);
+    ASSERT_EQ(manager->Init(meta), milvus::WAL_SUCCESS);
+    ASSERT_EQ(manager->GetNextRecovery(record), milvus::WAL_SUCCESS);
+    ASSERT_EQ(record.type, milvus::engine::wal::MXLogType::InsertVector);
+    manager->CollectionFlushed("", flush_lsn);
+    manager->Checkpoint();
+
+    // with checkpoint recovery starts after the flushed lsn
+    manager = std::make_shared<milvus::engine::wal::WalManager>(wal_config);
+    ASSERT_EQ(manager->Init(meta), milvus::WAL_SUCCESS);
+    ASSERT_EQ(manager->GetNextRecovery(record), milvus::WAL_SUCCESS);
+    ASSERT_EQ(record.type, milvus::engine::wal::MXLogType::None);
+}
+
 TEST(WalTest, MANAGER_TEST) {
     MakeEmptyTestPath();
 
@@ -32,6 +32,9 @@ TEST(MetricbaseTest, METRICBASE_TEST) {
     instance.FaissDiskLoadSizeBytesHistogramObserve(1.0);
     instance.FaissDiskLoadIOSpeedGaugeSet(1.0);
     instance.CacheAccessTotalIncrement();
+    instance.ResultCacheHitTotalIncrement();
+    instance.ResultCacheMissTotalIncrement();
+    instance.ResultCacheUsageGaugeSet(1.0);
     instance.MemTableMergeDurationSecondsHistogramObserve(1.0);
     instance.SearchIndexDataDurationSecondsHistogramObserve(1.0);
     instance.SearchRawDataDurationSecondsHistogramObserve(1.0);
@@ -57,6 +60,8 @@ TEST(MetricbaseTest, METRICBASE_TEST) {
     instance.ConnectionGaugeIncrement();
     instance.ConnectionGaugeDecrement();
     instance.KeepingAliveCounterIncrement();
+    instance.WalRecoveryDurationSecondsGaugeSet(1.0);
+    instance.WalRecoveryRowsPerSecondGaugeSet(1.0);
     instance.PushToGateway();
     instance.OctetsSet();
 }
@@ -289,6 +289,12 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(config.GetCacheConfigCacheInsertData(bool_val).ok());
     ASSERT_TRUE(bool_val == cache_insert_data);
 
+    int64_t cache_result_cache_size = 64 * 1024 * 1024;
+    ASSERT_TRUE(config.SetCacheConfigResultCacheSize("64MB").ok());
+    ASSERT_TRUE(config.GetCacheConfigResultCacheSize(int64_val).ok());
+    ASSERT_TRUE(int64_val == cache_result_cache_size);
+    ASSERT_FALSE(config.SetCacheConfigResultCacheSize("-1").ok());
+
     {
         // #2564
         int64_t total_mem = 0, free_mem = 0;
@@ -388,6 +394,11 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(config.GetWalConfigRecoveryErrorIgnore(bool_val).ok());
     ASSERT_TRUE(bool_val == wal_recovery_ignore);
 
+    bool wal_compression_enable = true;
+    ASSERT_TRUE(config.SetWalConfigCompressionEnable(std::to_string(wal_compression_enable)).ok());
+    ASSERT_TRUE(config.GetWalConfigCompressionEnable(bool_val).ok());
+    ASSERT_TRUE(bool_val == wal_compression_enable);
+
     int64_t wal_buffer_size = 128 * 1024 * 1024; // 128 M
     ASSERT_TRUE(config.SetWalConfigBufferSize(std::to_string(wal_buffer_size)).ok());
     ASSERT_TRUE(config.GetWalConfigBufferSize(int64_val).ok());
@@ -875,6 +886,11 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_FAIL_TEST) {
     ASSERT_FALSE(s.ok());
     fiu_disable("check_config_cache_insert_data_fail");
 
+    fiu_enable("check_config_result_cache_size_fail", 1, NULL, 0);
+    s = config.ValidateConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_result_cache_size_fail");
+
     /* engine config */
     fiu_enable("check_config_use_blas_threshold_fail", 1, NULL, 0);
     s = config.ValidateConfig();
@@ -1006,6 +1022,11 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_FAIL_TEST) {
     ASSERT_FALSE(s.ok());
     fiu_disable("check_config_wal_recovery_error_ignore_fail");
 
+    fiu_enable("check_config_wal_compression_enable_fail", 1, NULL, 0);
+    s = config.ValidateConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_wal_compression_enable_fail");
+
     fiu_enable("check_config_wal_buffer_size_fail", 1, NULL, 0);
     s = config.ValidateConfig();
     ASSERT_FALSE(s.ok());
@@ -1134,6 +1155,11 @@ TEST_F(ConfigTest, SERVER_CONFIG_RESET_DEFAULT_CONFIG_FAIL_TEST) {
     ASSERT_FALSE(s.ok());
     fiu_disable("check_config_cache_insert_data_fail");
 
+    fiu_enable("check_config_result_cache_size_fail", 1, NULL, 0);
+    s = config.ResetDefaultConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_result_cache_size_fail");
+
     /* engine config */
     fiu_enable("check_config_use_blas_threshold_fail", 1, NULL, 0);
     s = config.ResetDefaultConfig();
@@ -1196,6 +1222,11 @@ TEST_F(ConfigTest, SERVER_CONFIG_RESET_DEFAULT_CONFIG_FAIL_TEST) {
     ASSERT_FALSE(s.ok());
     fiu_disable("check_config_wal_recovery_error_ignore_fail");
 
+    fiu_enable("check_config_wal_compression_enable_fail", 1, NULL, 0);
+    s = config.ResetDefaultConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_wal_compression_enable_fail");
+
     fiu_enable("check_config_wal_buffer_size_fail", 1, NULL, 0);
     s = config.ResetDefaultConfig();
     ASSERT_FALSE(s.ok());
@@ -449,6 +449,34 @@ TEST(ValidationUtilTest, VALIDATE_DIMENSION_TEST) {
     }
 }
 
+TEST(ValidationUtilTest, VALIDATE_COLLECTION_PARAMS_TEST) {
+    int64_t flag = -1;
+    auto l2 = (int64_t)milvus::engine::MetricType::L2;
+    ASSERT_TRUE(milvus::server::ValidateCollectionParams(milvus::json(), l2, flag).ok());
+    ASSERT_EQ(flag, 0);
+
+    milvus::json params = {{"vector_type", "FLOAT"}};
+    ASSERT_TRUE(milvus::server::ValidateCollectionParams(params, l2, flag).ok());
+    ASSERT_EQ(flag, 0);
+
+    params = {{"vector_type", "FP16"}};
+    ASSERT_TRUE(milvus::server::ValidateCollectionParams(params, l2, flag).ok());
+    ASSERT_EQ(flag, milvus::engine::meta::FLAG_MASK_FP16_VECTOR);
+
+    params = {{"vector_type", "BF16"}};
+    ASSERT_TRUE(milvus::server::ValidateCollectionParams(params, (int64_t)milvus::engine::MetricType::IP, flag).ok());
+    ASSERT_EQ(flag, milvus::engine::meta::FLAG_MASK_BF16_VECTOR);
+
+    ASSERT_FALSE(
+        milvus::server::ValidateCollectionParams(params, (int64_t)milvus::engine::MetricType::HAMMING, flag).ok());
+
+    params = {{"vector_type", "INT8"}};
+    ASSERT_FALSE(milvus::server::ValidateCollectionParams(params, l2, flag).ok());
+
+    params = {{"vector_type", 16}};
+    ASSERT_FALSE(milvus::server::ValidateCollectionParams(params, l2, flag).ok());
+}
+
 TEST(ValidationUtilTest, VALIDATE_INDEX_TEST) {
     ASSERT_EQ(milvus::server::ValidateCollectionIndexType(
         (int)milvus::engine::EngineType::INVALID).code(), milvus::SERVER_INVALID_INDEX_TYPE);
@@ -660,6 +688,19 @@ TEST(ValidationUtilTest, VALIDATE_SEARCH_PARAMS_TEST) {
     json_params = {{"ef", 100}};
     status = milvus::server::ValidateSearchParams(json_params, collection_schema, topk);
     ASSERT_TRUE(status.ok());
+
+    collection_schema.engine_type_ = (int32_t)milvus::engine::EngineType::FAISS_IVFSQ8;
+    json_params = {{"nprobe", 32}, {"refine_factor", 0}};
+    status = milvus::server::ValidateSearchParams(json_params, collection_schema, topk);
+    ASSERT_FALSE(status.ok());
+
+    json_params = {{"nprobe", 32}, {"refine_factor", 65}};
+    status = milvus::server::ValidateSearchParams(json_params, collection_schema, topk);
+    ASSERT_FALSE(status.ok());
+
+    json_params = {{"nprobe", 32}, {"refine_factor", 4}};
+    status = milvus::server::ValidateSearchParams(json_params, collection_schema, topk);
+    ASSERT_TRUE(status.ok());
 }
 
 TEST(ValidationUtilTest, VALIDATE_VECTOR_DATA_TEST) {
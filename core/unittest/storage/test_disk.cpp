@@ -13,6 +13,8 @@
 #include <fiu-local.h>
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "easyloggingpp/easylogging++.h"
 #include "storage/disk/DiskIOReader.h"
 #include "storage/disk/DiskIOWriter.h"
@@ -64,6 +66,84 @@ TEST_F(StorageTest, DISK_RW_TEST) {
     }
 }
 
+TEST_F(StorageTest, DISK_BUFFERED_WRITE_TEST) {
+    const std::string file_names[2] = {"/tmp/test_buffered_0", "/tmp/test_buffered_1"};
+    const int64_t count = 100000;
+
+    // many small writes are combined, the writer is reused for a second file
+    milvus::storage::DiskIOWriter writer;
+    for (int64_t f = 0; f < 2; ++f) {
+        ASSERT_TRUE(writer.open(file_names[f]));
+        for (int64_t i = 0; i < count; ++i) {
+            int64_t value = i * 2 + f;
+            writer.write(&value, sizeof(value));
+        }
+        std::vector<int64_t> large(milvus::storage::DISK_WRITE_BUFFER_SIZE / sizeof(int64_t) + 1, f);
+        writer.write(large.data(), large.size() * sizeof(int64_t));
+        ASSERT_EQ(writer.length(), (count + large.size()) * sizeof(int64_t));
+        writer.close();
+    }
+
+    for (int64_t f = 0; f < 2; ++f) {
+        milvus::storage::DiskIOReader reader;
+        ASSERT_TRUE(reader.open(file_names[f]));
+        std::vector<int64_t> values(reader.length() / sizeof(int64_t));
+        ASSERT_EQ(values.size() * sizeof(int64_t), reader.length());
+        reader.read(values.data(), reader.length());
+        reader.close();
+        for (int64_t i = 0; i < count; ++i) {
+            ASSERT_EQ(values[i], i * 2 + f);
+        }
+        for (size_t i = count; i < values.size(); ++i) {
+            ASSERT_EQ(values[i], f);
+        }
+    }
+}
+
+TEST_F(StorageTest, DISK_READ_AT_TEST) {
+    const std::string file_name = "/tmp/test_read_at";
+    const int64_t count = 1000;
+
+    {
+        milvus::storage::DiskIOWriter writer;
+        ASSERT_TRUE(writer.open(file_name));
+        for (int64_t i = 0; i < count; ++i) {
+            writer.write(&i, sizeof(i));
+        }
+        writer.close();
+    }
+
+    milvus::storage::DiskIOReader reader;
+    ASSERT_TRUE(reader.open(file_name));
+
+    // positional reads leave the stream position alone
+    int64_t first = -1;
+    reader.seekg(0);
+    int64_t value = -1;
+    ASSERT_TRUE(reader.read_at(&value, sizeof(value), 500 * sizeof(int64_t)));
+    ASSERT_EQ(value, 500);
+    reader.read(&first, sizeof(first));
+    ASSERT_EQ(first, 0);
+
+    std::vector<int64_t> values(10);
+    ASSERT_TRUE(reader.read_at(values.data(), values.size() * sizeof(int64_t), (count - 10) * sizeof(int64_t)));
+    for (int64_t i = 0; i < 10; ++i) {
+        ASSERT_EQ(values[i], count - 10 + i);
+    }
+    ASSERT_FALSE(reader.read_at(values.data(), values.size() * sizeof(int64_t), (count - 5) * sizeof(int64_t)));
+
+    // a clone reads another file while the first one stays open
+    auto other = reader.clone();
+    ASSERT_FALSE(other->open("/tmp/notexist"));
+    ASSERT_TRUE(other->open(file_name));
+    ASSERT_TRUE(other->read_at(&value, sizeof(value), 7 * sizeof(int64_t)));
+    ASSERT_EQ(value, 7);
+    other->close();
+    ASSERT_TRUE(reader.read_at(&value, sizeof(value), 8 * sizeof(int64_t)));
+    ASSERT_EQ(value, 8);
+    reader.close();
+}
+
 TEST_F(StorageTest, DISK_OPERATION_TEST) {
     auto disk_operation = milvus::storage::DiskOperation("/tmp/milvus_test/milvus_disk_operation_test");
 
@@ -115,6 +115,10 @@ Utils::IndexTypeName(const milvus::IndexType& index_type) {
             return "HNSW";
         case milvus::IndexType::HNSW_SQ8NR:
             return "HNSW_SQ8NR";
+        case milvus::IndexType::IVFPQFS:
+            return "IVFPQFS";
+        case milvus::IndexType::DISKANN:
+            return "DISKANN";
         case milvus::IndexType::ANNOY:
             return "ANNOY";
         case milvus::IndexType::IVFSQ8NR:
@@ -62,6 +62,8 @@ static const char* MilvusService_method_names[] = {
   "/milvus.grpc.MilvusService/GetEntityByID",
   "/milvus.grpc.MilvusService/GetEntityIDs",
   "/milvus.grpc.MilvusService/DeleteEntitiesByID",
+  "/milvus.grpc.MilvusService/InsertPacked",
+  "/milvus.grpc.MilvusService/InsertStream",
 };
 
 std::unique_ptr< MilvusService::Stub> MilvusService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -113,6 +115,8 @@ MilvusService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& chan
   , rpcmethod_GetEntityByID_(MilvusService_method_names[39], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_GetEntityIDs_(MilvusService_method_names[40], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_DeleteEntitiesByID_(MilvusService_method_names[41], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_InsertPacked_(MilvusService_method_names[42], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_InsertStream_(MilvusService_method_names[43], ::grpc::internal::RpcMethod::CLIENT_STREAMING, channel)
   {}
 
 ::grpc::Status MilvusService::Stub::CreateCollection(::grpc::ClientContext* context, const ::milvus::grpc::CollectionSchema& request, ::milvus::grpc::Status* response) {
@@ -1291,6 +1295,50 @@ void MilvusService::Stub::experimental_async::DeleteEntitiesByID(::grpc::ClientC
   return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::milvus::grpc::Status>::Create(channel_.get(), cq, rpcmethod_DeleteEntitiesByID_, context, request, false);
 }
 
+::grpc::Status MilvusService::Stub::InsertPacked(::grpc::ClientContext* context, const ::milvus::grpc::InsertPackedParam& request, ::milvus::grpc::VectorIds* response) {
+  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_InsertPacked_, context, request, response);
+}
+
+void MilvusService::Stub::experimental_async::InsertPacked(::grpc::ClientContext* context, const ::milvus::grpc::InsertPackedParam* request, ::milvus::grpc::VectorIds* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_InsertPacked_, context, request, response, std::move(f));
+}
+
+void MilvusService::Stub::experimental_async::InsertPacked(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::milvus::grpc::VectorIds* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_InsertPacked_, context, request, response, std::move(f));
+}
+
+void MilvusService::Stub::experimental_async::InsertPacked(::grpc::ClientContext* context, const ::milvus::grpc::InsertPackedParam* request, ::milvus::grpc::VectorIds* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_InsertPacked_, context, request, response, reactor);
+}
+
+void MilvusService::Stub::experimental_async::InsertPacked(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::milvus::grpc::VectorIds* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_InsertPacked_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::milvus::grpc::VectorIds>* MilvusService::Stub::AsyncInsertPackedRaw(::grpc::ClientContext* context, const ::milvus::grpc::InsertPackedParam& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::milvus::grpc::VectorIds>::Create(channel_.get(), cq, rpcmethod_InsertPacked_, context, request, true);
+}
+
+::grpc::ClientAsyncResponseReader< ::milvus::grpc::VectorIds>* MilvusService::Stub::PrepareAsyncInsertPackedRaw(::grpc::ClientContext* context, const ::milvus::grpc::InsertPackedParam& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::milvus::grpc::VectorIds>::Create(channel_.get(), cq, rpcmethod_InsertPacked_, context, request, false);
+}
+
+::grpc::ClientWriter< ::milvus::grpc::InsertPackedParam>* MilvusService::Stub::InsertStreamRaw(::grpc::ClientContext* context, ::milvus::grpc::VectorIds* response) {
+  return ::grpc_impl::internal::ClientWriterFactory< ::milvus::grpc::InsertPackedParam>::Create(channel_.get(), rpcmethod_InsertStream_, context, response);
+}
+
+void MilvusService::Stub::experimental_async::InsertStream(::grpc::ClientContext* context, ::milvus::grpc::VectorIds* response, ::grpc::experimental::ClientWriteReactor< ::milvus::grpc::InsertPackedParam>* reactor) {
+  ::grpc_impl::internal::ClientCallbackWriterFactory< ::milvus::grpc::InsertPackedParam>::Create(stub_->channel_.get(), stub_->rpcmethod_InsertStream_, context, response, reactor);
+}
+
+::grpc::ClientAsyncWriter< ::milvus::grpc::InsertPackedParam>* MilvusService::Stub::AsyncInsertStreamRaw(::grpc::ClientContext* context, ::milvus::grpc::VectorIds* response, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc_impl::internal::ClientAsyncWriterFactory< ::milvus::grpc::InsertPackedParam>::Create(channel_.get(), cq, rpcmethod_InsertStream_, context, response, true, tag);
+}
+
+::grpc::ClientAsyncWriter< ::milvus::grpc::InsertPackedParam>* MilvusService::Stub::PrepareAsyncInsertStreamRaw(::grpc::ClientContext* context, ::milvus::grpc::VectorIds* response, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncWriterFactory< ::milvus::grpc::InsertPackedParam>::Create(channel_.get(), cq, rpcmethod_InsertStream_, context, response, false, nullptr);
+}
+
 MilvusService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       MilvusService_method_names[0],
@@ -1502,6 +1550,16 @@ MilvusService::Service::Service() {
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< MilvusService::Service, ::milvus::grpc::HDeleteByIDParam, ::milvus::grpc::Status>(
           std::mem_fn(&MilvusService::Service::DeleteEntitiesByID), this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MilvusService_method_names[42],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< MilvusService::Service, ::milvus::grpc::InsertPackedParam, ::milvus::grpc::VectorIds>(
+          std::mem_fn(&MilvusService::Service::InsertPacked), this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MilvusService_method_names[43],
+      ::grpc::internal::RpcMethod::CLIENT_STREAMING,
+      new ::grpc::internal::ClientStreamingHandler< MilvusService::Service, ::milvus::grpc::InsertPackedParam, ::milvus::grpc::VectorIds>(
+          std::mem_fn(&MilvusService::Service::InsertStream), this)));
 }
 
 MilvusService::Service::~Service() {
@@ -1801,6 +1859,20 @@ MilvusService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status MilvusService::Service::InsertPacked(::grpc::ServerContext* context, const ::milvus::grpc::InsertPackedParam* request, ::milvus::grpc::VectorIds* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MilvusService::Service::InsertStream(::grpc::ServerContext* context, ::grpc::ServerReader< ::milvus::grpc::InsertPackedParam>* reader, ::milvus::grpc::VectorIds* response) {
+  (void) context;
+  (void) reader;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace milvus
 }  // namespace grpc
@@ -250,6 +250,10 @@ class HIndexParamDefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<HIndexParam> _instance;
 } _HIndexParam_default_instance_;
+class InsertPackedParamDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<InsertPackedParam> _instance;
+} _InsertPackedParam_default_instance_;
 }  // namespace grpc
 }  // namespace milvus
 static void InitDefaultsscc_info_AttrRecord_milvus_2eproto() {
@@ -681,6 +685,20 @@ static void InitDefaultsscc_info_IndexParam_milvus_2eproto() {
       &scc_info_Status_status_2eproto.base,
       &scc_info_KeyValuePair_milvus_2eproto.base,}};
 
+static void InitDefaultsscc_info_InsertPackedParam_milvus_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::milvus::grpc::_InsertPackedParam_default_instance_;
+    new (ptr) ::milvus::grpc::InsertPackedParam();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::milvus::grpc::InsertPackedParam::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_InsertPackedParam_milvus_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsscc_info_InsertPackedParam_milvus_2eproto}, {}};
+
 static void InitDefaultsscc_info_InsertParam_milvus_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -1012,7 +1030,7 @@ static void InitDefaultsscc_info_VectorsIdentity_milvus_2eproto() {
 ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_VectorsIdentity_milvus_2eproto =
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsscc_info_VectorsIdentity_milvus_2eproto}, {}};
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_milvus_2eproto[51];
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_milvus_2eproto[52];
 static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_milvus_2eproto[3];
 static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_milvus_2eproto = nullptr;
 
@@ -1426,6 +1444,17 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_milvus_2eproto::offsets[] PROT
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::HIndexParam, collection_name_),
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::HIndexParam, field_names_),
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::HIndexParam, extra_params_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::InsertPackedParam, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::InsertPackedParam, collection_name_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::InsertPackedParam, dimension_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::InsertPackedParam, row_count_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::InsertPackedParam, vector_data_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::InsertPackedParam, row_id_array_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::InsertPackedParam, partition_tag_),
 };
 static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, sizeof(::milvus::grpc::KeyValuePair)},
@@ -1479,6 +1508,7 @@ static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOB
   { 386, -1, sizeof(::milvus::grpc::HGetEntityIDsParam)},
   { 393, -1, sizeof(::milvus::grpc::HDeleteByIDParam)},
   { 400, -1, sizeof(::milvus::grpc::HIndexParam)},
+  { 409, -1, sizeof(::milvus::grpc::InsertPackedParam)},
 };
 
 static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
@@ -1533,6 +1563,7 @@ static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] =
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::milvus::grpc::_HGetEntityIDsParam_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::milvus::grpc::_HDeleteByIDParam_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::milvus::grpc::_HIndexParam_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::milvus::grpc::_InsertPackedParam_default_instance_),
 };
 
 const char descriptor_table_protodef_milvus_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -1673,97 +1704,105 @@ const char descriptor_table_protodef_milvus_2eproto[] PROTOBUF_SECTION_VARIABLE(
   "y\030\002 \003(\003\"\221\001\n\013HIndexParam\022#\n\006status\030\001 \001(\0132"
   "\023.milvus.grpc.Status\022\027\n\017collection_name\030"
   "\002 \001(\t\022\023\n\013field_names\030\003 \003(\t\022/\n\014extra_para"
-  "ms\030\004 \003(\0132\031.milvus.grpc.KeyValuePair*\206\001\n\010"
-  "DataType\022\010\n\004NULL\020\000\022\010\n\004INT8\020\001\022\t\n\005INT16\020\002\022"
-  "\t\n\005INT32\020\003\022\t\n\005INT64\020\004\022\n\n\006STRING\020\024\022\010\n\004BOO"
-  "L\020\036\022\t\n\005FLOAT\020(\022\n\n\006DOUBLE\020)\022\n\n\006VECTOR\020d\022\014"
-  "\n\007UNKNOWN\020\217N*C\n\017CompareOperator\022\006\n\002LT\020\000\022"
-  "\007\n\003LTE\020\001\022\006\n\002EQ\020\002\022\006\n\002GT\020\003\022\007\n\003GTE\020\004\022\006\n\002NE\020"
-  "\005*8\n\005Occur\022\013\n\007INVALID\020\000\022\010\n\004MUST\020\001\022\n\n\006SHO"
-  "ULD\020\002\022\014\n\010MUST_NOT\020\0032\256\030\n\rMilvusService\022H\n"
-  "\020CreateCollection\022\035.milvus.grpc.Collecti"
-  "onSchema\032\023.milvus.grpc.Status\"\000\022F\n\rHasCo"
-  "llection\022\033.milvus.grpc.CollectionName\032\026."
-  "milvus.grpc.BoolReply\"\000\022R\n\022DescribeColle"
-  "ction\022\033.milvus.grpc.CollectionName\032\035.mil"
-  "vus.grpc.CollectionSchema\"\000\022Q\n\017CountColl"
-  "ection\022\033.milvus.grpc.CollectionName\032\037.mi"
-  "lvus.grpc.CollectionRowCount\"\000\022J\n\017ShowCo"
-  "llections\022\024.milvus.grpc.Command\032\037.milvus"
-  ".grpc.CollectionNameList\"\000\022P\n\022ShowCollec"
-  "tionInfo\022\033.milvus.grpc.CollectionName\032\033."
-  "milvus.grpc.CollectionInfo\"\000\022D\n\016DropColl"
-  "ection\022\033.milvus.grpc.CollectionName\032\023.mi"
-  "lvus.grpc.Status\"\000\022=\n\013CreateIndex\022\027.milv"
-  "us.grpc.IndexParam\032\023.milvus.grpc.Status\""
-  "\000\022G\n\rDescribeIndex\022\033.milvus.grpc.Collect"
-  "ionName\032\027.milvus.grpc.IndexParam\"\000\022\?\n\tDr"
-  "opIndex\022\033.milvus.grpc.CollectionName\032\023.m"
-  "ilvus.grpc.Status\"\000\022E\n\017CreatePartition\022\033"
-  ".milvus.grpc.PartitionParam\032\023.milvus.grp"
-  "c.Status\"\000\022E\n\014HasPartition\022\033.milvus.grpc"
-  ".PartitionParam\032\026.milvus.grpc.BoolReply\""
-  "\000\022K\n\016ShowPartitions\022\033.milvus.grpc.Collec"
-  "tionName\032\032.milvus.grpc.PartitionList\"\000\022C"
-  "\n\rDropPartition\022\033.milvus.grpc.PartitionP"
-  "aram\032\023.milvus.grpc.Status\"\000\022<\n\006Insert\022\030."
-  "milvus.grpc.InsertParam\032\026.milvus.grpc.Ve"
-  "ctorIds\"\000\022J\n\016GetVectorsByID\022\034.milvus.grp"
-  "c.VectorsIdentity\032\030.milvus.grpc.VectorsD"
-  "ata\"\000\022H\n\014GetVectorIDs\022\036.milvus.grpc.GetV"
-  "ectorIDsParam\032\026.milvus.grpc.VectorIds\"\000\022"
-  "B\n\006Search\022\030.milvus.grpc.SearchParam\032\034.mi"
-  "lvus.grpc.TopKQueryResult\"\000\022J\n\nSearchByI"
-  "D\022\034.milvus.grpc.SearchByIDParam\032\034.milvus"
-  ".grpc.TopKQueryResult\"\000\022P\n\rSearchInFiles"
-  "\022\037.milvus.grpc.SearchInFilesParam\032\034.milv"
-  "us.grpc.TopKQueryResult\"\000\0227\n\003Cmd\022\024.milvu"
-  "s.grpc.Command\032\030.milvus.grpc.StringReply"
-  "\"\000\022A\n\nDeleteByID\022\034.milvus.grpc.DeleteByI"
-  "DParam\032\023.milvus.grpc.Status\"\000\022G\n\021Preload"
-  "Collection\022\033.milvus.grpc.CollectionName\032"
-  "\023.milvus.grpc.Status\"\000\022I\n\016ReloadSegments"
-  "\022 .milvus.grpc.ReLoadSegmentsParam\032\023.mil"
-  "vus.grpc.Status\"\000\0227\n\005Flush\022\027.milvus.grpc"
-  ".FlushParam\032\023.milvus.grpc.Status\"\000\022=\n\007Co"
-  "mpact\022\033.milvus.grpc.CollectionName\032\023.mil"
-  "vus.grpc.Status\"\000\022E\n\026CreateHybridCollect"
-  "ion\022\024.milvus.grpc.Mapping\032\023.milvus.grpc."
-  "Status\"\000\022L\n\023HasHybridCollection\022\033.milvus"
-  ".grpc.CollectionName\032\026.milvus.grpc.BoolR"
-  "eply\"\000\022J\n\024DropHybridCollection\022\033.milvus."
-  "grpc.CollectionName\032\023.milvus.grpc.Status"
-  "\"\000\022O\n\030DescribeHybridCollection\022\033.milvus."
-  "grpc.CollectionName\032\024.milvus.grpc.Mappin"
-  "g\"\000\022W\n\025CountHybridCollection\022\033.milvus.gr"
-  "pc.CollectionName\032\037.milvus.grpc.Collecti"
-  "onRowCount\"\000\022I\n\025ShowHybridCollections\022\024."
-  "milvus.grpc.Command\032\030.milvus.grpc.Mappin"
-  "gList\"\000\022V\n\030ShowHybridCollectionInfo\022\033.mi"
-  "lvus.grpc.CollectionName\032\033.milvus.grpc.C"
-  "ollectionInfo\"\000\022M\n\027PreloadHybridCollecti"
-  "on\022\033.milvus.grpc.CollectionName\032\023.milvus"
-  ".grpc.Status\"\000\022D\n\021CreateHybridIndex\022\030.mi"
-  "lvus.grpc.HIndexParam\032\023.milvus.grpc.Stat"
-  "us\"\000\022D\n\014InsertEntity\022\031.milvus.grpc.HInse"
-  "rtParam\032\027.milvus.grpc.HEntityIDs\"\000\022J\n\016Hy"
-  "bridSearchPB\022\033.milvus.grpc.HSearchParamP"
-  "B\032\031.milvus.grpc.HQueryResult\"\000\022F\n\014Hybrid"
-  "Search\022\031.milvus.grpc.HSearchParam\032\031.milv"
-  "us.grpc.HQueryResult\"\000\022]\n\026HybridSearchIn"
-  "Segments\022#.milvus.grpc.HSearchInSegments"
-  "Param\032\034.milvus.grpc.TopKQueryResult\"\000\022E\n"
-  "\rGetEntityByID\022\034.milvus.grpc.VectorsIden"
-  "tity\032\024.milvus.grpc.HEntity\"\000\022J\n\014GetEntit"
-  "yIDs\022\037.milvus.grpc.HGetEntityIDsParam\032\027."
-  "milvus.grpc.HEntityIDs\"\000\022J\n\022DeleteEntiti"
-  "esByID\022\035.milvus.grpc.HDeleteByIDParam\032\023."
-  "milvus.grpc.Status\"\000b\006proto3"
+  "ms\030\004 \003(\0132\031.milvus.grpc.KeyValuePair\"\224\001\n\021"
+  "InsertPackedParam\022\027\n\017collection_name\030\001 \001"
+  "(\t\022\021\n\tdimension\030\002 \001(\003\022\021\n\trow_count\030\003 \001(\003"
+  "\022\023\n\013vector_data\030\004 \001(\014\022\024\n\014row_id_array\030\005 "
+  "\003(\003\022\025\n\rpartition_tag\030\006 \001(\t*\206\001\n\010DataType\022"
+  "\010\n\004NULL\020\000\022\010\n\004INT8\020\001\022\t\n\005INT16\020\002\022\t\n\005INT32\020"
+  "\003\022\t\n\005INT64\020\004\022\n\n\006STRING\020\024\022\010\n\004BOOL\020\036\022\t\n\005FL"
+  "OAT\020(\022\n\n\006DOUBLE\020)\022\n\n\006VECTOR\020d\022\014\n\007UNKNOWN"
+  "\020\217N*C\n\017CompareOperator\022\006\n\002LT\020\000\022\007\n\003LTE\020\001\022"
+  "\006\n\002EQ\020\002\022\006\n\002GT\020\003\022\007\n\003GTE\020\004\022\006\n\002NE\020\005*8\n\005Occu"
+  "r\022\013\n\007INVALID\020\000\022\010\n\004MUST\020\001\022\n\n\006SHOULD\020\002\022\014\n\010"
+  "MUST_NOT\020\0032\304\031\n\rMilvusService\022H\n\020CreateCo"
+  "llection\022\035.milvus.grpc.CollectionSchema\032"
+  "\023.milvus.grpc.Status\"\000\022F\n\rHasCollection\022"
+  "\033.milvus.grpc.CollectionName\032\026.milvus.gr"
+  "pc.BoolReply\"\000\022R\n\022DescribeCollection\022\033.m"
+  "ilvus.grpc.CollectionName\032\035.milvus.grpc."
+  "CollectionSchema\"\000\022Q\n\017CountCollection\022\033."
+  "milvus.grpc.CollectionName\032\037.milvus.grpc"
+  ".CollectionRowCount\"\000\022J\n\017ShowCollections"
+  "\022\024.milvus.grpc.Command\032\037.milvus.grpc.Col"
+  "lectionNameList\"\000\022P\n\022ShowCollectionInfo\022"
+  "\033.milvus.grpc.CollectionName\032\033.milvus.gr"
+  "pc.CollectionInfo\"\000\022D\n\016DropCollection\022\033."
+  "milvus.grpc.CollectionName\032\023.milvus.grpc"
+  ".Status\"\000\022=\n\013CreateIndex\022\027.milvus.grpc.I"
+  "ndexParam\032\023.milvus.grpc.Status\"\000\022G\n\rDesc"
+  "ribeIndex\022\033.milvus.grpc.CollectionName\032\027"
+  ".milvus.grpc.IndexParam\"\000\022\?\n\tDropIndex\022\033"
+  ".milvus.grpc.CollectionName\032\023.milvus.grp"
+  "c.Status\"\000\022E\n\017CreatePartition\022\033.milvus.g"
+  "rpc.PartitionParam\032\023.milvus.grpc.Status\""
+  "\000\022E\n\014HasPartition\022\033.milvus.grpc.Partitio"
+  "nParam\032\026.milvus.grpc.BoolReply\"\000\022K\n\016Show"
+  "Partitions\022\033.milvus.grpc.CollectionName\032"
+  "\032.milvus.grpc.PartitionList\"\000\022C\n\rDropPar"
+  "tition\022\033.milvus.grpc.PartitionParam\032\023.mi"
+  "lvus.grpc.Status\"\000\022<\n\006Insert\022\030.milvus.gr"
+  "pc.InsertParam\032\026.milvus.grpc.VectorIds\"\000"
+  "\022J\n\016GetVectorsByID\022\034.milvus.grpc.Vectors"
+  "Identity\032\030.milvus.grpc.VectorsData\"\000\022H\n\014"
+  "GetVectorIDs\022\036.milvus.grpc.GetVectorIDsP"
+  "aram\032\026.milvus.grpc.VectorIds\"\000\022B\n\006Search"
+  "\022\030.milvus.grpc.SearchParam\032\034.milvus.grpc"
+  ".TopKQueryResult\"\000\022J\n\nSearchByID\022\034.milvu"
+  "s.grpc.SearchByIDParam\032\034.milvus.grpc.Top"
+  "KQueryResult\"\000\022P\n\rSearchInFiles\022\037.milvus"
+  ".grpc.SearchInFilesParam\032\034.milvus.grpc.T"
+  "opKQueryResult\"\000\0227\n\003Cmd\022\024.milvus.grpc.Co"
+  "mmand\032\030.milvus.grpc.StringReply\"\000\022A\n\nDel"
+  "eteByID\022\034.milvus.grpc.DeleteByIDParam\032\023."
+  "milvus.grpc.Status\"\000\022G\n\021PreloadCollectio"
+  "n\022\033.milvus.grpc.CollectionName\032\023.milvus."
+  "grpc.Status\"\000\022I\n\016ReloadSegments\022 .milvus"
+  ".grpc.ReLoadSegmentsParam\032\023.milvus.grpc."
+  "Status\"\000\0227\n\005Flush\022\027.milvus.grpc.FlushPar"
+  "am\032\023.milvus.grpc.Status\"\000\022=\n\007Compact\022\033.m"
+  "ilvus.grpc.CollectionName\032\023.milvus.grpc."
+  "Status\"\000\022E\n\026CreateHybridCollection\022\024.mil"
+  "vus.grpc.Mapping\032\023.milvus.grpc.Status\"\000\022"
+  "L\n\023HasHybridCollection\022\033.milvus.grpc.Col"
+  "lectionName\032\026.milvus.grpc.BoolReply\"\000\022J\n"
+  "\024DropHybridCollection\022\033.milvus.grpc.Coll"
+  "ectionName\032\023.milvus.grpc.Status\"\000\022O\n\030Des"
+  "cribeHybridCollection\022\033.milvus.grpc.Coll"
+  "ectionName\032\024.milvus.grpc.Mapping\"\000\022W\n\025Co"
+  "untHybridCollection\022\033.milvus.grpc.Collec"
+  "tionName\032\037.milvus.grpc.CollectionRowCoun"
+  "t\"\000\022I\n\025ShowHybridCollections\022\024.milvus.gr"
+  "pc.Command\032\030.milvus.grpc.MappingList\"\000\022V"
+  "\n\030ShowHybridCollectionInfo\022\033.milvus.grpc"
+  ".CollectionName\032\033.milvus.grpc.Collection"
+  "Info\"\000\022M\n\027PreloadHybridCollection\022\033.milv"
+  "us.grpc.CollectionName\032\023.milvus.grpc.Sta"
+  "tus\"\000\022D\n\021CreateHybridIndex\022\030.milvus.grpc"
+  ".HIndexParam\032\023.milvus.grpc.Status\"\000\022D\n\014I"
+  "nsertEntity\022\031.milvus.grpc.HInsertParam\032\027"
+  ".milvus.grpc.HEntityIDs\"\000\022J\n\016HybridSearc"
+  "hPB\022\033.milvus.grpc.HSearchParamPB\032\031.milvu"
+  "s.grpc.HQueryResult\"\000\022F\n\014HybridSearch\022\031."
+  "milvus.grpc.HSearchParam\032\031.milvus.grpc.H"
+  "QueryResult\"\000\022]\n\026HybridSearchInSegments\022"
+  "#.milvus.grpc.HSearchInSegmentsParam\032\034.m"
+  "ilvus.grpc.TopKQueryResult\"\000\022E\n\rGetEntit"
+  "yByID\022\034.milvus.grpc.VectorsIdentity\032\024.mi"
+  "lvus.grpc.HEntity\"\000\022J\n\014GetEntityIDs\022\037.mi"
+  "lvus.grpc.HGetEntityIDsParam\032\027.milvus.gr"
+  "pc.HEntityIDs\"\000\022J\n\022DeleteEntitiesByID\022\035."
+  "milvus.grpc.HDeleteByIDParam\032\023.milvus.gr"
+  "pc.Status\"\000\022H\n\014InsertPacked\022\036.milvus.grp"
+  "c.InsertPackedParam\032\026.milvus.grpc.Vector"
+  "Ids\"\000\022J\n\014InsertStream\022\036.milvus.grpc.Inse"
+  "rtPackedParam\032\026.milvus.grpc.VectorIds\"\000("
+  "\001b\006proto3"
   ;
 static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_milvus_2eproto_deps[1] = {
   &::descriptor_table_status_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_milvus_2eproto_sccs[50] = {
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_milvus_2eproto_sccs[51] = {
   &scc_info_AttrRecord_milvus_2eproto.base,
   &scc_info_BoolReply_milvus_2eproto.base,
   &scc_info_BooleanQuery_milvus_2eproto.base,
@@ -1792,6 +1831,7 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_mil
   &scc_info_HSearchParam_milvus_2eproto.base,
   &scc_info_HSearchParamPB_milvus_2eproto.base,
   &scc_info_IndexParam_milvus_2eproto.base,
+  &scc_info_InsertPackedParam_milvus_2eproto.base,
   &scc_info_InsertParam_milvus_2eproto.base,
   &scc_info_KeyValuePair_milvus_2eproto.base,
   &scc_info_Mapping_milvus_2eproto.base,
@@ -1818,10 +1858,10 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_mil
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_milvus_2eproto_once;
 static bool descriptor_table_milvus_2eproto_initialized = false;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_milvus_2eproto = {
-  &descriptor_table_milvus_2eproto_initialized, descriptor_table_protodef_milvus_2eproto, "milvus.proto", 8908,
-  &descriptor_table_milvus_2eproto_once, descriptor_table_milvus_2eproto_sccs, descriptor_table_milvus_2eproto_deps, 50, 1,
+  &descriptor_table_milvus_2eproto_initialized, descriptor_table_protodef_milvus_2eproto, "milvus.proto", 9209,
+  &descriptor_table_milvus_2eproto_once, descriptor_table_milvus_2eproto_sccs, descriptor_table_milvus_2eproto_deps, 51, 1,
   schemas, file_default_instances, TableStruct_milvus_2eproto::offsets,
-  file_level_metadata_milvus_2eproto, 51, file_level_enum_descriptors_milvus_2eproto, file_level_service_descriptors_milvus_2eproto,
+  file_level_metadata_milvus_2eproto, 52, file_level_enum_descriptors_milvus_2eproto, file_level_service_descriptors_milvus_2eproto,
 };
 
 // Force running AddDescriptors() at dynamic initialization time.
@@ -21508,6 +21548,549 @@ void HIndexParam::InternalSwap(HIndexParam* other) {
 }
 
 
+// ===================================================================
+
+void InsertPackedParam::InitAsDefaultInstance() {
+}
+class InsertPackedParam::_Internal {
+ public:
+};
+
+InsertPackedParam::InsertPackedParam()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:milvus.grpc.InsertPackedParam)
+}
+InsertPackedParam::InsertPackedParam(const InsertPackedParam& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr),
+      row_id_array_(from.row_id_array_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  collection_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from.collection_name().empty()) {
+    collection_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.collection_name_);
+  }
+  vector_data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from.vector_data().empty()) {
+    vector_data_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.vector_data_);
+  }
+  partition_tag_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from.partition_tag().empty()) {
+    partition_tag_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.partition_tag_);
+  }
+  ::memcpy(&dimension_, &from.dimension_,
+    static_cast<size_t>(reinterpret_cast<char*>(&row_count_) -
+    reinterpret_cast<char*>(&dimension_)) + sizeof(row_count_));
+  // @@protoc_insertion_point(copy_constructor:milvus.grpc.InsertPackedParam)
+}
+
+void InsertPackedParam::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_InsertPackedParam_milvus_2eproto.base);
+  collection_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  vector_data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  partition_tag_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::memset(&dimension_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&row_count_) -
+      reinterpret_cast<char*>(&dimension_)) + sizeof(row_count_));
+}
+
+InsertPackedParam::~InsertPackedParam() {
+  // @@protoc_insertion_point(destructor:milvus.grpc.InsertPackedParam)
+  SharedDtor();
+}
+
+void InsertPackedParam::SharedDtor() {
+  collection_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  vector_data_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  partition_tag_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void InsertPackedParam::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const InsertPackedParam& InsertPackedParam::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_InsertPackedParam_milvus_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void InsertPackedParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:milvus.grpc.InsertPackedParam)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  row_id_array_.Clear();
+  collection_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  vector_data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  partition_tag_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::memset(&dimension_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&row_count_) -
+      reinterpret_cast<char*>(&dimension_)) + sizeof(row_count_));
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* InsertPackedParam::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string collection_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_collection_name(), ptr, ctx, "milvus.grpc.InsertPackedParam.collection_name");
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // int64 dimension = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          dimension_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // int64 row_count = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          row_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bytes vector_data = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(mutable_vector_data(), ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated int64 row_id_array = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(mutable_row_id_array(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40) {
+          add_row_id_array(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // string partition_tag = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_partition_tag(), ptr, ctx, "milvus.grpc.InsertPackedParam.partition_tag");
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool InsertPackedParam::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:milvus.grpc.InsertPackedParam)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // string collection_name = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->mutable_collection_name()));
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+            this->collection_name().data(), static_cast<int>(this->collection_name().length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
+            "milvus.grpc.InsertPackedParam.collection_name"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // int64 dimension = 2;
+      case 2: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (16 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, &dimension_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // int64 row_count = 3;
+      case 3: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (24 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, &row_count_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bytes vector_data = 4;
+      case 4: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (34 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_vector_data()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated int64 row_id_array = 5;
+      case 5: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (42 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, this->mutable_row_id_array())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (40 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 1, 42u, input, this->mutable_row_id_array())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string partition_tag = 6;
+      case 6: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (50 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->mutable_partition_tag()));
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+            this->partition_tag().data(), static_cast<int>(this->partition_tag().length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
+            "milvus.grpc.InsertPackedParam.partition_tag"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:milvus.grpc.InsertPackedParam)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:milvus.grpc.InsertPackedParam)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void InsertPackedParam::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:milvus.grpc.InsertPackedParam)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string collection_name = 1;
+  if (this->collection_name().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->collection_name().data(), static_cast<int>(this->collection_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "milvus.grpc.InsertPackedParam.collection_name");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->collection_name(), output);
+  }
+
+  // int64 dimension = 2;
+  if (this->dimension() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64(2, this->dimension(), output);
+  }
+
+  // int64 row_count = 3;
+  if (this->row_count() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64(3, this->row_count(), output);
+  }
+
+  // bytes vector_data = 4;
+  if (this->vector_data().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesMaybeAliased(
+      4, this->vector_data(), output);
+  }
+
+  // repeated int64 row_id_array = 5;
+  if (this->row_id_array_size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTag(5, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_row_id_array_cached_byte_size_.load(
+        std::memory_order_relaxed));
+  }
+  for (int i = 0, n = this->row_id_array_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64NoTag(
+      this->row_id_array(i), output);
+  }
+
+  // string partition_tag = 6;
+  if (this->partition_tag().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->partition_tag().data(), static_cast<int>(this->partition_tag().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "milvus.grpc.InsertPackedParam.partition_tag");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
+      6, this->partition_tag(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:milvus.grpc.InsertPackedParam)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* InsertPackedParam::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:milvus.grpc.InsertPackedParam)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string collection_name = 1;
+  if (this->collection_name().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->collection_name().data(), static_cast<int>(this->collection_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "milvus.grpc.InsertPackedParam.collection_name");
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
+        1, this->collection_name(), target);
+  }
+
+  // int64 dimension = 2;
+  if (this->dimension() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(2, this->dimension(), target);
+  }
+
+  // int64 row_count = 3;
+  if (this->row_count() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(3, this->row_count(), target);
+  }
+
+  // bytes vector_data = 4;
+  if (this->vector_data().size() > 0) {
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesToArray(
+        4, this->vector_data(), target);
+  }
+
+  // repeated int64 row_id_array = 5;
+  if (this->row_id_array_size() > 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTagToArray(
+      5,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream::WriteVarint32ToArray(
+        _row_id_array_cached_byte_size_.load(std::memory_order_relaxed),
+         target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteInt64NoTagToArray(this->row_id_array_, target);
+  }
+
+  // string partition_tag = 6;
+  if (this->partition_tag().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->partition_tag().data(), static_cast<int>(this->partition_tag().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "milvus.grpc.InsertPackedParam.partition_tag");
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
+        6, this->partition_tag(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:milvus.grpc.InsertPackedParam)
+  return target;
+}
+
+size_t InsertPackedParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:milvus.grpc.InsertPackedParam)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int64 row_id_array = 5;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      Int64Size(this->row_id_array_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _row_id_array_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // string collection_name = 1;
+  if (this->collection_name().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->collection_name());
+  }
+
+  // bytes vector_data = 4;
+  if (this->vector_data().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->vector_data());
+  }
+
+  // string partition_tag = 6;
+  if (this->partition_tag().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->partition_tag());
+  }
+
+  // int64 dimension = 2;
+  if (this->dimension() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
+        this->dimension());
+  }
+
+  // int64 row_count = 3;
+  if (this->row_count() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
+        this->row_count());
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void InsertPackedParam::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:milvus.grpc.InsertPackedParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  const InsertPackedParam* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<InsertPackedParam>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:milvus.grpc.InsertPackedParam)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:milvus.grpc.InsertPackedParam)
+    MergeFrom(*source);
+  }
+}
+
+void InsertPackedParam::MergeFrom(const InsertPackedParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:milvus.grpc.InsertPackedParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  row_id_array_.MergeFrom(from.row_id_array_);
+  if (from.collection_name().size() > 0) {
+
+    collection_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.collection_name_);
+  }
+  if (from.vector_data().size() > 0) {
+
+    vector_data_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.vector_data_);
+  }
+  if (from.partition_tag().size() > 0) {
+
+    partition_tag_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.partition_tag_);
+  }
+  if (from.dimension() != 0) {
+    set_dimension(from.dimension());
+  }
+  if (from.row_count() != 0) {
+    set_row_count(from.row_count());
+  }
+}
+
+void InsertPackedParam::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:milvus.grpc.InsertPackedParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void InsertPackedParam::CopyFrom(const InsertPackedParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:milvus.grpc.InsertPackedParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool InsertPackedParam::IsInitialized() const {
+  return true;
+}
+
+void InsertPackedParam::InternalSwap(InsertPackedParam* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  row_id_array_.InternalSwap(&other->row_id_array_);
+  collection_name_.Swap(&other->collection_name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  vector_data_.Swap(&other->vector_data_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  partition_tag_.Swap(&other->partition_tag_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  swap(dimension_, other->dimension_);
+  swap(row_count_, other->row_count_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata InsertPackedParam::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace grpc
 }  // namespace milvus
@@ -21665,6 +22248,9 @@ template<> PROTOBUF_NOINLINE ::milvus::grpc::HDeleteByIDParam* Arena::CreateMayb
 template<> PROTOBUF_NOINLINE ::milvus::grpc::HIndexParam* Arena::CreateMaybeMessage< ::milvus::grpc::HIndexParam >(Arena* arena) {
   return Arena::CreateInternal< ::milvus::grpc::HIndexParam >(arena);
 }
+template<> PROTOBUF_NOINLINE ::milvus::grpc::InsertPackedParam* Arena::CreateMaybeMessage< ::milvus::grpc::InsertPackedParam >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::InsertPackedParam >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
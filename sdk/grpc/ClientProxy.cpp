@@ -11,6 +11,7 @@
 
 #include "grpc/ClientProxy.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -249,6 +250,11 @@ ClientProxy::CreateCollection(const CollectionParam& param) {
         schema.set_dimension(param.dimension);
         schema.set_index_file_size(param.index_file_size);
         schema.set_metric_type(static_cast<int32_t>(param.metric_type));
+        if (!param.extra_params.empty()) {
+            milvus::grpc::KeyValuePair* kv = schema.add_extra_params();
+            kv->set_key(EXTRA_PARAM_KEY);
+            kv->set_value(param.extra_params);
+        }
 
         return client_ptr_->CreateCollection(schema);
     } catch (std::exception& ex) {
@@ -328,6 +334,88 @@ ClientProxy::Insert(const std::string& collection_name, const std::string& parti
     return status;
 }
 
+Status
+ClientProxy::InsertPacked(const std::string& collection_name, const std::string& partition_tag, int64_t dimension,
+                          int64_t row_count, const void* vector_data, int64_t data_size,
+                          std::vector<int64_t>& id_array) {
+    Status status = Status::OK();
+    try {
+        ::milvus::grpc::InsertPackedParam insert_param;
+        insert_param.set_collection_name(collection_name);
+        insert_param.set_partition_tag(partition_tag);
+        insert_param.set_dimension(dimension);
+        insert_param.set_row_count(row_count);
+        insert_param.set_vector_data(vector_data, data_size);
+
+        ::milvus::grpc::VectorIds vector_ids;
+        if (!id_array.empty()) {
+            /* set user's ids */
+            auto row_ids = insert_param.mutable_row_id_array();
+            row_ids->Resize(static_cast<int>(id_array.size()), -1);
+            memcpy(row_ids->mutable_data(), id_array.data(), id_array.size() * sizeof(int64_t));
+            status = client_ptr_->InsertPacked(insert_param, vector_ids);
+        } else {
+            status = client_ptr_->InsertPacked(insert_param, vector_ids);
+            /* return Milvus generated ids back to user */
+            id_array.insert(id_array.end(), vector_ids.vector_id_array().begin(), vector_ids.vector_id_array().end());
+        }
+    } catch (std::exception& ex) {
+        return Status(StatusCode::UnknownError, "Failed to add entities: " + std::string(ex.what()));
+    }
+
+    return status;
+}
+
+Status
+ClientProxy::InsertStream(const std::string& collection_name, const std::string& partition_tag, int64_t dimension,
+                          int64_t row_count, const void* vector_data, int64_t data_size, int64_t batch_row_count,
+                          std::vector<int64_t>& id_array) {
+    if (row_count <= 0 || data_size % row_count != 0 || batch_row_count <= 0) {
+        return Status(StatusCode::InvalidAgument, "Invalid row count or batch row count");
+    }
+    if (!id_array.empty() && id_array.size() != static_cast<size_t>(row_count)) {
+        return Status(StatusCode::InvalidAgument, "Size of id array doesn't match row count");
+    }
+
+    Status status = Status::OK();
+    try {
+        // every batch is sliced out of the caller's buffer right before it is written
+        auto data = static_cast<const char*>(vector_data);
+        int64_t row_size = data_size / row_count;
+        bool user_ids = !id_array.empty();
+        int64_t offset = 0;
+        auto next_batch = [&](::milvus::grpc::InsertPackedParam& insert_param) {
+            if (offset >= row_count) {
+                return false;
+            }
+            int64_t count = std::min(batch_row_count, row_count - offset);
+            insert_param.set_collection_name(collection_name);
+            insert_param.set_partition_tag(partition_tag);
+            insert_param.set_dimension(dimension);
+            insert_param.set_row_count(count);
+            insert_param.set_vector_data(data + offset * row_size, count * row_size);
+            if (user_ids) {
+                auto row_ids = insert_param.mutable_row_id_array();
+                row_ids->Resize(static_cast<int>(count), -1);
+                memcpy(row_ids->mutable_data(), id_array.data() + offset, count * sizeof(int64_t));
+            }
+            offset += count;
+            return true;
+        };
+
+        ::milvus::grpc::VectorIds vector_ids;
+        status = client_ptr_->InsertStream(next_batch, vector_ids);
+        if (!user_ids) {
+            /* return Milvus generated ids back to user */
+            id_array.insert(id_array.end(), vector_ids.vector_id_array().begin(), vector_ids.vector_id_array().end());
+        }
+    } catch (std::exception& ex) {
+        return Status(StatusCode::UnknownError, "Failed to add entities: " + std::string(ex.what()));
+    }
+
+    return status;
+}
+
 Status
 ClientProxy::GetEntityByID(const std::string& collection_name, const std::vector<int64_t>& id_array,
                            std::vector<Entity>& entities_data) {
@@ -66,6 +66,16 @@ class ClientProxy : public Connection {
     Insert(const std::string& collection_name, const std::string& partition_tag,
            const std::vector<Entity>& entity_array, std::vector<int64_t>& id_array) override;
 
+    Status
+    InsertPacked(const std::string& collection_name, const std::string& partition_tag, int64_t dimension,
+                 int64_t row_count, const void* vector_data, int64_t data_size,
+                 std::vector<int64_t>& id_array) override;
+
+    Status
+    InsertStream(const std::string& collection_name, const std::string& partition_tag, int64_t dimension,
+                 int64_t row_count, const void* vector_data, int64_t data_size, int64_t batch_row_count,
+                 std::vector<int64_t>& id_array) override;
+
     Status
     GetEntityByID(const std::string& collection_name, const std::vector<int64_t>& id_array,
                   std::vector<Entity>& entities_data) override;
@@ -124,6 +124,52 @@ GrpcClient::Insert(const ::milvus::grpc::InsertParam& insert_param, ::milvus::gr
     return Status::OK();
 }
 
+Status
+GrpcClient::InsertPacked(const ::milvus::grpc::InsertPackedParam& insert_param, ::milvus::grpc::VectorIds& vector_ids) {
+    ClientContext context;
+    ::grpc::Status grpc_status = stub_->InsertPacked(&context, insert_param, &vector_ids);
+
+    if (!grpc_status.ok()) {
+        std::cerr << "InsertPacked rpc failed!" << std::endl;
+        return Status(StatusCode::RPCFailed, grpc_status.error_message());
+    }
+    if (vector_ids.status().error_code() != grpc::SUCCESS) {
+        std::cerr << vector_ids.status().reason() << std::endl;
+        return Status(StatusCode::ServerFailed, vector_ids.status().reason());
+    }
+
+    return Status::OK();
+}
+
+Status
+GrpcClient::InsertStream(const std::function<bool(::milvus::grpc::InsertPackedParam&)>& next_batch,
+                         ::milvus::grpc::VectorIds& vector_ids) {
+    ClientContext context;
+    std::unique_ptr<::grpc::ClientWriter<::milvus::grpc::InsertPackedParam>> writer =
+        stub_->InsertStream(&context, &vector_ids);
+
+    ::milvus::grpc::InsertPackedParam insert_param;
+    while (next_batch(insert_param)) {
+        if (!writer->Write(insert_param)) {
+            // server stopped reading, its status is returned by Finish
+            break;
+        }
+    }
+    writer->WritesDone();
+    ::grpc::Status grpc_status = writer->Finish();
+
+    if (!grpc_status.ok()) {
+        std::cerr << "InsertStream rpc failed!" << std::endl;
+        return Status(StatusCode::RPCFailed, grpc_status.error_message());
+    }
+    if (vector_ids.status().error_code() != grpc::SUCCESS) {
+        std::cerr << vector_ids.status().reason() << std::endl;
+        return Status(StatusCode::ServerFailed, vector_ids.status().reason());
+    }
+
+    return Status::OK();
+}
+
 Status
 GrpcClient::GetEntityByID(const grpc::VectorsIdentity& vectors_identity, ::milvus::grpc::VectorsData& vectors_data) {
     ClientContext context;
@@ -16,6 +16,7 @@
 //#include "grpc/gen-status/status.grpc.pb.h"
 
 #include <chrono>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <random>
@@ -50,6 +51,13 @@ class GrpcClient {
     Status
     Insert(const grpc::InsertParam& insert_param, grpc::VectorIds& vector_ids);
 
+    Status
+    InsertPacked(const grpc::InsertPackedParam& insert_param, grpc::VectorIds& vector_ids);
+
+    // write batches filled by next_batch until it returns false
+    Status
+    InsertStream(const std::function<bool(grpc::InsertPackedParam&)>& next_batch, grpc::VectorIds& vector_ids);
+
     Status
     GetEntityByID(const grpc::VectorsIdentity& vectors_identity, ::milvus::grpc::VectorsData& vectors_data);
 
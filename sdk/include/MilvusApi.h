@@ -41,6 +41,8 @@ enum class IndexType {
     ANNOY = 12,
     IVFSQ8NR = 13,
     HNSW_SQ8NR = 14,
+    IVFPQFS = 15,
+    DISKANN = 16,
 };
 
 enum class MetricType {
@@ -69,6 +71,11 @@ struct CollectionParam {
     int64_t dimension = 0;                    ///< Vector dimension, must be a positive value
     int64_t index_file_size = 1024;           ///< Index file size, must be a positive value, unit: MB
     MetricType metric_type = MetricType::L2;  ///< Index metric type
+    std::string extra_params;                 ///< Extra parameters in json format, e.g. {"vector_type": "FP16"}
+                                              ///< vector_type: FLOAT(default), FP16 or BF16 for raw vector storage
+                                              ///< FLAT searches half precision vectors as stored; IVF_FLAT, HNSW,
+                                              ///< NSG and the other indexes decode them to float when built and
+                                              ///< loaded, so only the raw vector files shrink for them
 };
 
 /**
@@ -108,14 +115,28 @@ using TopKHybridQueryResult = std::vector<HybridQueryResult>;  ///< Topk hybrid
  *       IVFPQ:  {nlist: 16384, m: 12}
  *           ///< nlist range:[1, 999999]
  *           ///< m is decided by dim and have a couple of results.
+ *       IVFPQFS:  {nlist: 16384, m: 32, rerank: true}
+ *           ///< nlist range:[1, 999999]
+ *           ///< m is a divisor of dim, no more than 256.
+ *           ///< rerank is optional, keep raw vectors with the index to re-rank topk * refine_factor candidates.
  *       NSG:  {search_length: 45, out_degree:50, candidate_pool_size:300, knng:100}
  *           ///< search_length range:[10, 300]
  *           ///< out_degree range:[5, 300]
  *           ///< candidate_pool_size range:[50, 1000]
  *           ///< knng range:[5, 300]
+ *           ///< compact_graph is optional, pack all neighbor lists into one contiguous buffer.
+ *           ///< colocate_vectors is optional, keep each vector next to its neighbor list.
+ *           ///< nn_descent is optional, build the kNN graph by NN-descent instead of an IVF search.
  *       HNSW  {M: 16, efConstruction:300}
  *           ///< M range:[5, 48]
  *           ///< efConstruction range:[100, 500]
+ *       DISKANN  {out_degree: 64, search_length: 100, candidate_pool_size: 500, m: 16, alpha: 1.2, cache_nodes: 10000}
+ *           ///< out_degree range:[4, 128]
+ *           ///< search_length range:[10, 500]
+ *           ///< candidate_pool_size range:[50, 1000]
+ *           ///< m is a divisor of dim, bytes of PQ code kept in memory per vector.
+ *           ///< alpha is optional, range:[1.0, 2.0], default 1.2.
+ *           ///< cache_nodes is optional, nodes around the entry point kept in memory, range:[0, 1000000]
  */
 struct IndexParam {
     std::string collection_name;  ///< Collection name for create index
@@ -351,6 +372,48 @@ class Connection {
     Insert(const std::string& collection_name, const std::string& partition_tag,
            const std::vector<Entity>& entity_array, std::vector<int64_t>& id_array) = 0;
 
+    /**
+     * @brief Insert packed vectors to collection
+     *
+     * This method is used to insert vectors stored back to back in one buffer, the buffer is sent
+     * as a single message field instead of one message per vector.
+     *
+     * @param collection_name, target collection's name.
+     * @param partition_tag, target partition's tag, keep empty if no partition specified.
+     * @param dimension, dimension of the vectors.
+     * @param row_count, vector count in the buffer.
+     * @param vector_data, row_count float vectors, or row_count binary vectors of dimension / 8 bytes.
+     * @param data_size, size of vector_data in bytes.
+     * @param id_array, same as Insert.
+     *
+     * @return Indicate if vectors are inserted successfully
+     */
+    virtual Status
+    InsertPacked(const std::string& collection_name, const std::string& partition_tag, int64_t dimension,
+                 int64_t row_count, const void* vector_data, int64_t data_size, std::vector<int64_t>& id_array) = 0;
+
+    /**
+     * @brief Bulk load packed vectors to collection
+     *
+     * This method is used to load a large packed buffer, it is streamed to server in batches
+     * of batch_row_count vectors within one call.
+     *
+     * @param collection_name, target collection's name.
+     * @param partition_tag, target partition's tag, keep empty if no partition specified.
+     * @param dimension, dimension of the vectors.
+     * @param row_count, vector count in the buffer.
+     * @param vector_data, row_count float vectors, or row_count binary vectors of dimension / 8 bytes.
+     * @param data_size, size of vector_data in bytes.
+     * @param batch_row_count, vector count of each streamed batch.
+     * @param id_array, same as Insert.
+     *
+     * @return Indicate if vectors are inserted successfully
+     */
+    virtual Status
+    InsertStream(const std::string& collection_name, const std::string& partition_tag, int64_t dimension,
+                 int64_t row_count, const void* vector_data, int64_t data_size, int64_t batch_row_count,
+                 std::vector<int64_t>& id_array) = 0;
+
     /**
      * @brief Get entity data by id
      *
@@ -395,12 +458,18 @@ class Connection {
      * @param extra_params, extra search parameters according to different index type, must be json format.
      * Note: extra_params is extra parameters list, it must be json format, for example:
      *       For different index type, parameter list is different accordingly
-     *       FLAT/IVFLAT/SQ8/IVFPQ:  {nprobe: 32}
+     *       FLAT/IVFLAT/SQ8/IVFPQ/IVFPQFS:  {nprobe: 32}
      *           ///< nprobe range:[1,999999]
+     *       SQ8/SQ8NR/IVFPQ/IVFPQFS/HNSW_SQ8NR:  {refine_factor: 4}
+     *           ///< optional, re-rank topk * refine_factor candidates with raw vectors
+     *           ///< refine_factor range:[1, 64]
      *       NSG:  {search_length:100}
      *           ///< search_length range:[10, 300]
      *       HNSW  {ef: 64}
      *           ///< ef range:[topk, 4096]
+     *       DISKANN  {search_length: 100, beam_width: 4}
+     *           ///< search_length range:[topk, 4096]
+     *           ///< beam_width is optional, nodes read from disk per hop, range:[1, 64]
      * @param topk_query_result, result array.
      *
      * @return Indicate if query is successful.
@@ -102,6 +102,22 @@ ConnectionImpl::Insert(const std::string& collection_name, const std::string& pa
     return client_proxy_->Insert(collection_name, partition_tag, entity_array, id_array);
 }
 
+Status
+ConnectionImpl::InsertPacked(const std::string& collection_name, const std::string& partition_tag, int64_t dimension,
+                             int64_t row_count, const void* vector_data, int64_t data_size,
+                             std::vector<int64_t>& id_array) {
+    return client_proxy_->InsertPacked(collection_name, partition_tag, dimension, row_count, vector_data, data_size,
+                                       id_array);
+}
+
+Status
+ConnectionImpl::InsertStream(const std::string& collection_name, const std::string& partition_tag, int64_t dimension,
+                             int64_t row_count, const void* vector_data, int64_t data_size, int64_t batch_row_count,
+                             std::vector<int64_t>& id_array) {
+    return client_proxy_->InsertStream(collection_name, partition_tag, dimension, row_count, vector_data, data_size,
+                                       batch_row_count, id_array);
+}
+
 Status
 ConnectionImpl::GetEntityByID(const std::string& collection_name, const std::vector<int64_t>& id_array,
                               std::vector<Entity>& entities_data) {